@@ -0,0 +1,134 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#include <bpstd/any.hpp>
+
+#include <benchmark/benchmark.h>
+#include <string>
+
+#if __cplusplus >= 201703L
+# include <any>
+#endif
+
+namespace {
+
+  struct backport
+  {
+    using any = bpstd::any;
+
+    template <typename T>
+    static const T* any_cast(const any* a) noexcept
+    {
+      return bpstd::any_cast<T>(a);
+    }
+  };
+
+#if __cplusplus >= 201703L
+  struct standard
+  {
+    using any = std::any;
+
+    template <typename T>
+    static const T* any_cast(const any* a) noexcept
+    {
+      return std::any_cast<T>(a);
+    }
+  };
+#endif
+
+  // Large enough to defeat any small-buffer optimization
+  const auto large_string = std::string(256u, 'x');
+
+} // anonymous namespace
+
+//=============================================================================
+// any_cast
+//=============================================================================
+
+template <typename Lib>
+void any_cast_small(benchmark::State& state)
+{
+  const auto a = typename Lib::any{42};
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Lib::template any_cast<int>(&a));
+  }
+}
+
+BENCHMARK_TEMPLATE(any_cast_small, backport);
+#if __cplusplus >= 201703L
+BENCHMARK_TEMPLATE(any_cast_small, standard);
+#endif
+
+template <typename Lib>
+void any_cast_mismatch(benchmark::State& state)
+{
+  const auto a = typename Lib::any{42};
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Lib::template any_cast<long>(&a));
+  }
+}
+
+BENCHMARK_TEMPLATE(any_cast_mismatch, backport);
+#if __cplusplus >= 201703L
+BENCHMARK_TEMPLATE(any_cast_mismatch, standard);
+#endif
+
+//=============================================================================
+// copy
+//=============================================================================
+
+template <typename Lib>
+void any_copy_small(benchmark::State& state)
+{
+  const auto a = typename Lib::any{42};
+
+  for (auto _ : state) {
+    auto copy = a;
+    benchmark::DoNotOptimize(&copy);
+  }
+}
+
+BENCHMARK_TEMPLATE(any_copy_small, backport);
+#if __cplusplus >= 201703L
+BENCHMARK_TEMPLATE(any_copy_small, standard);
+#endif
+
+template <typename Lib>
+void any_copy_large(benchmark::State& state)
+{
+  const auto a = typename Lib::any{large_string};
+
+  for (auto _ : state) {
+    auto copy = a;
+    benchmark::DoNotOptimize(&copy);
+  }
+}
+
+BENCHMARK_TEMPLATE(any_copy_large, backport);
+#if __cplusplus >= 201703L
+BENCHMARK_TEMPLATE(any_copy_large, standard);
+#endif
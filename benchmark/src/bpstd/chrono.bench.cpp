@@ -0,0 +1,182 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#include <bpstd/chrono.hpp>
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <ctime>
+
+namespace {
+
+  // A spread of timestamps across several decades, so that no single date is
+  // favored by caches or branch prediction
+  std::int64_t timestamp(std::int64_t i)
+  {
+    return 946684800 + (i * 7919 * 3607) % (60 * 365 * 86400);
+  }
+
+  // The conventional approach: converting to a broken-down time, which needs
+  // a locked time zone lookup on some platforms, and then formatting it
+  std::size_t format_strftime(char* buffer, std::size_t size, std::time_t t)
+  {
+    auto tm = std::tm{};
+#if defined(_WIN32)
+    ::gmtime_s(&tm, &t);
+#else
+    ::gmtime_r(&t, &tm);
+#endif
+    return std::strftime(buffer, size, "%Y-%m-%dT%H:%M:%SZ", &tm);
+  }
+
+} // anonymous namespace
+
+//=============================================================================
+// civil conversions
+//=============================================================================
+
+void year_month_day_from_sys_days(benchmark::State& state)
+{
+  auto i = std::int64_t{0};
+
+  for (auto _ : state) {
+    const auto dp = bpstd::chrono::sys_days{
+      bpstd::chrono::days{static_cast<int>(timestamp(i++) / 86400)}
+    };
+    benchmark::DoNotOptimize(bpstd::chrono::year_month_day{dp});
+  }
+}
+
+BENCHMARK(year_month_day_from_sys_days);
+
+void year_month_day_to_sys_days(benchmark::State& state)
+{
+  auto i = std::int64_t{0};
+
+  for (auto _ : state) {
+    const auto ymd = bpstd::chrono::year_month_day{
+      bpstd::chrono::year{1970 + static_cast<int>(i % 100)},
+      bpstd::chrono::month{static_cast<unsigned>(1 + i % 12)},
+      bpstd::chrono::day{static_cast<unsigned>(1 + i % 28)}
+    };
+    ++i;
+    benchmark::DoNotOptimize(bpstd::chrono::sys_days{ymd});
+  }
+}
+
+BENCHMARK(year_month_day_to_sys_days);
+
+//=============================================================================
+// ISO-8601 formatting
+//=============================================================================
+
+void iso8601_format(benchmark::State& state)
+{
+  char buffer[32];
+  auto i = std::int64_t{0};
+
+  for (auto _ : state) {
+    const auto tp = bpstd::chrono::sys_seconds{
+      bpstd::chrono::seconds{timestamp(i++)}
+    };
+    benchmark::DoNotOptimize(bpstd::chrono::format_iso8601(buffer, tp));
+    benchmark::ClobberMemory();
+  }
+}
+
+BENCHMARK(iso8601_format);
+
+void iso8601_format_strftime(benchmark::State& state)
+{
+  char buffer[32];
+  auto i = std::int64_t{0};
+
+  for (auto _ : state) {
+    const auto t = static_cast<std::time_t>(timestamp(i++));
+    benchmark::DoNotOptimize(format_strftime(buffer, sizeof(buffer), t));
+    benchmark::ClobberMemory();
+  }
+}
+
+BENCHMARK(iso8601_format_strftime);
+
+//=============================================================================
+// ISO-8601 parsing
+//=============================================================================
+
+void iso8601_parse(benchmark::State& state)
+{
+  const auto str = bpstd::string_view{"2020-02-29T23:59:59.123456789Z"};
+  auto tp = bpstd::chrono::sys_time<std::chrono::nanoseconds>{};
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(bpstd::chrono::parse_iso8601(str, tp));
+    benchmark::DoNotOptimize(tp);
+  }
+}
+
+BENCHMARK(iso8601_parse);
+
+//=============================================================================
+// rounding
+//=============================================================================
+
+void time_point_floor_minutes(benchmark::State& state)
+{
+  auto i = std::int64_t{0};
+
+  for (auto _ : state) {
+    const auto tp = bpstd::chrono::sys_time<std::chrono::nanoseconds>{
+      std::chrono::nanoseconds{timestamp(i++) * 1000000007}
+    };
+    benchmark::DoNotOptimize(bpstd::chrono::floor<std::chrono::minutes>(tp));
+  }
+}
+
+BENCHMARK(time_point_floor_minutes);
+
+// Bucketing by converting through a floating-point duration, which is exact
+// only while the count fits in the 53 bits of a double's significand
+void time_point_floor_minutes_double(benchmark::State& state)
+{
+  using double_minutes = std::chrono::duration<double, std::ratio<60>>;
+
+  auto i = std::int64_t{0};
+
+  for (auto _ : state) {
+    const auto tp = bpstd::chrono::sys_time<std::chrono::nanoseconds>{
+      std::chrono::nanoseconds{timestamp(i++) * 1000000007}
+    };
+    const auto m = std::chrono::duration_cast<double_minutes>(tp.time_since_epoch());
+    const auto bucket = std::chrono::minutes{
+      static_cast<std::chrono::minutes::rep>(std::floor(m.count()))
+    };
+    benchmark::DoNotOptimize(bucket);
+  }
+}
+
+BENCHMARK(time_point_floor_minutes_double);
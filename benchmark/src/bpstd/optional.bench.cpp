@@ -0,0 +1,126 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#include <bpstd/optional.hpp>
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#if __cplusplus >= 201703L
+# include <optional>
+#endif
+
+namespace {
+
+  struct backport
+  {
+    template <typename T>
+    using optional = bpstd::optional<T>;
+  };
+
+#if __cplusplus >= 201703L
+  struct standard
+  {
+    template <typename T>
+    using optional = std::optional<T>;
+  };
+#endif
+
+  template <typename Lib, typename T>
+  std::vector<typename Lib::template optional<T>> make_optionals(std::size_t count,
+                                                                 const T& value)
+  {
+    auto result = std::vector<typename Lib::template optional<T>>(count);
+    for (auto i = std::size_t{0u}; i < count; i += 2u) {
+      result[i] = value;
+    }
+    return result;
+  }
+
+} // anonymous namespace
+
+//=============================================================================
+// value_or
+//=============================================================================
+
+template <typename Lib>
+void optional_value_or(benchmark::State& state)
+{
+  const auto optionals = make_optionals<Lib>(1024u, 42);
+
+  for (auto _ : state) {
+    auto total = 0;
+    for (const auto& o : optionals) {
+      total += o.value_or(1);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<long>(optionals.size()));
+}
+
+BENCHMARK_TEMPLATE(optional_value_or, backport);
+#if __cplusplus >= 201703L
+BENCHMARK_TEMPLATE(optional_value_or, standard);
+#endif
+
+//=============================================================================
+// copy
+//=============================================================================
+
+template <typename Lib>
+void optional_copy_trivial(benchmark::State& state)
+{
+  const auto optionals = make_optionals<Lib>(1024u, 42);
+
+  for (auto _ : state) {
+    auto copy = optionals;
+    benchmark::DoNotOptimize(copy.data());
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<long>(optionals.size()));
+}
+
+BENCHMARK_TEMPLATE(optional_copy_trivial, backport);
+#if __cplusplus >= 201703L
+BENCHMARK_TEMPLATE(optional_copy_trivial, standard);
+#endif
+
+template <typename Lib>
+void optional_copy_string(benchmark::State& state)
+{
+  const auto optionals = make_optionals<Lib>(1024u, std::string{"hello world"});
+
+  for (auto _ : state) {
+    auto copy = optionals;
+    benchmark::DoNotOptimize(copy.data());
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<long>(optionals.size()));
+}
+
+BENCHMARK_TEMPLATE(optional_copy_string, backport);
+#if __cplusplus >= 201703L
+BENCHMARK_TEMPLATE(optional_copy_string, standard);
+#endif
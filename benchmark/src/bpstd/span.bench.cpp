@@ -0,0 +1,127 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#include <bpstd/span.hpp>
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+#if __cplusplus > 201703L && defined(__has_include)
+# if __has_include(<span>)
+#   include <span>
+#   define BPSTD_BENCHMARK_HAS_STD_SPAN 1
+# endif
+#endif
+
+namespace {
+
+  struct backport
+  {
+    template <typename T>
+    using span = bpstd::span<T>;
+  };
+
+#if defined(BPSTD_BENCHMARK_HAS_STD_SPAN)
+  struct standard
+  {
+    template <typename T>
+    using span = std::span<T>;
+  };
+#endif
+
+  std::vector<int> make_values()
+  {
+    auto result = std::vector<int>(4096u);
+    std::iota(result.begin(), result.end(), 0);
+    return result;
+  }
+
+} // anonymous namespace
+
+//=============================================================================
+// iteration
+//=============================================================================
+
+void span_iterate_raw(benchmark::State& state)
+{
+  auto values = make_values();
+  const auto* const data = values.data();
+  const auto size = values.size();
+
+  for (auto _ : state) {
+    auto total = 0;
+    for (auto i = std::size_t{0u}; i < size; ++i) {
+      total += data[i];
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<long>(size));
+}
+
+BENCHMARK(span_iterate_raw);
+
+template <typename Lib>
+void span_iterate(benchmark::State& state)
+{
+  auto values = make_values();
+  const auto s = typename Lib::template span<const int>{values.data(), values.size()};
+
+  for (auto _ : state) {
+    auto total = 0;
+    for (auto v : s) {
+      total += v;
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<long>(s.size()));
+}
+
+BENCHMARK_TEMPLATE(span_iterate, backport);
+#if defined(BPSTD_BENCHMARK_HAS_STD_SPAN)
+BENCHMARK_TEMPLATE(span_iterate, standard);
+#endif
+
+template <typename Lib>
+void span_index(benchmark::State& state)
+{
+  auto values = make_values();
+  const auto s = typename Lib::template span<const int>{values.data(), values.size()};
+
+  for (auto _ : state) {
+    auto total = 0;
+    for (auto i = std::size_t{0u}; i < s.size(); ++i) {
+      total += s[i];
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<long>(s.size()));
+}
+
+BENCHMARK_TEMPLATE(span_index, backport);
+#if defined(BPSTD_BENCHMARK_HAS_STD_SPAN)
+BENCHMARK_TEMPLATE(span_index, standard);
+#endif
@@ -0,0 +1,118 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#include <bpstd/string_view.hpp>
+
+#include <benchmark/benchmark.h>
+#include <string>
+
+#if __cplusplus >= 201703L
+# include <string_view>
+#endif
+
+namespace {
+
+  struct backport
+  {
+    using string_view = bpstd::string_view;
+  };
+
+#if __cplusplus >= 201703L
+  struct standard
+  {
+    using string_view = std::string_view;
+  };
+#endif
+
+  // A haystack whose only match is at the very end
+  std::string make_haystack()
+  {
+    auto result = std::string(4096u, 'a');
+    result += "needle";
+    return result;
+  }
+
+  const auto haystack = make_haystack();
+
+} // anonymous namespace
+
+//=============================================================================
+// find
+//=============================================================================
+
+template <typename Lib>
+void string_view_find_char(benchmark::State& state)
+{
+  const auto sv = typename Lib::string_view{haystack.data(), haystack.size()};
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(sv.find('n'));
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<long>(sv.size()));
+}
+
+BENCHMARK_TEMPLATE(string_view_find_char, backport);
+#if __cplusplus >= 201703L
+BENCHMARK_TEMPLATE(string_view_find_char, standard);
+#endif
+
+template <typename Lib>
+void string_view_find_substring(benchmark::State& state)
+{
+  const auto sv = typename Lib::string_view{haystack.data(), haystack.size()};
+  const auto needle = typename Lib::string_view{"needle"};
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(sv.find(needle));
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<long>(sv.size()));
+}
+
+BENCHMARK_TEMPLATE(string_view_find_substring, backport);
+#if __cplusplus >= 201703L
+BENCHMARK_TEMPLATE(string_view_find_substring, standard);
+#endif
+
+//=============================================================================
+// compare
+//=============================================================================
+
+template <typename Lib>
+void string_view_compare(benchmark::State& state)
+{
+  const auto copy = haystack;
+  const auto lhs = typename Lib::string_view{haystack.data(), haystack.size()};
+  const auto rhs = typename Lib::string_view{copy.data(), copy.size()};
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lhs.compare(rhs));
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<long>(lhs.size()));
+}
+
+BENCHMARK_TEMPLATE(string_view_compare, backport);
+#if __cplusplus >= 201703L
+BENCHMARK_TEMPLATE(string_view_compare, standard);
+#endif
@@ -0,0 +1,175 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#include <bpstd/variant.hpp>
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if __cplusplus >= 201703L
+# include <variant>
+#endif
+
+namespace {
+
+  struct backport
+  {
+    template <typename...Types>
+    using variant = bpstd::variant<Types...>;
+
+    template <typename Fn, typename Variant>
+    static auto visit(Fn&& fn, Variant&& v)
+      -> decltype(bpstd::visit(std::forward<Fn>(fn), std::forward<Variant>(v)))
+    {
+      return bpstd::visit(std::forward<Fn>(fn), std::forward<Variant>(v));
+    }
+
+    template <typename T, typename Variant>
+    static auto get_if(Variant* v) -> decltype(bpstd::get_if<T>(v))
+    {
+      return bpstd::get_if<T>(v);
+    }
+  };
+
+#if __cplusplus >= 201703L
+  struct standard
+  {
+    template <typename...Types>
+    using variant = std::variant<Types...>;
+
+    template <typename Fn, typename Variant>
+    static decltype(auto) visit(Fn&& fn, Variant&& v)
+    {
+      return std::visit(std::forward<Fn>(fn), std::forward<Variant>(v));
+    }
+
+    template <typename T, typename Variant>
+    static auto get_if(Variant* v)
+    {
+      return std::get_if<T>(v);
+    }
+  };
+#endif
+
+  struct size_visitor
+  {
+    std::size_t operator()(int) const noexcept { return 1u; }
+    std::size_t operator()(double) const noexcept { return 2u; }
+    std::size_t operator()(const std::string& s) const noexcept { return s.size(); }
+  };
+
+  template <typename Lib>
+  using variant_type = typename Lib::template variant<int, double, std::string>;
+
+  template <typename Lib>
+  std::vector<variant_type<Lib>> make_variants(std::size_t count)
+  {
+    auto result = std::vector<variant_type<Lib>>{};
+    result.reserve(count);
+    for (auto i = std::size_t{0u}; i < count; ++i) {
+      switch (i % 3u) {
+        case 0u: result.emplace_back(static_cast<int>(i)); break;
+        case 1u: result.emplace_back(static_cast<double>(i)); break;
+        default: result.emplace_back(std::string(i % 16u, 'x')); break;
+      }
+    }
+    return result;
+  }
+
+} // anonymous namespace
+
+//=============================================================================
+// visit
+//=============================================================================
+
+template <typename Lib>
+void variant_visit(benchmark::State& state)
+{
+  const auto variants = make_variants<Lib>(1024u);
+
+  for (auto _ : state) {
+    auto total = std::size_t{0u};
+    for (const auto& v : variants) {
+      total += Lib::visit(size_visitor{}, v);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<long>(variants.size()));
+}
+
+BENCHMARK_TEMPLATE(variant_visit, backport);
+#if __cplusplus >= 201703L
+BENCHMARK_TEMPLATE(variant_visit, standard);
+#endif
+
+//=============================================================================
+// get_if
+//=============================================================================
+
+template <typename Lib>
+void variant_get_if(benchmark::State& state)
+{
+  auto variants = make_variants<Lib>(1024u);
+
+  for (auto _ : state) {
+    auto total = 0;
+    for (auto& v : variants) {
+      if (const auto* p = Lib::template get_if<int>(&v)) {
+        total += *p;
+      }
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<long>(variants.size()));
+}
+
+BENCHMARK_TEMPLATE(variant_get_if, backport);
+#if __cplusplus >= 201703L
+BENCHMARK_TEMPLATE(variant_get_if, standard);
+#endif
+
+//=============================================================================
+// copy
+//=============================================================================
+
+template <typename Lib>
+void variant_copy(benchmark::State& state)
+{
+  const auto variants = make_variants<Lib>(1024u);
+
+  for (auto _ : state) {
+    auto copy = variants;
+    benchmark::DoNotOptimize(copy.data());
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<long>(variants.size()));
+}
+
+BENCHMARK_TEMPLATE(variant_copy, backport);
+#if __cplusplus >= 201703L
+BENCHMARK_TEMPLATE(variant_copy, standard);
+#endif
@@ -0,0 +1,370 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file algorithm.hpp
+///
+/// \brief This header provides definitions from the C++ header <algorithm>
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_ALGORITHM_HPP
+#define BPSTD_ALGORITHM_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/config.hpp"
+#include "detail/parallel.hpp"
+
+#include "execution.hpp"   // execution::seq, execution::par, etc
+#include "functional.hpp"  // less
+#include "type_traits.hpp" // true_type, false_type
+
+#include <algorithm> // std::for_each, std::transform, std::sort, etc
+#include <cstddef>   // std::size_t
+#include <iterator>  // std::distance
+#include <vector>    // std::vector
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+
+  //============================================================================
+  // algorithms : execution policy overloads
+  //============================================================================
+
+  // With a parallel execution policy, random-access ranges are split into
+  // contiguous chunks that are processed concurrently; any other policy or
+  // iterator category executes sequentially on the calling thread.
+
+  /// \brief Applies \p f to every element in the range [first, last)
+  ///
+  /// \param policy the execution policy to use
+  /// \param first the start of the range
+  /// \param last the end of the range
+  /// \param f the function to apply
+  template <typename ExecutionPolicy, typename ForwardIt, typename UnaryFunction,
+            typename = detail::enable_if_execution_policy_t<ExecutionPolicy>>
+  void for_each(ExecutionPolicy&& policy,
+                ForwardIt first, ForwardIt last,
+                UnaryFunction f);
+
+  /// \brief Applies \p op to every element in the range [first, last),
+  ///        storing each result in the range starting at \p d_first
+  ///
+  /// \param policy the execution policy to use
+  /// \param first the start of the range
+  /// \param last the end of the range
+  /// \param d_first the start of the destination range
+  /// \param op the function to apply
+  /// \return an iterator past the last element written
+  template <typename ExecutionPolicy, typename ForwardIt1, typename ForwardIt2,
+            typename UnaryOperation,
+            typename = detail::enable_if_execution_policy_t<ExecutionPolicy>>
+  ForwardIt2 transform(ExecutionPolicy&& policy,
+                       ForwardIt1 first, ForwardIt1 last,
+                       ForwardIt2 d_first,
+                       UnaryOperation op);
+
+  /// \brief Applies \p op to every pair of elements from the ranges
+  ///        [first1, last1) and [first2, ...), storing each result in the
+  ///        range starting at \p d_first
+  ///
+  /// \param policy the execution policy to use
+  /// \param first1 the start of the first range
+  /// \param last1 the end of the first range
+  /// \param first2 the start of the second range
+  /// \param d_first the start of the destination range
+  /// \param op the function to apply
+  /// \return an iterator past the last element written
+  template <typename ExecutionPolicy, typename ForwardIt1, typename ForwardIt2,
+            typename ForwardIt3, typename BinaryOperation,
+            typename = detail::enable_if_execution_policy_t<ExecutionPolicy>>
+  ForwardIt3 transform(ExecutionPolicy&& policy,
+                       ForwardIt1 first1, ForwardIt1 last1,
+                       ForwardIt2 first2,
+                       ForwardIt3 d_first,
+                       BinaryOperation op);
+
+  /// \{
+  /// \brief Sorts the range [first, last) in ascending order, as determined
+  ///        by \p comp
+  ///
+  /// Each chunk is sorted concurrently, and then adjacent chunks are merged
+  /// pairwise, concurrently, until a single sorted range remains.
+  ///
+  /// \param policy the execution policy to use
+  /// \param first the start of the range
+  /// \param last the end of the range
+  /// \param comp the comparison function
+  template <typename ExecutionPolicy, typename RandomIt,
+            typename = detail::enable_if_execution_policy_t<ExecutionPolicy>>
+  void sort(ExecutionPolicy&& policy, RandomIt first, RandomIt last);
+  template <typename ExecutionPolicy, typename RandomIt, typename Compare,
+            typename = detail::enable_if_execution_policy_t<ExecutionPolicy>>
+  void sort(ExecutionPolicy&& policy,
+            RandomIt first, RandomIt last,
+            Compare comp);
+  /// \}
+
+  namespace detail {
+
+    template <typename ForwardIt, typename UnaryFunction>
+    void for_each(false_type, ForwardIt first, ForwardIt last, UnaryFunction& f);
+    template <typename RandomIt, typename UnaryFunction>
+    void for_each(true_type, RandomIt first, RandomIt last, UnaryFunction& f);
+
+    template <typename ForwardIt1, typename ForwardIt2, typename UnaryOperation>
+    ForwardIt2 transform(false_type,
+                         ForwardIt1 first, ForwardIt1 last,
+                         ForwardIt2 d_first,
+                         UnaryOperation& op);
+    template <typename RandomIt1, typename RandomIt2, typename UnaryOperation>
+    RandomIt2 transform(true_type,
+                        RandomIt1 first, RandomIt1 last,
+                        RandomIt2 d_first,
+                        UnaryOperation& op);
+
+    template <typename ForwardIt1, typename ForwardIt2, typename ForwardIt3,
+              typename BinaryOperation>
+    ForwardIt3 transform(false_type,
+                         ForwardIt1 first1, ForwardIt1 last1,
+                         ForwardIt2 first2,
+                         ForwardIt3 d_first,
+                         BinaryOperation& op);
+    template <typename RandomIt1, typename RandomIt2, typename RandomIt3,
+              typename BinaryOperation>
+    RandomIt3 transform(true_type,
+                        RandomIt1 first1, RandomIt1 last1,
+                        RandomIt2 first2,
+                        RandomIt3 d_first,
+                        BinaryOperation& op);
+
+    template <typename RandomIt, typename Compare>
+    void sort(false_type, RandomIt first, RandomIt last, Compare& comp);
+    template <typename RandomIt, typename Compare>
+    void sort(true_type, RandomIt first, RandomIt last, Compare& comp);
+
+  } // namespace detail
+} // namespace bpstd
+
+//==============================================================================
+// definitions : algorithms : execution policy overloads
+//==============================================================================
+
+template <typename ExecutionPolicy, typename ForwardIt, typename UnaryFunction,
+          typename>
+inline void bpstd::for_each(ExecutionPolicy&&,
+                            ForwardIt first, ForwardIt last,
+                            UnaryFunction f)
+{
+  using tag = detail::is_parallel_execution<ExecutionPolicy,ForwardIt>;
+
+  detail::for_each(tag{}, first, last, f);
+}
+
+template <typename ExecutionPolicy, typename ForwardIt1, typename ForwardIt2,
+          typename UnaryOperation, typename>
+inline ForwardIt2 bpstd::transform(ExecutionPolicy&&,
+                                   ForwardIt1 first, ForwardIt1 last,
+                                   ForwardIt2 d_first,
+                                   UnaryOperation op)
+{
+  using tag = detail::is_parallel_execution<ExecutionPolicy,ForwardIt1,ForwardIt2>;
+
+  return detail::transform(tag{}, first, last, d_first, op);
+}
+
+template <typename ExecutionPolicy, typename ForwardIt1, typename ForwardIt2,
+          typename ForwardIt3, typename BinaryOperation, typename>
+inline ForwardIt3 bpstd::transform(ExecutionPolicy&&,
+                                   ForwardIt1 first1, ForwardIt1 last1,
+                                   ForwardIt2 first2,
+                                   ForwardIt3 d_first,
+                                   BinaryOperation op)
+{
+  using tag = detail::is_parallel_execution<ExecutionPolicy,ForwardIt1,ForwardIt2,ForwardIt3>;
+
+  return detail::transform(tag{}, first1, last1, first2, d_first, op);
+}
+
+template <typename ExecutionPolicy, typename RandomIt, typename>
+inline void bpstd::sort(ExecutionPolicy&& policy, RandomIt first, RandomIt last)
+{
+  bpstd::sort(static_cast<ExecutionPolicy&&>(policy), first, last, less<>{});
+}
+
+template <typename ExecutionPolicy, typename RandomIt, typename Compare,
+          typename>
+inline void bpstd::sort(ExecutionPolicy&&,
+                        RandomIt first, RandomIt last,
+                        Compare comp)
+{
+  using tag = detail::is_parallel_execution<ExecutionPolicy,RandomIt>;
+
+  detail::sort(tag{}, first, last, comp);
+}
+
+//==============================================================================
+// definitions : detail algorithms
+//==============================================================================
+
+template <typename ForwardIt, typename UnaryFunction>
+inline void bpstd::detail::for_each(false_type,
+                                    ForwardIt first, ForwardIt last,
+                                    UnaryFunction& f)
+{
+  std::for_each(first, last, f);
+}
+
+template <typename RandomIt, typename UnaryFunction>
+inline void bpstd::detail::for_each(true_type,
+                                    RandomIt first, RandomIt last,
+                                    UnaryFunction& f)
+{
+  auto chunk = [&](std::size_t b, std::size_t e) {
+    std::for_each(first + b, first + e, f);
+  };
+
+  parallel_for_chunks(static_cast<std::size_t>(last - first), chunk);
+}
+
+//------------------------------------------------------------------------------
+
+template <typename ForwardIt1, typename ForwardIt2, typename UnaryOperation>
+inline ForwardIt2 bpstd::detail::transform(false_type,
+                                           ForwardIt1 first, ForwardIt1 last,
+                                           ForwardIt2 d_first,
+                                           UnaryOperation& op)
+{
+  return std::transform(first, last, d_first, op);
+}
+
+template <typename RandomIt1, typename RandomIt2, typename UnaryOperation>
+inline RandomIt2 bpstd::detail::transform(true_type,
+                                          RandomIt1 first, RandomIt1 last,
+                                          RandomIt2 d_first,
+                                          UnaryOperation& op)
+{
+  const auto size = static_cast<std::size_t>(last - first);
+  auto chunk = [&](std::size_t b, std::size_t e) {
+    std::transform(first + b, first + e, d_first + b, op);
+  };
+
+  parallel_for_chunks(size, chunk);
+
+  return d_first + size;
+}
+
+template <typename ForwardIt1, typename ForwardIt2, typename ForwardIt3,
+          typename BinaryOperation>
+inline ForwardIt3 bpstd::detail::transform(false_type,
+                                           ForwardIt1 first1, ForwardIt1 last1,
+                                           ForwardIt2 first2,
+                                           ForwardIt3 d_first,
+                                           BinaryOperation& op)
+{
+  return std::transform(first1, last1, first2, d_first, op);
+}
+
+template <typename RandomIt1, typename RandomIt2, typename RandomIt3,
+          typename BinaryOperation>
+inline RandomIt3 bpstd::detail::transform(true_type,
+                                          RandomIt1 first1, RandomIt1 last1,
+                                          RandomIt2 first2,
+                                          RandomIt3 d_first,
+                                          BinaryOperation& op)
+{
+  const auto size = static_cast<std::size_t>(last1 - first1);
+  auto chunk = [&](std::size_t b, std::size_t e) {
+    std::transform(first1 + b, first1 + e, first2 + b, d_first + b, op);
+  };
+
+  parallel_for_chunks(size, chunk);
+
+  return d_first + size;
+}
+
+//------------------------------------------------------------------------------
+
+template <typename RandomIt, typename Compare>
+inline void bpstd::detail::sort(false_type,
+                                RandomIt first, RandomIt last,
+                                Compare& comp)
+{
+  std::sort(first, last, comp);
+}
+
+template <typename RandomIt, typename Compare>
+inline void bpstd::detail::sort(true_type,
+                                RandomIt first, RandomIt last,
+                                Compare& comp)
+{
+  const auto size = static_cast<std::size_t>(last - first);
+  const auto chunks = parallel_chunk_count(size);
+
+  if (chunks == 1u) {
+    std::sort(first, last, comp);
+    return;
+  }
+
+  // 'bounds' holds the first index of each sorted run, followed by 'size'
+  auto bounds = std::vector<std::size_t>(chunks + 1u);
+  for (auto i = std::size_t{0u}; i <= chunks; ++i) {
+    bounds[i] = parallel_chunk_begin(size, chunks, i);
+  }
+
+  auto sort_run = [&](std::size_t i) {
+    std::sort(first + bounds[i], first + bounds[i + 1u], comp);
+  };
+  parallel_invoke_n(chunks, sort_run);
+
+  auto merge_runs = [&](std::size_t i) {
+    std::inplace_merge(
+      first + bounds[2u * i],
+      first + bounds[2u * i + 1u],
+      first + bounds[2u * i + 2u],
+      comp
+    );
+  };
+  while (bounds.size() > 2u) {
+    const auto runs = bounds.size() - 1u;
+    parallel_invoke_n(runs / 2u, merge_runs);
+
+    // Drop the boundary between each merged pair of runs; an odd run out at
+    // the end is carried into the next round as-is
+    auto out = std::size_t{1u};
+    for (auto i = std::size_t{2u}; i < bounds.size(); i += 2u) {
+      bounds[out++] = bounds[i];
+    }
+    if (runs % 2u != 0u) {
+      bounds[out++] = size;
+    }
+    bounds.resize(out);
+  }
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_ALGORITHM_HPP */
@@ -35,6 +35,7 @@
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
 #include "detail/config.hpp"
+#include "detail/instrumentation.hpp" // BPSTD_INSTRUMENT
 #include "type_traits.hpp"  // enable_if_t, is_*
 #include "utility.hpp"      // in_place_type_t, move, forward
 
@@ -414,6 +415,7 @@ const void* bpstd::any::internal_storage_handler<T>
     {
       assert(self != nullptr);
       assert(other != nullptr);
+      BPSTD_INSTRUMENT(any, copy);
 
       // Copy construct from the internal storage
       const auto* p = reinterpret_cast<const T*>(&other->internal);
@@ -425,6 +427,7 @@ const void* bpstd::any::internal_storage_handler<T>
     {
       assert(self != nullptr);
       assert(other != nullptr);
+      BPSTD_INSTRUMENT(any, move);
 
       // Move construct from the internal storage. '
       const auto* p = reinterpret_cast<const T*>(&other->internal);
@@ -489,6 +492,7 @@ T* bpstd::any::external_storage_handler<T>
   ::construct(storage& s, Args&&...args)
 {
   s.external = new T(bpstd::forward<Args>(args)...);
+  BPSTD_INSTRUMENT(any, heap_spill);
   return static_cast<T*>(s.external);
 }
 
@@ -499,6 +503,7 @@ T* bpstd::any::external_storage_handler<T>
   ::construct(storage& s, std::initializer_list<U> il, Args&&...args)
 {
   s.external = new T(il, bpstd::forward<Args>(args)...);
+  BPSTD_INSTRUMENT(any, heap_spill);
   return static_cast<T*>(s.external);
 }
 
@@ -532,6 +537,7 @@ const void* bpstd::any::external_storage_handler<T>
     {
       assert(self != nullptr);
       assert(other != nullptr);
+      BPSTD_INSTRUMENT(any, copy);
 
       // Copy construct from the internal storage
       construct( const_cast<storage&>(*self),
@@ -543,6 +549,7 @@ const void* bpstd::any::external_storage_handler<T>
     {
       BPSTD_UNUSED(self != nullptr);
       assert(other != nullptr);
+      BPSTD_INSTRUMENT(any, move);
 
       const auto p = static_cast<const T*>(other->external);
       // Move construct from the internal storage. '
@@ -853,6 +860,7 @@ T bpstd::any_cast(any& operand)
 
   auto* p = any_cast<underlying_type>(&operand);
   if (p == nullptr) {
+    BPSTD_INSTRUMENT(any, bad_access);
     throw bad_any_cast{};
   }
   return static_cast<T>(*p);
@@ -871,6 +879,7 @@ T bpstd::any_cast(any&& operand)
 
   auto* p = any_cast<underlying_type>(&operand);
   if (p == nullptr) {
+    BPSTD_INSTRUMENT(any, bad_access);
     throw bad_any_cast{};
   }
   return static_cast<T>(bpstd::move(*p));
@@ -889,6 +898,7 @@ T bpstd::any_cast(const any& operand)
 
   const auto* p = any_cast<underlying_type>(&operand);
   if (p == nullptr) {
+    BPSTD_INSTRUMENT(any, bad_access);
     throw bad_any_cast{};
   }
   return static_cast<T>(*p);
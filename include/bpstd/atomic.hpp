@@ -0,0 +1,1070 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file atomic.hpp
+///
+/// \brief This header provides definitions from the C++ header <atomic>
+////////////////////////////////////////////////////////////////////////////////
+
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_ATOMIC_HPP
+#define BPSTD_ATOMIC_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/config.hpp"
+#include "detail/atomic_wait.hpp"
+
+#include "type_traits.hpp" // conditional_t, is_integral, is_floating_point, ...
+
+#include <atomic>  // std::atomic, std::memory_order
+#include <cassert> // assert
+#include <cstddef> // std::size_t, std::ptrdiff_t
+#include <cstdint> // std::uintptr_t
+#include <memory>  // std::addressof
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+
+  //============================================================================
+  // non-member functions : atomic waiting
+  //============================================================================
+
+  /// \brief Blocks the calling thread until \p object is notified and no
+  ///        longer holds \p old
+  ///
+  /// Values are compared by their value representation. The thread spins
+  /// briefly before parking (on a futex, on Linux).
+  ///
+  /// \param object the atomic to wait on
+  /// \param old the value to wait while seeing
+  template <typename T>
+  void atomic_wait(const std::atomic<T>* object,
+                   typename type_identity<T>::type old) noexcept;
+
+  /// \brief Blocks the calling thread until \p object is notified and no
+  ///        longer holds \p old, loading it with \p order
+  ///
+  /// \param object the atomic to wait on
+  /// \param old the value to wait while seeing
+  /// \param order the memory order to load \p object with
+  template <typename T>
+  void atomic_wait_explicit(const std::atomic<T>* object,
+                            typename type_identity<T>::type old,
+                            std::memory_order order) noexcept;
+
+  /// \brief Unblocks at least one thread that is waiting on \p object
+  ///
+  /// \param object the atomic to notify
+  template <typename T>
+  void atomic_notify_one(std::atomic<T>* object) noexcept;
+
+  /// \brief Unblocks every thread that is waiting on \p object
+  ///
+  /// \param object the atomic to notify
+  template <typename T>
+  void atomic_notify_all(std::atomic<T>* object) noexcept;
+
+  //============================================================================
+  // class : atomic_ref
+  //============================================================================
+
+  namespace detail {
+
+    // GCC and Clang provide the __atomic builtins, which are defined to
+    // operate atomically on plain objects, and which atomic_ref uses directly.
+    // Elsewhere, atomic_ref operates on the referenced object through a
+    // std::atomic<T>, which is required to have the same size and
+    // representation as T for this to be possible. Every mainstream
+    // implementation defines std::atomic<T> as a suitably aligned T, and
+    // implements operations on it with the same primitives.
+
+#if defined(BPSTD_DETAIL_HAS_ATOMIC_BUILTINS)
+    /// \brief Converts \p order to the equivalent __ATOMIC_* constant
+    constexpr int to_atomic_builtin_order(std::memory_order order) noexcept;
+#endif
+
+    /// \brief Gets the strongest failure order that may be used with a
+    ///        compare-and-exchange of success order \p order
+    constexpr std::memory_order
+      compare_exchange_failure_order(std::memory_order order) noexcept;
+
+    /// \brief Adds \p rhs to \p lhs, wrapping around on overflow as atomic
+    ///        arithmetic does
+    template <typename T>
+    constexpr T atomic_wrapping_add(T lhs, T rhs) noexcept;
+
+    /// \brief Subtracts \p rhs from \p lhs, wrapping around on overflow as
+    ///        atomic arithmetic does
+    template <typename T>
+    constexpr T atomic_wrapping_sub(T lhs, T rhs) noexcept;
+
+    /// \brief The number of bytes that adding 1 to a \p T advances it by
+    template <typename T>
+    struct atomic_arithmetic_scale
+      : std::integral_constant<std::ptrdiff_t,1>{};
+
+    template <typename T>
+    struct atomic_arithmetic_scale<T*>
+      : std::integral_constant<std::ptrdiff_t,sizeof(T)>{};
+
+    template <typename T>
+    bool atomic_object_is_lock_free(const T* object) noexcept;
+
+    template <typename T>
+    T atomic_object_load(const T* object, std::memory_order order) noexcept;
+
+    template <typename T>
+    void atomic_object_store(T* object,
+                             T desired,
+                             std::memory_order order) noexcept;
+
+    template <typename T>
+    T atomic_object_exchange(T* object,
+                             T desired,
+                             std::memory_order order) noexcept;
+
+    template <typename T>
+    bool atomic_object_compare_exchange(T* object,
+                                        T& expected,
+                                        T desired,
+                                        bool weak,
+                                        std::memory_order success,
+                                        std::memory_order failure) noexcept;
+
+    template <typename T, typename U>
+    T atomic_object_fetch_add(T* object, U arg, std::memory_order order) noexcept;
+    template <typename T, typename U>
+    T atomic_object_fetch_sub(T* object, U arg, std::memory_order order) noexcept;
+    template <typename T>
+    T atomic_object_fetch_and(T* object, T arg, std::memory_order order) noexcept;
+    template <typename T>
+    T atomic_object_fetch_or(T* object, T arg, std::memory_order order) noexcept;
+    template <typename T>
+    T atomic_object_fetch_xor(T* object, T arg, std::memory_order order) noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The operations of an atomic_ref that are common to every type
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    class atomic_ref_base
+    {
+      static_assert(
+        sizeof(std::atomic<T>) == sizeof(T),
+        "atomic_ref requires std::atomic<T> to have the representation of T"
+      );
+
+      //------------------------------------------------------------------------
+      // Public Member Types
+      //------------------------------------------------------------------------
+    public:
+
+      using value_type = T;
+
+      //------------------------------------------------------------------------
+      // Public Static Members
+      //------------------------------------------------------------------------
+    public:
+
+      /// \brief The alignment that a referenced object must have
+      static constexpr std::size_t required_alignment = alignof(std::atomic<T>);
+
+      //------------------------------------------------------------------------
+      // Constructors / Assignment
+      //------------------------------------------------------------------------
+    public:
+
+      explicit atomic_ref_base(T& object) noexcept;
+      atomic_ref_base(const atomic_ref_base&) noexcept = default;
+      atomic_ref_base& operator=(const atomic_ref_base&) = delete;
+
+      T operator=(T desired) const noexcept;
+
+      //------------------------------------------------------------------------
+      // Operations
+      //------------------------------------------------------------------------
+    public:
+
+      bool is_lock_free() const noexcept;
+
+      void store(T desired,
+                 std::memory_order order = std::memory_order_seq_cst) const noexcept;
+
+      T load(std::memory_order order = std::memory_order_seq_cst) const noexcept;
+
+      operator T() const noexcept;
+
+      T exchange(T desired,
+                 std::memory_order order = std::memory_order_seq_cst) const noexcept;
+
+      bool compare_exchange_weak(T& expected, T desired,
+                                 std::memory_order success,
+                                 std::memory_order failure) const noexcept;
+      bool compare_exchange_weak(T& expected, T desired,
+                                 std::memory_order order = std::memory_order_seq_cst) const noexcept;
+      bool compare_exchange_strong(T& expected, T desired,
+                                   std::memory_order success,
+                                   std::memory_order failure) const noexcept;
+      bool compare_exchange_strong(T& expected, T desired,
+                                   std::memory_order order = std::memory_order_seq_cst) const noexcept;
+
+      //------------------------------------------------------------------------
+      // Waiting
+      //------------------------------------------------------------------------
+    public:
+
+      void wait(T old,
+                std::memory_order order = std::memory_order_seq_cst) const noexcept;
+      void notify_one() const noexcept;
+      void notify_all() const noexcept;
+
+      //------------------------------------------------------------------------
+      // Protected Members
+      //------------------------------------------------------------------------
+    protected:
+
+      T* m_object;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The additional operations of an atomic_ref to an integral type
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    class atomic_ref_integral : public atomic_ref_base<T>
+    {
+      using base_type = atomic_ref_base<T>;
+
+    public:
+
+      using difference_type = T;
+
+      using base_type::base_type;
+      using base_type::operator=;
+
+      T fetch_add(T arg, std::memory_order order = std::memory_order_seq_cst) const noexcept;
+      T fetch_sub(T arg, std::memory_order order = std::memory_order_seq_cst) const noexcept;
+      T fetch_and(T arg, std::memory_order order = std::memory_order_seq_cst) const noexcept;
+      T fetch_or(T arg, std::memory_order order = std::memory_order_seq_cst) const noexcept;
+      T fetch_xor(T arg, std::memory_order order = std::memory_order_seq_cst) const noexcept;
+
+      T operator++(int) const noexcept;
+      T operator--(int) const noexcept;
+      T operator++() const noexcept;
+      T operator--() const noexcept;
+      T operator+=(T arg) const noexcept;
+      T operator-=(T arg) const noexcept;
+      T operator&=(T arg) const noexcept;
+      T operator|=(T arg) const noexcept;
+      T operator^=(T arg) const noexcept;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The additional operations of an atomic_ref to a floating-point
+    ///        type
+    ///
+    /// std::atomic only gained arithmetic on floating-point types in C++20,
+    /// so these are implemented as compare-and-exchange loops.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    class atomic_ref_floating : public atomic_ref_base<T>
+    {
+      using base_type = atomic_ref_base<T>;
+
+    public:
+
+      using difference_type = T;
+
+      using base_type::base_type;
+      using base_type::operator=;
+
+      T fetch_add(T arg, std::memory_order order = std::memory_order_seq_cst) const noexcept;
+      T fetch_sub(T arg, std::memory_order order = std::memory_order_seq_cst) const noexcept;
+
+      T operator+=(T arg) const noexcept;
+      T operator-=(T arg) const noexcept;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The additional operations of an atomic_ref to a pointer
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    class atomic_ref_pointer : public atomic_ref_base<T>
+    {
+      using base_type = atomic_ref_base<T>;
+
+    public:
+
+      using difference_type = std::ptrdiff_t;
+
+      using base_type::base_type;
+      using base_type::operator=;
+
+      T fetch_add(std::ptrdiff_t arg, std::memory_order order = std::memory_order_seq_cst) const noexcept;
+      T fetch_sub(std::ptrdiff_t arg, std::memory_order order = std::memory_order_seq_cst) const noexcept;
+
+      T operator++(int) const noexcept;
+      T operator--(int) const noexcept;
+      T operator++() const noexcept;
+      T operator--() const noexcept;
+      T operator+=(std::ptrdiff_t arg) const noexcept;
+      T operator-=(std::ptrdiff_t arg) const noexcept;
+    };
+
+    template <typename T>
+    using atomic_ref_impl = conditional_t<
+      is_integral<T>::value && !is_same<T,bool>::value,
+      atomic_ref_integral<T>,
+      conditional_t<
+        is_floating_point<T>::value,
+        atomic_ref_floating<T>,
+        conditional_t<
+          is_pointer<T>::value,
+          atomic_ref_pointer<T>,
+          atomic_ref_base<T>
+        >
+      >
+    >;
+
+  } // namespace detail
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief A reference that applies atomic operations to the object it
+  ///        refers to
+  ///
+  /// This allows plain objects -- such as the counters in an array that is
+  /// viewed through a span -- to be operated on atomically without changing
+  /// their layout. While any atomic_ref to an object exists, the object must
+  /// only be accessed through atomic_refs.
+  ///
+  /// Integral, floating-point and pointer types provide the arithmetic
+  /// operations that std::atomic would. Every type supports wait(),
+  /// notify_one() and notify_all(), as with atomic_wait.
+  ///
+  /// \pre the referenced object is aligned to required_alignment
+  /// \tparam T the type of the referenced object; must be trivially copyable
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  class atomic_ref : public detail::atomic_ref_impl<T>
+  {
+    static_assert(
+      std::is_trivially_copyable<T>::value,
+      "atomic_ref requires a trivially copyable type"
+    );
+
+    using base_type = detail::atomic_ref_impl<T>;
+
+    //--------------------------------------------------------------------------
+    // Constructors / Assignment
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs an atomic_ref that refers to \p object
+    ///
+    /// \param object the object to refer to
+    explicit atomic_ref(T& object) noexcept;
+
+    /// \brief Constructs an atomic_ref that refers to the same object as
+    ///        \p other
+    ///
+    /// \param other the other reference
+    atomic_ref(const atomic_ref& other) noexcept = default;
+
+    //--------------------------------------------------------------------------
+
+    using base_type::operator=;
+
+    atomic_ref& operator=(const atomic_ref&) = delete;
+  };
+
+} // namespace bpstd
+
+//==============================================================================
+// definitions : non-member functions : atomic waiting
+//==============================================================================
+
+template <typename T>
+inline void bpstd::atomic_wait(const std::atomic<T>* object,
+                               typename type_identity<T>::type old)
+  noexcept
+{
+  detail::atomic_wait(*object, old, std::memory_order_seq_cst);
+}
+
+template <typename T>
+inline void bpstd::atomic_wait_explicit(const std::atomic<T>* object,
+                                        typename type_identity<T>::type old,
+                                        std::memory_order order)
+  noexcept
+{
+  detail::atomic_wait(*object, old, order);
+}
+
+template <typename T>
+inline void bpstd::atomic_notify_one(std::atomic<T>* object)
+  noexcept
+{
+  detail::atomic_notify(*object, false);
+}
+
+template <typename T>
+inline void bpstd::atomic_notify_all(std::atomic<T>* object)
+  noexcept
+{
+  detail::atomic_notify(*object, true);
+}
+
+//==============================================================================
+// definitions : atomic operations on plain objects
+//==============================================================================
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+std::memory_order
+  bpstd::detail::compare_exchange_failure_order(std::memory_order order)
+  noexcept
+{
+  return (order == std::memory_order_acq_rel) ? std::memory_order_acquire
+       : (order == std::memory_order_release) ? std::memory_order_relaxed
+       : order;
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+T bpstd::detail::atomic_wrapping_add(T lhs, T rhs)
+  noexcept
+{
+  return static_cast<T>(
+    static_cast<make_unsigned_t<T>>(lhs) + static_cast<make_unsigned_t<T>>(rhs)
+  );
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+T bpstd::detail::atomic_wrapping_sub(T lhs, T rhs)
+  noexcept
+{
+  return static_cast<T>(
+    static_cast<make_unsigned_t<T>>(lhs) - static_cast<make_unsigned_t<T>>(rhs)
+  );
+}
+
+#if defined(BPSTD_DETAIL_HAS_ATOMIC_BUILTINS)
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+int bpstd::detail::to_atomic_builtin_order(std::memory_order order)
+  noexcept
+{
+  return (order == std::memory_order_relaxed) ? __ATOMIC_RELAXED
+       : (order == std::memory_order_consume) ? __ATOMIC_CONSUME
+       : (order == std::memory_order_acquire) ? __ATOMIC_ACQUIRE
+       : (order == std::memory_order_release) ? __ATOMIC_RELEASE
+       : (order == std::memory_order_acq_rel) ? __ATOMIC_ACQ_REL
+       : __ATOMIC_SEQ_CST;
+}
+
+template <typename T>
+inline bool bpstd::detail::atomic_object_is_lock_free(const T* object)
+  noexcept
+{
+  return __atomic_is_lock_free(sizeof(T), object);
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_object_load(const T* object,
+                                           std::memory_order order)
+  noexcept
+{
+  // T need not be default-constructible, so it is loaded into raw storage
+  alignas(T) unsigned char storage[sizeof(T)];
+  auto* const result = reinterpret_cast<T*>(storage);
+
+  __atomic_load(object, result, to_atomic_builtin_order(order));
+  return *result;
+}
+
+template <typename T>
+inline void bpstd::detail::atomic_object_store(T* object,
+                                               T desired,
+                                               std::memory_order order)
+  noexcept
+{
+  __atomic_store(object, std::addressof(desired), to_atomic_builtin_order(order));
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_object_exchange(T* object,
+                                               T desired,
+                                               std::memory_order order)
+  noexcept
+{
+  alignas(T) unsigned char storage[sizeof(T)];
+  auto* const result = reinterpret_cast<T*>(storage);
+
+  __atomic_exchange(object,
+                    std::addressof(desired),
+                    result,
+                    to_atomic_builtin_order(order));
+  return *result;
+}
+
+template <typename T>
+inline bool bpstd::detail::atomic_object_compare_exchange(T* object,
+                                                          T& expected,
+                                                          T desired,
+                                                          bool weak,
+                                                          std::memory_order success,
+                                                          std::memory_order failure)
+  noexcept
+{
+  return __atomic_compare_exchange(object,
+                                   std::addressof(expected),
+                                   std::addressof(desired),
+                                   weak,
+                                   to_atomic_builtin_order(success),
+                                   to_atomic_builtin_order(failure));
+}
+
+// The arithmetic builtins do not scale pointer arithmetic by the size of the
+// pointee, so this is done here
+
+template <typename T, typename U>
+inline T bpstd::detail::atomic_object_fetch_add(T* object,
+                                                U arg,
+                                                std::memory_order order)
+  noexcept
+{
+  return __atomic_fetch_add(object,
+                            arg * atomic_arithmetic_scale<T>::value,
+                            to_atomic_builtin_order(order));
+}
+
+template <typename T, typename U>
+inline T bpstd::detail::atomic_object_fetch_sub(T* object,
+                                                U arg,
+                                                std::memory_order order)
+  noexcept
+{
+  return __atomic_fetch_sub(object,
+                            arg * atomic_arithmetic_scale<T>::value,
+                            to_atomic_builtin_order(order));
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_object_fetch_and(T* object,
+                                                T arg,
+                                                std::memory_order order)
+  noexcept
+{
+  return __atomic_fetch_and(object, arg, to_atomic_builtin_order(order));
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_object_fetch_or(T* object,
+                                               T arg,
+                                               std::memory_order order)
+  noexcept
+{
+  return __atomic_fetch_or(object, arg, to_atomic_builtin_order(order));
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_object_fetch_xor(T* object,
+                                                T arg,
+                                                std::memory_order order)
+  noexcept
+{
+  return __atomic_fetch_xor(object, arg, to_atomic_builtin_order(order));
+}
+
+#else
+
+template <typename T>
+inline bool bpstd::detail::atomic_object_is_lock_free(const T* object)
+  noexcept
+{
+  return reinterpret_cast<const std::atomic<T>*>(object)->is_lock_free();
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_object_load(const T* object,
+                                           std::memory_order order)
+  noexcept
+{
+  return reinterpret_cast<const std::atomic<T>*>(object)->load(order);
+}
+
+template <typename T>
+inline void bpstd::detail::atomic_object_store(T* object,
+                                               T desired,
+                                               std::memory_order order)
+  noexcept
+{
+  reinterpret_cast<std::atomic<T>*>(object)->store(desired, order);
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_object_exchange(T* object,
+                                               T desired,
+                                               std::memory_order order)
+  noexcept
+{
+  return reinterpret_cast<std::atomic<T>*>(object)->exchange(desired, order);
+}
+
+template <typename T>
+inline bool bpstd::detail::atomic_object_compare_exchange(T* object,
+                                                          T& expected,
+                                                          T desired,
+                                                          bool weak,
+                                                          std::memory_order success,
+                                                          std::memory_order failure)
+  noexcept
+{
+  auto* const atomic = reinterpret_cast<std::atomic<T>*>(object);
+
+  return weak
+    ? atomic->compare_exchange_weak(expected, desired, success, failure)
+    : atomic->compare_exchange_strong(expected, desired, success, failure);
+}
+
+template <typename T, typename U>
+inline T bpstd::detail::atomic_object_fetch_add(T* object,
+                                                U arg,
+                                                std::memory_order order)
+  noexcept
+{
+  return reinterpret_cast<std::atomic<T>*>(object)->fetch_add(arg, order);
+}
+
+template <typename T, typename U>
+inline T bpstd::detail::atomic_object_fetch_sub(T* object,
+                                                U arg,
+                                                std::memory_order order)
+  noexcept
+{
+  return reinterpret_cast<std::atomic<T>*>(object)->fetch_sub(arg, order);
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_object_fetch_and(T* object,
+                                                T arg,
+                                                std::memory_order order)
+  noexcept
+{
+  return reinterpret_cast<std::atomic<T>*>(object)->fetch_and(arg, order);
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_object_fetch_or(T* object,
+                                               T arg,
+                                               std::memory_order order)
+  noexcept
+{
+  return reinterpret_cast<std::atomic<T>*>(object)->fetch_or(arg, order);
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_object_fetch_xor(T* object,
+                                                T arg,
+                                                std::memory_order order)
+  noexcept
+{
+  return reinterpret_cast<std::atomic<T>*>(object)->fetch_xor(arg, order);
+}
+
+#endif // defined(BPSTD_DETAIL_HAS_ATOMIC_BUILTINS)
+
+//==============================================================================
+// definitions : class : atomic_ref_base
+//==============================================================================
+
+template <typename T>
+constexpr std::size_t bpstd::detail::atomic_ref_base<T>::required_alignment;
+
+//------------------------------------------------------------------------------
+// Constructors / Assignment
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline bpstd::detail::atomic_ref_base<T>::atomic_ref_base(T& object)
+  noexcept
+  : m_object{std::addressof(object)}
+{
+  // A misaligned object would silently lose atomicity
+  assert(reinterpret_cast<std::uintptr_t>(m_object) % required_alignment == 0u);
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_ref_base<T>::operator=(T desired)
+  const noexcept
+{
+  store(desired);
+  return desired;
+}
+
+//------------------------------------------------------------------------------
+// Operations
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline bool bpstd::detail::atomic_ref_base<T>::is_lock_free()
+  const noexcept
+{
+  return atomic_object_is_lock_free(m_object);
+}
+
+template <typename T>
+inline void bpstd::detail::atomic_ref_base<T>::store(T desired,
+                                                     std::memory_order order)
+  const noexcept
+{
+  atomic_object_store(m_object, desired, order);
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_ref_base<T>::load(std::memory_order order)
+  const noexcept
+{
+  return atomic_object_load(m_object, order);
+}
+
+template <typename T>
+inline bpstd::detail::atomic_ref_base<T>::operator T()
+  const noexcept
+{
+  return load();
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_ref_base<T>::exchange(T desired,
+                                                     std::memory_order order)
+  const noexcept
+{
+  return atomic_object_exchange(m_object, desired, order);
+}
+
+template <typename T>
+inline bool bpstd::detail::atomic_ref_base<T>
+  ::compare_exchange_weak(T& expected, T desired,
+                          std::memory_order success,
+                          std::memory_order failure)
+  const noexcept
+{
+  return atomic_object_compare_exchange(m_object, expected, desired, true,
+                                        success, failure);
+}
+
+template <typename T>
+inline bool bpstd::detail::atomic_ref_base<T>
+  ::compare_exchange_weak(T& expected, T desired, std::memory_order order)
+  const noexcept
+{
+  return compare_exchange_weak(expected, desired,
+                               order, compare_exchange_failure_order(order));
+}
+
+template <typename T>
+inline bool bpstd::detail::atomic_ref_base<T>
+  ::compare_exchange_strong(T& expected, T desired,
+                            std::memory_order success,
+                            std::memory_order failure)
+  const noexcept
+{
+  return atomic_object_compare_exchange(m_object, expected, desired, false,
+                                        success, failure);
+}
+
+template <typename T>
+inline bool bpstd::detail::atomic_ref_base<T>
+  ::compare_exchange_strong(T& expected, T desired, std::memory_order order)
+  const noexcept
+{
+  return compare_exchange_strong(expected, desired,
+                                 order, compare_exchange_failure_order(order));
+}
+
+//------------------------------------------------------------------------------
+// Waiting
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline void bpstd::detail::atomic_ref_base<T>::wait(T old,
+                                                    std::memory_order order)
+  const noexcept
+{
+  const auto* const object = m_object;
+
+  detail::atomic_wait_at(object, [object, order]{
+    return atomic_object_load(object, order);
+  }, old);
+}
+
+template <typename T>
+inline void bpstd::detail::atomic_ref_base<T>::notify_one()
+  const noexcept
+{
+  detail::atomic_notify_at<T>(m_object, false);
+}
+
+template <typename T>
+inline void bpstd::detail::atomic_ref_base<T>::notify_all()
+  const noexcept
+{
+  detail::atomic_notify_at<T>(m_object, true);
+}
+
+//==============================================================================
+// definitions : class : atomic_ref_integral
+//==============================================================================
+
+template <typename T>
+inline T bpstd::detail::atomic_ref_integral<T>::fetch_add(T arg,
+                                                          std::memory_order order)
+  const noexcept
+{
+  return atomic_object_fetch_add(this->m_object, arg, order);
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_ref_integral<T>::fetch_sub(T arg,
+                                                          std::memory_order order)
+  const noexcept
+{
+  return atomic_object_fetch_sub(this->m_object, arg, order);
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_ref_integral<T>::fetch_and(T arg,
+                                                          std::memory_order order)
+  const noexcept
+{
+  return atomic_object_fetch_and(this->m_object, arg, order);
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_ref_integral<T>::fetch_or(T arg,
+                                                         std::memory_order order)
+  const noexcept
+{
+  return atomic_object_fetch_or(this->m_object, arg, order);
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_ref_integral<T>::fetch_xor(T arg,
+                                                          std::memory_order order)
+  const noexcept
+{
+  return atomic_object_fetch_xor(this->m_object, arg, order);
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_ref_integral<T>::operator++(int)
+  const noexcept
+{
+  return fetch_add(T{1});
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_ref_integral<T>::operator--(int)
+  const noexcept
+{
+  return fetch_sub(T{1});
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_ref_integral<T>::operator++()
+  const noexcept
+{
+  return atomic_wrapping_add(fetch_add(T{1}), T{1});
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_ref_integral<T>::operator--()
+  const noexcept
+{
+  return atomic_wrapping_sub(fetch_sub(T{1}), T{1});
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_ref_integral<T>::operator+=(T arg)
+  const noexcept
+{
+  return atomic_wrapping_add(fetch_add(arg), arg);
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_ref_integral<T>::operator-=(T arg)
+  const noexcept
+{
+  return atomic_wrapping_sub(fetch_sub(arg), arg);
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_ref_integral<T>::operator&=(T arg)
+  const noexcept
+{
+  return static_cast<T>(fetch_and(arg) & arg);
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_ref_integral<T>::operator|=(T arg)
+  const noexcept
+{
+  return static_cast<T>(fetch_or(arg) | arg);
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_ref_integral<T>::operator^=(T arg)
+  const noexcept
+{
+  return static_cast<T>(fetch_xor(arg) ^ arg);
+}
+
+//==============================================================================
+// definitions : class : atomic_ref_floating
+//==============================================================================
+
+template <typename T>
+inline T bpstd::detail::atomic_ref_floating<T>::fetch_add(T arg,
+                                                          std::memory_order order)
+  const noexcept
+{
+  auto current = atomic_object_load(this->m_object, std::memory_order_relaxed);
+  while (!atomic_object_compare_exchange(this->m_object, current, current + arg,
+                                         true,
+                                         order,
+                                         std::memory_order_relaxed)) {
+    // 'current' is reloaded by a failed exchange
+  }
+  return current;
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_ref_floating<T>::fetch_sub(T arg,
+                                                          std::memory_order order)
+  const noexcept
+{
+  auto current = atomic_object_load(this->m_object, std::memory_order_relaxed);
+  while (!atomic_object_compare_exchange(this->m_object, current, current - arg,
+                                         true,
+                                         order,
+                                         std::memory_order_relaxed)) {
+    // 'current' is reloaded by a failed exchange
+  }
+  return current;
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_ref_floating<T>::operator+=(T arg)
+  const noexcept
+{
+  return fetch_add(arg) + arg;
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_ref_floating<T>::operator-=(T arg)
+  const noexcept
+{
+  return fetch_sub(arg) - arg;
+}
+
+//==============================================================================
+// definitions : class : atomic_ref_pointer
+//==============================================================================
+
+template <typename T>
+inline T bpstd::detail::atomic_ref_pointer<T>::fetch_add(std::ptrdiff_t arg,
+                                                         std::memory_order order)
+  const noexcept
+{
+  return atomic_object_fetch_add(this->m_object, arg, order);
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_ref_pointer<T>::fetch_sub(std::ptrdiff_t arg,
+                                                         std::memory_order order)
+  const noexcept
+{
+  return atomic_object_fetch_sub(this->m_object, arg, order);
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_ref_pointer<T>::operator++(int)
+  const noexcept
+{
+  return fetch_add(1);
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_ref_pointer<T>::operator--(int)
+  const noexcept
+{
+  return fetch_sub(1);
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_ref_pointer<T>::operator++()
+  const noexcept
+{
+  return fetch_add(1) + 1;
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_ref_pointer<T>::operator--()
+  const noexcept
+{
+  return fetch_sub(1) - 1;
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_ref_pointer<T>::operator+=(std::ptrdiff_t arg)
+  const noexcept
+{
+  return fetch_add(arg) + arg;
+}
+
+template <typename T>
+inline T bpstd::detail::atomic_ref_pointer<T>::operator-=(std::ptrdiff_t arg)
+  const noexcept
+{
+  return fetch_sub(arg) - arg;
+}
+
+//==============================================================================
+// definitions : class : atomic_ref
+//==============================================================================
+
+template <typename T>
+inline bpstd::atomic_ref<T>::atomic_ref(T& object)
+  noexcept
+  : base_type{object}
+{
+
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_ATOMIC_HPP */
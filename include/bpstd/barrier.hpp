@@ -0,0 +1,296 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file barrier.hpp
+///
+/// \brief This header provides definitions from the C++ header <barrier>
+////////////////////////////////////////////////////////////////////////////////
+
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_BARRIER_HPP
+#define BPSTD_BARRIER_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/config.hpp"
+#include "detail/atomic_wait.hpp"
+
+#include "functional.hpp"  // invoke
+#include "type_traits.hpp" // is_nothrow_invocable
+
+#include <atomic>  // std::atomic
+#include <cstddef> // std::ptrdiff_t
+#include <cstdint> // std::int32_t, std::uint32_t, std::uint64_t
+#include <limits>  // std::numeric_limits
+#include <utility> // std::move
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+  namespace detail {
+
+    /// \brief The completion function of a barrier that does nothing
+    struct empty_completion
+    {
+      void operator()() noexcept {}
+    };
+
+  } // namespace detail
+
+  //============================================================================
+  // class : barrier
+  //============================================================================
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief A reusable synchronization point for a group of threads, that
+  ///        runs a completion function at the end of every phase
+  ///
+  /// The barrier's phase and the arrivals it still expects are held together
+  /// in a single atomic word, so that arriving is a single atomic
+  /// subtraction. The last thread to arrive runs the completion function
+  /// (through bpstd::invoke) and begins the next phase; waiting threads spin
+  /// briefly before parking on the phase (a futex on Linux).
+  ///
+  /// \tparam CompletionFunction the type of the function to invoke when a
+  ///         phase completes
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename CompletionFunction = detail::empty_completion>
+  class barrier
+  {
+    static_assert(
+      is_nothrow_invocable<CompletionFunction&>::value,
+      "The completion function of a barrier must be nothrow invocable"
+    );
+
+    //--------------------------------------------------------------------------
+    // Public Member Types
+    //--------------------------------------------------------------------------
+  public:
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief A token identifying the phase that a thread arrived in
+    ////////////////////////////////////////////////////////////////////////////
+    class arrival_token
+    {
+    public:
+      arrival_token(arrival_token&&) = default;
+      arrival_token& operator=(arrival_token&&) = default;
+
+    private:
+      explicit arrival_token(std::uint32_t phase) noexcept : m_phase{phase}{}
+
+      std::uint32_t m_phase;
+
+      friend class barrier;
+    };
+
+    //--------------------------------------------------------------------------
+    // Static Member Functions
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets the maximum expected count that is supported
+    ///
+    /// \return the maximum value
+    static constexpr std::ptrdiff_t max() noexcept;
+
+    //--------------------------------------------------------------------------
+    // Constructors / Destructor / Assignment
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs a barrier that expects \p expected arrivals in each
+    ///        phase
+    ///
+    /// \pre 0 <= expected <= max()
+    /// \param expected the number of arrivals in each phase
+    /// \param f the function to invoke when a phase completes
+    explicit barrier(std::ptrdiff_t expected,
+                     CompletionFunction f = CompletionFunction{});
+
+    barrier(const barrier&) = delete;
+
+    //--------------------------------------------------------------------------
+
+    barrier& operator=(const barrier&) = delete;
+
+    //--------------------------------------------------------------------------
+    // Arrival
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Arrives at the barrier \p n times, without blocking
+    ///
+    /// \pre 0 < n <= the arrivals still expected in the current phase
+    /// \param n the number of arrivals
+    /// \return a token for the phase that was arrived in
+    arrival_token arrive(std::ptrdiff_t n = 1) noexcept;
+
+    /// \brief Blocks the calling thread until the phase identified by
+    ///        \p arrival has completed
+    ///
+    /// \param arrival the token of the phase to wait for
+    void wait(arrival_token&& arrival) const noexcept;
+
+    /// \brief Arrives at the barrier, and then waits for the current phase
+    ///        to complete
+    void arrive_and_wait() noexcept;
+
+    /// \brief Arrives at the barrier, and removes the calling thread from
+    ///        the arrivals expected in every later phase
+    void arrive_and_drop() noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Member Functions
+    //--------------------------------------------------------------------------
+  private:
+
+    void complete_phase(std::uint32_t phase) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Members
+    //--------------------------------------------------------------------------
+  private:
+
+    // The phase occupies the upper 32 bits, and the arrivals still expected
+    // in it occupy the lower 32 bits
+    std::atomic<std::uint64_t> m_state;
+    std::atomic<std::int32_t> m_expected;
+    std::atomic<std::int32_t> m_phase; // mirrors the phase, to wait on
+    mutable std::atomic<std::int32_t> m_waiters;
+    CompletionFunction m_completion;
+  };
+
+} // namespace bpstd
+
+//==============================================================================
+// definitions : class : barrier
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Static Member Functions
+//------------------------------------------------------------------------------
+
+template <typename CompletionFunction>
+inline constexpr
+std::ptrdiff_t bpstd::barrier<CompletionFunction>::max()
+  noexcept
+{
+  return std::numeric_limits<std::int32_t>::max();
+}
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+template <typename CompletionFunction>
+inline bpstd::barrier<CompletionFunction>::barrier(std::ptrdiff_t expected,
+                                                   CompletionFunction f)
+  : m_state{static_cast<std::uint64_t>(expected)},
+    m_expected{static_cast<std::int32_t>(expected)},
+    m_phase{0},
+    m_waiters{0},
+    m_completion(std::move(f))
+{
+
+}
+
+//------------------------------------------------------------------------------
+// Arrival
+//------------------------------------------------------------------------------
+
+template <typename CompletionFunction>
+inline typename bpstd::barrier<CompletionFunction>::arrival_token
+  bpstd::barrier<CompletionFunction>::arrive(std::ptrdiff_t n)
+  noexcept
+{
+  const auto update = static_cast<std::uint64_t>(n);
+
+  // 'n' never exceeds the arrivals still expected, so this never borrows
+  // from the phase
+  const auto old = m_state.fetch_sub(update, std::memory_order_acq_rel);
+  const auto phase = static_cast<std::uint32_t>(old >> 32u);
+
+  if ((old & 0xffffffffu) == update) {
+    complete_phase(phase);
+  }
+  return arrival_token{phase};
+}
+
+template <typename CompletionFunction>
+inline void bpstd::barrier<CompletionFunction>::wait(arrival_token&& arrival)
+  const noexcept
+{
+  const auto phase = static_cast<std::int32_t>(arrival.m_phase);
+
+  while (m_phase.load(std::memory_order_acquire) == phase) {
+    detail::wait_while_equal(m_phase, phase, m_waiters);
+  }
+}
+
+template <typename CompletionFunction>
+inline void bpstd::barrier<CompletionFunction>::arrive_and_wait()
+  noexcept
+{
+  wait(arrive());
+}
+
+template <typename CompletionFunction>
+inline void bpstd::barrier<CompletionFunction>::arrive_and_drop()
+  noexcept
+{
+  // The last arrival of this phase synchronizes with this arrival, and so
+  // sees the lowered count when it resets the barrier
+  m_expected.fetch_sub(1, std::memory_order_relaxed);
+  arrive();
+}
+
+//------------------------------------------------------------------------------
+// Private Member Functions
+//------------------------------------------------------------------------------
+
+template <typename CompletionFunction>
+inline void bpstd::barrier<CompletionFunction>::complete_phase(std::uint32_t phase)
+  noexcept
+{
+  bpstd::invoke(m_completion);
+
+  const auto next = static_cast<std::uint32_t>(phase + 1u);
+  const auto expected = m_expected.load(std::memory_order_relaxed);
+
+  m_state.store(
+    (static_cast<std::uint64_t>(next) << 32u) | static_cast<std::uint32_t>(expected),
+    std::memory_order_release
+  );
+
+  // Sequentially consistent, as required by 'notify_waiters'
+  m_phase.store(static_cast<std::int32_t>(next));
+  detail::notify_waiters(m_phase, m_waiters, true);
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_BARRIER_HPP */
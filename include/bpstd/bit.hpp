@@ -0,0 +1,728 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file bit.hpp
+///
+/// \brief This header provides definitions from the C++ header <bit>
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_BIT_HPP
+#define BPSTD_BIT_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/config.hpp"
+#include "cstddef.hpp"     // byte
+#include "type_traits.hpp" // enable_if_t, is_unsigned, is_integral, ...
+
+#include <cstdint> // std::uint16_t, std::uint32_t, std::uint64_t
+#include <cstring> // std::memcpy
+#include <limits>  // std::numeric_limits
+
+// GCC and Clang expose builtins for each of these operations that are both
+// usable in constant expressions and lowered to single instructions (where the
+// target has one). Other compilers fall back to portable bit-twiddling.
+#if !defined(BPSTD_HAS_BIT_BUILTINS)
+# if defined(__GNUC__) || defined(__clang__)
+#   define BPSTD_HAS_BIT_BUILTINS 1
+# else
+#   define BPSTD_HAS_BIT_BUILTINS 0
+# endif
+#endif // !defined(BPSTD_HAS_BIT_BUILTINS)
+
+#if !defined(BPSTD_HAS_BUILTIN_BIT_CAST)
+# if defined(__has_builtin)
+#   if __has_builtin(__builtin_bit_cast)
+#     define BPSTD_HAS_BUILTIN_BIT_CAST 1
+#   endif
+# elif defined(_MSC_VER) && (_MSC_VER >= 1926)
+#   define BPSTD_HAS_BUILTIN_BIT_CAST 1
+# endif
+# if !defined(BPSTD_HAS_BUILTIN_BIT_CAST)
+#   define BPSTD_HAS_BUILTIN_BIT_CAST 0
+# endif
+#endif // !defined(BPSTD_HAS_BUILTIN_BIT_CAST)
+
+#if BPSTD_HAS_BUILTIN_BIT_CAST
+# define BPSTD_BIT_CAST_CONSTEXPR constexpr
+#else
+# define BPSTD_BIT_CAST_CONSTEXPR
+#endif
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+
+  //============================================================================
+  // enum class : endian
+  //============================================================================
+
+  /// \brief Indicates the endianness of scalar types
+  ///
+  /// If all scalar types are little-endian, endian::native equals
+  /// endian::little; if all are big-endian, it equals endian::big.
+  /// Otherwise it equals neither.
+#if defined(_MSC_VER) && !defined(__clang__)
+  enum class endian
+  {
+    little = 0,
+    big    = 1,
+    native = little,
+  };
+#else
+  enum class endian
+  {
+    little = __ORDER_LITTLE_ENDIAN__,
+    big    = __ORDER_BIG_ENDIAN__,
+    native = __BYTE_ORDER__,
+  };
+#endif
+
+  namespace detail {
+
+    /// \brief Type-trait to determine whether \p T is an unsigned integer type
+    ///        that may be used with the bit-manipulation functions
+    ///
+    /// Following the standard, bool and the character types are excluded.
+    template <typename T>
+    struct is_bit_integer
+      : bool_constant<
+          is_unsigned<T>::value &&
+          !is_same<remove_cv_t<T>,bool>::value &&
+          !is_same<remove_cv_t<T>,char>::value &&
+          !is_same<remove_cv_t<T>,wchar_t>::value &&
+          !is_same<remove_cv_t<T>,char16_t>::value &&
+          !is_same<remove_cv_t<T>,char32_t>::value &&
+          (sizeof(T) <= sizeof(std::uint64_t))
+        >{};
+
+    template <typename T>
+    using bit_integer_t = enable_if_t<is_bit_integer<T>::value,T>;
+
+    template <typename T>
+    using bit_integer_int_t = enable_if_t<is_bit_integer<T>::value,int>;
+
+    template <typename T>
+    using bit_integer_bool_t = enable_if_t<is_bit_integer<T>::value,bool>;
+
+    constexpr int popcount64(std::uint64_t x) noexcept;
+    constexpr int countl_zero64(std::uint64_t x) noexcept;
+    constexpr int countr_zero64(std::uint64_t x) noexcept;
+
+    constexpr std::uint16_t byteswap16(std::uint16_t x) noexcept;
+    constexpr std::uint32_t byteswap32(std::uint32_t x) noexcept;
+    constexpr std::uint64_t byteswap64(std::uint64_t x) noexcept;
+
+  } // namespace detail
+
+  //============================================================================
+  // non-member functions
+  //============================================================================
+
+  //----------------------------------------------------------------------------
+  // Casting
+  //----------------------------------------------------------------------------
+
+  /// \brief Reinterprets the object representation of \p from as a \p To
+  ///
+  /// This is usable in constant expressions only when the compiler provides
+  /// `__builtin_bit_cast`; otherwise it is implemented with std::memcpy.
+  ///
+  /// \param from the object to reinterpret
+  /// \return an object of type \p To with the same bits as \p from
+  template <typename To, typename From>
+  BPSTD_BIT_CAST_CONSTEXPR
+  enable_if_t<
+    (sizeof(To) == sizeof(From))
+#if BPSTD_HAS_TRIVIAL_TYPE_TRAITS
+    && is_trivially_copyable<To>::value
+    && is_trivially_copyable<From>::value
+#endif
+    ,To
+  > bit_cast(const From& from) noexcept;
+
+  //----------------------------------------------------------------------------
+  // Byte Ordering
+  //----------------------------------------------------------------------------
+
+  /// \brief Reverses the bytes of the integer \p value
+  ///
+  /// \param value the value to swap
+  /// \return \p value with its object representation reversed
+  template <typename T>
+  constexpr enable_if_t<is_integral<T>::value,T>
+    byteswap(T value) noexcept;
+
+  //----------------------------------------------------------------------------
+  // Integral Powers of 2
+  //----------------------------------------------------------------------------
+
+  /// \brief Checks whether \p x is an integral power of two
+  ///
+  /// \param x the value to check
+  /// \return true if exactly one bit of \p x is set
+  template <typename T>
+  constexpr detail::bit_integer_bool_t<T> has_single_bit(T x) noexcept;
+
+  /// \brief Computes the smallest integral power of two not less than \p x
+  ///
+  /// \pre the result is representable in \p T
+  /// \param x the value
+  /// \return the smallest power of two that is at least \p x
+  template <typename T>
+  constexpr detail::bit_integer_t<T> bit_ceil(T x) noexcept;
+
+  /// \brief Computes the largest integral power of two not greater than \p x
+  ///
+  /// \param x the value
+  /// \return the largest power of two that is at most \p x, or 0 if \p x is 0
+  template <typename T>
+  constexpr detail::bit_integer_t<T> bit_floor(T x) noexcept;
+
+  /// \brief Computes the number of bits needed to represent \p x
+  ///
+  /// \param x the value
+  /// \return 1 + floor(log2(x)), or 0 if \p x is 0
+  template <typename T>
+  constexpr detail::bit_integer_int_t<T> bit_width(T x) noexcept;
+
+  //----------------------------------------------------------------------------
+  // Rotating
+  //----------------------------------------------------------------------------
+
+  /// \brief Rotates the bits of \p x left by \p s
+  ///
+  /// \param x the value to rotate
+  /// \param s the number of bits to rotate by; negative values rotate right
+  /// \return the rotated value
+  template <typename T>
+  constexpr detail::bit_integer_t<T> rotl(T x, int s) noexcept;
+
+  /// \brief Rotates the bits of \p x right by \p s
+  ///
+  /// \param x the value to rotate
+  /// \param s the number of bits to rotate by; negative values rotate left
+  /// \return the rotated value
+  template <typename T>
+  constexpr detail::bit_integer_t<T> rotr(T x, int s) noexcept;
+
+  //----------------------------------------------------------------------------
+  // Counting
+  //----------------------------------------------------------------------------
+
+  /// \brief Counts the consecutive 0 bits of \p x, starting from the most
+  ///        significant bit
+  ///
+  /// \param x the value
+  /// \return the number of leading 0 bits
+  template <typename T>
+  constexpr detail::bit_integer_int_t<T> countl_zero(T x) noexcept;
+
+  /// \brief Counts the consecutive 1 bits of \p x, starting from the most
+  ///        significant bit
+  ///
+  /// \param x the value
+  /// \return the number of leading 1 bits
+  template <typename T>
+  constexpr detail::bit_integer_int_t<T> countl_one(T x) noexcept;
+
+  /// \brief Counts the consecutive 0 bits of \p x, starting from the least
+  ///        significant bit
+  ///
+  /// \param x the value
+  /// \return the number of trailing 0 bits
+  template <typename T>
+  constexpr detail::bit_integer_int_t<T> countr_zero(T x) noexcept;
+
+  /// \brief Counts the consecutive 1 bits of \p x, starting from the least
+  ///        significant bit
+  ///
+  /// \param x the value
+  /// \return the number of trailing 1 bits
+  template <typename T>
+  constexpr detail::bit_integer_int_t<T> countr_one(T x) noexcept;
+
+  /// \brief Counts the number of 1 bits in \p x
+  ///
+  /// \param x the value
+  /// \return the number of set bits
+  template <typename T>
+  constexpr detail::bit_integer_int_t<T> popcount(T x) noexcept;
+
+  //============================================================================
+  // non-member functions : enum class : byte
+  //============================================================================
+
+  // These overloads are an extension: they treat a byte as an unsigned char,
+  // so that byte buffers can be inspected without casting at each call site
+
+  constexpr bool has_single_bit(byte x) noexcept;
+  constexpr byte bit_ceil(byte x) noexcept;
+  constexpr byte bit_floor(byte x) noexcept;
+  constexpr int bit_width(byte x) noexcept;
+
+  constexpr byte rotl(byte x, int s) noexcept;
+  constexpr byte rotr(byte x, int s) noexcept;
+
+  constexpr int countl_zero(byte x) noexcept;
+  constexpr int countl_one(byte x) noexcept;
+  constexpr int countr_zero(byte x) noexcept;
+  constexpr int countr_one(byte x) noexcept;
+  constexpr int popcount(byte x) noexcept;
+
+} // namespace bpstd
+
+//==============================================================================
+// definitions : detail
+//==============================================================================
+
+namespace bpstd {
+  namespace detail {
+
+#if !BPSTD_HAS_BIT_BUILTINS
+
+    // Each step of the SWAR population count, split into functions so that
+    // each remains a single expression for C++11 constexpr
+
+    inline BPSTD_INLINE_VISIBILITY constexpr
+    int popcount64_sum(std::uint64_t x)
+      noexcept
+    {
+      return static_cast<int>((x * 0x0101010101010101ull) >> 56u);
+    }
+
+    inline BPSTD_INLINE_VISIBILITY constexpr
+    int popcount64_nibbles(std::uint64_t x)
+      noexcept
+    {
+      return popcount64_sum((x + (x >> 4u)) & 0x0f0f0f0f0f0f0f0full);
+    }
+
+    inline BPSTD_INLINE_VISIBILITY constexpr
+    int popcount64_pairs(std::uint64_t x)
+      noexcept
+    {
+      return popcount64_nibbles(
+        (x & 0x3333333333333333ull) + ((x >> 2u) & 0x3333333333333333ull)
+      );
+    }
+
+    /// \brief Counts the leading zeros in the low \p width bits of \p x by
+    ///        binary search
+    ///
+    /// \pre \p x < 2^width, and \p width is a power of two
+    inline constexpr
+    int countl_zero_search(std::uint64_t x, int width)
+      noexcept
+    {
+      return (width == 1)
+        ? static_cast<int>(x == 0u)
+        : ((x >> (width / 2)) != 0u)
+          ? countl_zero_search(x >> (width / 2), width / 2)
+          : (width / 2) + countl_zero_search(x, width / 2);
+    }
+
+    /// \brief Counts the trailing zeros in the low \p width bits of \p x by
+    ///        binary search
+    ///
+    /// \pre \p x < 2^width, and \p width is a power of two
+    inline constexpr
+    int countr_zero_search(std::uint64_t x, int width)
+      noexcept
+    {
+      return (width == 1)
+        ? static_cast<int>(x == 0u)
+        : ((x & ((std::uint64_t{1} << (width / 2)) - 1u)) != 0u)
+          ? countr_zero_search(x & ((std::uint64_t{1} << (width / 2)) - 1u), width / 2)
+          : (width / 2) + countr_zero_search(x >> (width / 2), width / 2);
+    }
+
+#endif // !BPSTD_HAS_BIT_BUILTINS
+
+    inline BPSTD_INLINE_VISIBILITY constexpr
+    int popcount64(std::uint64_t x)
+      noexcept
+    {
+#if BPSTD_HAS_BIT_BUILTINS
+      return __builtin_popcountll(x);
+#else
+      return popcount64_pairs(x - ((x >> 1u) & 0x5555555555555555ull));
+#endif
+    }
+
+    inline BPSTD_INLINE_VISIBILITY constexpr
+    int countl_zero64(std::uint64_t x)
+      noexcept
+    {
+#if BPSTD_HAS_BIT_BUILTINS
+      return (x == 0u) ? 64 : __builtin_clzll(x);
+#else
+      return countl_zero_search(x, 64);
+#endif
+    }
+
+    inline BPSTD_INLINE_VISIBILITY constexpr
+    int countr_zero64(std::uint64_t x)
+      noexcept
+    {
+#if BPSTD_HAS_BIT_BUILTINS
+      return (x == 0u) ? 64 : __builtin_ctzll(x);
+#else
+      return countr_zero_search(x, 64);
+#endif
+    }
+
+    inline BPSTD_INLINE_VISIBILITY constexpr
+    std::uint16_t byteswap16(std::uint16_t x)
+      noexcept
+    {
+#if BPSTD_HAS_BIT_BUILTINS
+      return __builtin_bswap16(x);
+#else
+      return static_cast<std::uint16_t>((x << 8u) | (x >> 8u));
+#endif
+    }
+
+    inline BPSTD_INLINE_VISIBILITY constexpr
+    std::uint32_t byteswap32(std::uint32_t x)
+      noexcept
+    {
+#if BPSTD_HAS_BIT_BUILTINS
+      return __builtin_bswap32(x);
+#else
+      return (static_cast<std::uint32_t>(byteswap16(static_cast<std::uint16_t>(x))) << 16u)
+           | byteswap16(static_cast<std::uint16_t>(x >> 16u));
+#endif
+    }
+
+    inline BPSTD_INLINE_VISIBILITY constexpr
+    std::uint64_t byteswap64(std::uint64_t x)
+      noexcept
+    {
+#if BPSTD_HAS_BIT_BUILTINS
+      return __builtin_bswap64(x);
+#else
+      return (static_cast<std::uint64_t>(byteswap32(static_cast<std::uint32_t>(x))) << 32u)
+           | byteswap32(static_cast<std::uint32_t>(x >> 32u));
+#endif
+    }
+
+    // Dispatches byteswap by the size of the type, operating on the unsigned
+    // representation so that the shifts are well-defined
+
+    template <typename T>
+    inline BPSTD_INLINE_VISIBILITY constexpr
+    T byteswap_impl(T x, integral_constant<std::size_t,1u>)
+      noexcept
+    {
+      return x;
+    }
+
+    template <typename T>
+    inline BPSTD_INLINE_VISIBILITY constexpr
+    T byteswap_impl(T x, integral_constant<std::size_t,2u>)
+      noexcept
+    {
+      return static_cast<T>(byteswap16(static_cast<std::uint16_t>(x)));
+    }
+
+    template <typename T>
+    inline BPSTD_INLINE_VISIBILITY constexpr
+    T byteswap_impl(T x, integral_constant<std::size_t,4u>)
+      noexcept
+    {
+      return static_cast<T>(byteswap32(static_cast<std::uint32_t>(x)));
+    }
+
+    template <typename T>
+    inline BPSTD_INLINE_VISIBILITY constexpr
+    T byteswap_impl(T x, integral_constant<std::size_t,8u>)
+      noexcept
+    {
+      return static_cast<T>(byteswap64(static_cast<std::uint64_t>(x)));
+    }
+
+    /// \brief Rotates \p x left by \p r, where \p r is in [0, digits)
+    template <typename T>
+    inline BPSTD_INLINE_VISIBILITY constexpr
+    T rotl_impl(T x, int r)
+      noexcept
+    {
+      return (r == 0)
+        ? x
+        : static_cast<T>(
+            (x << r) | (x >> (std::numeric_limits<T>::digits - r))
+          );
+    }
+
+  } // namespace detail
+} // namespace bpstd
+
+//==============================================================================
+// definitions : non-member functions
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Casting
+//------------------------------------------------------------------------------
+
+template <typename To, typename From>
+inline BPSTD_INLINE_VISIBILITY BPSTD_BIT_CAST_CONSTEXPR
+bpstd::enable_if_t<
+  (sizeof(To) == sizeof(From))
+#if BPSTD_HAS_TRIVIAL_TYPE_TRAITS
+  && bpstd::is_trivially_copyable<To>::value
+  && bpstd::is_trivially_copyable<From>::value
+#endif
+  ,To
+> bpstd::bit_cast(const From& from)
+  noexcept
+{
+#if BPSTD_HAS_BUILTIN_BIT_CAST
+  return __builtin_bit_cast(To, from);
+#else
+  auto to = To{};
+  std::memcpy(&to, &from, sizeof(to));
+  return to;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Byte Ordering
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::enable_if_t<bpstd::is_integral<T>::value,T>
+  bpstd::byteswap(T value)
+  noexcept
+{
+  return detail::byteswap_impl(
+    value,
+    integral_constant<std::size_t,sizeof(T)>{}
+  );
+}
+
+//------------------------------------------------------------------------------
+// Integral Powers of 2
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::detail::bit_integer_bool_t<T> bpstd::has_single_bit(T x)
+  noexcept
+{
+  return x != 0u && (x & static_cast<T>(x - 1u)) == 0u;
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::detail::bit_integer_t<T> bpstd::bit_ceil(T x)
+  noexcept
+{
+  return (x <= 1u)
+    ? static_cast<T>(1u)
+    : static_cast<T>(T{1u} << bit_width(static_cast<T>(x - 1u)));
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::detail::bit_integer_t<T> bpstd::bit_floor(T x)
+  noexcept
+{
+  return (x == 0u)
+    ? static_cast<T>(0u)
+    : static_cast<T>(T{1u} << (bit_width(x) - 1));
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::detail::bit_integer_int_t<T> bpstd::bit_width(T x)
+  noexcept
+{
+  return std::numeric_limits<T>::digits - countl_zero(x);
+}
+
+//------------------------------------------------------------------------------
+// Rotating
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::detail::bit_integer_t<T> bpstd::rotl(T x, int s)
+  noexcept
+{
+  // 'r' is computed in [0, digits) for both signs of 's', so that negative
+  // rotations never shift by a negative amount
+  return detail::rotl_impl(
+    x,
+    ((s % std::numeric_limits<T>::digits) + std::numeric_limits<T>::digits)
+      % std::numeric_limits<T>::digits
+  );
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::detail::bit_integer_t<T> bpstd::rotr(T x, int s)
+  noexcept
+{
+  return detail::rotl_impl(
+    x,
+    (std::numeric_limits<T>::digits - (s % std::numeric_limits<T>::digits))
+      % std::numeric_limits<T>::digits
+  );
+}
+
+//------------------------------------------------------------------------------
+// Counting
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::detail::bit_integer_int_t<T> bpstd::countl_zero(T x)
+  noexcept
+{
+  return detail::countl_zero64(x) - (64 - std::numeric_limits<T>::digits);
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::detail::bit_integer_int_t<T> bpstd::countl_one(T x)
+  noexcept
+{
+  return countl_zero(static_cast<T>(~x));
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::detail::bit_integer_int_t<T> bpstd::countr_zero(T x)
+  noexcept
+{
+  return (x == 0u)
+    ? std::numeric_limits<T>::digits
+    : detail::countr_zero64(x);
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::detail::bit_integer_int_t<T> bpstd::countr_one(T x)
+  noexcept
+{
+  return countr_zero(static_cast<T>(~x));
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::detail::bit_integer_int_t<T> bpstd::popcount(T x)
+  noexcept
+{
+  return detail::popcount64(x);
+}
+
+//==============================================================================
+// definitions : non-member functions : enum class : byte
+//==============================================================================
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::has_single_bit(byte x)
+  noexcept
+{
+  return has_single_bit(static_cast<unsigned char>(x));
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::byte bpstd::bit_ceil(byte x)
+  noexcept
+{
+  return static_cast<byte>(bit_ceil(static_cast<unsigned char>(x)));
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::byte bpstd::bit_floor(byte x)
+  noexcept
+{
+  return static_cast<byte>(bit_floor(static_cast<unsigned char>(x)));
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+int bpstd::bit_width(byte x)
+  noexcept
+{
+  return bit_width(static_cast<unsigned char>(x));
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::byte bpstd::rotl(byte x, int s)
+  noexcept
+{
+  return static_cast<byte>(rotl(static_cast<unsigned char>(x), s));
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::byte bpstd::rotr(byte x, int s)
+  noexcept
+{
+  return static_cast<byte>(rotr(static_cast<unsigned char>(x), s));
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+int bpstd::countl_zero(byte x)
+  noexcept
+{
+  return countl_zero(static_cast<unsigned char>(x));
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+int bpstd::countl_one(byte x)
+  noexcept
+{
+  return countl_one(static_cast<unsigned char>(x));
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+int bpstd::countr_zero(byte x)
+  noexcept
+{
+  return countr_zero(static_cast<unsigned char>(x));
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+int bpstd::countr_one(byte x)
+  noexcept
+{
+  return countr_one(static_cast<unsigned char>(x));
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+int bpstd::popcount(byte x)
+  noexcept
+{
+  return popcount(static_cast<unsigned char>(x));
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_BIT_HPP */
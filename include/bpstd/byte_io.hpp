@@ -0,0 +1,917 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file byte_io.hpp
+///
+/// \brief This header provides readers and writers of binary data over spans
+///        of bytes
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_BYTE_IO_HPP
+#define BPSTD_BYTE_IO_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/config.hpp"
+#include "bit.hpp"         // endian, byteswap, bit_cast, bit_width
+#include "cstddef.hpp"     // byte
+#include "span.hpp"        // span
+#include "type_traits.hpp" // enable_if_t, is_integral, is_signed, ...
+
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint8_t, std::uint16_t, std::int64_t, ...
+#include <cstring> // std::memcpy
+#include <limits>  // std::numeric_limits
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+  namespace detail {
+
+    /// \brief Type-trait to determine whether \p T may be read or written as
+    ///        a fixed-width value
+    ///
+    /// This is any integer other than bool, or a float or double
+    template <typename T>
+    struct is_byte_io_value
+      : bool_constant<
+          (is_integral<T>::value && !is_same<remove_cv_t<T>,bool>::value) ||
+          (is_floating_point<T>::value &&
+            (sizeof(T) == sizeof(std::uint32_t) || sizeof(T) == sizeof(std::uint64_t)))
+        >{};
+
+    /// \brief Type-trait to determine whether \p T may be read or written as
+    ///        a LEB128 variable-length integer
+    template <typename T>
+    struct is_byte_io_varint
+      : bool_constant<
+          is_integral<T>::value && !is_same<remove_cv_t<T>,bool>::value &&
+          (sizeof(T) <= sizeof(std::uint64_t))
+        >{};
+
+    template <std::size_t Size>
+    struct byte_io_uint;
+
+    template <>
+    struct byte_io_uint<1u>{ using type = std::uint8_t; };
+    template <>
+    struct byte_io_uint<2u>{ using type = std::uint16_t; };
+    template <>
+    struct byte_io_uint<4u>{ using type = std::uint32_t; };
+    template <>
+    struct byte_io_uint<8u>{ using type = std::uint64_t; };
+
+    /// \brief The unsigned type with the same size as \p T, used to reorder
+    ///        the bytes of \p T
+    template <typename T>
+    using byte_io_uint_t = typename byte_io_uint<sizeof(T)>::type;
+
+    /// \brief Copies \p size bytes from \p source to \p destination
+    ///
+    /// This is std::memcpy for the fixed-width copies; it is the one place
+    /// where GCC's bogus bounds diagnostics about them are silenced.
+    void copy_bytes(void* destination,
+                    const void* source,
+                    std::size_t size) noexcept;
+
+    template <typename T>
+    T load_value(const byte* p, endian order) noexcept;
+
+    template <typename T>
+    void store_value(byte* p, T value, endian order) noexcept;
+
+    /// \brief Computes the number of bytes in the LEB128 encoding of \p value
+    template <typename T>
+    constexpr std::size_t leb128_size(T value, false_type) noexcept;
+    template <typename T>
+    constexpr std::size_t leb128_size(T value, true_type) noexcept;
+
+    /// \brief Writes the low \p size 7-bit groups of \p value as LEB128
+    ///
+    /// \param p the destination, which must have room for \p size bytes
+    /// \param value the two's complement bits of the value to encode
+    /// \param size the number of bytes to encode
+    /// \param negative whether the encoded value is negative
+    void store_leb128(byte* p,
+                      std::uint64_t value,
+                      std::size_t size,
+                      bool negative) noexcept;
+
+  } // namespace detail
+
+  //============================================================================
+  // constants : max_varint_size
+  //============================================================================
+
+  /// \brief The maximum number of bytes in the LEB128 encoding of \p T
+  template <typename T>
+  struct max_varint_size
+    : integral_constant<
+        std::size_t,
+        (std::numeric_limits<T>::digits + (is_signed<T>::value ? 1 : 0) + 6) / 7
+      >{};
+
+  //============================================================================
+  // class : byte_reader
+  //============================================================================
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief A cursor that decodes binary data from a span of bytes
+  ///
+  /// Each checked read verifies that enough bytes remain, and leaves the
+  /// reader unchanged when they don't. Decoding several fixed-width values
+  /// may instead check once with `can_read`, and then use the `_unchecked`
+  /// reads, which only require that the precondition was established.
+  ///
+  /// Floating-point values are read as the bits of their IEEE-754
+  /// representation in the given byte order.
+  //////////////////////////////////////////////////////////////////////////////
+  class byte_reader
+  {
+    //--------------------------------------------------------------------------
+    // Public Member Types
+    //--------------------------------------------------------------------------
+  public:
+
+    using size_type = std::size_t;
+
+    //--------------------------------------------------------------------------
+    // Constructors
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs a reader over no bytes
+    constexpr byte_reader() noexcept;
+
+    /// \brief Constructs a reader over \p bytes
+    ///
+    /// \param bytes the bytes to read
+    constexpr explicit byte_reader(span<const byte> bytes) noexcept;
+
+    constexpr byte_reader(const byte_reader& other) noexcept = default;
+
+    BPSTD_CPP14_CONSTEXPR byte_reader& operator=(const byte_reader& other) noexcept = default;
+
+    //--------------------------------------------------------------------------
+    // Observers
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets the number of bytes that have been read
+    constexpr size_type position() const noexcept;
+
+    /// \brief Gets the number of bytes left to read
+    constexpr size_type remaining() const noexcept;
+
+    /// \brief Checks whether all bytes have been read
+    constexpr bool empty() const noexcept;
+
+    /// \brief Checks whether at least \p n bytes are left to read
+    constexpr bool can_read(size_type n) const noexcept;
+
+    /// \brief Gets a view of the bytes left to read
+    constexpr span<const byte> remaining_bytes() const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Fixed-width Reads
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Reads a \p T in the byte \p order into \p value
+    ///
+    /// \param value the value to read into
+    /// \param order the byte order of the encoded value
+    /// \return true on success, or false if too few bytes remain
+    template <typename T>
+    enable_if_t<detail::is_byte_io_value<T>::value,bool>
+      read(T& value, endian order) noexcept;
+
+    /// \brief Reads `values.size()` contiguous \p T values in the byte
+    ///        \p order
+    ///
+    /// \param values the values to read into
+    /// \param order the byte order of the encoded values
+    /// \return true on success, or false if too few bytes remain
+    template <typename T>
+    enable_if_t<detail::is_byte_io_value<T>::value,bool>
+      read(span<T> values, endian order) noexcept;
+
+    /// \brief Reads a \p T in the byte \p order
+    ///
+    /// \pre `can_read(sizeof(T))`
+    /// \param order the byte order of the encoded value
+    /// \return the value
+    template <typename T>
+    enable_if_t<detail::is_byte_io_value<T>::value,T>
+      read_unchecked(endian order) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Variable-length Reads
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Reads a LEB128-encoded integer into \p value
+    ///
+    /// Unsigned types are read as unsigned LEB128, and signed types as
+    /// signed LEB128.
+    ///
+    /// \param value the value to read into
+    /// \return true on success, or false if too few bytes remain, or if the
+    ///         encoded value does not fit in \p T
+    template <typename T>
+    enable_if_t<detail::is_byte_io_varint<T>::value,bool>
+      read_varint(T& value) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Byte Reads
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Views the next \p n bytes without copying them
+    ///
+    /// \param n the number of bytes to read
+    /// \param bytes the span to set to the read bytes
+    /// \return true on success, or false if too few bytes remain
+    bool read_bytes(size_type n, span<const byte>& bytes) noexcept;
+
+    /// \brief Copies the next `bytes.size()` bytes into \p bytes
+    ///
+    /// \param bytes the destination of the read bytes
+    /// \return true on success, or false if too few bytes remain
+    bool read_bytes(span<byte> bytes) noexcept;
+
+    /// \brief Skips the next \p n bytes
+    ///
+    /// \param n the number of bytes to skip
+    /// \return true on success, or false if too few bytes remain
+    bool skip(size_type n) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Member Functions
+    //--------------------------------------------------------------------------
+  private:
+
+    template <typename T>
+    bool read_varint(T& value, false_type) noexcept;
+    template <typename T>
+    bool read_varint(T& value, true_type) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Members
+    //--------------------------------------------------------------------------
+  private:
+
+    const byte* m_first;
+    const byte* m_current;
+    const byte* m_last;
+  };
+
+  //============================================================================
+  // class : byte_writer
+  //============================================================================
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief A cursor that encodes binary data into a span of bytes
+  ///
+  /// Each checked write verifies that enough room remains, and leaves the
+  /// writer unchanged when it doesn't. Encoding several fixed-width values
+  /// may instead check once with `can_write`, and then use the `_unchecked`
+  /// writes, which only require that the precondition was established.
+  ///
+  /// Floating-point values are written as the bits of their IEEE-754
+  /// representation in the given byte order.
+  //////////////////////////////////////////////////////////////////////////////
+  class byte_writer
+  {
+    //--------------------------------------------------------------------------
+    // Public Member Types
+    //--------------------------------------------------------------------------
+  public:
+
+    using size_type = std::size_t;
+
+    //--------------------------------------------------------------------------
+    // Constructors
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs a writer with no room to write
+    constexpr byte_writer() noexcept;
+
+    /// \brief Constructs a writer over \p bytes
+    ///
+    /// \param bytes the bytes to write
+    constexpr explicit byte_writer(span<byte> bytes) noexcept;
+
+    constexpr byte_writer(const byte_writer& other) noexcept = default;
+
+    BPSTD_CPP14_CONSTEXPR byte_writer& operator=(const byte_writer& other) noexcept = default;
+
+    //--------------------------------------------------------------------------
+    // Observers
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets the number of bytes that have been written
+    constexpr size_type position() const noexcept;
+
+    /// \brief Gets the number of bytes left to write
+    constexpr size_type remaining() const noexcept;
+
+    /// \brief Checks whether there is room for at least \p n bytes
+    constexpr bool can_write(size_type n) const noexcept;
+
+    /// \brief Gets a view of the bytes that have been written
+    constexpr span<byte> written_bytes() const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Fixed-width Writes
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Writes \p value in the byte \p order
+    ///
+    /// \param value the value to write
+    /// \param order the byte order to encode the value in
+    /// \return true on success, or false if too little room remains
+    template <typename T>
+    enable_if_t<detail::is_byte_io_value<T>::value,bool>
+      write(T value, endian order) noexcept;
+
+    /// \brief Writes the contiguous \p values in the byte \p order
+    ///
+    /// \param values the values to write
+    /// \param order the byte order to encode the values in
+    /// \return true on success, or false if too little room remains
+    template <typename T>
+    enable_if_t<detail::is_byte_io_value<T>::value,bool>
+      write(span<T> values, endian order) noexcept;
+
+    /// \brief Writes \p value in the byte \p order
+    ///
+    /// \pre `can_write(sizeof(T))`
+    /// \param value the value to write
+    /// \param order the byte order to encode the value in
+    template <typename T>
+    enable_if_t<detail::is_byte_io_value<T>::value>
+      write_unchecked(T value, endian order) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Variable-length Writes
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Writes \p value as a LEB128-encoded integer
+    ///
+    /// Unsigned types are written as unsigned LEB128, and signed types as
+    /// signed LEB128.
+    ///
+    /// \param value the value to write
+    /// \return true on success, or false if too little room remains
+    template <typename T>
+    enable_if_t<detail::is_byte_io_varint<T>::value,bool>
+      write_varint(T value) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Byte Writes
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Copies \p bytes into the output
+    ///
+    /// \param bytes the bytes to write
+    /// \return true on success, or false if too little room remains
+    bool write_bytes(span<const byte> bytes) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Members
+    //--------------------------------------------------------------------------
+  private:
+
+    byte* m_first;
+    byte* m_current;
+    byte* m_last;
+  };
+
+} // namespace bpstd
+
+//==============================================================================
+// definitions : detail
+//==============================================================================
+
+// GCC 12 at -O2 and above reports -Warray-bounds and -Wstringop-overflow
+// (meta-bugs 56456 and 88443) for this copy when a checked read or write of a
+// fixed-width value, whose bounds check has failed, is inlined into a caller
+// with a shorter array; the copy is unreachable on that path.
+#if defined(__GNUC__) && !defined(__clang__)
+# pragma GCC diagnostic push
+# pragma GCC diagnostic ignored "-Warray-bounds"
+# pragma GCC diagnostic ignored "-Wstringop-overflow"
+#endif
+
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::detail::copy_bytes(void* destination,
+                               const void* source,
+                               std::size_t size)
+  noexcept
+{
+  std::memcpy(destination, source, size);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+# pragma GCC diagnostic pop
+#endif
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+T bpstd::detail::load_value(const byte* p, endian order)
+  noexcept
+{
+  auto bits = byte_io_uint_t<T>{};
+  copy_bytes(&bits, p, sizeof(bits));
+  if (order != endian::native) {
+    bits = byteswap(bits);
+  }
+  return bit_cast<T>(bits);
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::detail::store_value(byte* p, T value, endian order)
+  noexcept
+{
+  auto bits = bit_cast<byte_io_uint_t<T>>(value);
+  if (order != endian::native) {
+    bits = byteswap(bits);
+  }
+  copy_bytes(p, &bits, sizeof(bits));
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+std::size_t bpstd::detail::leb128_size(T value, false_type)
+  noexcept
+{
+  return static_cast<std::size_t>(
+    (bit_width(static_cast<std::uint64_t>(value) | 1u) + 6) / 7
+  );
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+std::size_t bpstd::detail::leb128_size(T value, true_type)
+  noexcept
+{
+  // Every value needs room for its sign bit, which for negative values is
+  // found from the width of the complement
+  return static_cast<std::size_t>(
+    (bit_width(static_cast<std::uint64_t>(value < 0 ? ~value : value)) + 7) / 7
+  );
+}
+
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::detail::store_leb128(byte* p,
+                                 std::uint64_t value,
+                                 std::size_t size,
+                                 bool negative)
+  noexcept
+{
+  // Shifting in the sign keeps the 10th byte of a negative 64-bit value
+  // sign-extended, rather than holding only the top bit
+  const auto fill = negative ? ~(~std::uint64_t{0u} >> 7u) : std::uint64_t{0u};
+
+  for (auto i = std::size_t{1u}; i < size; ++i) {
+    *p++ = static_cast<byte>((value & 0x7fu) | 0x80u);
+    value = (value >> 7u) | fill;
+  }
+  *p = static_cast<byte>(value & 0x7fu);
+}
+
+//==============================================================================
+// definitions : class : byte_reader
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::byte_reader::byte_reader()
+  noexcept
+  : m_first{nullptr},
+    m_current{nullptr},
+    m_last{nullptr}
+{
+
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::byte_reader::byte_reader(span<const byte> bytes)
+  noexcept
+  : m_first{bytes.data()},
+    m_current{bytes.data()},
+    m_last{bytes.data() + bytes.size()}
+{
+
+}
+
+//------------------------------------------------------------------------------
+// Observers
+//------------------------------------------------------------------------------
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::byte_reader::size_type bpstd::byte_reader::position()
+  const noexcept
+{
+  return static_cast<size_type>(m_current - m_first);
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::byte_reader::size_type bpstd::byte_reader::remaining()
+  const noexcept
+{
+  return static_cast<size_type>(m_last - m_current);
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::byte_reader::empty()
+  const noexcept
+{
+  return m_current == m_last;
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::byte_reader::can_read(size_type n)
+  const noexcept
+{
+  return n <= remaining();
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::span<const bpstd::byte> bpstd::byte_reader::remaining_bytes()
+  const noexcept
+{
+  return span<const byte>{m_current, remaining()};
+}
+
+//------------------------------------------------------------------------------
+// Fixed-width Reads
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::enable_if_t<bpstd::detail::is_byte_io_value<T>::value,bool>
+  bpstd::byte_reader::read(T& value, endian order)
+  noexcept
+{
+  if (!can_read(sizeof(T))) {
+    return false;
+  }
+  value = read_unchecked<T>(order);
+  return true;
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::enable_if_t<bpstd::detail::is_byte_io_value<T>::value,bool>
+  bpstd::byte_reader::read(span<T> values, endian order)
+  noexcept
+{
+  if (values.size() > remaining() / sizeof(T)) {
+    return false;
+  }
+  // The values are copied in bulk, and only reordered afterwards if needed
+  const auto size = values.size() * sizeof(T);
+  if (size != 0u) {
+    detail::copy_bytes(values.data(), m_current, size);
+  }
+  m_current += size;
+
+  if (order != endian::native && sizeof(T) > 1u) {
+    for (auto& value : values) {
+      value = bit_cast<T>(byteswap(bit_cast<detail::byte_io_uint_t<T>>(value)));
+    }
+  }
+  return true;
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::enable_if_t<bpstd::detail::is_byte_io_value<T>::value,T>
+  bpstd::byte_reader::read_unchecked(endian order)
+  noexcept
+{
+  const auto value = detail::load_value<T>(m_current, order);
+  m_current += sizeof(T);
+  return value;
+}
+
+//------------------------------------------------------------------------------
+// Variable-length Reads
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::enable_if_t<bpstd::detail::is_byte_io_varint<T>::value,bool>
+  bpstd::byte_reader::read_varint(T& value)
+  noexcept
+{
+  return read_varint(value, is_signed<T>{});
+}
+
+//------------------------------------------------------------------------------
+// Byte Reads
+//------------------------------------------------------------------------------
+
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::byte_reader::read_bytes(size_type n, span<const byte>& bytes)
+  noexcept
+{
+  if (!can_read(n)) {
+    return false;
+  }
+  bytes = span<const byte>{m_current, n};
+  m_current += n;
+  return true;
+}
+
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::byte_reader::read_bytes(span<byte> bytes)
+  noexcept
+{
+  if (!can_read(bytes.size())) {
+    return false;
+  }
+  if (!bytes.empty()) {
+    std::memcpy(bytes.data(), m_current, bytes.size());
+  }
+  m_current += bytes.size();
+  return true;
+}
+
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::byte_reader::skip(size_type n)
+  noexcept
+{
+  if (!can_read(n)) {
+    return false;
+  }
+  m_current += n;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// Private Member Functions
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline
+bool bpstd::byte_reader::read_varint(T& value, false_type)
+  noexcept
+{
+  constexpr auto max_size = max_varint_size<T>::value;
+  constexpr auto digits = std::numeric_limits<T>::digits;
+
+  // Bounds are checked once up front, rather than for each byte
+  const auto size = remaining() < max_size ? remaining() : max_size;
+
+  auto result = std::uint64_t{0u};
+  for (auto i = std::size_t{0u}; i < size; ++i) {
+    const auto b = static_cast<unsigned char>(m_current[i]);
+    const auto shift = static_cast<int>(i * 7u);
+
+    result |= static_cast<std::uint64_t>(b & 0x7fu) << shift;
+    if ((b & 0x80u) == 0u) {
+      // Only the final group may hold bits beyond the width of 'T'
+      if (i + 1u == max_size && ((b & 0x7fu) >> (digits - shift)) != 0u) {
+        return false;
+      }
+      value = static_cast<T>(result);
+      m_current += i + 1u;
+      return true;
+    }
+  }
+  return false;
+}
+
+template <typename T>
+inline
+bool bpstd::byte_reader::read_varint(T& value, true_type)
+  noexcept
+{
+  using limits = std::numeric_limits<T>;
+
+  constexpr auto max_size = max_varint_size<T>::value;
+
+  // Bounds are checked once up front, rather than for each byte
+  const auto size = remaining() < max_size ? remaining() : max_size;
+
+  auto result = std::uint64_t{0u};
+  for (auto i = std::size_t{0u}; i < size; ++i) {
+    const auto b = static_cast<unsigned char>(m_current[i]);
+    const auto shift = static_cast<int>(i * 7u);
+
+    result |= static_cast<std::uint64_t>(b & 0x7fu) << shift;
+    if ((b & 0x80u) == 0u) {
+      if (shift + 7 < 64 && (b & 0x40u) != 0u) {
+        result |= ~std::uint64_t{0u} << (shift + 7);
+      }
+      if (sizeof(T) == sizeof(std::uint64_t)) {
+        // The 10th byte holds only the sign bit, so the rest must match it
+        if (i + 1u == max_size && (b & 0x7fu) != 0u && (b & 0x7fu) != 0x7fu) {
+          return false;
+        }
+      } else {
+        const auto signed_result = static_cast<std::int64_t>(result);
+        if (signed_result < limits::min() || signed_result > limits::max()) {
+          return false;
+        }
+      }
+      value = static_cast<T>(result);
+      m_current += i + 1u;
+      return true;
+    }
+  }
+  return false;
+}
+
+//==============================================================================
+// definitions : class : byte_writer
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::byte_writer::byte_writer()
+  noexcept
+  : m_first{nullptr},
+    m_current{nullptr},
+    m_last{nullptr}
+{
+
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::byte_writer::byte_writer(span<byte> bytes)
+  noexcept
+  : m_first{bytes.data()},
+    m_current{bytes.data()},
+    m_last{bytes.data() + bytes.size()}
+{
+
+}
+
+//------------------------------------------------------------------------------
+// Observers
+//------------------------------------------------------------------------------
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::byte_writer::size_type bpstd::byte_writer::position()
+  const noexcept
+{
+  return static_cast<size_type>(m_current - m_first);
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::byte_writer::size_type bpstd::byte_writer::remaining()
+  const noexcept
+{
+  return static_cast<size_type>(m_last - m_current);
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::byte_writer::can_write(size_type n)
+  const noexcept
+{
+  return n <= remaining();
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::span<bpstd::byte> bpstd::byte_writer::written_bytes()
+  const noexcept
+{
+  return span<byte>{m_first, position()};
+}
+
+//------------------------------------------------------------------------------
+// Fixed-width Writes
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::enable_if_t<bpstd::detail::is_byte_io_value<T>::value,bool>
+  bpstd::byte_writer::write(T value, endian order)
+  noexcept
+{
+  if (!can_write(sizeof(T))) {
+    return false;
+  }
+  write_unchecked(value, order);
+  return true;
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::enable_if_t<bpstd::detail::is_byte_io_value<T>::value,bool>
+  bpstd::byte_writer::write(span<T> values, endian order)
+  noexcept
+{
+  if (values.size() > remaining() / sizeof(T)) {
+    return false;
+  }
+  if (order == endian::native || sizeof(T) == 1u) {
+    const auto size = values.size() * sizeof(T);
+    if (size != 0u) {
+      std::memcpy(m_current, values.data(), size);
+    }
+    m_current += size;
+  } else {
+    for (const auto& value : values) {
+      write_unchecked(value, order);
+    }
+  }
+  return true;
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::enable_if_t<bpstd::detail::is_byte_io_value<T>::value>
+  bpstd::byte_writer::write_unchecked(T value, endian order)
+  noexcept
+{
+  detail::store_value(m_current, value, order);
+  m_current += sizeof(T);
+}
+
+//------------------------------------------------------------------------------
+// Variable-length Writes
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::enable_if_t<bpstd::detail::is_byte_io_varint<T>::value,bool>
+  bpstd::byte_writer::write_varint(T value)
+  noexcept
+{
+  // The encoded size is computed up front, so that the bounds are checked
+  // once rather than for each byte
+  const auto size = detail::leb128_size(value, is_signed<T>{});
+  if (!can_write(size)) {
+    return false;
+  }
+  detail::store_leb128(
+    m_current,
+    static_cast<std::uint64_t>(value),
+    size,
+    is_signed<T>::value && static_cast<std::int64_t>(value) < 0
+  );
+  m_current += size;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// Byte Writes
+//------------------------------------------------------------------------------
+
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::byte_writer::write_bytes(span<const byte> bytes)
+  noexcept
+{
+  if (!can_write(bytes.size())) {
+    return false;
+  }
+  if (!bytes.empty()) {
+    std::memcpy(m_current, bytes.data(), bytes.size());
+  }
+  m_current += bytes.size();
+  return true;
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_BYTE_IO_HPP */
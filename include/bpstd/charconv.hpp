@@ -0,0 +1,1533 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file charconv.hpp
+///
+/// \brief This header provides definitions from the C++ header <charconv>
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_CHARCONV_HPP
+#define BPSTD_CHARCONV_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/config.hpp"
+#include "detail/charconv_float.hpp" // to_shortest_decimal, compute_float, ...
+
+#include "span.hpp"        // span
+#include "string_view.hpp" // string_view
+#include "type_traits.hpp" // enable_if_t, conditional_t, is_integral, ...
+
+#include <cfloat>       // FLT_EVAL_METHOD
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint32_t, std::uint64_t, std::int64_t
+#include <cstring>      // std::memset
+#include <limits>       // std::numeric_limits
+#include <system_error> // std::errc
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+
+  //============================================================================
+  // enum class : chars_format
+  //============================================================================
+
+  /// \brief A bitmask type that specifies the format of floating-point
+  ///        conversions
+  enum class chars_format
+  {
+    scientific = 0x1,               ///< [-]d.ddde+dd
+    fixed      = 0x2,               ///< [-]ddd.ddd
+    hex        = 0x4,               ///< [-]h.hhhp+d, without any "0x" prefix
+    general    = fixed | scientific ///< fixed or scientific, as by printf's %g
+  };
+
+  constexpr chars_format operator|(chars_format lhs, chars_format rhs) noexcept;
+  constexpr chars_format operator&(chars_format lhs, chars_format rhs) noexcept;
+  constexpr chars_format operator^(chars_format lhs, chars_format rhs) noexcept;
+  constexpr chars_format operator~(chars_format f) noexcept;
+
+  //============================================================================
+  // struct : to_chars_result
+  //============================================================================
+
+  /// \brief The result of a call to to_chars
+  struct to_chars_result
+  {
+    char* ptr;    ///< One past the last character written
+    std::errc ec; ///< The error, or a value-initialized std::errc on success
+  };
+
+  //============================================================================
+  // struct : from_chars_result
+  //============================================================================
+
+  /// \brief The result of a call to from_chars
+  struct from_chars_result
+  {
+    const char* ptr; ///< The first character not matching the pattern
+    std::errc ec;    ///< The error, or a value-initialized std::errc on success
+  };
+
+  namespace detail {
+
+    /// \brief Type-trait to determine whether \p T is an integer type that
+    ///        may be used with to_chars/from_chars
+    template <typename T>
+    struct is_charconv_integer
+      : bool_constant<
+          is_integral<T>::value && !is_same<remove_cv_t<T>,bool>::value
+        >{};
+
+    /// \brief The unsigned type used to perform conversions for \p T
+    ///
+    /// All types at most 32 bits wide share a single 32-bit implementation,
+    /// which keeps the arithmetic in native registers and the number of
+    /// instantiations small.
+    template <typename T>
+    using charconv_uint_t = conditional_t<
+      (sizeof(T) <= sizeof(std::uint32_t)),
+      std::uint32_t,
+      std::uint64_t
+    >;
+
+    template <typename = void>
+    struct charconv_tables
+    {
+      /// All two-digit decimal numbers, so that formatting can emit two
+      /// digits per division
+      static constexpr char digit_pairs[201] =
+        "0001020304050607080910111213141516171819"
+        "2021222324252627282930313233343536373839"
+        "4041424344454647484950515253545556575859"
+        "6061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+
+      static constexpr char digits[37] = "0123456789abcdefghijklmnopqrstuvwxyz";
+    };
+
+    template <typename T>
+    constexpr char charconv_tables<T>::digit_pairs[201];
+
+    template <typename T>
+    constexpr char charconv_tables<T>::digits[37];
+
+    //--------------------------------------------------------------------------
+    // Formatting
+    //--------------------------------------------------------------------------
+
+    /// \brief Counts the number of decimal digits in \p value
+    template <typename UInt>
+    BPSTD_CPP14_CONSTEXPR int count_digits10(UInt value) noexcept;
+
+    /// \brief Counts the number of digits in \p value in base 2^\p shift
+    template <typename UInt>
+    BPSTD_CPP14_CONSTEXPR int count_digits_pow2(UInt value, int shift) noexcept;
+
+    /// \brief Counts the number of digits in \p value in base \p base
+    template <typename UInt>
+    BPSTD_CPP14_CONSTEXPR int count_digits(UInt value, UInt base) noexcept;
+
+    /// \brief Writes \p value in base \p base to the range ending at \p last,
+    ///        which must be large enough to hold every digit
+    template <typename UInt>
+    BPSTD_CPP14_CONSTEXPR void write_digits(char* last, UInt value, int base) noexcept;
+
+    /// \brief Formats the unsigned \p value into [first, last)
+    template <typename UInt>
+    BPSTD_CPP14_CONSTEXPR
+    to_chars_result to_chars_unsigned(char* first, char* last,
+                                      UInt value, int base) noexcept;
+
+    template <typename T>
+    BPSTD_CPP14_CONSTEXPR
+    to_chars_result to_chars_integer(char* first, char* last,
+                                     T value, int base, true_type) noexcept;
+    template <typename T>
+    BPSTD_CPP14_CONSTEXPR
+    to_chars_result to_chars_integer(char* first, char* last,
+                                     T value, int base, false_type) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Parsing
+    //--------------------------------------------------------------------------
+
+    /// \brief Gets the numeric value of the digit \p c in any base up to 36,
+    ///        or a value of at least 36 if \p c is not a digit
+    constexpr unsigned char_to_digit(char c) noexcept;
+
+    /// \brief Parses an unsigned magnitude no larger than \p max from
+    ///        [first, last)
+    ///
+    /// On success \p value is assigned; on error it is left untouched.
+    template <typename UInt>
+    BPSTD_CPP14_CONSTEXPR
+    from_chars_result from_chars_unsigned(const char* first, const char* last,
+                                          UInt& value, UInt max,
+                                          int base) noexcept;
+
+    template <typename T>
+    BPSTD_CPP14_CONSTEXPR
+    from_chars_result from_chars_integer(const char* first, const char* last,
+                                         T& value, int base, true_type) noexcept;
+    template <typename T>
+    BPSTD_CPP14_CONSTEXPR
+    from_chars_result from_chars_integer(const char* first, const char* last,
+                                         T& value, int base, false_type) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Floating-point Formatting
+    //--------------------------------------------------------------------------
+
+    /// \brief Formats \p significand * 10^(\p exponent - \p digits + 1),
+    ///        which has \p digits digits, as d.ddde+dd
+    to_chars_result write_scientific(char* first, char* last,
+                                     std::uint64_t significand,
+                                     int digits, int exponent) noexcept;
+
+    /// \brief Formats \p significand * 10^(\p exponent - \p digits + 1),
+    ///        which has \p digits digits, as ddd.ddd
+    to_chars_result write_fixed(char* first, char* last,
+                                std::uint64_t significand,
+                                int digits, int exponent) noexcept;
+
+    /// \brief Formats a finite binary floating-point value, given its stored
+    ///        significand and exponent bits, as h.hhhp+d
+    template <typename T>
+    to_chars_result write_hex(char* first, char* last,
+                              typename float_traits<T>::bits_type significand,
+                              int exponent) noexcept;
+
+    /// \brief Formats \p value in the format \p fmt, or in the shortest of
+    ///        fixed and scientific format if \p is_plain
+    template <typename T>
+    to_chars_result to_chars_float(char* first, char* last, T value,
+                                   chars_format fmt, bool is_plain) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Floating-point Parsing
+    //--------------------------------------------------------------------------
+
+    /// \brief Parses "inf", "infinity", "nan", or "nan(chars)", ignoring case
+    template <typename T>
+    from_chars_result parse_special(const char* first, const char* last,
+                                    bool negative, T& value) noexcept;
+
+    /// \brief Parses a hexadecimal floating-point number without a prefix
+    template <typename T>
+    from_chars_result parse_hex(const char* first, const char* last,
+                                bool negative, T& value) noexcept;
+
+    /// \brief Parses a decimal floating-point number in format \p fmt
+    template <typename T>
+    from_chars_result parse_decimal(const char* first, const char* last,
+                                    bool negative, T& value,
+                                    chars_format fmt) noexcept;
+
+    template <typename T>
+    from_chars_result from_chars_float(const char* first, const char* last,
+                                       T& value, chars_format fmt) noexcept;
+
+  } // namespace detail
+
+  //============================================================================
+  // non-member functions : <charconv>
+  //============================================================================
+
+  //----------------------------------------------------------------------------
+  // Formatting
+  //----------------------------------------------------------------------------
+
+  /// \brief Formats the integer \p value into the character range
+  ///        [first, last) in the given \p base
+  ///
+  /// Digits above 9 are written as lowercase letters, negative values are
+  /// prefixed with '-', and no other prefix or padding is ever written.
+  /// Unlike std::snprintf, this is independent of the current locale and
+  /// does not write a null terminator.
+  ///
+  /// \pre \p base is in the range [2, 36]
+  /// \param first the start of the output range
+  /// \param last the end of the output range
+  /// \param value the value to format
+  /// \param base the base to format in
+  /// \return the end of the written characters on success, or
+  ///         {last, std::errc::value_too_large} if the range is too small
+  template <typename T>
+  BPSTD_CPP14_CONSTEXPR
+  enable_if_t<detail::is_charconv_integer<T>::value,to_chars_result>
+    to_chars(char* first, char* last, T value, int base = 10) noexcept;
+
+  to_chars_result to_chars(char* first, char* last, bool value, int base = 10) = delete;
+
+  /// \brief Formats the integer \p value into \p buffer in the given \p base
+  ///
+  /// \pre \p base is in the range [2, 36]
+  /// \param buffer the output buffer
+  /// \param value the value to format
+  /// \param base the base to format in
+  /// \return the end of the written characters on success, or
+  ///         {buffer end, std::errc::value_too_large} if the buffer is too
+  ///         small
+  template <typename T>
+  BPSTD_CPP14_CONSTEXPR
+  enable_if_t<detail::is_charconv_integer<T>::value,to_chars_result>
+    to_chars(span<char> buffer, T value, int base = 10) noexcept;
+
+  /// \brief Formats the floating-point \p value into the character range
+  ///        [first, last) using the fewest characters that parse back to
+  ///        exactly \p value
+  ///
+  /// Of fixed and scientific notation, whichever is shorter is used,
+  /// preferring fixed notation on a tie. Of all representations of that
+  /// length, the one closest to \p value is chosen. Infinities are written
+  /// as "inf" and NaNs as "nan", each preceded by '-' if the sign bit is set.
+  ///
+  /// \param first the start of the output range
+  /// \param last the end of the output range
+  /// \param value the value to format
+  /// \return the end of the written characters on success, or
+  ///         {last, std::errc::value_too_large} if the range is too small
+  to_chars_result to_chars(char* first, char* last, float value) noexcept;
+  to_chars_result to_chars(char* first, char* last, double value) noexcept;
+
+  /// \brief Formats the floating-point \p value into the character range
+  ///        [first, last) in the format \p fmt, using the fewest digits that
+  ///        parse back to exactly \p value
+  ///
+  /// chars_format::general selects fixed notation when the decimal exponent
+  /// is in [-4, 6), and scientific notation otherwise, as printf's "%g" does.
+  /// Fixed notation of values too large to have a fractional part writes
+  /// every digit of the exact integral value.
+  ///
+  /// \param first the start of the output range
+  /// \param last the end of the output range
+  /// \param value the value to format
+  /// \param fmt the format to use
+  /// \return the end of the written characters on success, or
+  ///         {last, std::errc::value_too_large} if the range is too small
+  to_chars_result to_chars(char* first, char* last,
+                           float value, chars_format fmt) noexcept;
+  to_chars_result to_chars(char* first, char* last,
+                           double value, chars_format fmt) noexcept;
+
+  /// \brief Formats the floating-point \p value into \p buffer
+  ///
+  /// \param buffer the output buffer
+  /// \param value the value to format
+  /// \return see to_chars(char*, char*, double)
+  to_chars_result to_chars(span<char> buffer, float value) noexcept;
+  to_chars_result to_chars(span<char> buffer, double value) noexcept;
+
+  /// \brief Formats the floating-point \p value into \p buffer in the
+  ///        format \p fmt
+  ///
+  /// \param buffer the output buffer
+  /// \param value the value to format
+  /// \param fmt the format to use
+  /// \return see to_chars(char*, char*, double, chars_format)
+  to_chars_result to_chars(span<char> buffer,
+                           float value, chars_format fmt) noexcept;
+  to_chars_result to_chars(span<char> buffer,
+                           double value, chars_format fmt) noexcept;
+
+  //----------------------------------------------------------------------------
+  // Parsing
+  //----------------------------------------------------------------------------
+
+  /// \brief Parses an integer in the given \p base from the start of the
+  ///        character range [first, last)
+  ///
+  /// The accepted pattern is an optional '-' (for signed types only)
+  /// followed by one or more digits of \p base, where letters of either case
+  /// represent digits above 9. Leading whitespace, '+', and base prefixes
+  /// such as "0x" are not accepted. Parsing is independent of the current
+  /// locale, and the range does not need to be null-terminated.
+  ///
+  /// \pre \p base is in the range [2, 36]
+  /// \param first the start of the input range
+  /// \param last the end of the input range
+  /// \param value the value to assign the parsed result to; left unmodified
+  ///              on error
+  /// \param base the base to parse in
+  /// \return a pointer past the parsed characters, and either a
+  ///         value-initialized std::errc, std::errc::invalid_argument if no
+  ///         digits were found, or std::errc::result_out_of_range if the
+  ///         result does not fit in \p value
+  template <typename T>
+  BPSTD_CPP14_CONSTEXPR
+  enable_if_t<detail::is_charconv_integer<T>::value,from_chars_result>
+    from_chars(const char* first, const char* last,
+               T& value, int base = 10) noexcept;
+
+  /// \brief Parses an integer in the given \p base from the start of \p str
+  ///
+  /// \pre \p base is in the range [2, 36]
+  /// \param str the string to parse
+  /// \param value the value to assign the parsed result to; left unmodified
+  ///              on error
+  /// \param base the base to parse in
+  /// \return see from_chars(const char*, const char*, T&, int)
+  template <typename T>
+  BPSTD_CPP14_CONSTEXPR
+  enable_if_t<detail::is_charconv_integer<T>::value,from_chars_result>
+    from_chars(string_view str, T& value, int base = 10) noexcept;
+
+  /// \brief Parses a floating-point number in the format \p fmt from the
+  ///        start of the character range [first, last)
+  ///
+  /// The accepted pattern is an optional '-', followed by either "inf",
+  /// "infinity", "nan", or "nan(chars)" in any case, or by a nonempty
+  /// sequence of digits optionally containing a '.', followed by an exponent.
+  /// The exponent is 'e' and a signed decimal integer, which is required for
+  /// chars_format::scientific, optional for chars_format::general, and not
+  /// accepted for chars_format::fixed. For chars_format::hex the digits are
+  /// hexadecimal, without any "0x" prefix, and the optional exponent is 'p'
+  /// and a signed decimal power of two.
+  ///
+  /// The result is correctly rounded to nearest, ties to even, regardless of
+  /// the number of digits. Parsing is independent of the current locale, and
+  /// the range does not need to be null-terminated.
+  ///
+  /// \param first the start of the input range
+  /// \param last the end of the input range
+  /// \param value the value to assign the parsed result to; left unmodified
+  ///              on error
+  /// \param fmt the format to parse
+  /// \return a pointer past the parsed characters, and either a
+  ///         value-initialized std::errc, std::errc::invalid_argument if the
+  ///         pattern was not matched, or std::errc::result_out_of_range if
+  ///         the magnitude rounds to infinity or to zero
+  from_chars_result from_chars(const char* first, const char* last,
+                               float& value,
+                               chars_format fmt = chars_format::general) noexcept;
+  from_chars_result from_chars(const char* first, const char* last,
+                               double& value,
+                               chars_format fmt = chars_format::general) noexcept;
+
+  /// \brief Parses a floating-point number in the format \p fmt from the
+  ///        start of \p str
+  ///
+  /// \param str the string to parse
+  /// \param value the value to assign the parsed result to; left unmodified
+  ///              on error
+  /// \param fmt the format to parse
+  /// \return see from_chars(const char*, const char*, double&, chars_format)
+  from_chars_result from_chars(string_view str, float& value,
+                               chars_format fmt = chars_format::general) noexcept;
+  from_chars_result from_chars(string_view str, double& value,
+                               chars_format fmt = chars_format::general) noexcept;
+
+} // namespace bpstd
+
+//==============================================================================
+// definitions : enum class : chars_format
+//==============================================================================
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::chars_format bpstd::operator|(chars_format lhs, chars_format rhs)
+  noexcept
+{
+  return static_cast<chars_format>(
+    static_cast<unsigned>(lhs) | static_cast<unsigned>(rhs)
+  );
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::chars_format bpstd::operator&(chars_format lhs, chars_format rhs)
+  noexcept
+{
+  return static_cast<chars_format>(
+    static_cast<unsigned>(lhs) & static_cast<unsigned>(rhs)
+  );
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::chars_format bpstd::operator^(chars_format lhs, chars_format rhs)
+  noexcept
+{
+  return static_cast<chars_format>(
+    static_cast<unsigned>(lhs) ^ static_cast<unsigned>(rhs)
+  );
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::chars_format bpstd::operator~(chars_format f)
+  noexcept
+{
+  return static_cast<chars_format>(~static_cast<unsigned>(f) & 0x7u);
+}
+
+//==============================================================================
+// definitions : detail : <charconv>
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Formatting
+//------------------------------------------------------------------------------
+
+template <typename UInt>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+int bpstd::detail::count_digits10(UInt value)
+  noexcept
+{
+  auto result = 1;
+  while (true) {
+    if (value < 10u) { return result; }
+    if (value < 100u) { return result + 1; }
+    if (value < 1000u) { return result + 2; }
+    if (value < 10000u) { return result + 3; }
+    value /= 10000u;
+    result += 4;
+  }
+}
+
+template <typename UInt>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+int bpstd::detail::count_digits_pow2(UInt value, int shift)
+  noexcept
+{
+  auto result = 1;
+  while ((value >>= shift) != 0u) {
+    ++result;
+  }
+  return result;
+}
+
+template <typename UInt>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+int bpstd::detail::count_digits(UInt value, UInt base)
+  noexcept
+{
+  auto result = 1;
+  while ((value /= base) != 0u) {
+    ++result;
+  }
+  return result;
+}
+
+template <typename UInt>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+void bpstd::detail::write_digits(char* last, UInt value, int base)
+  noexcept
+{
+  using tables = charconv_tables<>;
+
+  if (base == 10) {
+    while (value >= 100u) {
+      const auto index = static_cast<std::size_t>(value % 100u) * 2u;
+      value /= 100u;
+      last -= 2;
+      last[0] = tables::digit_pairs[index];
+      last[1] = tables::digit_pairs[index + 1u];
+    }
+    if (value >= 10u) {
+      const auto index = static_cast<std::size_t>(value) * 2u;
+      last[-2] = tables::digit_pairs[index];
+      last[-1] = tables::digit_pairs[index + 1u];
+    } else {
+      last[-1] = static_cast<char>('0' + value);
+    }
+    return;
+  }
+
+  const auto ubase = static_cast<UInt>(base);
+  if ((ubase & (ubase - 1u)) == 0u) {
+    const auto shift = count_digits_pow2(ubase, 1) - 1;
+    const auto mask  = ubase - 1u;
+    do {
+      *--last = tables::digits[static_cast<std::size_t>(value & mask)];
+      value >>= shift;
+    } while (value != 0u);
+    return;
+  }
+
+  do {
+    *--last = tables::digits[static_cast<std::size_t>(value % ubase)];
+    value /= ubase;
+  } while (value != 0u);
+}
+
+template <typename UInt>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::to_chars_result
+  bpstd::detail::to_chars_unsigned(char* first, char* last,
+                                   UInt value, int base)
+  noexcept
+{
+  const auto ubase = static_cast<UInt>(base);
+
+  // Counting the digits first lets every digit be written directly into the
+  // destination, rather than into a scratch buffer that must then be copied
+  auto digits = 0;
+  if (base == 10) {
+    digits = count_digits10(value);
+  } else if ((ubase & (ubase - 1u)) == 0u) {
+    digits = count_digits_pow2(value, count_digits_pow2(ubase, 1) - 1);
+  } else {
+    digits = count_digits(value, ubase);
+  }
+
+  if (last - first < digits) {
+    return {last, std::errc::value_too_large};
+  }
+
+  last = first + digits;
+  write_digits(last, value, base);
+
+  return {last, std::errc{}};
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::to_chars_result
+  bpstd::detail::to_chars_integer(char* first, char* last,
+                                  T value, int base, true_type)
+  noexcept
+{
+  using uint_type = charconv_uint_t<T>;
+
+  if (value >= 0) {
+    return to_chars_unsigned(first, last, static_cast<uint_type>(value), base);
+  }
+  if (first == last) {
+    return {last, std::errc::value_too_large};
+  }
+  *first = '-';
+
+  // Negate in unsigned arithmetic, since -value overflows for the minimum
+  // value of T
+  const auto magnitude = static_cast<uint_type>(
+    uint_type{0u} - static_cast<uint_type>(value)
+  );
+
+  return to_chars_unsigned(first + 1, last, magnitude, base);
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::to_chars_result
+  bpstd::detail::to_chars_integer(char* first, char* last,
+                                  T value, int base, false_type)
+  noexcept
+{
+  return to_chars_unsigned(first, last, static_cast<charconv_uint_t<T>>(value), base);
+}
+
+//------------------------------------------------------------------------------
+// Parsing
+//------------------------------------------------------------------------------
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+unsigned bpstd::detail::char_to_digit(char c)
+  noexcept
+{
+  // Setting bit 5 folds uppercase letters onto lowercase in ASCII
+  return (static_cast<unsigned char>(c) - unsigned{'0'} < 10u)
+    ? static_cast<unsigned char>(c) - unsigned{'0'}
+    : ((static_cast<unsigned char>(c) | 0x20u) - unsigned{'a'} < 26u)
+      ? (static_cast<unsigned char>(c) | 0x20u) - unsigned{'a'} + 10u
+      : 36u;
+}
+
+template <typename UInt>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::from_chars_result
+  bpstd::detail::from_chars_unsigned(const char* first, const char* last,
+                                     UInt& value, UInt max, int base)
+  noexcept
+{
+  const auto ubase = static_cast<unsigned>(base);
+
+  auto it = first;
+  auto result = UInt{0u};
+  auto overflow = false;
+
+  if (base == 10) {
+    // No sequence of 'digits10' decimal digits can overflow UInt, so the
+    // leading digits can be accumulated without any overflow checks
+    const auto safe_last = (last - first > std::numeric_limits<UInt>::digits10)
+      ? first + std::numeric_limits<UInt>::digits10
+      : last;
+
+    for (; it != safe_last; ++it) {
+      const auto digit = static_cast<unsigned char>(*it) - unsigned{'0'};
+      if (digit >= 10u) {
+        break;
+      }
+      result = static_cast<UInt>(result * 10u + digit);
+    }
+    overflow = result > max;
+  }
+
+  const auto cutoff = static_cast<UInt>(max / ubase);
+  const auto cutlim = static_cast<UInt>(max % ubase);
+
+  for (; it != last; ++it) {
+    const auto digit = char_to_digit(*it);
+    if (digit >= ubase) {
+      break;
+    }
+    if (overflow || result > cutoff || (result == cutoff && digit > cutlim)) {
+      // Keep consuming digits so that 'ptr' is past the entire match
+      overflow = true;
+      continue;
+    }
+    result = static_cast<UInt>(result * ubase + digit);
+  }
+
+  if (it == first) {
+    return {first, std::errc::invalid_argument};
+  }
+  if (overflow) {
+    return {it, std::errc::result_out_of_range};
+  }
+  value = result;
+  return {it, std::errc{}};
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::from_chars_result
+  bpstd::detail::from_chars_integer(const char* first, const char* last,
+                                    T& value, int base, true_type)
+  noexcept
+{
+  using uint_type = charconv_uint_t<T>;
+
+  const auto negative = (first != last && *first == '-');
+  const auto max = static_cast<uint_type>((std::numeric_limits<T>::max)());
+
+  // The magnitude of the minimum value is one larger than the maximum
+  auto magnitude = uint_type{0u};
+  const auto result = from_chars_unsigned(
+    negative ? first + 1 : first,
+    last,
+    magnitude,
+    negative ? static_cast<uint_type>(max + 1u) : max,
+    base
+  );
+
+  if (result.ec == std::errc::invalid_argument) {
+    return {first, result.ec};
+  }
+  if (result.ec == std::errc{}) {
+    if (!negative) {
+      value = static_cast<T>(magnitude);
+    } else if (magnitude == 0u) {
+      value = T{0};
+    } else {
+      // Computed this way to avoid overflowing when producing the minimum
+      value = static_cast<T>(-static_cast<T>(magnitude - 1u) - 1);
+    }
+  }
+  return result;
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::from_chars_result
+  bpstd::detail::from_chars_integer(const char* first, const char* last,
+                                    T& value, int base, false_type)
+  noexcept
+{
+  using uint_type = charconv_uint_t<T>;
+
+  auto magnitude = uint_type{0u};
+  const auto result = from_chars_unsigned(
+    first,
+    last,
+    magnitude,
+    static_cast<uint_type>((std::numeric_limits<T>::max)()),
+    base
+  );
+
+  if (result.ec == std::errc{}) {
+    value = static_cast<T>(magnitude);
+  }
+  return result;
+}
+
+//------------------------------------------------------------------------------
+// Floating-point Formatting
+//------------------------------------------------------------------------------
+
+inline
+bpstd::to_chars_result
+  bpstd::detail::write_scientific(char* first, char* last,
+                                  std::uint64_t significand,
+                                  int digits, int exponent)
+  noexcept
+{
+  using tables = charconv_tables<>;
+
+  const auto abs_exponent = static_cast<unsigned>(exponent < 0 ? -exponent : exponent);
+  const auto length = digits + (digits > 1 ? 1 : 0) + 2 + (abs_exponent >= 100u ? 3 : 2);
+  if (last - first < length) {
+    return {last, std::errc::value_too_large};
+  }
+
+  // Write the digits one position to the right, then move the leading digit
+  // in front of the decimal point
+  write_digits(first + 1 + digits, significand, 10);
+  first[0] = first[1];
+  auto it = first + 1;
+  if (digits > 1) {
+    first[1] = '.';
+    it = first + 1 + digits;
+  }
+
+  *it++ = 'e';
+  *it++ = (exponent < 0) ? '-' : '+';
+  auto remainder = abs_exponent;
+  if (remainder >= 100u) {
+    *it++ = static_cast<char>('0' + remainder / 100u);
+    remainder %= 100u;
+  }
+  *it++ = tables::digit_pairs[remainder * 2u];
+  *it++ = tables::digit_pairs[remainder * 2u + 1u];
+
+  return {it, std::errc{}};
+}
+
+inline
+bpstd::to_chars_result
+  bpstd::detail::write_fixed(char* first, char* last,
+                             std::uint64_t significand,
+                             int digits, int exponent)
+  noexcept
+{
+  if (exponent >= digits - 1) {
+    // An integer, padded with trailing zeros
+    const auto length = exponent + 1;
+    if (last - first < length) {
+      return {last, std::errc::value_too_large};
+    }
+    write_digits(first + digits, significand, 10);
+    std::memset(first + digits, '0', static_cast<std::size_t>(length - digits));
+    return {first + length, std::errc{}};
+  }
+
+  if (exponent >= 0) {
+    // The decimal point falls between the digits
+    const auto length = digits + 1;
+    if (last - first < length) {
+      return {last, std::errc::value_too_large};
+    }
+    write_digits(first + 1 + digits, significand, 10);
+    for (auto i = 0; i <= exponent; ++i) {
+      first[i] = first[i + 1];
+    }
+    first[exponent + 1] = '.';
+    return {first + length, std::errc{}};
+  }
+
+  // The value is less than one, and starts with "0." and any leading zeros
+  const auto zeros = -exponent - 1;
+  const auto length = 2 + zeros + digits;
+  if (last - first < length) {
+    return {last, std::errc::value_too_large};
+  }
+  first[0] = '0';
+  first[1] = '.';
+  std::memset(first + 2, '0', static_cast<std::size_t>(zeros));
+  write_digits(first + length, significand, 10);
+  return {first + length, std::errc{}};
+}
+
+template <typename T>
+inline
+bpstd::to_chars_result
+  bpstd::detail::write_hex(char* first, char* last,
+                           typename float_traits<T>::bits_type significand,
+                           int exponent)
+  noexcept
+{
+  using traits = float_traits<T>;
+  using tables = charconv_tables<>;
+
+  // Align the significand to a whole number of hex digits
+  const auto total_digits = (traits::significand_bits + 3) / 4;
+  auto bits = static_cast<std::uint64_t>(significand)
+    << (total_digits * 4 - traits::significand_bits);
+
+  auto digits = total_digits;
+  while (digits > 0 && (bits & 0xfu) == 0u) {
+    bits >>= 4u;
+    --digits;
+  }
+
+  auto binary_exponent = 0;
+  if (exponent != 0) {
+    binary_exponent = exponent - traits::exponent_bias;
+  } else if (significand != 0u) {
+    binary_exponent = 1 - traits::exponent_bias;
+  }
+  const auto abs_exponent = static_cast<std::uint32_t>(
+    binary_exponent < 0 ? -binary_exponent : binary_exponent
+  );
+  const auto exponent_digits = count_digits10(abs_exponent);
+
+  const auto length = 1 + (digits > 0 ? digits + 1 : 0) + 2 + exponent_digits;
+  if (last - first < length) {
+    return {last, std::errc::value_too_large};
+  }
+
+  auto it = first;
+  *it++ = (exponent != 0) ? '1' : '0';
+  if (digits > 0) {
+    *it++ = '.';
+    it += digits;
+    for (auto i = 1; i <= digits; ++i) {
+      it[-i] = tables::digits[bits & 0xfu];
+      bits >>= 4u;
+    }
+  }
+  *it++ = 'p';
+  *it++ = (binary_exponent < 0) ? '-' : '+';
+  it += exponent_digits;
+  write_digits(it, abs_exponent, 10);
+
+  return {it, std::errc{}};
+}
+
+template <typename T>
+inline
+bpstd::to_chars_result
+  bpstd::detail::to_chars_float(char* first, char* last, T value,
+                                chars_format fmt, bool is_plain)
+  noexcept
+{
+  using traits    = float_traits<T>;
+  using bits_type = typename traits::bits_type;
+
+  const auto bits = float_to_bits(value);
+  const auto significand = static_cast<bits_type>(
+    bits & ((bits_type{1u} << traits::significand_bits) - 1u)
+  );
+  const auto exponent = static_cast<int>(
+    (bits >> traits::significand_bits) & static_cast<unsigned>(traits::max_biased_exponent)
+  );
+
+  if ((bits >> (sizeof(bits_type) * 8u - 1u)) != 0u) {
+    if (first == last) {
+      return {last, std::errc::value_too_large};
+    }
+    *first++ = '-';
+  }
+
+  if (exponent == traits::max_biased_exponent) {
+    if (last - first < 3) {
+      return {last, std::errc::value_too_large};
+    }
+    const auto* text = (significand == 0u) ? "inf" : "nan";
+    first[0] = text[0];
+    first[1] = text[1];
+    first[2] = text[2];
+    return {first + 3, std::errc{}};
+  }
+
+  if (fmt == chars_format::hex) {
+    return write_hex<T>(first, last, significand, exponent);
+  }
+
+  if (exponent == 0 && significand == 0u) {
+    if (fmt == chars_format::scientific && !is_plain) {
+      return write_scientific(first, last, 0u, 1, 0);
+    }
+    return write_fixed(first, last, 0u, 1, 0);
+  }
+
+  const auto decimal = to_shortest_decimal<T>(significand, exponent);
+  const auto digits = count_digits10(decimal.significand);
+  const auto sci_exponent = decimal.exponent + digits - 1;
+
+  if (is_plain) {
+    const auto sci_length = digits + (digits > 1 ? 1 : 0) + 2 +
+                            ((sci_exponent >= 100 || sci_exponent <= -100) ? 3 : 2);
+
+    // Values without a fractional part must be written exactly in fixed
+    // notation, which may differ in digits from the shortest representation
+    const auto binary_exponent = exponent - traits::exponent_bias - traits::significand_bits;
+    if (binary_exponent > 0) {
+      if (sci_exponent <= sci_length) {
+        char buffer[310];
+        const auto length = write_exact_integer(
+          buffer,
+          significand | (std::uint64_t{1u} << traits::significand_bits),
+          binary_exponent
+        );
+        if (static_cast<int>(length) <= sci_length) {
+          if (static_cast<std::size_t>(last - first) < length) {
+            return {last, std::errc::value_too_large};
+          }
+          std::memcpy(first, buffer, length);
+          return {first + length, std::errc{}};
+        }
+      }
+      return write_scientific(first, last, decimal.significand, digits, sci_exponent);
+    }
+
+    auto fixed_length = 0;
+    if (sci_exponent < 0) {
+      fixed_length = digits + 1 - sci_exponent;
+    } else if (digits <= sci_exponent + 1) {
+      fixed_length = sci_exponent + 1;
+    } else {
+      fixed_length = digits + 1;
+    }
+    if (fixed_length <= sci_length) {
+      return write_fixed(first, last, decimal.significand, digits, sci_exponent);
+    }
+    return write_scientific(first, last, decimal.significand, digits, sci_exponent);
+  }
+
+  if (fmt == chars_format::scientific) {
+    return write_scientific(first, last, decimal.significand, digits, sci_exponent);
+  }
+  if (fmt == chars_format::general) {
+    if (sci_exponent >= -4 && sci_exponent < 6) {
+      return write_fixed(first, last, decimal.significand, digits, sci_exponent);
+    }
+    return write_scientific(first, last, decimal.significand, digits, sci_exponent);
+  }
+
+  const auto binary_exponent = exponent - traits::exponent_bias - traits::significand_bits;
+  if (binary_exponent > 0) {
+    char buffer[310];
+    const auto length = write_exact_integer(
+      buffer,
+      significand | (std::uint64_t{1u} << traits::significand_bits),
+      binary_exponent
+    );
+    if (static_cast<std::size_t>(last - first) < length) {
+      return {last, std::errc::value_too_large};
+    }
+    std::memcpy(first, buffer, length);
+    return {first + length, std::errc{}};
+  }
+  return write_fixed(first, last, decimal.significand, digits, sci_exponent);
+}
+
+//------------------------------------------------------------------------------
+// Floating-point Parsing
+//------------------------------------------------------------------------------
+
+namespace bpstd {
+  namespace detail {
+
+    /// \brief Determines whether [first, last) starts with the lowercase
+    ///        \p text, ignoring case
+    inline BPSTD_INLINE_VISIBILITY
+    bool starts_with_nocase(const char* first, const char* last,
+                            const char* text, std::size_t length)
+      noexcept
+    {
+      if (static_cast<std::size_t>(last - first) < length) {
+        return false;
+      }
+      for (auto i = std::size_t{0u}; i < length; ++i) {
+        if ((static_cast<unsigned char>(first[i]) | 0x20u) != static_cast<unsigned char>(text[i])) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    /// \brief Parses the digits of an exponent, saturating large magnitudes
+    ///
+    /// \return the end of the exponent, or \p first if there is none
+    inline BPSTD_INLINE_VISIBILITY
+    const char* parse_exponent(const char* first, const char* last,
+                               std::int64_t& exponent)
+      noexcept
+    {
+      auto it = first;
+      const auto negative = (it != last && *it == '-');
+      if (it != last && (*it == '-' || *it == '+')) {
+        ++it;
+      }
+      const auto digits_first = it;
+      auto result = std::int64_t{0};
+      for (; it != last; ++it) {
+        const auto digit = static_cast<unsigned char>(*it) - unsigned{'0'};
+        if (digit >= 10u) {
+          break;
+        }
+        if (result < 0x10000000) {
+          result = result * 10 + digit;
+        }
+      }
+      if (it == digits_first) {
+        return first;
+      }
+      exponent = negative ? -result : result;
+      return it;
+    }
+
+    template <typename T>
+    inline BPSTD_INLINE_VISIBILITY
+    void assign_float(T& value, bool negative, adjusted_mantissa result)
+      noexcept
+    {
+      using traits    = float_traits<T>;
+      using bits_type = typename traits::bits_type;
+
+      auto bits = static_cast<bits_type>(
+        result.mantissa | (static_cast<std::uint64_t>(result.power2) << traits::significand_bits)
+      );
+      if (negative) {
+        bits |= static_cast<bits_type>(bits_type{1u} << (sizeof(bits_type) * 8u - 1u));
+      }
+      value = float_from_bits<T>(bits);
+    }
+
+  } // namespace detail
+} // namespace bpstd
+
+template <typename T>
+inline
+bpstd::from_chars_result
+  bpstd::detail::parse_special(const char* first, const char* last,
+                               bool negative, T& value)
+  noexcept
+{
+  using traits = float_traits<T>;
+
+  if (starts_with_nocase(first, last, "inf", 3u)) {
+    first += starts_with_nocase(first, last, "infinity", 8u) ? 8 : 3;
+    assign_float(value, negative, {0u, traits::max_biased_exponent});
+    return {first, std::errc{}};
+  }
+  if (starts_with_nocase(first, last, "nan", 3u)) {
+    first += 3;
+
+    // An optional parenthesized sequence of letters, digits, and underscores
+    if (first != last && *first == '(') {
+      auto it = first + 1;
+      while (it != last && (*it == '_' ||
+                            static_cast<unsigned char>(*it) - unsigned{'0'} < 10u ||
+                            (static_cast<unsigned char>(*it) | 0x20u) - unsigned{'a'} < 26u)) {
+        ++it;
+      }
+      if (it != last && *it == ')') {
+        first = it + 1;
+      }
+    }
+    assign_float(value, negative, {
+      std::uint64_t{1u} << (traits::significand_bits - 1),
+      traits::max_biased_exponent
+    });
+    return {first, std::errc{}};
+  }
+  return {first, std::errc::invalid_argument};
+}
+
+template <typename T>
+inline
+bpstd::from_chars_result
+  bpstd::detail::parse_hex(const char* first, const char* last,
+                           bool negative, T& value)
+  noexcept
+{
+  using traits = float_traits<T>;
+
+  auto significand = std::uint64_t{0u};
+  auto exponent = std::int64_t{0};
+  auto sticky = false;
+  auto significant = 0;
+  auto has_digits = false;
+  auto integral = true;
+
+  auto it = first;
+  for (; it != last; ++it) {
+    if (*it == '.' && integral) {
+      integral = false;
+      continue;
+    }
+    const auto digit = char_to_digit(*it);
+    if (digit >= 16u) {
+      break;
+    }
+    has_digits = true;
+    if (significant == 0 && digit == 0u) {
+      // Leading zeros only scale the value if they follow the point
+      exponent -= integral ? 0 : 4;
+      continue;
+    }
+    if (significant < 16) {
+      significand = (significand << 4u) | digit;
+      ++significant;
+      exponent -= integral ? 0 : 4;
+    } else {
+      sticky = sticky || (digit != 0u);
+      exponent += integral ? 4 : 0;
+    }
+  }
+  if (!has_digits) {
+    return {first - static_cast<int>(negative), std::errc::invalid_argument};
+  }
+  if (it != last && (*it == 'p' || *it == 'P')) {
+    auto explicit_exponent = std::int64_t{0};
+    const auto end = parse_exponent(it + 1, last, explicit_exponent);
+    if (end != it + 1) {
+      it = end;
+      exponent += explicit_exponent;
+    }
+  }
+
+  const auto result = round_binary<T>(significand, exponent, sticky);
+  if (result.power2 == traits::max_biased_exponent ||
+      (result.power2 == 0 && result.mantissa == 0u && significand != 0u)) {
+    return {it, std::errc::result_out_of_range};
+  }
+  assign_float(value, negative, result);
+  return {it, std::errc{}};
+}
+
+template <typename T>
+inline
+bpstd::from_chars_result
+  bpstd::detail::parse_decimal(const char* first, const char* last,
+                               bool negative, T& value, chars_format fmt)
+  noexcept
+{
+  using traits = float_traits<T>;
+
+  const auto start = first - static_cast<int>(negative);
+
+  // Accumulate every digit into 'w'; this is only inaccurate if there are
+  // more than 19 digits, which is handled below
+  auto w = std::uint64_t{0u};
+  auto it = first;
+  for (; it != last; ++it) {
+    const auto digit = static_cast<unsigned char>(*it) - unsigned{'0'};
+    if (digit >= 10u) {
+      break;
+    }
+    w = w * 10u + digit;
+  }
+  const auto integral_end = it;
+  auto fraction_first = it;
+  if (it != last && *it == '.') {
+    fraction_first = ++it;
+    for (; it != last; ++it) {
+      const auto digit = static_cast<unsigned char>(*it) - unsigned{'0'};
+      if (digit >= 10u) {
+        break;
+      }
+      w = w * 10u + digit;
+    }
+  }
+  const auto digits_last = it;
+  const auto fraction_digits = digits_last - fraction_first;
+  const auto digit_count = (integral_end - first) + fraction_digits;
+
+  if (digit_count == 0) {
+    return {start, std::errc::invalid_argument};
+  }
+
+  auto explicit_exponent = std::int64_t{0};
+  const auto allows_exponent = (fmt & chars_format::scientific) == chars_format::scientific;
+  const auto requires_exponent = allows_exponent &&
+                                 (fmt & chars_format::fixed) != chars_format::fixed;
+  auto has_exponent = false;
+  if (allows_exponent && it != last && (*it == 'e' || *it == 'E')) {
+    const auto end = parse_exponent(it + 1, last, explicit_exponent);
+    if (end != it + 1) {
+      it = end;
+      has_exponent = true;
+    }
+  }
+  if (requires_exponent && !has_exponent) {
+    return {start, std::errc::invalid_argument};
+  }
+
+  auto q = explicit_exponent - fraction_digits;
+  auto truncated = false;
+
+  if (digit_count > 19) {
+    // Leading zeros are not significant
+    auto p = first;
+    while (p != digits_last && (*p == '0' || *p == '.')) {
+      ++p;
+    }
+    auto significant = digits_last - p;
+    if (p < integral_end && fraction_digits > 0) {
+      --significant; // for the decimal point
+    }
+
+    if (significant > 19) {
+      // Keep only the leading 19 significant digits; the value lies in
+      // [w, w + 1) * 10^q
+      truncated = true;
+      w = 0u;
+      auto taken = 0;
+      for (; taken < 19; ++p) {
+        if (*p == '.') {
+          continue;
+        }
+        w = w * 10u + static_cast<unsigned>(*p - '0');
+        ++taken;
+      }
+      q = (p <= integral_end)
+        ? explicit_exponent + (integral_end - p)
+        : explicit_exponent - (p - fraction_first);
+    }
+  }
+
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+  // Both the significand and the power of ten are exact, so a single
+  // correctly-rounded IEEE operation produces the correctly-rounded result
+  if (!truncated && w <= traits::max_exact_integer &&
+      q >= -traits::max_exact_power10 && q <= traits::max_exact_power10) {
+    static constexpr double powers[23] = {
+      1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    auto result = static_cast<T>(w);
+    if (q < 0) {
+      result /= static_cast<T>(powers[-q]);
+    } else {
+      result *= static_cast<T>(powers[q]);
+    }
+    value = negative ? -result : result;
+    return {it, std::errc{}};
+  }
+#endif
+
+  auto ambiguous = false;
+  auto result = compute_float<T>(q, w, ambiguous);
+  if (truncated && !ambiguous) {
+    // The truncated digits only matter if rounding w + 1 differs
+    const auto upper = compute_float<T>(q, w + 1u, ambiguous);
+    ambiguous = ambiguous ||
+                upper.mantissa != result.mantissa ||
+                upper.power2 != result.power2;
+  }
+  if (ambiguous) {
+    result = compute_float_exact<T>(first, digits_last, explicit_exponent, result);
+  }
+
+  if (result.power2 == traits::max_biased_exponent ||
+      (result.power2 == 0 && result.mantissa == 0u && w != 0u)) {
+    return {it, std::errc::result_out_of_range};
+  }
+  assign_float(value, negative, result);
+  return {it, std::errc{}};
+}
+
+template <typename T>
+inline
+bpstd::from_chars_result
+  bpstd::detail::from_chars_float(const char* first, const char* last,
+                                  T& value, chars_format fmt)
+  noexcept
+{
+  const auto negative = (first != last && *first == '-');
+  const auto it = negative ? first + 1 : first;
+
+  if (it != last) {
+    const auto lower = static_cast<unsigned char>(*it) | 0x20u;
+    if (lower == 'i' || lower == 'n') {
+      const auto result = parse_special(it, last, negative, value);
+      if (result.ec == std::errc{}) {
+        return result;
+      }
+      return {first, result.ec};
+    }
+  }
+  if (fmt == chars_format::hex) {
+    return parse_hex(it, last, negative, value);
+  }
+  return parse_decimal(it, last, negative, value, fmt);
+}
+
+//==============================================================================
+// definitions : non-member functions : <charconv>
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Formatting
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::enable_if_t<bpstd::detail::is_charconv_integer<T>::value,bpstd::to_chars_result>
+  bpstd::to_chars(char* first, char* last, T value, int base)
+  noexcept
+{
+  return detail::to_chars_integer(first, last, value, base, is_signed<T>{});
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::enable_if_t<bpstd::detail::is_charconv_integer<T>::value,bpstd::to_chars_result>
+  bpstd::to_chars(span<char> buffer, T value, int base)
+  noexcept
+{
+  return detail::to_chars_integer(
+    buffer.data(),
+    buffer.data() + buffer.size(),
+    value,
+    base,
+    is_signed<T>{}
+  );
+}
+
+//------------------------------------------------------------------------------
+// Parsing
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::enable_if_t<bpstd::detail::is_charconv_integer<T>::value,bpstd::from_chars_result>
+  bpstd::from_chars(const char* first, const char* last, T& value, int base)
+  noexcept
+{
+  return detail::from_chars_integer(first, last, value, base, is_signed<T>{});
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::enable_if_t<bpstd::detail::is_charconv_integer<T>::value,bpstd::from_chars_result>
+  bpstd::from_chars(string_view str, T& value, int base)
+  noexcept
+{
+  return detail::from_chars_integer(
+    str.data(),
+    str.data() + str.size(),
+    value,
+    base,
+    is_signed<T>{}
+  );
+}
+
+//------------------------------------------------------------------------------
+// Floating-point Formatting
+//------------------------------------------------------------------------------
+
+inline
+bpstd::to_chars_result bpstd::to_chars(char* first, char* last, float value)
+  noexcept
+{
+  return detail::to_chars_float(first, last, value, chars_format::general, true);
+}
+
+inline
+bpstd::to_chars_result bpstd::to_chars(char* first, char* last, double value)
+  noexcept
+{
+  return detail::to_chars_float(first, last, value, chars_format::general, true);
+}
+
+inline
+bpstd::to_chars_result bpstd::to_chars(char* first, char* last,
+                                       float value, chars_format fmt)
+  noexcept
+{
+  return detail::to_chars_float(first, last, value, fmt, false);
+}
+
+inline
+bpstd::to_chars_result bpstd::to_chars(char* first, char* last,
+                                       double value, chars_format fmt)
+  noexcept
+{
+  return detail::to_chars_float(first, last, value, fmt, false);
+}
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::to_chars_result bpstd::to_chars(span<char> buffer, float value)
+  noexcept
+{
+  return to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+}
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::to_chars_result bpstd::to_chars(span<char> buffer, double value)
+  noexcept
+{
+  return to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+}
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::to_chars_result bpstd::to_chars(span<char> buffer,
+                                       float value, chars_format fmt)
+  noexcept
+{
+  return to_chars(buffer.data(), buffer.data() + buffer.size(), value, fmt);
+}
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::to_chars_result bpstd::to_chars(span<char> buffer,
+                                       double value, chars_format fmt)
+  noexcept
+{
+  return to_chars(buffer.data(), buffer.data() + buffer.size(), value, fmt);
+}
+
+//------------------------------------------------------------------------------
+// Floating-point Parsing
+//------------------------------------------------------------------------------
+
+inline
+bpstd::from_chars_result bpstd::from_chars(const char* first, const char* last,
+                                           float& value, chars_format fmt)
+  noexcept
+{
+  return detail::from_chars_float(first, last, value, fmt);
+}
+
+inline
+bpstd::from_chars_result bpstd::from_chars(const char* first, const char* last,
+                                           double& value, chars_format fmt)
+  noexcept
+{
+  return detail::from_chars_float(first, last, value, fmt);
+}
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::from_chars_result bpstd::from_chars(string_view str, float& value,
+                                           chars_format fmt)
+  noexcept
+{
+  return detail::from_chars_float(str.data(), str.data() + str.size(), value, fmt);
+}
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::from_chars_result bpstd::from_chars(string_view str, double& value,
+                                           chars_format fmt)
+  noexcept
+{
+  return detail::from_chars_float(str.data(), str.data() + str.size(), value, fmt);
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_CHARCONV_HPP */
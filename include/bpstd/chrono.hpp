@@ -31,13 +31,96 @@
 #define BPSTD_CHRONO_HPP
 
 #include "detail/config.hpp"
+#include "detail/tsc.hpp"
 
-#include <chrono>  // std::chrono::duration, std::chrono::system_clock, etc
-#include <cstdint> // std::int32_t
+#include "span.hpp"        // span
+#include "string_view.hpp" // string_view
+#include "type_traits.hpp" // enable_if_t, true_type, false_type
+
+#include <chrono>      // std::chrono::duration, std::chrono::system_clock, etc
+#include <cstdint>     // std::int32_t, std::int64_t, std::uint64_t
+#include <limits>      // std::numeric_limits
+#include <ratio>       // std::ratio, std::nano
+#include <type_traits> // std::common_type
+
+#if !defined(BPSTD_USE_STD_CHRONO_ROUNDING)
+// std::chrono::floor, ceil, round and abs were added in C++17; defining our
+// own alongside them would make unqualified calls ambiguous through ADL
+# if defined(__cpp_lib_chrono) && (__cpp_lib_chrono >= 201611)
+#   define BPSTD_USE_STD_CHRONO_ROUNDING 1
+# else
+#   define BPSTD_USE_STD_CHRONO_ROUNDING 0
+# endif
+#endif // BPSTD_USE_STD_CHRONO_ROUNDING
 
 BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
 
 namespace bpstd {
+  namespace detail {
+
+    /// \brief Type-trait to determine whether \p T is a duration
+    template <typename T>
+    struct is_duration : false_type{};
+
+    template <typename Rep, typename Period>
+    struct is_duration<std::chrono::duration<Rep,Period>> : true_type{};
+
+#if !BPSTD_USE_STD_CHRONO_ROUNDING
+    /// \brief Rounds \p d to whichever of \p lower or the next \p To is
+    ///        nearest, or to the even one of the two if \p d is halfway
+    template <typename To, typename Duration>
+    constexpr To round_duration(const Duration& d, const To& lower);
+#endif
+
+    /// \brief Checks whether \p y is a leap year in the Gregorian calendar
+    constexpr bool is_leap_year(int y) noexcept;
+
+    /// \brief Gets the number of days in month \p m of year \p y
+    constexpr unsigned last_day_of_month(int y, unsigned m) noexcept;
+
+    /// \brief Gets the number of days from 1970-01-01 to the date \p y-m-d
+    BPSTD_CPP14_CONSTEXPR int days_from_civil(int y, unsigned m, unsigned d) noexcept;
+
+    /// \brief Computes 10^n
+    constexpr std::intmax_t pow10(unsigned n) noexcept;
+
+    /// \brief Gets the fewest decimal digits that exactly represent a
+    ///        fraction of a second with denominator \p den, or 6 if there is
+    ///        no such number of digits up to 18
+    constexpr unsigned fractional_width(std::intmax_t den,
+                                        unsigned width = 0u,
+                                        std::intmax_t scale = 1) noexcept;
+
+    /// \brief Writes \p value as exactly \p width decimal digits, with
+    ///        leading zeros, returning the end of the written digits
+    char* write_iso8601_digits(char* p, std::uint64_t value, unsigned width) noexcept;
+
+    /// \brief Reads exactly \p width decimal digits into \p value, advancing
+    ///        \p p past them
+    ///
+    /// \return true on success, or false if fewer than \p width digits remain
+    bool read_iso8601_digits(const char*& p,
+                             const char* last,
+                             unsigned width,
+                             unsigned& value) noexcept;
+
+    /// \brief Reads the character \p c, advancing \p p past it
+    ///
+    /// \return true on success, or false if the next character is not \p c
+    bool read_iso8601_char(const char*& p, const char* last, char c) noexcept;
+
+    /// \brief The static members of tsc_clock
+    ///
+    /// This is a template so that is_steady can be defined out of class in a
+    /// header, which C++11 requires for it to be odr-used.
+    template <typename = void>
+    struct tsc_clock_base
+    {
+      static constexpr bool is_steady = true;
+    };
+
+  } // namespace detail
+
   namespace chrono {
 
     template <typename Rep, typename Period = std::ratio<1>>
@@ -65,6 +148,503 @@ namespace bpstd {
     using sys_seconds = sys_time<seconds>;
     using sys_days    = sys_time<days>;
 
+    //==========================================================================
+    // non-member functions : rounding
+    //==========================================================================
+
+#if BPSTD_USE_STD_CHRONO_ROUNDING
+    using std::chrono::floor;
+    using std::chrono::ceil;
+    using std::chrono::round;
+    using std::chrono::abs;
+#else
+    /// \brief Converts \p d to the greatest \p To that is less than or
+    ///        equal to it
+    ///
+    /// Unlike duration_cast, which truncates towards zero, this rounds
+    /// negative durations towards negative infinity. The conversion is exact
+    /// for integral representations; no floating-point arithmetic is used.
+    ///
+    /// \param d the duration to convert
+    /// \return the rounded duration
+    template <typename To, typename Rep, typename Period,
+              typename = enable_if_t<detail::is_duration<To>::value>>
+    constexpr To floor(const duration<Rep,Period>& d);
+
+    /// \brief Converts \p d to the least \p To that is greater than or
+    ///        equal to it
+    ///
+    /// \param d the duration to convert
+    /// \return the rounded duration
+    template <typename To, typename Rep, typename Period,
+              typename = enable_if_t<detail::is_duration<To>::value>>
+    constexpr To ceil(const duration<Rep,Period>& d);
+
+    /// \brief Converts \p d to the nearest \p To, rounding halfway cases to
+    ///        even
+    ///
+    /// \param d the duration to convert
+    /// \return the rounded duration
+    template <typename To, typename Rep, typename Period,
+              typename = enable_if_t<
+                detail::is_duration<To>::value &&
+                !std::chrono::treat_as_floating_point<typename To::rep>::value
+              >>
+    constexpr To round(const duration<Rep,Period>& d);
+
+    /// \brief Gets the absolute value of \p d
+    ///
+    /// \param d the duration
+    /// \return \p d if it is non-negative, otherwise -d
+    template <typename Rep, typename Period,
+              typename = enable_if_t<std::numeric_limits<Rep>::is_signed>>
+    constexpr duration<Rep,Period> abs(duration<Rep,Period> d);
+
+    //--------------------------------------------------------------------------
+
+    /// \brief Converts \p tp to the greatest time point with a duration of
+    ///        \p To that is not later than it
+    ///
+    /// This buckets time points, such as `floor<minutes>(tp)` for the start
+    /// of the minute that \p tp is in.
+    ///
+    /// \param tp the time point to convert
+    /// \return the rounded time point
+    template <typename To, typename Clock, typename Duration,
+              typename = enable_if_t<detail::is_duration<To>::value>>
+    BPSTD_CPP14_CONSTEXPR time_point<Clock,To>
+      floor(const time_point<Clock,Duration>& tp);
+
+    /// \brief Converts \p tp to the least time point with a duration of
+    ///        \p To that is not earlier than it
+    ///
+    /// \param tp the time point to convert
+    /// \return the rounded time point
+    template <typename To, typename Clock, typename Duration,
+              typename = enable_if_t<detail::is_duration<To>::value>>
+    BPSTD_CPP14_CONSTEXPR time_point<Clock,To>
+      ceil(const time_point<Clock,Duration>& tp);
+
+    /// \brief Converts \p tp to the nearest time point with a duration of
+    ///        \p To, rounding halfway cases to even
+    ///
+    /// \param tp the time point to convert
+    /// \return the rounded time point
+    template <typename To, typename Clock, typename Duration,
+              typename = enable_if_t<
+                detail::is_duration<To>::value &&
+                !std::chrono::treat_as_floating_point<typename To::rep>::value
+              >>
+    BPSTD_CPP14_CONSTEXPR time_point<Clock,To>
+      round(const time_point<Clock,Duration>& tp);
+#endif // BPSTD_USE_STD_CHRONO_ROUNDING
+
+    //==========================================================================
+    // class : day
+    //==========================================================================
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A day of a month
+    //////////////////////////////////////////////////////////////////////////
+    class day
+    {
+      //------------------------------------------------------------------------
+      // Constructors
+      //------------------------------------------------------------------------
+    public:
+
+      day() = default;
+
+      /// \brief Constructs a day from its value
+      ///
+      /// \param d the day, which is valid in [1, 31]
+      constexpr explicit day(unsigned d) noexcept;
+
+      //------------------------------------------------------------------------
+      // Observers
+      //------------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the value of this day
+      constexpr explicit operator unsigned() const noexcept;
+
+      /// \brief Checks whether this day is in [1, 31]
+      constexpr bool ok() const noexcept;
+
+      //------------------------------------------------------------------------
+      // Private Members
+      //------------------------------------------------------------------------
+    private:
+
+      unsigned char m_day;
+    };
+
+    //==========================================================================
+    // class : month
+    //==========================================================================
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A month of a year
+    //////////////////////////////////////////////////////////////////////////
+    class month
+    {
+      //------------------------------------------------------------------------
+      // Constructors
+      //------------------------------------------------------------------------
+    public:
+
+      month() = default;
+
+      /// \brief Constructs a month from its value
+      ///
+      /// \param m the month, which is valid in [1, 12]
+      constexpr explicit month(unsigned m) noexcept;
+
+      //------------------------------------------------------------------------
+      // Observers
+      //------------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the value of this month
+      constexpr explicit operator unsigned() const noexcept;
+
+      /// \brief Checks whether this month is in [1, 12]
+      constexpr bool ok() const noexcept;
+
+      //------------------------------------------------------------------------
+      // Private Members
+      //------------------------------------------------------------------------
+    private:
+
+      unsigned char m_month;
+    };
+
+    //==========================================================================
+    // class : year
+    //==========================================================================
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A year in the proleptic Gregorian calendar
+    //////////////////////////////////////////////////////////////////////////
+    class year
+    {
+      //------------------------------------------------------------------------
+      // Constructors
+      //------------------------------------------------------------------------
+    public:
+
+      year() = default;
+
+      /// \brief Constructs a year from its value
+      ///
+      /// \param y the year, which is valid in [-32767, 32767]
+      constexpr explicit year(int y) noexcept;
+
+      //------------------------------------------------------------------------
+      // Observers
+      //------------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the value of this year
+      constexpr explicit operator int() const noexcept;
+
+      /// \brief Checks whether this year is in [-32767, 32767]
+      constexpr bool ok() const noexcept;
+
+      /// \brief Checks whether this year is a leap year
+      constexpr bool is_leap() const noexcept;
+
+      //------------------------------------------------------------------------
+      // Private Members
+      //------------------------------------------------------------------------
+    private:
+
+      short m_year;
+    };
+
+    //==========================================================================
+    // class : year_month_day
+    //==========================================================================
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A date in the proleptic Gregorian calendar
+    ///
+    /// Conversions to and from sys_days use Howard Hinnant's
+    /// days_from_civil and civil_from_days algorithms, which work in
+    /// 400-year eras of a calendar starting in March, so that they need
+    /// no tables, loops, or special cases for leap days.
+    //////////////////////////////////////////////////////////////////////////
+    class year_month_day
+    {
+      //------------------------------------------------------------------------
+      // Constructors
+      //------------------------------------------------------------------------
+    public:
+
+      year_month_day() = default;
+
+      /// \brief Constructs a date from its fields
+      ///
+      /// \param y the year
+      /// \param m the month
+      /// \param d the day
+      constexpr year_month_day(const chrono::year& y,
+                               const chrono::month& m,
+                               const chrono::day& d) noexcept;
+
+      /// \brief Constructs the date of \p dp
+      ///
+      /// \param dp the days since the epoch
+      BPSTD_CPP14_CONSTEXPR year_month_day(const sys_days& dp) noexcept;
+
+      //------------------------------------------------------------------------
+      // Observers
+      //------------------------------------------------------------------------
+    public:
+
+      constexpr chrono::year year() const noexcept;
+      constexpr chrono::month month() const noexcept;
+      constexpr chrono::day day() const noexcept;
+
+      /// \brief Checks whether this is a valid date
+      constexpr bool ok() const noexcept;
+
+      //------------------------------------------------------------------------
+      // Conversions
+      //------------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the days since the epoch of this date
+      ///
+      /// \pre `ok()`
+      BPSTD_CPP14_CONSTEXPR operator sys_days() const noexcept;
+
+      //------------------------------------------------------------------------
+      // Private Members
+      //------------------------------------------------------------------------
+    private:
+
+      chrono::year m_year;
+      chrono::month m_month;
+      chrono::day m_day;
+    };
+
+    //==========================================================================
+    // non-member functions : calendar
+    //==========================================================================
+
+    //--------------------------------------------------------------------------
+    // Comparison
+    //--------------------------------------------------------------------------
+
+    constexpr bool operator==(const day& lhs, const day& rhs) noexcept;
+    constexpr bool operator!=(const day& lhs, const day& rhs) noexcept;
+    constexpr bool operator<(const day& lhs, const day& rhs) noexcept;
+    constexpr bool operator>(const day& lhs, const day& rhs) noexcept;
+    constexpr bool operator<=(const day& lhs, const day& rhs) noexcept;
+    constexpr bool operator>=(const day& lhs, const day& rhs) noexcept;
+
+    constexpr bool operator==(const month& lhs, const month& rhs) noexcept;
+    constexpr bool operator!=(const month& lhs, const month& rhs) noexcept;
+    constexpr bool operator<(const month& lhs, const month& rhs) noexcept;
+    constexpr bool operator>(const month& lhs, const month& rhs) noexcept;
+    constexpr bool operator<=(const month& lhs, const month& rhs) noexcept;
+    constexpr bool operator>=(const month& lhs, const month& rhs) noexcept;
+
+    constexpr bool operator==(const year& lhs, const year& rhs) noexcept;
+    constexpr bool operator!=(const year& lhs, const year& rhs) noexcept;
+    constexpr bool operator<(const year& lhs, const year& rhs) noexcept;
+    constexpr bool operator>(const year& lhs, const year& rhs) noexcept;
+    constexpr bool operator<=(const year& lhs, const year& rhs) noexcept;
+    constexpr bool operator>=(const year& lhs, const year& rhs) noexcept;
+
+    constexpr bool operator==(const year_month_day& lhs,
+                              const year_month_day& rhs) noexcept;
+    constexpr bool operator!=(const year_month_day& lhs,
+                              const year_month_day& rhs) noexcept;
+    constexpr bool operator<(const year_month_day& lhs,
+                             const year_month_day& rhs) noexcept;
+    constexpr bool operator>(const year_month_day& lhs,
+                             const year_month_day& rhs) noexcept;
+    constexpr bool operator<=(const year_month_day& lhs,
+                              const year_month_day& rhs) noexcept;
+    constexpr bool operator>=(const year_month_day& lhs,
+                              const year_month_day& rhs) noexcept;
+
+    //--------------------------------------------------------------------------
+    // ISO-8601
+    //--------------------------------------------------------------------------
+
+    /// \brief Formats \p tp as an ISO-8601 UTC timestamp into \p buffer
+    ///
+    /// The timestamp has the form `YYYY-MM-DDThh:mm:ss[.f...]Z`, where the
+    /// number of fractional digits is the fewest that can exactly represent
+    /// the precision of \p Duration, or 6 if no number of digits can.
+    ///
+    /// Nothing is allocated, and no locale or time zone is consulted.
+    ///
+    /// \param buffer the buffer to write into
+    /// \param tp the time point to format
+    /// \return the characters written, or an empty span if \p buffer is too
+    ///         small or the year of \p tp is not in [0, 9999]
+    template <typename Duration>
+    span<char> format_iso8601(span<char> buffer, sys_time<Duration> tp) noexcept;
+
+    /// \brief Parses an ISO-8601 timestamp from \p str
+    ///
+    /// The timestamp must have the form `YYYY-MM-DD`, optionally followed by
+    /// a 'T' (or a space) and a time `hh:mm:ss`. The time may have a
+    /// fraction of a second, introduced by '.' or ','; and a UTC offset of
+    /// 'Z', `+hh:mm`, `-hh:mm`, `+hhmm`, or `-hhmm`. A timestamp without an
+    /// offset is taken to be in UTC.
+    ///
+    /// Fractions are read to a precision of at most nanoseconds; the result
+    /// is rounded down to the precision of \p Duration.
+    ///
+    /// \param str the string to parse
+    /// \param tp the time point to set to the parsed time
+    /// \return true on success, or false if \p str is not entirely a valid
+    ///         timestamp, in which case \p tp is unchanged
+    template <typename Duration>
+    bool parse_iso8601(string_view str, sys_time<Duration>& tp) noexcept;
+
+    //==========================================================================
+    // class : tsc_clock
+    //==========================================================================
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A steady clock backed by the processor's time-stamp counter
+    ///
+    /// Reading the time-stamp counter is a single instruction, which avoids
+    /// the system call (or vDSO call) that steady_clock::now() goes through.
+    /// Ticks are converted to nanoseconds using a rate measured against
+    /// steady_clock the first time the clock is used, and times are offset
+    /// so that they share steady_clock's epoch.
+    ///
+    /// On platforms without a time-stamp counter, or where the counter is not
+    /// invariant under frequency scaling, this clock defers to steady_clock.
+    ///
+    /// \note Calibration spins for a few milliseconds on the first call to
+    ///       now(); call it once at startup to keep this off the hot path.
+    //////////////////////////////////////////////////////////////////////////
+    class tsc_clock : public detail::tsc_clock_base<>
+    {
+      //------------------------------------------------------------------------
+      // Public Member Types
+      //------------------------------------------------------------------------
+    public:
+
+      using rep        = std::int64_t;
+      using period     = std::nano;
+      using duration   = chrono::duration<rep, period>;
+      using time_point = chrono::time_point<tsc_clock>;
+
+      //------------------------------------------------------------------------
+      // Public Static Members
+      //------------------------------------------------------------------------
+    public:
+
+      using detail::tsc_clock_base<>::is_steady;
+
+      /// \brief Gets the current time
+      ///
+      /// \return the current time point
+      static time_point now() noexcept;
+
+      /// \brief Queries whether this clock reads the time-stamp counter, or
+      ///        defers to steady_clock
+      ///
+      /// \return true if the time-stamp counter is used
+      static bool is_tsc_based() noexcept;
+
+      //------------------------------------------------------------------------
+      // Private Member Types
+      //------------------------------------------------------------------------
+    private:
+
+      struct calibration
+      {
+        std::uint64_t base_ticks;
+        rep base_time;
+        double nanoseconds_per_tick;
+        bool use_tsc;
+      };
+
+      //------------------------------------------------------------------------
+      // Private Static Members
+      //------------------------------------------------------------------------
+    private:
+
+      static const calibration& get_calibration() noexcept;
+      static calibration calibrate() noexcept;
+      static rep steady_now() noexcept;
+    };
+
+    //==========================================================================
+    // class : scoped_timer
+    //==========================================================================
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief An RAII timer that reports the time elapsed over its lifetime
+    ///
+    /// On destruction, the sink is invoked with the elapsed Clock::duration.
+    /// The sink is held by reference, so no allocation or copying takes place;
+    /// it must outlive the timer.
+    ///
+    /// \tparam Sink a callable accepting a Clock::duration
+    /// \tparam Clock the clock to measure with
+    //////////////////////////////////////////////////////////////////////////
+    template <typename Sink, typename Clock = tsc_clock>
+    class scoped_timer
+    {
+      //------------------------------------------------------------------------
+      // Public Member Types
+      //------------------------------------------------------------------------
+    public:
+
+      using sink_type  = Sink;
+      using clock      = Clock;
+      using duration   = typename Clock::duration;
+      using time_point = typename Clock::time_point;
+
+      //------------------------------------------------------------------------
+      // Constructors / Destructor / Assignment
+      //------------------------------------------------------------------------
+    public:
+
+      /// \brief Starts a timer that reports to \p sink
+      ///
+      /// \param sink the sink to report the elapsed time to
+      explicit scoped_timer(Sink& sink) noexcept;
+      scoped_timer(const scoped_timer&) = delete;
+
+      //------------------------------------------------------------------------
+
+      /// \brief Invokes the sink with the elapsed time
+      ~scoped_timer();
+
+      //------------------------------------------------------------------------
+
+      scoped_timer& operator=(const scoped_timer&) = delete;
+
+      //------------------------------------------------------------------------
+      // Observers
+      //------------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the time elapsed since this timer started
+      ///
+      /// \return the elapsed time
+      duration elapsed() const noexcept;
+
+      //------------------------------------------------------------------------
+      // Private Members
+      //------------------------------------------------------------------------
+    private:
+
+      Sink& m_sink;
+      time_point m_start;
+    };
 
   } // namespace chrono
 
@@ -184,6 +764,887 @@ bpstd::chrono::duration<double, std::nano>
   return chrono::duration<double, std::nano>{x};
 }
 
+//==============================================================================
+// definitions : detail
+//==============================================================================
+
+#if !BPSTD_USE_STD_CHRONO_ROUNDING
+template <typename To, typename Duration>
+inline BPSTD_INLINE_VISIBILITY constexpr
+To bpstd::detail::round_duration(const Duration& d, const To& lower)
+{
+  return ((d - lower) < ((lower + To{1}) - d))
+    ? lower
+    : (((d - lower) > ((lower + To{1}) - d))
+      ? lower + To{1}
+      : (((lower.count() & 1) == 0) ? lower : lower + To{1}));
+}
+
+#endif // !BPSTD_USE_STD_CHRONO_ROUNDING
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::detail::is_leap_year(int y)
+  noexcept
+{
+  return (y % 4 == 0) && ((y % 100 != 0) || (y % 400 == 0));
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+unsigned bpstd::detail::last_day_of_month(int y, unsigned m)
+  noexcept
+{
+  return (m == 2u)
+    ? (is_leap_year(y) ? 29u : 28u)
+    : ((m == 4u || m == 6u || m == 9u || m == 11u) ? 30u : 31u);
+}
+
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+int bpstd::detail::days_from_civil(int y, unsigned m, unsigned d)
+  noexcept
+{
+  // Counts years from March, so that the leap day is the last of the year
+  y -= (m <= 2u) ? 1 : 0;
+  const auto era = ((y >= 0) ? y : y - 399) / 400;
+  const auto yoe = static_cast<unsigned>(y - era * 400);                // [0, 399]
+  const auto doy = (153u * ((m > 2u) ? m - 3u : m + 9u) + 2u) / 5u + d - 1u; // [0, 365]
+  const auto doe = yoe * 365u + yoe / 4u - yoe / 100u + doy;            // [0, 146096]
+
+  return era * 146097 + static_cast<int>(doe) - 719468;
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+std::intmax_t bpstd::detail::pow10(unsigned n)
+  noexcept
+{
+  return (n == 0u) ? 1 : 10 * pow10(n - 1u);
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+unsigned bpstd::detail::fractional_width(std::intmax_t den,
+                                         unsigned width,
+                                         std::intmax_t scale)
+  noexcept
+{
+  return (scale % den == 0)
+    ? width
+    : ((width == 18u) ? 6u : fractional_width(den, width + 1u, scale * 10));
+}
+
+inline
+char* bpstd::detail::write_iso8601_digits(char* p,
+                                          std::uint64_t value,
+                                          unsigned width)
+  noexcept
+{
+  for (auto i = width; i > 0u; --i) {
+    p[i - 1u] = static_cast<char>('0' + (value % 10u));
+    value /= 10u;
+  }
+  return p + width;
+}
+
+inline
+bool bpstd::detail::read_iso8601_digits(const char*& p,
+                                        const char* last,
+                                        unsigned width,
+                                        unsigned& value)
+  noexcept
+{
+  if (static_cast<std::size_t>(last - p) < width) {
+    return false;
+  }
+  auto result = 0u;
+  for (auto i = 0u; i < width; ++i) {
+    const auto c = p[i];
+    if (c < '0' || c > '9') {
+      return false;
+    }
+    result = result * 10u + static_cast<unsigned>(c - '0');
+  }
+  p += width;
+  value = result;
+  return true;
+}
+
+inline
+bool bpstd::detail::read_iso8601_char(const char*& p, const char* last, char c)
+  noexcept
+{
+  if (p == last || *p != c) {
+    return false;
+  }
+  ++p;
+  return true;
+}
+
+#if !BPSTD_USE_STD_CHRONO_ROUNDING
+
+//==============================================================================
+// non-member functions : rounding
+//==============================================================================
+
+template <typename To, typename Rep, typename Period, typename>
+inline BPSTD_INLINE_VISIBILITY constexpr
+To bpstd::chrono::floor(const duration<Rep,Period>& d)
+{
+  return (std::chrono::duration_cast<To>(d) > d)
+    ? std::chrono::duration_cast<To>(d) - To{1}
+    : std::chrono::duration_cast<To>(d);
+}
+
+template <typename To, typename Rep, typename Period, typename>
+inline BPSTD_INLINE_VISIBILITY constexpr
+To bpstd::chrono::ceil(const duration<Rep,Period>& d)
+{
+  return (std::chrono::duration_cast<To>(d) < d)
+    ? std::chrono::duration_cast<To>(d) + To{1}
+    : std::chrono::duration_cast<To>(d);
+}
+
+template <typename To, typename Rep, typename Period, typename>
+inline BPSTD_INLINE_VISIBILITY constexpr
+To bpstd::chrono::round(const duration<Rep,Period>& d)
+{
+  return detail::round_duration(d, chrono::floor<To>(d));
+}
+
+template <typename Rep, typename Period, typename>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::chrono::duration<Rep,Period>
+  bpstd::chrono::abs(duration<Rep,Period> d)
+{
+  return (d >= duration<Rep,Period>::zero()) ? d : -d;
+}
+
+//------------------------------------------------------------------------------
+
+template <typename To, typename Clock, typename Duration, typename>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::chrono::time_point<Clock,To>
+  bpstd::chrono::floor(const time_point<Clock,Duration>& tp)
+{
+  return time_point<Clock,To>{chrono::floor<To>(tp.time_since_epoch())};
+}
+
+template <typename To, typename Clock, typename Duration, typename>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::chrono::time_point<Clock,To>
+  bpstd::chrono::ceil(const time_point<Clock,Duration>& tp)
+{
+  return time_point<Clock,To>{chrono::ceil<To>(tp.time_since_epoch())};
+}
+
+template <typename To, typename Clock, typename Duration, typename>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::chrono::time_point<Clock,To>
+  bpstd::chrono::round(const time_point<Clock,Duration>& tp)
+{
+  return time_point<Clock,To>{chrono::round<To>(tp.time_since_epoch())};
+}
+
+#endif // !BPSTD_USE_STD_CHRONO_ROUNDING
+
+//==============================================================================
+// class : day
+//==============================================================================
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::chrono::day::day(unsigned d)
+  noexcept
+  : m_day(static_cast<unsigned char>(d))
+{
+
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::chrono::day::operator unsigned()
+  const noexcept
+{
+  return m_day;
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::chrono::day::ok()
+  const noexcept
+{
+  return m_day >= 1u && m_day <= 31u;
+}
+
+//==============================================================================
+// class : month
+//==============================================================================
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::chrono::month::month(unsigned m)
+  noexcept
+  : m_month(static_cast<unsigned char>(m))
+{
+
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::chrono::month::operator unsigned()
+  const noexcept
+{
+  return m_month;
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::chrono::month::ok()
+  const noexcept
+{
+  return m_month >= 1u && m_month <= 12u;
+}
+
+//==============================================================================
+// class : year
+//==============================================================================
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::chrono::year::year(int y)
+  noexcept
+  : m_year(static_cast<short>(y))
+{
+
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::chrono::year::operator int()
+  const noexcept
+{
+  return m_year;
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::chrono::year::ok()
+  const noexcept
+{
+  return m_year >= -32767;
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::chrono::year::is_leap()
+  const noexcept
+{
+  return detail::is_leap_year(m_year);
+}
+
+//==============================================================================
+// class : year_month_day
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::chrono::year_month_day::year_month_day(const chrono::year& y,
+                                              const chrono::month& m,
+                                              const chrono::day& d)
+  noexcept
+  : m_year(y),
+    m_month(m),
+    m_day(d)
+{
+
+}
+
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::chrono::year_month_day::year_month_day(const sys_days& dp)
+  noexcept
+  : m_year(),
+    m_month(),
+    m_day()
+{
+  // Hinnant's civil_from_days: shifts the epoch to 0000-03-01, so that each
+  // 400-year era starts on a March 1st and ends on a leap day
+  const auto z = dp.time_since_epoch().count() + 719468;
+  const auto era = ((z >= 0) ? z : z - 146096) / 146097;
+  const auto doe = static_cast<unsigned>(z - era * 146097);                  // [0, 146096]
+  const auto yoe = (doe - doe / 1460u + doe / 36524u - doe / 146096u) / 365u; // [0, 399]
+  const auto doy = doe - (365u * yoe + yoe / 4u - yoe / 100u);              // [0, 365]
+  const auto mp = (5u * doy + 2u) / 153u;                                   // [0, 11]
+  const auto d = doy - (153u * mp + 2u) / 5u + 1u;                          // [1, 31]
+  const auto m = (mp < 10u) ? mp + 3u : mp - 9u;                            // [1, 12]
+  const auto y = static_cast<int>(yoe) + static_cast<int>(era) * 400;
+
+  m_year = chrono::year{y + ((m <= 2u) ? 1 : 0)};
+  m_month = chrono::month{m};
+  m_day = chrono::day{d};
+}
+
+//------------------------------------------------------------------------------
+// Observers
+//------------------------------------------------------------------------------
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::chrono::year bpstd::chrono::year_month_day::year()
+  const noexcept
+{
+  return m_year;
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::chrono::month bpstd::chrono::year_month_day::month()
+  const noexcept
+{
+  return m_month;
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::chrono::day bpstd::chrono::year_month_day::day()
+  const noexcept
+{
+  return m_day;
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::chrono::year_month_day::ok()
+  const noexcept
+{
+  return m_year.ok() && m_month.ok() && m_day.ok() &&
+    static_cast<unsigned>(m_day) <= detail::last_day_of_month(
+      static_cast<int>(m_year),
+      static_cast<unsigned>(m_month)
+    );
+}
+
+//------------------------------------------------------------------------------
+// Conversions
+//------------------------------------------------------------------------------
+
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::chrono::year_month_day::operator sys_days()
+  const noexcept
+{
+  return sys_days{days{detail::days_from_civil(
+    static_cast<int>(m_year),
+    static_cast<unsigned>(m_month),
+    static_cast<unsigned>(m_day)
+  )}};
+}
+
+//==============================================================================
+// non-member functions : calendar
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Comparison
+//------------------------------------------------------------------------------
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::chrono::operator==(const day& lhs, const day& rhs)
+  noexcept
+{
+  return static_cast<unsigned>(lhs) == static_cast<unsigned>(rhs);
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::chrono::operator!=(const day& lhs, const day& rhs)
+  noexcept
+{
+  return !(lhs == rhs);
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::chrono::operator<(const day& lhs, const day& rhs)
+  noexcept
+{
+  return static_cast<unsigned>(lhs) < static_cast<unsigned>(rhs);
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::chrono::operator>(const day& lhs, const day& rhs)
+  noexcept
+{
+  return rhs < lhs;
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::chrono::operator<=(const day& lhs, const day& rhs)
+  noexcept
+{
+  return !(rhs < lhs);
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::chrono::operator>=(const day& lhs, const day& rhs)
+  noexcept
+{
+  return !(lhs < rhs);
+}
+
+//------------------------------------------------------------------------------
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::chrono::operator==(const month& lhs, const month& rhs)
+  noexcept
+{
+  return static_cast<unsigned>(lhs) == static_cast<unsigned>(rhs);
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::chrono::operator!=(const month& lhs, const month& rhs)
+  noexcept
+{
+  return !(lhs == rhs);
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::chrono::operator<(const month& lhs, const month& rhs)
+  noexcept
+{
+  return static_cast<unsigned>(lhs) < static_cast<unsigned>(rhs);
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::chrono::operator>(const month& lhs, const month& rhs)
+  noexcept
+{
+  return rhs < lhs;
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::chrono::operator<=(const month& lhs, const month& rhs)
+  noexcept
+{
+  return !(rhs < lhs);
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::chrono::operator>=(const month& lhs, const month& rhs)
+  noexcept
+{
+  return !(lhs < rhs);
+}
+
+//------------------------------------------------------------------------------
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::chrono::operator==(const year& lhs, const year& rhs)
+  noexcept
+{
+  return static_cast<int>(lhs) == static_cast<int>(rhs);
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::chrono::operator!=(const year& lhs, const year& rhs)
+  noexcept
+{
+  return !(lhs == rhs);
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::chrono::operator<(const year& lhs, const year& rhs)
+  noexcept
+{
+  return static_cast<int>(lhs) < static_cast<int>(rhs);
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::chrono::operator>(const year& lhs, const year& rhs)
+  noexcept
+{
+  return rhs < lhs;
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::chrono::operator<=(const year& lhs, const year& rhs)
+  noexcept
+{
+  return !(rhs < lhs);
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::chrono::operator>=(const year& lhs, const year& rhs)
+  noexcept
+{
+  return !(lhs < rhs);
+}
+
+//------------------------------------------------------------------------------
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::chrono::operator==(const year_month_day& lhs,
+                               const year_month_day& rhs)
+  noexcept
+{
+  return lhs.year() == rhs.year() &&
+         lhs.month() == rhs.month() &&
+         lhs.day() == rhs.day();
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::chrono::operator!=(const year_month_day& lhs,
+                               const year_month_day& rhs)
+  noexcept
+{
+  return !(lhs == rhs);
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::chrono::operator<(const year_month_day& lhs,
+                              const year_month_day& rhs)
+  noexcept
+{
+  return (lhs.year() != rhs.year())
+    ? (lhs.year() < rhs.year())
+    : ((lhs.month() != rhs.month())
+      ? (lhs.month() < rhs.month())
+      : (lhs.day() < rhs.day()));
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::chrono::operator>(const year_month_day& lhs,
+                              const year_month_day& rhs)
+  noexcept
+{
+  return rhs < lhs;
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::chrono::operator<=(const year_month_day& lhs,
+                               const year_month_day& rhs)
+  noexcept
+{
+  return !(rhs < lhs);
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::chrono::operator>=(const year_month_day& lhs,
+                               const year_month_day& rhs)
+  noexcept
+{
+  return !(lhs < rhs);
+}
+
+//------------------------------------------------------------------------------
+// ISO-8601
+//------------------------------------------------------------------------------
+
+template <typename Duration>
+inline
+bpstd::span<char>
+  bpstd::chrono::format_iso8601(span<char> buffer, sys_time<Duration> tp)
+  noexcept
+{
+  using precision = typename std::common_type<Duration, seconds>::type;
+  using fraction = chrono::duration<
+    std::int64_t,
+    std::ratio<1, detail::pow10(detail::fractional_width(precision::period::den))>
+  >;
+
+  const auto width = detail::fractional_width(precision::period::den);
+  const auto size = std::size_t{20u} + ((width > 0u) ? width + 1u : 0u);
+
+  const auto t = std::chrono::time_point_cast<precision>(tp);
+  const auto dp = chrono::floor<days>(t);
+  const auto ymd = year_month_day{dp};
+  const auto y = static_cast<int>(ymd.year());
+
+  if (y < 0 || y > 9999 || buffer.size() < size) {
+    return {};
+  }
+
+  // The time of day is non-negative, so truncating casts round it down
+  const auto tod = t - dp;
+  const auto s = std::chrono::duration_cast<seconds>(tod);
+  const auto secs = static_cast<std::uint64_t>(s.count());
+
+  auto* p = buffer.data();
+  p = detail::write_iso8601_digits(p, static_cast<std::uint64_t>(y), 4u);
+  *p++ = '-';
+  p = detail::write_iso8601_digits(p, static_cast<unsigned>(ymd.month()), 2u);
+  *p++ = '-';
+  p = detail::write_iso8601_digits(p, static_cast<unsigned>(ymd.day()), 2u);
+  *p++ = 'T';
+  p = detail::write_iso8601_digits(p, secs / 3600u, 2u);
+  *p++ = ':';
+  p = detail::write_iso8601_digits(p, (secs / 60u) % 60u, 2u);
+  *p++ = ':';
+  p = detail::write_iso8601_digits(p, secs % 60u, 2u);
+  if (width > 0u) {
+    const auto sub = std::chrono::duration_cast<fraction>(tod - s);
+    *p++ = '.';
+    p = detail::write_iso8601_digits(p, static_cast<std::uint64_t>(sub.count()), width);
+  }
+  *p = 'Z';
+
+  return buffer.first(size);
+}
+
+template <typename Duration>
+inline
+bool bpstd::chrono::parse_iso8601(string_view str, sys_time<Duration>& tp)
+  noexcept
+{
+  const auto* p = str.data();
+  const auto* const last = p + str.size();
+
+  auto y = 0u;
+  auto mo = 0u;
+  auto d = 0u;
+  if (!detail::read_iso8601_digits(p, last, 4u, y) ||
+      !detail::read_iso8601_char(p, last, '-') ||
+      !detail::read_iso8601_digits(p, last, 2u, mo) ||
+      !detail::read_iso8601_char(p, last, '-') ||
+      !detail::read_iso8601_digits(p, last, 2u, d)) {
+    return false;
+  }
+  const auto ymd = year_month_day{
+    chrono::year{static_cast<int>(y)},
+    chrono::month{mo},
+    chrono::day{d}
+  };
+  if (!ymd.ok()) {
+    return false;
+  }
+
+  // Seconds since midnight, less the UTC offset
+  auto secs = std::int64_t{0};
+  auto nanos = std::int64_t{0};
+
+  if (p != last) {
+    if (*p != 'T' && *p != 't' && *p != ' ') {
+      return false;
+    }
+    ++p;
+
+    auto h = 0u;
+    auto mi = 0u;
+    auto s = 0u;
+    if (!detail::read_iso8601_digits(p, last, 2u, h) ||
+        !detail::read_iso8601_char(p, last, ':') ||
+        !detail::read_iso8601_digits(p, last, 2u, mi) ||
+        !detail::read_iso8601_char(p, last, ':') ||
+        !detail::read_iso8601_digits(p, last, 2u, s) ||
+        h > 23u || mi > 59u || s > 59u) {
+      return false;
+    }
+    secs = static_cast<std::int64_t>(h * 3600u + mi * 60u + s);
+
+    if (p != last && (*p == '.' || *p == ',')) {
+      ++p;
+      const auto* const first_digit = p;
+      auto scale = std::int64_t{100000000};
+      for (; p != last && *p >= '0' && *p <= '9'; ++p) {
+        nanos += (*p - '0') * scale;
+        scale /= 10;
+      }
+      if (p == first_digit) {
+        return false;
+      }
+    }
+
+    if (p != last) {
+      if (*p == 'Z' || *p == 'z') {
+        ++p;
+      } else if (*p == '+' || *p == '-') {
+        const auto sign = (*p == '+') ? 1 : -1;
+        ++p;
+
+        auto oh = 0u;
+        auto om = 0u;
+        if (!detail::read_iso8601_digits(p, last, 2u, oh)) {
+          return false;
+        }
+        if (p != last && *p == ':') {
+          ++p;
+        }
+        if (!detail::read_iso8601_digits(p, last, 2u, om) ||
+            oh > 23u || om > 59u) {
+          return false;
+        }
+        secs -= sign * static_cast<std::int64_t>(oh * 3600u + om * 60u);
+      } else {
+        return false;
+      }
+    }
+  }
+
+  if (p != last) {
+    return false;
+  }
+
+  // The fraction is under a second, so it cannot change which multiple of a
+  // coarser Duration the whole seconds round down to
+  const auto whole = sys_seconds{sys_days{ymd}} + seconds{secs};
+
+  tp = sys_time<Duration>{
+    chrono::floor<Duration>(whole.time_since_epoch()) +
+    std::chrono::duration_cast<Duration>(nanoseconds{nanos})
+  };
+  return true;
+}
+
+//==============================================================================
+// struct : tsc_clock_base
+//==============================================================================
+
+template <typename T>
+constexpr bool bpstd::detail::tsc_clock_base<T>::is_steady;
+
+//==============================================================================
+// class : tsc_clock
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Public Static Members
+//------------------------------------------------------------------------------
+
+inline
+bpstd::chrono::tsc_clock::time_point bpstd::chrono::tsc_clock::now()
+  noexcept
+{
+  const auto& c = get_calibration();
+
+  if (!c.use_tsc) {
+    return time_point{duration{steady_now()}};
+  }
+
+  // The difference is signed, since the counters of different cores may be
+  // very slightly out of step with the one that was calibrated against
+  const auto ticks = static_cast<std::int64_t>(detail::read_tsc() - c.base_ticks);
+  const auto elapsed = static_cast<double>(ticks) * c.nanoseconds_per_tick;
+
+  return time_point{duration{c.base_time + static_cast<rep>(elapsed)}};
+}
+
+inline
+bool bpstd::chrono::tsc_clock::is_tsc_based()
+  noexcept
+{
+  return get_calibration().use_tsc;
+}
+
+//------------------------------------------------------------------------------
+// Private Static Members
+//------------------------------------------------------------------------------
+
+inline
+const bpstd::chrono::tsc_clock::calibration&
+  bpstd::chrono::tsc_clock::get_calibration()
+  noexcept
+{
+  // Not BPSTD_INLINE_VISIBILITY, so that every module shares one calibration
+  static const auto s_calibration = calibrate();
+
+  return s_calibration;
+}
+
+inline
+bpstd::chrono::tsc_clock::calibration bpstd::chrono::tsc_clock::calibrate()
+  noexcept
+{
+  const auto no_tsc = calibration{0u, 0, 0.0, false};
+
+  if (!detail::has_invariant_tsc()) {
+    return no_tsc;
+  }
+
+  // Samples steady_clock between two counter reads, taking the midpoint of
+  // the reads as the counter's value at that time. The tightest of several
+  // attempts is kept, which discards reads that were preempted or that paid
+  // for first-use costs of steady_clock.
+  struct sample
+  {
+    std::uint64_t ticks;
+    rep time;
+  };
+  const auto take_sample = []() noexcept -> sample {
+    auto best = sample{0u, 0};
+    auto best_span = ~std::uint64_t{0u};
+
+    for (auto i = 0; i < 8; ++i) {
+      const auto before = detail::read_tsc();
+      const auto time = steady_now();
+      const auto after = detail::read_tsc();
+      const auto span = after - before;
+
+      if (span < best_span) {
+        best = sample{before + span / 2u, time};
+        best_span = span;
+      }
+    }
+    return best;
+  };
+
+  // 10ms is long enough for the error of each sample to fall to a few parts
+  // per million of the measured rate
+  const auto window = std::chrono::duration_cast<duration>(
+    std::chrono::milliseconds{10}
+  ).count();
+
+  const auto first = take_sample();
+  auto last = take_sample();
+  while (last.time - first.time < window) {
+    last = take_sample();
+  }
+
+  if (last.ticks <= first.ticks) {
+    return no_tsc;
+  }
+
+  const auto elapsed_time = static_cast<double>(last.time - first.time);
+  const auto elapsed_ticks = static_cast<double>(last.ticks - first.ticks);
+
+  return calibration{
+    last.ticks,
+    last.time,
+    elapsed_time / elapsed_ticks,
+    true
+  };
+}
+
+inline
+bpstd::chrono::tsc_clock::rep bpstd::chrono::tsc_clock::steady_now()
+  noexcept
+{
+  const auto now = steady_clock::now().time_since_epoch();
+
+  return std::chrono::duration_cast<duration>(now).count();
+}
+
+//==============================================================================
+// class : scoped_timer
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Constructors / Destructor / Assignment
+//------------------------------------------------------------------------------
+
+template <typename Sink, typename Clock>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::chrono::scoped_timer<Sink,Clock>::scoped_timer(Sink& sink)
+  noexcept
+  : m_sink(sink),
+    m_start(Clock::now())
+{
+
+}
+
+//------------------------------------------------------------------------------
+
+template <typename Sink, typename Clock>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::chrono::scoped_timer<Sink,Clock>::~scoped_timer()
+{
+  m_sink(elapsed());
+}
+
+//------------------------------------------------------------------------------
+// Observers
+//------------------------------------------------------------------------------
+
+template <typename Sink, typename Clock>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::chrono::scoped_timer<Sink,Clock>::duration
+  bpstd::chrono::scoped_timer<Sink,Clock>::elapsed()
+  const noexcept
+{
+  return Clock::now() - m_start;
+}
+
 BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
 
 #endif /* BPSTD_CHRONO_HPP */
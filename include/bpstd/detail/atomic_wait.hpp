@@ -0,0 +1,534 @@
+/*****************************************************************************
+ * \file atomic_wait.hpp
+ *
+ * \brief This internal header provides the blocking waits used to implement
+ *        atomic waiting and the synchronization primitives
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_DETAIL_ATOMIC_WAIT_HPP
+#define BPSTD_DETAIL_ATOMIC_WAIT_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "config.hpp"
+
+#include "../type_traits.hpp" // bool_constant, true_type, false_type
+
+#include <atomic>  // std::atomic, std::atomic_thread_fence
+#include <chrono>  // std::chrono::steady_clock, std::chrono::nanoseconds
+#include <cstdint> // std::int32_t, std::uintptr_t
+#include <cstring> // std::memcmp, std::memcpy
+#include <memory>  // std::addressof
+#include <thread>  // std::this_thread::yield
+
+#if defined(__linux__)
+# define BPSTD_DETAIL_HAS_FUTEX 1
+# include <linux/futex.h> // FUTEX_WAIT_PRIVATE, FUTEX_WAKE_PRIVATE
+# include <sys/syscall.h> // SYS_futex
+# include <unistd.h>      // ::syscall
+# include <climits>       // INT_MAX
+# include <ctime>         // ::timespec
+#else
+# define BPSTD_DETAIL_HAS_FUTEX 0
+# include <condition_variable> // std::condition_variable
+# include <mutex>              // std::mutex, std::unique_lock
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+# include <intrin.h> // _mm_pause
+#endif
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+  namespace detail {
+
+    //==========================================================================
+    // spinning
+    //==========================================================================
+
+    /// \brief Hints to the processor that the calling thread is spinning
+    inline void cpu_relax()
+      noexcept
+    {
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+      ::_mm_pause();
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__))
+      __builtin_ia32_pause();
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+      __asm__ __volatile__("yield");
+#endif
+    }
+
+    /// \brief Compares the value representations of \p lhs and \p rhs, as
+    ///        atomic waits do
+    template <typename T>
+    inline bool atomic_equals(const T& lhs, const T& rhs)
+      noexcept
+    {
+      return std::memcmp(std::addressof(lhs), std::addressof(rhs), sizeof(T)) == 0;
+    }
+
+    /// \brief Spins, and then yields, for a bounded amount of time while
+    ///        \p load returns \p old
+    ///
+    /// Most waits are short; spinning lets them complete without a trip into
+    /// the kernel on either side.
+    ///
+    /// \param load a function that atomically loads the value to spin on
+    /// \param old the value to spin while seeing
+    /// \return true if the loaded value changed from \p old
+    template <typename Load, typename T>
+    inline bool spin_while_loads_equal(const Load& load, const T& old)
+      noexcept
+    {
+      static constexpr auto spin_count  = 128;
+      static constexpr auto yield_count = 16;
+
+      for (auto i = 0; i < spin_count; ++i) {
+        if (!atomic_equals(load(), old)) {
+          return true;
+        }
+        cpu_relax();
+      }
+      for (auto i = 0; i < yield_count; ++i) {
+        if (!atomic_equals(load(), old)) {
+          return true;
+        }
+        std::this_thread::yield();
+      }
+      return false;
+    }
+
+    /// \brief Spins, and then yields, for a bounded amount of time while
+    ///        \p value holds \p old
+    ///
+    /// \param value the value to spin on
+    /// \param old the value to spin while seeing
+    /// \param order the memory order to load \p value with
+    /// \return true if \p value changed from \p old
+    template <typename T>
+    inline bool spin_while_equal(const std::atomic<T>& value,
+                                 const T& old,
+                                 std::memory_order order = std::memory_order_acquire)
+      noexcept
+    {
+      return spin_while_loads_equal([&value, order]{
+        return value.load(order);
+      }, old);
+    }
+
+    //==========================================================================
+    // parking
+    //==========================================================================
+
+    // The functions below park the calling thread on a 32-bit word for as
+    // long as it holds 'old', and wake threads parked on it. As with a futex,
+    // a wait may return spuriously, and a waker must have changed the word
+    // before waking.
+
+#if BPSTD_DETAIL_HAS_FUTEX
+
+    static_assert(
+      sizeof(std::atomic<std::int32_t>) == sizeof(std::int32_t),
+      "A futex must be a plain 32-bit word"
+    );
+
+    inline void futex_wait(const void* address, std::int32_t old)
+      noexcept
+    {
+      ::syscall(SYS_futex, address, FUTEX_WAIT_PRIVATE, old, nullptr, nullptr, 0);
+    }
+
+    inline void futex_wait_for(const void* address,
+                               std::int32_t old,
+                               std::chrono::nanoseconds timeout)
+      noexcept
+    {
+      using seconds_type = std::chrono::duration<::time_t>;
+
+      const auto seconds = std::chrono::duration_cast<seconds_type>(timeout);
+      auto ts = ::timespec{};
+      ts.tv_sec  = seconds.count();
+      ts.tv_nsec = static_cast<long>((timeout - seconds).count());
+
+      ::syscall(SYS_futex, address, FUTEX_WAIT_PRIVATE, old, &ts, nullptr, 0);
+    }
+
+    inline void futex_wake(const void* address, bool all)
+      noexcept
+    {
+      ::syscall(SYS_futex, address, FUTEX_WAKE_PRIVATE, all ? INT_MAX : 1,
+                nullptr, nullptr, 0);
+    }
+
+    inline void platform_wait(const std::atomic<std::int32_t>& value,
+                              std::int32_t old)
+      noexcept
+    {
+      futex_wait(&value, old);
+    }
+
+    inline void platform_wait_for(const std::atomic<std::int32_t>& value,
+                                  std::int32_t old,
+                                  std::chrono::nanoseconds timeout)
+      noexcept
+    {
+      futex_wait_for(&value, old, timeout);
+    }
+
+    inline void platform_notify(const std::atomic<std::int32_t>& value,
+                                bool all)
+      noexcept
+    {
+      futex_wake(&value, all);
+    }
+
+    /// \brief Whether a std::atomic<T> can be used as a futex directly
+    template <typename T>
+    struct is_futex_word : bool_constant<
+      sizeof(std::atomic<T>) == sizeof(std::int32_t) &&
+      alignof(std::atomic<T>) >= alignof(std::int32_t)
+    >{};
+
+#else
+
+    template <typename T>
+    struct is_futex_word : false_type{};
+
+#endif // BPSTD_DETAIL_HAS_FUTEX
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The state shared by every address that hashes to the same
+    ///        bucket
+    ///////////////////////////////////////////////////////////////////////////
+    struct alignas(64) wait_bucket
+    {
+      std::atomic<std::int32_t> waiters; // threads parked on any address
+      std::atomic<std::int32_t> version; // bumped to wake those threads
+#if !BPSTD_DETAIL_HAS_FUTEX
+      std::mutex mutex;
+      std::condition_variable condition;
+#endif
+    };
+
+    inline wait_bucket& wait_bucket_for(const void* address)
+      noexcept
+    {
+      static constexpr auto bucket_count = std::uintptr_t{16u};
+      static wait_bucket buckets[bucket_count];
+
+      const auto key = reinterpret_cast<std::uintptr_t>(address);
+
+      return buckets[(key >> 6u) % bucket_count];
+    }
+
+#if !BPSTD_DETAIL_HAS_FUTEX
+
+    inline void platform_wait(const std::atomic<std::int32_t>& value,
+                              std::int32_t old)
+      noexcept
+    {
+      auto& bucket = wait_bucket_for(&value);
+      auto lock = std::unique_lock<std::mutex>{bucket.mutex};
+      if (value.load() == old) {
+        bucket.condition.wait(lock);
+      }
+    }
+
+    inline void platform_wait_for(const std::atomic<std::int32_t>& value,
+                                  std::int32_t old,
+                                  std::chrono::nanoseconds timeout)
+      noexcept
+    {
+      auto& bucket = wait_bucket_for(&value);
+      auto lock = std::unique_lock<std::mutex>{bucket.mutex};
+      if (value.load() == old) {
+        bucket.condition.wait_for(lock, timeout);
+      }
+    }
+
+    inline void platform_notify(const std::atomic<std::int32_t>& value,
+                                bool all)
+      noexcept
+    {
+      BPSTD_UNUSED(all); // the bucket may be shared with other addresses
+
+      auto& bucket = wait_bucket_for(&value);
+      {
+        // Taking the lock orders this notification after any waiter that
+        // has checked 'value', but not yet started waiting
+        std::lock_guard<std::mutex> lock{bucket.mutex};
+      }
+      bucket.condition.notify_all();
+    }
+
+#endif // !BPSTD_DETAIL_HAS_FUTEX
+
+    //==========================================================================
+    // waiting : 32-bit counters
+    //==========================================================================
+
+    /// \brief Blocks the calling thread until \p value no longer holds \p old
+    ///
+    /// \p waiters counts the threads parked on \p value, which allows the
+    /// notifying side to skip the system call when nobody is parked.
+    ///
+    /// \param value the value to wait on
+    /// \param old the value to wait while seeing
+    /// \param waiters the count of parked threads
+    inline void wait_while_equal(const std::atomic<std::int32_t>& value,
+                                 std::int32_t old,
+                                 std::atomic<std::int32_t>& waiters)
+      noexcept
+    {
+      if (spin_while_equal(value, old)) {
+        return;
+      }
+
+      // Both this increment and the load below are sequentially consistent,
+      // as is the modification made by the notifying side before it reads
+      // 'waiters'; so either this sees the new value, or the notifier sees
+      // this waiter
+      waiters.fetch_add(1);
+      while (value.load() == old) {
+        platform_wait(value, old);
+      }
+      waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /// \brief Blocks the calling thread until \p value no longer holds \p old,
+    ///        or until \p deadline is reached
+    ///
+    /// \param value the value to wait on
+    /// \param old the value to wait while seeing
+    /// \param waiters the count of parked threads
+    /// \param deadline the time to stop waiting at
+    /// \return true if \p value changed from \p old
+    inline bool wait_while_equal_until(const std::atomic<std::int32_t>& value,
+                                       std::int32_t old,
+                                       std::atomic<std::int32_t>& waiters,
+                                       std::chrono::steady_clock::time_point deadline)
+      noexcept
+    {
+      if (spin_while_equal(value, old)) {
+        return true;
+      }
+
+      auto changed = true;
+      waiters.fetch_add(1);
+      while (value.load() == old) {
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= deadline) {
+          changed = false;
+          break;
+        }
+        platform_wait_for(value, old, deadline - now);
+      }
+      waiters.fetch_sub(1, std::memory_order_relaxed);
+
+      return changed;
+    }
+
+    /// \brief Wakes threads that are parked on \p value
+    ///
+    /// \p value must be modified with a sequentially consistent operation
+    /// before calling this
+    ///
+    /// \param value the value that was modified
+    /// \param waiters the count of parked threads
+    /// \param all whether to wake every parked thread, rather than one
+    inline void notify_waiters(const std::atomic<std::int32_t>& value,
+                               std::atomic<std::int32_t>& waiters,
+                               bool all)
+      noexcept
+    {
+      if (waiters.load() != 0) {
+        platform_notify(value, all);
+      }
+    }
+
+    //==========================================================================
+    // waiting : any atomic
+    //==========================================================================
+
+    // Objects that are not a futex word park on the version of their bucket
+    // instead, which every notification of an address in that bucket bumps.
+    // Parked threads are counted per bucket, so that notifying an address
+    // nobody waits on never makes a system call.
+    //
+    // The notifying side may have modified the object with any memory order,
+    // so both sides separate their modification from their check with a
+    // sequentially consistent fence.
+
+    template <typename Load, typename T>
+    inline void park_while_equal(const void* address,
+                                 const Load& load,
+                                 const T& old,
+                                 wait_bucket& bucket,
+                                 true_type /* is futex word */)
+      noexcept
+    {
+#if BPSTD_DETAIL_HAS_FUTEX
+      auto word = std::int32_t{};
+      std::memcpy(&word, std::addressof(old), sizeof(word));
+
+      while (atomic_equals(load(), old)) {
+        futex_wait(address, word);
+      }
+#else
+      BPSTD_UNUSED(address);
+      BPSTD_UNUSED(load);
+      BPSTD_UNUSED(old);
+#endif
+      BPSTD_UNUSED(bucket);
+    }
+
+    template <typename Load, typename T>
+    inline void park_while_equal(const void* address,
+                                 const Load& load,
+                                 const T& old,
+                                 wait_bucket& bucket,
+                                 false_type /* is futex word */)
+      noexcept
+    {
+      BPSTD_UNUSED(address);
+
+      while (true) {
+        // The version is read before the value is checked, so a
+        // notification that lands in between makes the wait return at once
+        const auto version = bucket.version.load();
+        if (!atomic_equals(load(), old)) {
+          break;
+        }
+        platform_wait(bucket.version, version);
+      }
+    }
+
+    /// \brief Blocks the calling thread until the object at \p address no
+    ///        longer holds \p old, as compared by value representation
+    ///
+    /// \param address the address of the object to wait on
+    /// \param load a function that atomically loads the object
+    /// \param old the value to wait while seeing
+    template <typename Load, typename T>
+    inline void atomic_wait_at(const void* address, const Load& load, T old)
+      noexcept
+    {
+      if (spin_while_loads_equal(load, old)) {
+        return;
+      }
+
+      auto& bucket = wait_bucket_for(address);
+
+      bucket.waiters.fetch_add(1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      park_while_equal(address, load, old, bucket, is_futex_word<T>{});
+      bucket.waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /// \brief Blocks the calling thread until \p value no longer holds
+    ///        \p old, as compared by value representation
+    ///
+    /// \param value the value to wait on
+    /// \param old the value to wait while seeing
+    /// \param order the memory order to load \p value with
+    template <typename T>
+    inline void atomic_wait(const std::atomic<T>& value,
+                            T old,
+                            std::memory_order order)
+      noexcept
+    {
+      atomic_wait_at(std::addressof(value), [&value, order]{
+        return value.load(order);
+      }, old);
+    }
+
+    inline void notify_parked(const void* address,
+                              bool all,
+                              wait_bucket& bucket,
+                              true_type /* is futex word */)
+      noexcept
+    {
+#if BPSTD_DETAIL_HAS_FUTEX
+      futex_wake(address, all);
+#else
+      BPSTD_UNUSED(address);
+      BPSTD_UNUSED(all);
+#endif
+      BPSTD_UNUSED(bucket);
+    }
+
+    inline void notify_parked(const void* address,
+                              bool all,
+                              wait_bucket& bucket,
+                              false_type /* is futex word */)
+      noexcept
+    {
+      BPSTD_UNUSED(address);
+      BPSTD_UNUSED(all); // other addresses may share the bucket
+
+      bucket.version.fetch_add(1);
+      platform_notify(bucket.version, true);
+    }
+
+    /// \brief Wakes threads waiting on the object of type \p T at \p address
+    ///        with atomic_wait_at
+    ///
+    /// \param address the address of the object that was modified
+    /// \param all whether to wake every waiting thread, rather than one
+    template <typename T>
+    inline void atomic_notify_at(const void* address, bool all)
+      noexcept
+    {
+      auto& bucket = wait_bucket_for(address);
+
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (bucket.waiters.load(std::memory_order_relaxed) == 0) {
+        return;
+      }
+      notify_parked(address, all, bucket, is_futex_word<T>{});
+    }
+
+    /// \brief Wakes threads waiting on \p value with atomic_wait
+    ///
+    /// \param value the value that was modified
+    /// \param all whether to wake every waiting thread, rather than one
+    template <typename T>
+    inline void atomic_notify(const std::atomic<T>& value, bool all)
+      noexcept
+    {
+      atomic_notify_at<T>(std::addressof(value), all);
+    }
+
+  } // namespace detail
+} // namespace bpstd
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_DETAIL_ATOMIC_WAIT_HPP */
@@ -0,0 +1,936 @@
+/*****************************************************************************
+ * \file charconv_float.hpp
+ *
+ * \brief This internal header provides the binary/decimal conversion
+ *        algorithms behind the floating-point overloads of 'to_chars' and
+ *        'from_chars'
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_DETAIL_CHARCONV_FLOAT_HPP
+#define BPSTD_DETAIL_CHARCONV_FLOAT_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "config.hpp"
+#include "hash.hpp"        // hash_multiply
+#include "pow10_table.hpp" // pow10_table
+
+#include "../bit.hpp" // bit_cast, countl_zero
+
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t, std::uint64_t, std::int64_t
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+  namespace detail {
+
+    //==========================================================================
+    // struct : float_traits
+    //==========================================================================
+
+    /// \brief The properties of an IEEE-754 binary floating-point format
+    template <typename T>
+    struct float_traits;
+
+    template <>
+    struct float_traits<double>
+    {
+      using bits_type = std::uint64_t;
+
+      static constexpr int significand_bits    = 52; // excluding the hidden bit
+      static constexpr int exponent_bias       = 1023;
+      static constexpr int max_biased_exponent = 2047;
+
+      // The range of decimal exponents outside of which every value rounds
+      // to zero or infinity
+      static constexpr int min_decimal_exponent = -342;
+      static constexpr int max_decimal_exponent = 308;
+
+      // The range of decimal exponents for which an exact tie between two
+      // representable values is possible
+      static constexpr int min_round_to_even_exponent = -4;
+      static constexpr int max_round_to_even_exponent = 23;
+
+      // The largest integer and power of ten that are exactly representable
+      static constexpr std::uint64_t max_exact_integer = std::uint64_t{1u} << 53;
+      static constexpr int max_exact_power10 = 22;
+
+      // The number of significant decimal digits beyond which no digit can
+      // affect rounding, other than by being nonzero
+      static constexpr int max_digits = 769;
+    };
+
+    template <>
+    struct float_traits<float>
+    {
+      using bits_type = std::uint32_t;
+
+      static constexpr int significand_bits    = 23;
+      static constexpr int exponent_bias       = 127;
+      static constexpr int max_biased_exponent = 255;
+
+      static constexpr int min_decimal_exponent = -65;
+      static constexpr int max_decimal_exponent = 38;
+
+      static constexpr int min_round_to_even_exponent = -17;
+      static constexpr int max_round_to_even_exponent = 10;
+
+      static constexpr std::uint64_t max_exact_integer = std::uint64_t{1u} << 24;
+      static constexpr int max_exact_power10 = 10;
+
+      static constexpr int max_digits = 114;
+    };
+
+    //==========================================================================
+    // Utilities
+    //==========================================================================
+
+    template <typename T>
+    typename float_traits<T>::bits_type float_to_bits(T value) noexcept;
+
+    template <typename T>
+    T float_from_bits(typename float_traits<T>::bits_type bits) noexcept;
+
+    struct uint128_parts
+    {
+      std::uint64_t high;
+      std::uint64_t low;
+    };
+
+    /// \brief Computes the full 128-bit product of \p a and \p b
+    uint128_parts multiply_128(std::uint64_t a, std::uint64_t b) noexcept;
+
+    /// \brief Gets the significand of 10^\p e from the pow10 table
+    uint128_parts pow10_significand(int e) noexcept;
+
+    // Each computes floor(log_b(x)) exactly, for the ranges of exponents that
+    // binary64 requires
+    constexpr int floor_log10_pow2(int e) noexcept;
+    constexpr int floor_log10_three_quarters_pow2(int e) noexcept;
+    constexpr int floor_log2_pow10(int e) noexcept;
+
+    //==========================================================================
+    // Binary to decimal
+    //==========================================================================
+
+    /// \brief A decimal floating-point value: significand * 10^exponent
+    struct decimal_fp
+    {
+      std::uint64_t significand;
+      int exponent;
+    };
+
+    /// \brief Computes the shortest decimal representation that uniquely
+    ///        identifies a finite, nonzero binary floating-point value
+    ///
+    /// Of all decimals in the rounding interval of the value, this yields one
+    /// with the fewest significant digits, preferring the one closest to the
+    /// value. The significand never has trailing zeros.
+    ///
+    /// This is the "Schubfach" algorithm by Raffaello Giulietti, which needs
+    /// only three 64x128-bit multiplications and no loops or bignums.
+    ///
+    /// \param significand the stored significand bits
+    /// \param exponent the stored (biased) exponent bits
+    /// \return the shortest decimal representation
+    template <typename T>
+    decimal_fp to_shortest_decimal(typename float_traits<T>::bits_type significand,
+                                   int exponent) noexcept;
+
+    //==========================================================================
+    // class : charconv_bigint
+    //==========================================================================
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A fixed-capacity arbitrary-precision unsigned integer
+    ///
+    /// This is only ever used on the slow paths of conversions, where exact
+    /// arithmetic is unavoidable: formatting the exact digits of large
+    /// integral values, and deciding the rounding of decimal inputs that lie
+    /// almost exactly between two binary values.
+    //////////////////////////////////////////////////////////////////////////
+    class charconv_bigint
+    {
+    public:
+
+      // Large enough for 769 decimal digits scaled by every power of two and
+      // five that may be compared against them
+      static constexpr std::size_t max_limbs = 128;
+
+      explicit charconv_bigint(std::uint64_t value = 0u) noexcept;
+
+      void multiply(std::uint32_t factor) noexcept;
+      void add(std::uint32_t value) noexcept;
+      void multiply_pow5(unsigned exponent) noexcept;
+      void shift_left(unsigned bits) noexcept;
+
+      /// \brief Divides this integer by \p divisor in place
+      ///
+      /// \return the remainder
+      std::uint32_t divide(std::uint32_t divisor) noexcept;
+
+      bool is_zero() const noexcept;
+
+      /// \return a negative value, zero, or a positive value if this is less
+      ///         than, equal to, or greater than \p other
+      int compare(const charconv_bigint& other) const noexcept;
+
+    private:
+
+      std::uint32_t m_limbs[max_limbs];
+      std::size_t m_size;
+    };
+
+    /// \brief Writes the decimal digits of the integer \p significand * 2^\p
+    ///        exponent to \p buffer, which must hold at least 310 characters
+    ///
+    /// \return the number of digits written
+    std::size_t write_exact_integer(char* buffer,
+                                    std::uint64_t significand,
+                                    int exponent) noexcept;
+
+    //==========================================================================
+    // Decimal to binary
+    //==========================================================================
+
+    /// \brief A binary floating-point value with a biased exponent, as it is
+    ///        stored, except that the significand may carry into the hidden
+    ///        bit to indicate the smallest normal value
+    struct adjusted_mantissa
+    {
+      std::uint64_t mantissa;
+      int power2;
+    };
+
+    /// \brief Rounds \p w * 10^\p q to the nearest value of \p T
+    ///
+    /// This is the Eisel-Lemire algorithm: a 64x128-bit product with the
+    /// power of ten yields the correctly rounded result, except for rare
+    /// inputs lying extremely close to halfway between two values, which are
+    /// reported as \p ambiguous. The result is within one unit in the last
+    /// place even when ambiguous.
+    ///
+    /// \param q the decimal exponent
+    /// \param w the decimal significand
+    /// \param ambiguous set to true if the result may be incorrectly rounded
+    /// \return the rounded value
+    template <typename T>
+    adjusted_mantissa compute_float(std::int64_t q,
+                                    std::uint64_t w,
+                                    bool& ambiguous) noexcept;
+
+    /// \brief Correctly rounds the decimal number whose digits, with at most
+    ///        one decimal point, are [first, last) and which is scaled by
+    ///        10^\p exponent
+    ///
+    /// This compares the number exactly against the midpoints of the values
+    /// neighbouring \p estimate, which must be within a unit in the last
+    /// place of the result.
+    ///
+    /// \param first the start of the digits
+    /// \param last the end of the digits
+    /// \param exponent the decimal exponent that scales the digits
+    /// \param estimate an estimate of the result
+    /// \return the correctly rounded value
+    template <typename T>
+    adjusted_mantissa compute_float_exact(const char* first,
+                                          const char* last,
+                                          std::int64_t exponent,
+                                          adjusted_mantissa estimate) noexcept;
+
+    /// \brief Rounds \p significand * 2^\p exponent, plus a nonzero amount
+    ///        less than one unit of \p significand if \p sticky, to the
+    ///        nearest value of \p T
+    template <typename T>
+    adjusted_mantissa round_binary(std::uint64_t significand,
+                                   std::int64_t exponent,
+                                   bool sticky) noexcept;
+
+  } // namespace detail
+} // namespace bpstd
+
+//==============================================================================
+// definitions : Utilities
+//==============================================================================
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::detail::float_traits<T>::bits_type
+  bpstd::detail::float_to_bits(T value)
+  noexcept
+{
+  return bit_cast<typename float_traits<T>::bits_type>(value);
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+T bpstd::detail::float_from_bits(typename float_traits<T>::bits_type bits)
+  noexcept
+{
+  return bit_cast<T>(bits);
+}
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::detail::uint128_parts
+  bpstd::detail::multiply_128(std::uint64_t a, std::uint64_t b)
+  noexcept
+{
+  hash_multiply(a, b);
+  return {b, a};
+}
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::detail::uint128_parts bpstd::detail::pow10_significand(int e)
+  noexcept
+{
+  using table = pow10_table<>;
+
+  const auto index = static_cast<std::size_t>(e - table::min_exponent) * 2u;
+  return {table::significands[index], table::significands[index + 1u]};
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+int bpstd::detail::floor_log10_pow2(int e)
+  noexcept
+{
+  return (e * 315653) >> 20;
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+int bpstd::detail::floor_log10_three_quarters_pow2(int e)
+  noexcept
+{
+  return (e * 315653 - 131237) >> 20;
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+int bpstd::detail::floor_log2_pow10(int e)
+  noexcept
+{
+  return (e * 1741647) >> 19;
+}
+
+//==============================================================================
+// definitions : Binary to decimal
+//==============================================================================
+
+namespace bpstd {
+  namespace detail {
+
+    /// \brief Computes (g * cp) / 2^128 rounded to odd, where g is a 128-bit
+    ///        significand from the pow10 table
+    ///
+    /// Rounding to odd preserves enough information about the discarded
+    /// bits for the comparisons that Schubfach performs to remain exact.
+    inline BPSTD_INLINE_VISIBILITY
+    std::uint64_t round_to_odd(uint128_parts g, std::uint64_t cp)
+      noexcept
+    {
+      const auto x = multiply_128(g.low, cp);
+      const auto y = multiply_128(g.high, cp);
+
+      const auto z = y.low + x.high;
+      const auto upper = y.high + static_cast<std::uint64_t>(z < y.low);
+
+      return upper | static_cast<std::uint64_t>(z > 1u);
+    }
+
+    inline BPSTD_INLINE_VISIBILITY
+    decimal_fp remove_trailing_zeros(decimal_fp value)
+      noexcept
+    {
+      while (value.significand % 100u == 0u) {
+        value.significand /= 100u;
+        value.exponent += 2;
+      }
+      if (value.significand % 10u == 0u) {
+        value.significand /= 10u;
+        ++value.exponent;
+      }
+      return value;
+    }
+
+  } // namespace detail
+} // namespace bpstd
+
+template <typename T>
+inline
+bpstd::detail::decimal_fp
+  bpstd::detail::to_shortest_decimal(typename float_traits<T>::bits_type significand,
+                                     int exponent)
+  noexcept
+{
+  using traits = float_traits<T>;
+
+  const auto hidden_bit = std::uint64_t{1u} << traits::significand_bits;
+
+  auto c = std::uint64_t{significand};
+  auto q = 0;
+  if (exponent != 0) {
+    c |= hidden_bit;
+    q = exponent - traits::exponent_bias - traits::significand_bits;
+
+    // Small integers are their own shortest representation
+    if (q <= 0 && -q <= traits::significand_bits) {
+      const auto fraction_mask = (std::uint64_t{1u} << -q) - 1u;
+      if ((c & fraction_mask) == 0u) {
+        return remove_trailing_zeros({c >> -q, 0});
+      }
+    }
+  } else {
+    q = 1 - traits::exponent_bias - traits::significand_bits;
+  }
+
+  const auto is_even = (c % 2u) == 0u;
+
+  // At the boundary of a binade, the gap to the next lower value is half
+  // the size of the gap to the next higher one
+  const auto lower_is_closer = (significand == 0u && exponent > 1);
+
+  // The value and the bounds of its rounding interval, scaled by 4 so that
+  // the half-gaps are integral
+  const auto cbl = 4u * c - 2u + static_cast<std::uint64_t>(lower_is_closer);
+  const auto cb  = 4u * c;
+  const auto cbr = 4u * c + 2u;
+
+  const auto k = lower_is_closer
+    ? floor_log10_three_quarters_pow2(q)
+    : floor_log10_pow2(q);
+  const auto h = q + floor_log2_pow10(-k) + 1;
+
+  const auto g = pow10_significand(-k);
+
+  const auto vbl = round_to_odd(g, cbl << h);
+  const auto vb  = round_to_odd(g, cb << h);
+  const auto vbr = round_to_odd(g, cbr << h);
+
+  // Bounds are inclusive only when the value is even, since a tie rounds to
+  // the even neighbour
+  const auto lower = vbl + static_cast<std::uint64_t>(!is_even);
+  const auto upper = vbr - static_cast<std::uint64_t>(!is_even);
+
+  const auto s = vb / 4u;
+
+  // Prefer a decimal with one digit fewer, if one lies in the interval
+  if (s >= 10u) {
+    const auto sp = s / 10u;
+    const auto up_inside = lower <= 40u * sp;
+    const auto wp_inside = 40u * sp + 40u <= upper;
+    if (up_inside != wp_inside) {
+      return remove_trailing_zeros({sp + static_cast<std::uint64_t>(wp_inside), k + 1});
+    }
+  }
+
+  const auto u_inside = lower <= 4u * s;
+  const auto w_inside = 4u * s + 4u <= upper;
+  if (u_inside != w_inside) {
+    return remove_trailing_zeros({s + static_cast<std::uint64_t>(w_inside), k});
+  }
+
+  // Both neighbours are in the interval; choose the closer, or the even one
+  // on a tie
+  const auto mid = 4u * s + 2u;
+  const auto round_up = vb > mid || (vb == mid && (s & 1u) != 0u);
+
+  return remove_trailing_zeros({s + static_cast<std::uint64_t>(round_up), k});
+}
+
+//==============================================================================
+// definitions : class : charconv_bigint
+//==============================================================================
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::detail::charconv_bigint::charconv_bigint(std::uint64_t value)
+  noexcept
+  : m_limbs{},
+    m_size{0u}
+{
+  while (value != 0u) {
+    m_limbs[m_size++] = static_cast<std::uint32_t>(value);
+    value >>= 32u;
+  }
+}
+
+inline
+void bpstd::detail::charconv_bigint::multiply(std::uint32_t factor)
+  noexcept
+{
+  auto carry = std::uint64_t{0u};
+  for (auto i = std::size_t{0u}; i < m_size; ++i) {
+    const auto product = std::uint64_t{m_limbs[i]} * factor + carry;
+    m_limbs[i] = static_cast<std::uint32_t>(product);
+    carry = product >> 32u;
+  }
+  if (carry != 0u && m_size < max_limbs) {
+    m_limbs[m_size++] = static_cast<std::uint32_t>(carry);
+  }
+}
+
+inline
+void bpstd::detail::charconv_bigint::add(std::uint32_t value)
+  noexcept
+{
+  auto carry = std::uint64_t{value};
+  for (auto i = std::size_t{0u}; i < m_size && carry != 0u; ++i) {
+    const auto sum = std::uint64_t{m_limbs[i]} + carry;
+    m_limbs[i] = static_cast<std::uint32_t>(sum);
+    carry = sum >> 32u;
+  }
+  if (carry != 0u && m_size < max_limbs) {
+    m_limbs[m_size++] = static_cast<std::uint32_t>(carry);
+  }
+}
+
+inline
+void bpstd::detail::charconv_bigint::multiply_pow5(unsigned exponent)
+  noexcept
+{
+  // 5^13 is the largest power of five that fits in a limb
+  static constexpr std::uint32_t pow5[14] = {
+    1u, 5u, 25u, 125u, 625u, 3125u, 15625u, 78125u, 390625u, 1953125u,
+    9765625u, 48828125u, 244140625u, 1220703125u
+  };
+
+  while (exponent >= 13u) {
+    multiply(pow5[13]);
+    exponent -= 13u;
+  }
+  if (exponent != 0u) {
+    multiply(pow5[exponent]);
+  }
+}
+
+inline
+void bpstd::detail::charconv_bigint::shift_left(unsigned bits)
+  noexcept
+{
+  if (m_size == 0u) {
+    return;
+  }
+  const auto limbs = std::size_t{bits / 32u};
+  const auto shift = bits % 32u;
+
+  const auto new_size = (m_size + limbs + 1u < max_limbs) ? m_size + limbs + 1u : max_limbs;
+
+  for (auto i = new_size; i-- > 0u;) {
+    auto value = std::uint32_t{0u};
+    if (i >= limbs && i - limbs < m_size) {
+      value = m_limbs[i - limbs] << shift;
+    }
+    if (shift != 0u && i >= limbs + 1u && i - limbs - 1u < m_size) {
+      value |= m_limbs[i - limbs - 1u] >> (32u - shift);
+    }
+    m_limbs[i] = value;
+  }
+  m_size = new_size;
+  while (m_size > 0u && m_limbs[m_size - 1u] == 0u) {
+    --m_size;
+  }
+}
+
+inline
+std::uint32_t bpstd::detail::charconv_bigint::divide(std::uint32_t divisor)
+  noexcept
+{
+  auto remainder = std::uint64_t{0u};
+  for (auto i = m_size; i-- > 0u;) {
+    const auto current = (remainder << 32u) | m_limbs[i];
+    m_limbs[i] = static_cast<std::uint32_t>(current / divisor);
+    remainder = current % divisor;
+  }
+  while (m_size > 0u && m_limbs[m_size - 1u] == 0u) {
+    --m_size;
+  }
+  return static_cast<std::uint32_t>(remainder);
+}
+
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::detail::charconv_bigint::is_zero()
+  const noexcept
+{
+  return m_size == 0u;
+}
+
+inline
+int bpstd::detail::charconv_bigint::compare(const charconv_bigint& other)
+  const noexcept
+{
+  if (m_size != other.m_size) {
+    return (m_size < other.m_size) ? -1 : 1;
+  }
+  for (auto i = m_size; i-- > 0u;) {
+    if (m_limbs[i] != other.m_limbs[i]) {
+      return (m_limbs[i] < other.m_limbs[i]) ? -1 : 1;
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+
+inline
+std::size_t bpstd::detail::write_exact_integer(char* buffer,
+                                               std::uint64_t significand,
+                                               int exponent)
+  noexcept
+{
+  auto value = charconv_bigint{significand};
+  value.shift_left(static_cast<unsigned>(exponent));
+
+  // Collect 9-digit chunks from least to most significant, then emit them
+  // in reverse
+  std::uint32_t chunks[36] = {};
+  auto count = std::size_t{0u};
+  while (!value.is_zero()) {
+    chunks[count++] = value.divide(1000000000u);
+  }
+
+  auto* out = buffer;
+  auto leading = chunks[count - 1u];
+  char scratch[9] = {};
+  auto length = 0;
+  do {
+    scratch[length++] = static_cast<char>('0' + leading % 10u);
+    leading /= 10u;
+  } while (leading != 0u);
+  while (length > 0) {
+    *out++ = scratch[--length];
+  }
+
+  for (auto i = count - 1u; i-- > 0u;) {
+    auto chunk = chunks[i];
+    for (auto j = 9; j-- > 0;) {
+      out[j] = static_cast<char>('0' + chunk % 10u);
+      chunk /= 10u;
+    }
+    out += 9;
+  }
+  return static_cast<std::size_t>(out - buffer);
+}
+
+//==============================================================================
+// definitions : Decimal to binary
+//==============================================================================
+
+template <typename T>
+inline
+bpstd::detail::adjusted_mantissa
+  bpstd::detail::compute_float(std::int64_t q,
+                               std::uint64_t w,
+                               bool& ambiguous)
+  noexcept
+{
+  using traits = float_traits<T>;
+
+  ambiguous = false;
+  if (w == 0u || q < traits::min_decimal_exponent) {
+    return {0u, 0};
+  }
+  if (q > traits::max_decimal_exponent) {
+    return {0u, traits::max_biased_exponent};
+  }
+
+  const auto lz = countl_zero(w);
+  w <<= lz;
+
+  // The table holds upper bounds; this algorithm needs truncated values,
+  // except where 5^-q fits in 64 bits and the rounded-up reciprocal is what
+  // allows an exact product
+  auto power = pow10_significand(static_cast<int>(q));
+  if (q < -27 || q >= 0) {
+    power.high -= static_cast<std::uint64_t>(power.low == 0u);
+    power.low -= 1u;
+  }
+
+  // Only the high 64 bits of the 192-bit product are needed, and only the
+  // top significand_bits + 3 of those decide the result; the second
+  // multiplication is needed only when the truncation could carry into them
+  auto product = multiply_128(w, power.high);
+  const auto precision_mask = ~std::uint64_t{0u} >> (traits::significand_bits + 3);
+  if ((product.high & precision_mask) == precision_mask) {
+    const auto second = multiply_128(w, power.low);
+    product.low += second.high;
+    product.high += static_cast<std::uint64_t>(second.high > product.low);
+  }
+
+  if (product.low == ~std::uint64_t{0u}) {
+    // Either 5^q is exact in the table, or the error of the truncated
+    // product may have carried into the result
+    ambiguous = (q < -27 || q > 55);
+  }
+
+  const auto upper_bit = static_cast<int>(product.high >> 63u);
+  const auto shift = upper_bit + 64 - traits::significand_bits - 3;
+
+  auto result = adjusted_mantissa{
+    product.high >> shift,
+    static_cast<int>(((217706 * q) >> 16) + 63) + upper_bit - lz + traits::exponent_bias
+  };
+
+  if (result.power2 <= 0) {
+    // Subnormal
+    if (-result.power2 + 1 >= 64) {
+      return {0u, 0};
+    }
+    result.mantissa >>= -result.power2 + 1;
+    result.mantissa += (result.mantissa & 1u);
+    result.mantissa >>= 1u;
+
+    // Rounding may have carried into the smallest normal value
+    result.power2 = (result.mantissa < (std::uint64_t{1u} << traits::significand_bits)) ? 0 : 1;
+    return result;
+  }
+
+  // A tie between two values is only possible if no bits were dropped by
+  // the shift, in which case round to even rather than up
+  if (product.low <= 1u &&
+      q >= traits::min_round_to_even_exponent &&
+      q <= traits::max_round_to_even_exponent &&
+      (result.mantissa & 3u) == 1u &&
+      (result.mantissa << shift) == product.high) {
+    result.mantissa &= ~std::uint64_t{1u};
+  }
+
+  result.mantissa += (result.mantissa & 1u);
+  result.mantissa >>= 1u;
+  if (result.mantissa >= (std::uint64_t{2u} << traits::significand_bits)) {
+    result.mantissa = (std::uint64_t{1u} << traits::significand_bits);
+    ++result.power2;
+  }
+  result.mantissa &= ~(std::uint64_t{1u} << traits::significand_bits);
+
+  if (result.power2 >= traits::max_biased_exponent) {
+    return {0u, traits::max_biased_exponent};
+  }
+  return result;
+}
+
+//------------------------------------------------------------------------------
+
+namespace bpstd {
+  namespace detail {
+
+    /// \brief Compares digits * 10^\p exponent (plus a tiny amount if
+    ///        \p sticky) against \p m * 2^\p e exactly
+    inline
+    int compare_decimal_binary(const charconv_bigint& digits,
+                               std::int64_t exponent,
+                               bool sticky,
+                               std::uint64_t m,
+                               std::int64_t e)
+      noexcept
+    {
+      // digits * 5^exponent * 2^exponent  vs  m * 2^e, with every power of
+      // five moved to the side where it is a multiplication
+      auto lhs = digits;
+      auto rhs = charconv_bigint{m};
+      if (exponent >= 0) {
+        lhs.multiply_pow5(static_cast<unsigned>(exponent));
+      } else {
+        rhs.multiply_pow5(static_cast<unsigned>(-exponent));
+      }
+      if (exponent > e) {
+        lhs.shift_left(static_cast<unsigned>(exponent - e));
+      } else {
+        rhs.shift_left(static_cast<unsigned>(e - exponent));
+      }
+
+      const auto result = lhs.compare(rhs);
+      return (result == 0 && sticky) ? 1 : result;
+    }
+
+  } // namespace detail
+} // namespace bpstd
+
+template <typename T>
+inline
+bpstd::detail::adjusted_mantissa
+  bpstd::detail::compute_float_exact(const char* first,
+                                     const char* last,
+                                     std::int64_t exponent,
+                                     adjusted_mantissa estimate)
+  noexcept
+{
+  using traits = float_traits<T>;
+
+  const auto hidden_bit = std::uint64_t{1u} << traits::significand_bits;
+  const auto min_exponent = std::int64_t{1 - traits::exponent_bias - traits::significand_bits};
+
+  // Accumulate up to max_digits significant digits; any nonzero digit past
+  // those can only break an exact tie
+  auto digits = charconv_bigint{};
+  auto sticky = false;
+  auto significant = 0;
+  auto integral = true;
+  auto chunk = std::uint32_t{0u};
+  auto chunk_size = 0;
+
+  for (auto it = first; it != last; ++it) {
+    if (*it == '.') {
+      integral = false;
+      continue;
+    }
+    const auto digit = static_cast<std::uint32_t>(*it - '0');
+    if (significant == traits::max_digits) {
+      sticky = sticky || (digit != 0u);
+      if (integral) {
+        ++exponent;
+      }
+      continue;
+    }
+    if (!integral) {
+      --exponent;
+    }
+    if (significant == 0 && digit == 0u) {
+      continue;
+    }
+    ++significant;
+    chunk = chunk * 10u + digit;
+    if (++chunk_size == 9) {
+      digits.multiply(1000000000u);
+      digits.add(chunk);
+      chunk = 0u;
+      chunk_size = 0;
+    }
+  }
+  if (chunk_size != 0) {
+    auto scale = std::uint32_t{1u};
+    for (auto i = 0; i < chunk_size; ++i) {
+      scale *= 10u;
+    }
+    digits.multiply(scale);
+    digits.add(chunk);
+  }
+
+  // Convert the estimate to the form m * 2^e
+  auto m = estimate.mantissa;
+  auto e = min_exponent;
+  if (estimate.power2 != 0) {
+    m |= hidden_bit;
+    e = std::int64_t{estimate.power2} - traits::exponent_bias - traits::significand_bits;
+  }
+  const auto max_e = std::int64_t{traits::max_biased_exponent} - traits::exponent_bias - traits::significand_bits;
+
+  // Walk towards the correctly rounded value; the estimate is at most one
+  // unit away, so this takes at most two steps
+  while (true) {
+    if (e < max_e) {
+      const auto up = compare_decimal_binary(digits, exponent, sticky, 2u * m + 1u, e - 1);
+      if (up > 0 || (up == 0 && (m & 1u) != 0u)) {
+        if (++m == (hidden_bit << 1u)) {
+          m = hidden_bit;
+          ++e;
+        }
+        continue;
+      }
+    }
+    if (m == 0u) {
+      break;
+    }
+    const auto down = (m == hidden_bit && e > min_exponent)
+      ? compare_decimal_binary(digits, exponent, sticky, 4u * m - 1u, e - 2)
+      : compare_decimal_binary(digits, exponent, sticky, 2u * m - 1u, e - 1);
+    if (down < 0 || (down == 0 && (m & 1u) != 0u)) {
+      if (m-- == hidden_bit && e > min_exponent) {
+        m = (hidden_bit << 1u) - 1u;
+        --e;
+      }
+      continue;
+    }
+    break;
+  }
+
+  if (e >= max_e) {
+    return {0u, traits::max_biased_exponent};
+  }
+  if (m < hidden_bit) {
+    return {m, 0};
+  }
+  return {m & ~hidden_bit, static_cast<int>(e + traits::exponent_bias + traits::significand_bits)};
+}
+
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline
+bpstd::detail::adjusted_mantissa
+  bpstd::detail::round_binary(std::uint64_t significand,
+                              std::int64_t exponent,
+                              bool sticky)
+  noexcept
+{
+  using traits = float_traits<T>;
+
+  const auto hidden_bit = std::uint64_t{1u} << traits::significand_bits;
+  const auto min_exponent = std::int64_t{1 - traits::exponent_bias - traits::significand_bits};
+  const auto max_e = std::int64_t{traits::max_biased_exponent} - traits::exponent_bias - traits::significand_bits;
+
+  if (significand == 0u) {
+    return {0u, 0};
+  }
+
+  // The exponent of the least significant bit that the result can keep
+  const auto width = 64 - countl_zero(significand);
+  auto lsb = exponent + width - 1 - traits::significand_bits;
+  if (lsb < min_exponent) {
+    lsb = min_exponent;
+  }
+
+  const auto shift = lsb - exponent;
+  if (shift > 0) {
+    if (shift > 64) {
+      return {0u, 0};
+    }
+    const auto dropped = (shift == 64) ? significand : significand & ((std::uint64_t{1u} << shift) - 1u);
+    const auto half = std::uint64_t{1u} << (shift - 1);
+    significand = (shift == 64) ? 0u : significand >> shift;
+
+    const auto round_up = dropped > half ||
+                          (dropped == half && (sticky || (significand & 1u) != 0u));
+    significand += static_cast<std::uint64_t>(round_up);
+    if (significand == (hidden_bit << 1u)) {
+      significand = hidden_bit;
+      ++lsb;
+    }
+  } else {
+    significand <<= -shift;
+  }
+
+  if (lsb >= max_e) {
+    return {0u, traits::max_biased_exponent};
+  }
+  if (significand < hidden_bit) {
+    return {significand, 0};
+  }
+  return {significand & ~hidden_bit, static_cast<int>(lsb + traits::exponent_bias + traits::significand_bits)};
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_DETAIL_CHARCONV_FLOAT_HPP */
@@ -63,6 +63,52 @@
 
 #define BPSTD_UNUSED(x) static_cast<void>(x)
 
+// Whether __builtin_is_constant_evaluated() may be used to give constexpr
+// functions a faster path at runtime. Compilers warn that the check is always
+// false outside of constexpr functions, so it should only be used in them.
+#if defined(__has_builtin)
+# if __has_builtin(__builtin_is_constant_evaluated)
+#   define BPSTD_DETAIL_HAS_IS_CONSTANT_EVALUATED 1
+# endif
+#elif (defined(__GNUC__) && (__GNUC__ >= 9)) || \
+      (defined(_MSC_VER) && (_MSC_VER >= 1925))
+# define BPSTD_DETAIL_HAS_IS_CONSTANT_EVALUATED 1
+#endif
+
+// Whether '__make_integer_seq' (Clang and MSVC) or '__integer_pack' (GCC) may
+// be used to produce an integer sequence without any template recursion
+#if defined(__has_builtin)
+# if __has_builtin(__make_integer_seq)
+#   define BPSTD_DETAIL_HAS_MAKE_INTEGER_SEQ 1
+# endif
+#elif defined(_MSC_VER) && (_MSC_VER >= 1910)
+# define BPSTD_DETAIL_HAS_MAKE_INTEGER_SEQ 1
+#endif
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 8)
+# define BPSTD_DETAIL_HAS_INTEGER_PACK 1
+#endif
+
+// Whether '__type_pack_element' (Clang, and GCC 14) may be used to index a
+// pack without instantiating anything per element
+#if defined(__has_builtin)
+# if __has_builtin(__type_pack_element)
+#   define BPSTD_DETAIL_HAS_TYPE_PACK_ELEMENT 1
+# endif
+#endif
+
+// Whether the __atomic builtins, which operate atomically on plain objects,
+// are available
+#if defined(__GNUC__) || defined(__clang__)
+# define BPSTD_DETAIL_HAS_ATOMIC_BUILTINS 1
+#endif
+
+// Opt-in counters for copies, moves, and other events of interest in the
+// vocabulary types (see instrumentation.hpp). This must have the same value in
+// every translation unit of a program.
+#if !defined(BPSTD_ENABLE_INSTRUMENTATION)
+# define BPSTD_ENABLE_INSTRUMENTATION 0
+#endif
+
 // Use __may_alias__ attribute on gcc and clang
 #if defined(__clang__) || (defined(__GNUC__) && __GNUC__ > 5)
 # define BPSTD_MAY_ALIAS __attribute__((__may_alias__))
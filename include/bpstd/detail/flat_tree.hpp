@@ -0,0 +1,152 @@
+/*****************************************************************************
+ * \file flat_tree.hpp
+ *
+ * \brief This internal header provides the shared utilities used by the
+ *        sorted-vector containers 'flat_map' and 'flat_set'
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_DETAIL_FLAT_TREE_HPP
+#define BPSTD_DETAIL_FLAT_TREE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "config.hpp"
+#include "../type_traits.hpp" // void_t, true_type, false_type
+
+#include <algorithm> // std::stable_sort, std::inplace_merge, std::unique
+#include <cstddef>   // std::size_t
+#include <utility>   // std::declval
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+
+  //============================================================================
+  // struct : sorted_unique_t
+  //============================================================================
+
+  /// \brief A special disambiguation tag for flat containers, indicating that
+  ///        the supplied input is already sorted and free of duplicate keys
+  ///
+  /// Passing this tag skips the sorting and deduplication step entirely. It is
+  /// undefined behaviour if the input does not satisfy this precondition.
+  struct sorted_unique_t
+  {
+    explicit sorted_unique_t() = default;
+  };
+  BPSTD_CPP17_INLINE constexpr sorted_unique_t sorted_unique{};
+
+  namespace detail {
+
+    /// \brief Type-trait to determine whether \p Compare is a transparent
+    ///        comparator (such as bpstd::less<void>)
+    template <typename Compare, typename = void>
+    struct is_transparent_compare : false_type{};
+
+    template <typename Compare>
+    struct is_transparent_compare<Compare, void_t<typename Compare::is_transparent>>
+      : true_type{};
+
+    //--------------------------------------------------------------------------
+
+    template <typename Container, typename = void>
+    struct has_reserve : false_type{};
+
+    template <typename Container>
+    struct has_reserve<Container, void_t<decltype(std::declval<Container&>().reserve(std::size_t{}))>>
+      : true_type{};
+
+    /// \brief Reserves \p n elements in \p c if the container supports it
+    template <typename Container>
+    inline BPSTD_INLINE_VISIBILITY
+    void reserve_if_able(Container& c, std::size_t n, true_type)
+    {
+      c.reserve(n);
+    }
+
+    template <typename Container>
+    inline BPSTD_INLINE_VISIBILITY
+    void reserve_if_able(Container&, std::size_t, false_type)
+    {
+
+    }
+
+    template <typename Container>
+    inline BPSTD_INLINE_VISIBILITY
+    void reserve_if_able(Container& c, std::size_t n)
+    {
+      reserve_if_able(c, n, has_reserve<Container>{});
+    }
+
+    //--------------------------------------------------------------------------
+
+    /// \brief A predicate that determines equivalence of two adjacent entries
+    ///        in a range that has been sorted by \p Compare
+    template <typename Compare>
+    struct sorted_equivalent
+    {
+      const Compare& compare;
+
+      template <typename T, typename U>
+      inline BPSTD_INLINE_VISIBILITY
+      bool operator()(const T& lhs, const U& rhs) const
+      {
+        return !compare(lhs, rhs);
+      }
+    };
+
+    /// \brief Merges the unsorted range [middle, last) into the sorted range
+    ///        [first, middle), removing all entries with equivalent keys
+    ///
+    /// The range [first, middle) must already be sorted and unique. Of all
+    /// equivalent entries, the first one to appear in the overall range is
+    /// the one that is kept.
+    ///
+    /// \param first the start of the range
+    /// \param middle the end of the sorted prefix
+    /// \param last the end of the range
+    /// \param compare the comparator
+    /// \return the new end of the unique range
+    template <typename RandomIt, typename Compare>
+    inline RandomIt merge_unique(RandomIt first,
+                                 RandomIt middle,
+                                 RandomIt last,
+                                 const Compare& compare)
+    {
+      std::stable_sort(middle, last, compare);
+      std::inplace_merge(first, middle, last, compare);
+
+      return std::unique(first, last, sorted_equivalent<Compare>{compare});
+    }
+
+  } // namespace detail
+} // namespace bpstd
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_DETAIL_FLAT_TREE_HPP */
@@ -0,0 +1,231 @@
+/*****************************************************************************
+ * \file hash.hpp
+ *
+ * \brief This internal header provides the byte-hashing and hash-mixing
+ *        primitives shared by the std::hash specializations of this library
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_DETAIL_HASH_HPP
+#define BPSTD_DETAIL_HASH_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "config.hpp"
+
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t, std::uint32_t
+#include <cstring> // std::memcpy
+
+#if defined(_MSC_VER) && defined(_M_X64)
+# include <intrin.h> // _umul128
+#endif
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+  namespace detail {
+
+    // The secrets, and the overall structure of 'hash_bytes', follow the
+    // 'wyhash' algorithm: a fast, non-cryptographic 64-bit hash that passes
+    // SMHasher. The result is not stable across platforms of differing
+    // endianness, and must not be persisted.
+    struct hash_secret
+    {
+      static constexpr std::uint64_t s0 = 0xa0761d6478bd642full;
+      static constexpr std::uint64_t s1 = 0xe7037ed1a0b428dbull;
+      static constexpr std::uint64_t s2 = 0x8ebc6af09c88c6e3ull;
+      static constexpr std::uint64_t s3 = 0x589965cc75374cc3ull;
+    };
+
+    /// \brief Computes the full 128-bit product of \p a and \p b, storing the
+    ///        low half in \p a and the high half in \p b
+    inline BPSTD_INLINE_VISIBILITY
+    void hash_multiply(std::uint64_t& a, std::uint64_t& b)
+      noexcept
+    {
+#if defined(__SIZEOF_INT128__)
+      __extension__ typedef unsigned __int128 uint128;
+
+      const auto r = static_cast<uint128>(a) * b;
+      a = static_cast<std::uint64_t>(r);
+      b = static_cast<std::uint64_t>(r >> 64u);
+#elif defined(_MSC_VER) && defined(_M_X64)
+      a = _umul128(a, b, &b);
+#else
+      const auto ha = a >> 32u;
+      const auto hb = b >> 32u;
+      const auto la = static_cast<std::uint32_t>(a);
+      const auto lb = static_cast<std::uint32_t>(b);
+
+      const auto rh  = ha * hb;
+      const auto rm0 = ha * lb;
+      const auto rm1 = hb * la;
+      const auto rl  = static_cast<std::uint64_t>(la) * lb;
+      const auto t   = rl + (rm0 << 32u);
+      const auto lo  = t + (rm1 << 32u);
+      const auto c   = static_cast<std::uint64_t>(t < rl) + (lo < t);
+
+      a = lo;
+      b = rh + (rm0 >> 32u) + (rm1 >> 32u) + c;
+#endif
+    }
+
+    /// \brief Mixes \p a and \p b by folding their 128-bit product
+    ///
+    /// \return the mixed value
+    inline BPSTD_INLINE_VISIBILITY
+    std::uint64_t hash_mix(std::uint64_t a, std::uint64_t b)
+      noexcept
+    {
+      hash_multiply(a, b);
+      return a ^ b;
+    }
+
+    inline BPSTD_INLINE_VISIBILITY
+    std::uint64_t hash_read8(const unsigned char* p)
+      noexcept
+    {
+      auto v = std::uint64_t{};
+      std::memcpy(&v, p, sizeof(v));
+      return v;
+    }
+
+    inline BPSTD_INLINE_VISIBILITY
+    std::uint64_t hash_read4(const unsigned char* p)
+      noexcept
+    {
+      auto v = std::uint32_t{};
+      std::memcpy(&v, p, sizeof(v));
+      return v;
+    }
+
+    /// \brief Reads 1-3 bytes from \p p into a single value
+    inline BPSTD_INLINE_VISIBILITY
+    std::uint64_t hash_read3(const unsigned char* p, std::size_t n)
+      noexcept
+    {
+      return (static_cast<std::uint64_t>(p[0]) << 16u)
+           | (static_cast<std::uint64_t>(p[n >> 1u]) << 8u)
+           | p[n - 1u];
+    }
+
+    /// \brief Hashes \p size bytes starting at \p data
+    ///
+    /// \param data pointer to the bytes to hash
+    /// \param size the number of bytes to hash
+    /// \param seed the seed to start hashing with
+    /// \return the 64-bit hash
+    inline std::uint64_t hash_bytes(const void* data,
+                                    std::size_t size,
+                                    std::uint64_t seed)
+      noexcept
+    {
+      auto p = static_cast<const unsigned char*>(data);
+      auto a = std::uint64_t{};
+      auto b = std::uint64_t{};
+
+      seed ^= hash_mix(seed ^ hash_secret::s0, hash_secret::s1);
+
+      if (size <= 16u) {
+        if (size >= 4u) {
+          const auto offset = (size >> 3u) << 2u;
+          a = (hash_read4(p) << 32u) | hash_read4(p + offset);
+          b = (hash_read4(p + size - 4u) << 32u) | hash_read4(p + size - 4u - offset);
+        } else if (size > 0u) {
+          a = hash_read3(p, size);
+        }
+      } else {
+        auto remaining = size;
+        if (remaining > 48u) {
+          auto see1 = seed;
+          auto see2 = seed;
+          do {
+            seed = hash_mix(hash_read8(p) ^ hash_secret::s1, hash_read8(p + 8) ^ seed);
+            see1 = hash_mix(hash_read8(p + 16) ^ hash_secret::s2, hash_read8(p + 24) ^ see1);
+            see2 = hash_mix(hash_read8(p + 32) ^ hash_secret::s3, hash_read8(p + 40) ^ see2);
+            p += 48;
+            remaining -= 48u;
+          } while (remaining > 48u);
+          seed ^= see1 ^ see2;
+        }
+        while (remaining > 16u) {
+          seed = hash_mix(hash_read8(p) ^ hash_secret::s1, hash_read8(p + 8) ^ seed);
+          p += 16;
+          remaining -= 16u;
+        }
+        a = hash_read8(p + remaining - 16u);
+        b = hash_read8(p + remaining - 8u);
+      }
+
+      a ^= hash_secret::s1;
+      b ^= seed;
+      hash_multiply(a, b);
+
+      return hash_mix(a ^ hash_secret::s0 ^ size, b ^ hash_secret::s1);
+    }
+
+    /// \brief Combines the hash \p value into the hash \p seed
+    ///
+    /// Unlike the common 'seed ^ (value + 0x9e3779b9 + ...)' formula, this
+    /// fully avalanches both inputs, so that combining poorly distributed
+    /// hashes (such as the identity hashes of integers) still produces a well
+    /// distributed result.
+    ///
+    /// \param seed the hash to combine into
+    /// \param value the hash to combine
+    /// \return the combined hash
+    inline BPSTD_INLINE_VISIBILITY
+    std::size_t hash_combine(std::size_t seed, std::size_t value)
+      noexcept
+    {
+      return static_cast<std::size_t>(
+        hash_mix(seed ^ hash_secret::s0, value ^ hash_secret::s1)
+      );
+    }
+
+    /// \brief The base of a std::hash specialization that is disabled, as
+    ///        the standard requires when a wrapped type is not hashable
+    ///
+    /// A disabled hash is not constructible, copyable, or assignable, and
+    /// has no call operator.
+    struct disabled_hash
+    {
+      disabled_hash() = delete;
+      disabled_hash(const disabled_hash&) = delete;
+      disabled_hash(disabled_hash&&) = delete;
+
+      disabled_hash& operator=(const disabled_hash&) = delete;
+      disabled_hash& operator=(disabled_hash&&) = delete;
+    };
+
+  } // namespace detail
+} // namespace bpstd
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_DETAIL_HASH_HPP */
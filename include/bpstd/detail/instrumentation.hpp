@@ -0,0 +1,72 @@
+/*****************************************************************************
+ * \file instrumentation.hpp
+ *
+ * \brief This internal header provides the hooks that record events into
+ *        the instrumentation_registry
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_DETAIL_INSTRUMENTATION_HPP
+#define BPSTD_DETAIL_INSTRUMENTATION_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "config.hpp" // BPSTD_ENABLE_INSTRUMENTATION
+
+#if BPSTD_ENABLE_INSTRUMENTATION
+
+# include "../instrumentation.hpp" // instrumentation_registry
+
+# define BPSTD_INSTRUMENT(Type, Event) \
+  ::bpstd::instrumentation_registry::record( \
+    ::bpstd::instrumented_type::Type, \
+    ::bpstd::instrumentation_event::Event \
+  )
+
+// Recording is never a constant expression, so hooks in BPSTD_CPP14_CONSTEXPR
+// functions skip it during constant evaluation, where the compiler can tell.
+// This is only done when such functions are constexpr, since compilers warn
+// that the check is always false in any other function.
+# if defined(BPSTD_DETAIL_HAS_IS_CONSTANT_EVALUATED) && \
+     defined(__cplusplus) && (__cplusplus >= 201402L)
+#   define BPSTD_CPP14_CONSTEXPR_INSTRUMENT(Type, Event) \
+  (__builtin_is_constant_evaluated() \
+    ? static_cast<void>(0) \
+    : BPSTD_INSTRUMENT(Type, Event))
+# else
+#   define BPSTD_CPP14_CONSTEXPR_INSTRUMENT(Type, Event) \
+  BPSTD_INSTRUMENT(Type, Event)
+# endif
+
+#else
+
+# define BPSTD_INSTRUMENT(Type, Event) static_cast<void>(0)
+# define BPSTD_CPP14_CONSTEXPR_INSTRUMENT(Type, Event) static_cast<void>(0)
+
+#endif // BPSTD_ENABLE_INSTRUMENTATION
+
+#endif /* BPSTD_DETAIL_INSTRUMENTATION_HPP */
@@ -1,7 +1,8 @@
 /*****************************************************************************
  * \file nth_type.hpp
  *
- * \brief This internal header provides the definition of the INVOKE overload
+ * \brief This internal header provides utilities for indexing into a
+ *        variadic pack of types
  *****************************************************************************/
 
 /*
@@ -34,30 +35,85 @@
 # pragma once
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
+#include "config.hpp"         // BPSTD_DETAIL_HAS_TYPE_PACK_ELEMENT
+#include "../utility.hpp"     // index_sequence_for
+#include "../type_traits.hpp" // integral_constant, type_identity
+
 #include <cstddef> // std::size_t
+#include <utility> // std::declval
 
 namespace bpstd {
   namespace detail {
 
+    //==========================================================================
+    // struct : indexed_types
+    //==========================================================================
+
+    // Lookups into a pack are done by overload resolution against a type that
+    // inherits a distinct base for each (index, type) pair. Deducing either
+    // half of a base from the other is a single step for the compiler,
+    // regardless of the size of the pack, where a recursive lookup would
+    // instantiate a template for every element before the one requested.
+
+    template <std::size_t I, typename T>
+    struct indexed_type{};
+
+    template <typename Indices, typename...Types>
+    struct indexed_types_impl;
+
+    template <std::size_t...Is, typename...Types>
+    struct indexed_types_impl<index_sequence<Is...>, Types...>
+      : indexed_type<Is, Types>...{};
+
+    template <typename...Types>
+    using indexed_types = indexed_types_impl<index_sequence_for<Types...>, Types...>;
+
+    template <std::size_t I, typename T>
+    type_identity<T> select_type(const indexed_type<I, T>*);
+
+    // Deduction fails if 'T' is the type of more than one base, so a
+    // duplicated type falls through to the 'npos' overload
+    template <typename T, std::size_t I>
+    integral_constant<std::size_t, I> select_index(const indexed_type<I, T>*);
+
+    template <typename T>
+    integral_constant<std::size_t, static_cast<std::size_t>(-1)> select_index(...);
+
+    //==========================================================================
+    // trait : nth_type
+    //==========================================================================
+
     /// \brief Gets the nth type from a variadic pack of arguments
     ///
     /// \tparam N the argument to retrieve
     /// \tparam Args the arguments to extract from
+#if defined(BPSTD_DETAIL_HAS_TYPE_PACK_ELEMENT)
     template <std::size_t N, typename...Args>
-    struct nth_type;
-
-    template <std::size_t N, typename Arg0, typename...Args>
-    struct nth_type<N,Arg0,Args...> : nth_type<N-1,Args...>{};
-
-    template <typename Arg0, typename...Args>
-    struct nth_type<0,Arg0,Args...>
-    {
-      using type = Arg0;
-    };
+    struct nth_type : type_identity<__type_pack_element<N, Args...>>{};
+#else
+    template <std::size_t N, typename...Args>
+    struct nth_type
+      : decltype(select_type<N>(std::declval<indexed_types<Args...>*>())){};
+#endif
 
     template <std::size_t N, typename...Args>
     using nth_type_t = typename nth_type<N,Args...>::type;
 
+    //==========================================================================
+    // trait : index_in_pack
+    //==========================================================================
+
+    /// \brief Gets the index of 'T' in a variadic pack of types
+    ///
+    /// The index result is 'static_cast<std::size_t>(-1)' if 'T' does not
+    /// appear exactly once in 'Types...'
+    ///
+    /// \tparam T the type to find
+    /// \tparam Types the types to search
+    template <typename T, typename...Types>
+    struct index_in_pack
+      : decltype(select_index<T>(std::declval<indexed_types<Types...>*>())){};
+
   } // namespace detail
 } // namespace bpstd
 
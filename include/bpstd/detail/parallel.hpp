@@ -0,0 +1,219 @@
+/*****************************************************************************
+ * \file parallel.hpp
+ *
+ * \brief This internal header provides the chunking and dispatch primitives
+ *        shared by the parallel algorithm overloads
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_DETAIL_PARALLEL_HPP
+#define BPSTD_DETAIL_PARALLEL_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "config.hpp"
+
+#include "../execution.hpp"   // execution::parallel_policy, etc
+#include "../thread_pool.hpp" // thread_pool
+#include "../type_traits.hpp" // conjunction, remove_cvref_t, etc
+
+#include <algorithm> // std::min, std::max
+#include <atomic>    // std::atomic
+#include <cstddef>   // std::size_t
+#include <iterator>  // std::iterator_traits, std::random_access_iterator_tag
+#include <thread>    // std::thread, std::this_thread::yield
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+  namespace detail {
+
+    //==========================================================================
+    // trait : is_parallel_execution
+    //==========================================================================
+
+    template <typename ExecutionPolicy>
+    struct is_parallel_policy : false_type{};
+
+    template <>
+    struct is_parallel_policy<execution::parallel_policy> : true_type{};
+    template <>
+    struct is_parallel_policy<execution::parallel_unsequenced_policy> : true_type{};
+
+    template <typename It>
+    using is_random_access_iterator = is_base_of<
+      std::random_access_iterator_tag,
+      typename std::iterator_traits<It>::iterator_category
+    >;
+
+    /// \brief Determines whether an algorithm invoked with ExecutionPolicy
+    ///        over iterators of type Its should be split across threads
+    ///
+    /// Only random-access ranges are split, since finding the boundaries of
+    /// each chunk would otherwise require a sequential pass of its own.
+    template <typename ExecutionPolicy, typename...Its>
+    using is_parallel_execution = conjunction<
+      is_parallel_policy<remove_cvref_t<ExecutionPolicy>>,
+      is_random_access_iterator<Its>...
+    >;
+
+    template <typename ExecutionPolicy>
+    using enable_if_execution_policy_t = enable_if_t<
+      is_execution_policy<remove_cvref_t<ExecutionPolicy>>::value
+    >;
+
+    //==========================================================================
+    // functions : parallel chunking
+    //==========================================================================
+
+    /// \brief The fewest elements worth handing to a separate thread
+    BPSTD_CPP17_INLINE constexpr auto parallel_grain_size = std::size_t{2048u};
+
+    /// \brief Gets the number of threads that parallel algorithms may use
+    ///
+    /// \return the number of threads
+    inline std::size_t parallel_concurrency()
+      noexcept
+    {
+      static const auto concurrency = static_cast<std::size_t>(
+        std::thread::hardware_concurrency()
+      );
+
+      return (concurrency == 0u) ? 1u : concurrency;
+    }
+
+    /// \brief Gets the thread_pool that parallel algorithms run on
+    ///
+    /// The pool is created on first use. Since the thread invoking an
+    /// algorithm also processes chunks, the pool has one fewer worker than
+    /// there are hardware threads.
+    ///
+    /// \return the thread pool
+    inline thread_pool& parallel_pool()
+    {
+      static thread_pool pool{parallel_concurrency() - 1u};
+
+      return pool;
+    }
+
+    /// \brief Gets the number of chunks to split \p size elements into
+    ///
+    /// Every chunk holds at least parallel_grain_size elements, unless there
+    /// is only a single chunk.
+    ///
+    /// \param size the number of elements
+    /// \return the number of chunks
+    inline std::size_t parallel_chunk_count(std::size_t size)
+      noexcept
+    {
+      return (std::max)(
+        std::size_t{1u},
+        (std::min)(size / parallel_grain_size, parallel_concurrency())
+      );
+    }
+
+    /// \brief Gets the index of the first element of the \p index'th of
+    ///        \p chunks chunks of \p size elements
+    ///
+    /// The remainder is spread across the leading chunks, so chunk sizes
+    /// differ by at most one.
+    ///
+    /// \param size the number of elements
+    /// \param chunks the number of chunks
+    /// \param index the index of the chunk; may be \p chunks for the end
+    /// \return the index of the first element of the chunk
+    inline std::size_t parallel_chunk_begin(std::size_t size,
+                                            std::size_t chunks,
+                                            std::size_t index)
+      noexcept
+    {
+      return index * (size / chunks) + (std::min)(index, size % chunks);
+    }
+
+    /// \brief Invokes \p fn with every index in [0, count) concurrently,
+    ///        returning once all invocations have completed
+    ///
+    /// The calling thread runs the first invocation itself, and then helps
+    /// run pending tasks of the pool until the rest have completed; this
+    /// keeps nested parallel algorithms invoked from within a task from
+    /// deadlocking the pool. As with the standard parallel algorithms, an
+    /// exception escaping \p fn calls std::terminate.
+    ///
+    /// \param count the number of invocations
+    /// \param fn the function to invoke
+    template <typename Fn>
+    void parallel_invoke_n(std::size_t count, Fn& fn)
+      noexcept
+    {
+      if (count == 0u) {
+        return;
+      }
+
+      auto& pool = parallel_pool();
+      std::atomic<std::size_t> remaining{count - 1u};
+
+      for (auto i = std::size_t{1u}; i < count; ++i) {
+        pool.execute([&fn, &remaining, i]{
+          fn(i);
+          remaining.fetch_sub(1u, std::memory_order_release);
+        });
+      }
+      fn(std::size_t{0u});
+
+      while (remaining.load(std::memory_order_acquire) != 0u) {
+        if (!pool.run_pending_task()) {
+          std::this_thread::yield();
+        }
+      }
+    }
+
+    /// \brief Splits [0, size) into chunks, and invokes \p fn with the bounds
+    ///        of each chunk concurrently
+    ///
+    /// \param size the number of elements
+    /// \param fn the function to invoke as fn(first_index, last_index)
+    template <typename Fn>
+    void parallel_for_chunks(std::size_t size, Fn& fn)
+      noexcept
+    {
+      const auto chunks = parallel_chunk_count(size);
+      auto chunk = [&](std::size_t i) {
+        fn(
+          parallel_chunk_begin(size, chunks, i),
+          parallel_chunk_begin(size, chunks, i + 1u)
+        );
+      };
+
+      parallel_invoke_n(chunks, chunk);
+    }
+
+  } // namespace detail
+} // namespace bpstd
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_DETAIL_PARALLEL_HPP */
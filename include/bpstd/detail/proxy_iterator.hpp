@@ -194,6 +194,12 @@ namespace bpstd {
       Iterator m_iter; ///< The iterator used for iteration
 
       template <typename, typename> friend class proxy_iterator;
+
+      // Pointers are returned directly; any other iterator is asked for its
+      // pointer through its own operator->
+      static constexpr pointer to_pointer(const pointer& p) noexcept;
+      template <typename UIterator>
+      static constexpr pointer to_pointer(const UIterator& it) noexcept;
     };
 
     //==========================================================================
@@ -347,7 +353,7 @@ inline constexpr typename bpstd::detail::proxy_iterator<Iterator,U>::pointer
   bpstd::detail::proxy_iterator<Iterator,U>::operator->()
   const noexcept
 {
-  return m_iter;
+  return to_pointer(m_iter);
 }
 
 template<typename Iterator, typename U>
@@ -358,6 +364,27 @@ inline constexpr typename bpstd::detail::proxy_iterator<Iterator,U>::reference
   return *m_iter;
 }
 
+//------------------------------------------------------------------------------
+// Private Observers
+//------------------------------------------------------------------------------
+
+template<typename Iterator, typename U>
+inline constexpr typename bpstd::detail::proxy_iterator<Iterator,U>::pointer
+  bpstd::detail::proxy_iterator<Iterator,U>::to_pointer(const pointer& p)
+  noexcept
+{
+  return p;
+}
+
+template<typename Iterator, typename U>
+template<typename UIterator>
+inline constexpr typename bpstd::detail::proxy_iterator<Iterator,U>::pointer
+  bpstd::detail::proxy_iterator<Iterator,U>::to_pointer(const UIterator& it)
+  noexcept
+{
+  return it.operator->();
+}
+
 //------------------------------------------------------------------------------
 // Comparisons
 //------------------------------------------------------------------------------
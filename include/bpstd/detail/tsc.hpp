@@ -0,0 +1,135 @@
+/*****************************************************************************
+ * \file tsc.hpp
+ *
+ * \brief This internal header provides access to the processor's time-stamp
+ *        counter, for implementing tsc_clock
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_DETAIL_TSC_HPP
+#define BPSTD_DETAIL_TSC_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "config.hpp"
+
+#include <cstdint> // std::uint64_t
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+# define BPSTD_DETAIL_HAS_TSC 1
+# if defined(_MSC_VER)
+#   include <intrin.h> // __rdtsc, __cpuid
+# else
+#   include <cpuid.h> // __get_cpuid
+# endif
+#else
+# define BPSTD_DETAIL_HAS_TSC 0
+#endif
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+  namespace detail {
+
+#if BPSTD_DETAIL_HAS_TSC
+
+    /// \brief Reads the time-stamp counter
+    ///
+    /// This is deliberately not serializing, since it is used for timing
+    /// whole operations rather than individual instructions.
+    ///
+    /// \return the number of ticks since the processor was reset
+    inline BPSTD_INLINE_VISIBILITY
+    std::uint64_t read_tsc()
+      noexcept
+    {
+#if defined(_MSC_VER)
+      return static_cast<std::uint64_t>(__rdtsc());
+#else
+      // The builtin avoids <x86intrin.h>, which pulls in every intrinsic
+      // header and dominates the cost of including chrono.hpp
+      return static_cast<std::uint64_t>(__builtin_ia32_rdtsc());
+#endif
+    }
+
+    /// \brief Determines whether the time-stamp counter ticks at a constant
+    ///        rate, regardless of frequency scaling and sleep states
+    ///
+    /// \return true if the counter is invariant
+    inline
+    bool has_invariant_tsc()
+      noexcept
+    {
+      const auto invariant_tsc_leaf = 0x80000007u;
+      const auto invariant_tsc_bit = 1u << 8;
+
+#if defined(_MSC_VER)
+      int registers[4] = {};
+      __cpuid(registers, static_cast<int>(0x80000000u));
+      if (static_cast<unsigned>(registers[0]) < invariant_tsc_leaf) {
+        return false;
+      }
+      __cpuid(registers, static_cast<int>(invariant_tsc_leaf));
+
+      return (static_cast<unsigned>(registers[3]) & invariant_tsc_bit) != 0u;
+#else
+      unsigned eax = 0u;
+      unsigned ebx = 0u;
+      unsigned ecx = 0u;
+      unsigned edx = 0u;
+      if (__get_cpuid(invariant_tsc_leaf, &eax, &ebx, &ecx, &edx) == 0) {
+        return false;
+      }
+
+      return (edx & invariant_tsc_bit) != 0u;
+#endif
+    }
+
+#else
+
+    inline BPSTD_INLINE_VISIBILITY
+    std::uint64_t read_tsc()
+      noexcept
+    {
+      return 0u;
+    }
+
+    inline
+    bool has_invariant_tsc()
+      noexcept
+    {
+      return false;
+    }
+
+#endif // BPSTD_DETAIL_HAS_TSC
+
+  } // namespace detail
+} // namespace bpstd
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_DETAIL_TSC_HPP */
@@ -35,6 +35,7 @@
 #include "nth_type.hpp"       // detail::nth_type
 #include "move.hpp"           // forward
 #include "variant_traits.hpp"
+#include "../utility.hpp"     // make_index_sequence
 
 #include <cstddef>     // std::size_t
 #include <type_traits> // std::decay
@@ -98,6 +99,12 @@ namespace bpstd {
     /////////////////////////////////////////////////////////////////////////////
     /// \brief Implementation of the variant_union class
     ///
+    /// The alternatives are stored as a balanced tree of unions: each union
+    /// holds the first half of its types in 'left' and the second half in
+    /// 'right', until a single type remains as 'current'. Reaching any
+    /// alternative only descends O(log N) unions, rather than one union for
+    /// every alternative that precedes it.
+    ///
     /// \tparam IsTrivial true if all the types in the variant are trivial
     /// \tparam Types the types in the variant
     ////////////////////////////////////////////////////////////////////////////
@@ -114,20 +121,92 @@ namespace bpstd {
     struct variant_union_size<variant_union<B,Types...>>
       : std::integral_constant<std::size_t,sizeof...(Types)>{};
 
+    /// \brief A type-trait for retrieving the variant_union of the \p Count
+    ///        types starting at \p Offset in \p Types
+    template <bool IsTrivial, std::size_t Offset, typename Indices, typename...Types>
+    struct variant_union_slice;
+
+    template <bool IsTrivial, std::size_t Offset, std::size_t...Is, typename...Types>
+    struct variant_union_slice<IsTrivial, Offset, index_sequence<Is...>, Types...>
+    {
+      using type = variant_union<IsTrivial, nth_type_t<Offset + Is, Types...>...>;
+    };
+
+    template <bool IsTrivial, std::size_t Offset, std::size_t Count, typename...Types>
+    using variant_union_slice_t = typename variant_union_slice<
+      IsTrivial, Offset, make_index_sequence<Count>, Types...
+    >::type;
+
+    /// \brief A type-trait for splitting \p Types into the two halves held by
+    ///        a variant_union
+    template <bool IsTrivial, typename...Types>
+    struct variant_union_halves
+    {
+      using left_size  = std::integral_constant<std::size_t, sizeof...(Types) / 2u>;
+      using right_size = std::integral_constant<std::size_t, sizeof...(Types) - left_size::value>;
+
+      using left_type  = variant_union_slice_t<IsTrivial, 0u, left_size::value, Types...>;
+      using right_type = variant_union_slice_t<IsTrivial, left_size::value, right_size::value, Types...>;
+    };
+
     //==========================================================================
-    // union : variant_union<true,Type0,Types...>
+    // union : variant_union<true,Type0,Type1,Types...>
     //==========================================================================
 
     // Partial specialization: All types are trivial; is trivially destructible
-    template <typename Type0, typename...Types>
-    union variant_union<true,Type0,Types...>
+    template <typename Type0, typename Type1, typename...Types>
+    union variant_union<true,Type0,Type1,Types...>
+    {
+      //------------------------------------------------------------------------
+      // Public Members Types
+      //------------------------------------------------------------------------
+
+      using halves_type = variant_union_halves<true,Type0,Type1,Types...>;
+      using left_size   = typename halves_type::left_size;
+      using left_type   = typename halves_type::left_type;
+      using right_type  = typename halves_type::right_type;
+
+      //------------------------------------------------------------------------
+      // Public Members
+      //------------------------------------------------------------------------
+
+      variant_empty empty;
+      left_type     left;
+      right_type    right;
+
+      //------------------------------------------------------------------------
+      // Constructors
+      //------------------------------------------------------------------------
+
+      constexpr variant_union();
+
+      template <std::size_t N, typename...Args>
+      constexpr variant_union(variant_index_tag<N>, Args&&...args);
+
+      //------------------------------------------------------------------------
+      // Private Constructors
+      //------------------------------------------------------------------------
+    private:
+
+      template <std::size_t N, typename...Args>
+      constexpr variant_union(std::true_type, variant_index_tag<N>, Args&&...args);
+
+      template <std::size_t N, typename...Args>
+      constexpr variant_union(std::false_type, variant_index_tag<N>, Args&&...args);
+    };
+
+    //==========================================================================
+    // union : variant_union<true,Type0>
+    //==========================================================================
+
+    template <typename Type0>
+    union variant_union<true,Type0>
     {
       //------------------------------------------------------------------------
       // Public Members Types
       //------------------------------------------------------------------------
 
       using current_type = Type0;
-      using next_type    = variant_union<true,Types...>;
 
       //------------------------------------------------------------------------
       // Public Members
@@ -135,7 +214,6 @@ namespace bpstd {
 
       variant_empty empty;
       current_type  current;
-      next_type     next;
 
       //------------------------------------------------------------------------
       // Constructors
@@ -145,35 +223,34 @@ namespace bpstd {
 
       template <typename...Args>
       constexpr variant_union(variant_index_tag<0>, Args&&...args);
-
-      template <std::size_t N, typename...Args>
-      constexpr variant_union(variant_index_tag<N>, Args&&...args);
     };
 
     //==========================================================================
-    // union : variant_union<false,Type0,Types...>
+    // union : variant_union<false,Type0,Type1,Types...>
     //==========================================================================
 
     // Partial specialization: At least one type is not trivial
     // This specialization needs to exist to explicitly define ~variant_union,
     // but is otherwise the *only* difference
-    template <typename Type0, typename...Types>
-    union variant_union<false,Type0,Types...>
+    template <typename Type0, typename Type1, typename...Types>
+    union variant_union<false,Type0,Type1,Types...>
     {
       //------------------------------------------------------------------------
       // Public Members Types
       //------------------------------------------------------------------------
 
-      using current_type = Type0;
-      using next_type    = variant_union<false,Types...>;
+      using halves_type = variant_union_halves<false,Type0,Type1,Types...>;
+      using left_size   = typename halves_type::left_size;
+      using left_type   = typename halves_type::left_type;
+      using right_type  = typename halves_type::right_type;
 
       //------------------------------------------------------------------------
       // Public Members
       //------------------------------------------------------------------------
 
       variant_empty empty;
-      current_type  current;
-      next_type     next;
+      left_type     left;
+      right_type    right;
 
       //------------------------------------------------------------------------
       // Constructors / Destructor
@@ -181,36 +258,53 @@ namespace bpstd {
 
       constexpr variant_union();
 
-      template <typename...Args>
-      constexpr variant_union(variant_index_tag<0>, Args&&...args);
-
       template <std::size_t N, typename...Args>
       constexpr variant_union(variant_index_tag<N>, Args&&...args);
 
       ~variant_union(){}
+
+      //------------------------------------------------------------------------
+      // Private Constructors
+      //------------------------------------------------------------------------
+    private:
+
+      template <std::size_t N, typename...Args>
+      constexpr variant_union(std::true_type, variant_index_tag<N>, Args&&...args);
+
+      template <std::size_t N, typename...Args>
+      constexpr variant_union(std::false_type, variant_index_tag<N>, Args&&...args);
     };
 
     //==========================================================================
-    // union : variant_union<B>
+    // union : variant_union<false,Type0>
     //==========================================================================
 
-    template <bool B>
-    union variant_union<B>
+    template <typename Type0>
+    union variant_union<false,Type0>
     {
+      //------------------------------------------------------------------------
+      // Public Members Types
+      //------------------------------------------------------------------------
+
+      using current_type = Type0;
+
       //------------------------------------------------------------------------
       // Public Members
       //------------------------------------------------------------------------
 
       variant_empty empty;
+      current_type  current;
 
       //------------------------------------------------------------------------
-      // Constructors
+      // Constructors / Destructor
       //------------------------------------------------------------------------
 
       constexpr variant_union();
 
       template <typename...Args>
-      constexpr variant_union(variant_index_tag<0>);
+      constexpr variant_union(variant_index_tag<0>, Args&&...args);
+
+      ~variant_union(){}
     };
 
     //==========================================================================
@@ -271,96 +365,155 @@ namespace bpstd {
 } // namespace bpstd
 
 //==============================================================================
-// union : variant_union<true, Type0, Types...>
+// union : variant_union<true, Type0, Type1, Types...>
 //==============================================================================
 
 //------------------------------------------------------------------------------
 // Constructors
 //------------------------------------------------------------------------------
 
-template <typename Type0, typename...Types>
-inline constexpr bpstd::detail::variant_union<true, Type0, Types...>
+template <typename Type0, typename Type1, typename...Types>
+inline constexpr bpstd::detail::variant_union<true, Type0, Type1, Types...>
   ::variant_union()
   : empty{}
 {
 
 }
 
-template <typename Type0, typename...Types>
-template <typename...Args>
-inline constexpr bpstd::detail::variant_union<true, Type0, Types...>
-  ::variant_union(variant_index_tag<0>, Args&&...args)
-  : current(bpstd::forward<Args>(args)...)
+template <typename Type0, typename Type1, typename...Types>
+template <std::size_t N, typename...Args>
+inline constexpr bpstd::detail::variant_union<true, Type0, Type1, Types...>
+  ::variant_union(variant_index_tag<N>, Args&&...args)
+  : variant_union(
+      std::integral_constant<bool,(N < left_size::value)>{},
+      variant_index_tag<N>{},
+      bpstd::forward<Args>(args)...
+    )
+{
+
+}
+
+//------------------------------------------------------------------------------
+// Private Constructors
+//------------------------------------------------------------------------------
+
+template <typename Type0, typename Type1, typename...Types>
+template <std::size_t N, typename...Args>
+inline constexpr bpstd::detail::variant_union<true, Type0, Type1, Types...>
+  ::variant_union(std::true_type, variant_index_tag<N>, Args&&...args)
+  : left{variant_index_tag<N>{}, bpstd::forward<Args>(args)...}
 {
 
 }
 
-template <typename Type0, typename...Types>
+template <typename Type0, typename Type1, typename...Types>
 template <std::size_t N, typename...Args>
-inline constexpr bpstd::detail::variant_union<true, Type0, Types...>
-  ::variant_union(variant_index_tag<N>, Args&&...args)
-  : next{variant_index_tag<N-1>{}, bpstd::forward<Args>(args)...}
+inline constexpr bpstd::detail::variant_union<true, Type0, Type1, Types...>
+  ::variant_union(std::false_type, variant_index_tag<N>, Args&&...args)
+  : right{variant_index_tag<(N - left_size::value)>{}, bpstd::forward<Args>(args)...}
 {
 
 }
 
 //==============================================================================
-// union : variant_union<false, Type0, Types...>
+// union : variant_union<true, Type0>
 //==============================================================================
 
 //------------------------------------------------------------------------------
 // Constructors
 //------------------------------------------------------------------------------
 
-template <typename Type0, typename...Types>
-inline constexpr bpstd::detail::variant_union<false, Type0, Types...>
+template <typename Type0>
+inline constexpr bpstd::detail::variant_union<true, Type0>
   ::variant_union()
   : empty{}
 {
 
 }
 
-template <typename Type0, typename...Types>
+template <typename Type0>
 template <typename...Args>
-inline constexpr bpstd::detail::variant_union<false, Type0, Types...>
+inline constexpr bpstd::detail::variant_union<true, Type0>
   ::variant_union(variant_index_tag<0>, Args&&...args)
   : current(bpstd::forward<Args>(args)...)
 {
 
 }
 
-template <typename Type0, typename...Types>
+//==============================================================================
+// union : variant_union<false, Type0, Type1, Types...>
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+template <typename Type0, typename Type1, typename...Types>
+inline constexpr bpstd::detail::variant_union<false, Type0, Type1, Types...>
+  ::variant_union()
+  : empty{}
+{
+
+}
+
+template <typename Type0, typename Type1, typename...Types>
 template <std::size_t N, typename...Args>
-inline constexpr bpstd::detail::variant_union<false, Type0, Types...>
+inline constexpr bpstd::detail::variant_union<false, Type0, Type1, Types...>
   ::variant_union(variant_index_tag<N>, Args&&...args)
-  : next{variant_index_tag<N-1>{}, bpstd::forward<Args>(args)...}
+  : variant_union(
+      std::integral_constant<bool,(N < left_size::value)>{},
+      variant_index_tag<N>{},
+      bpstd::forward<Args>(args)...
+    )
+{
+
+}
+
+//------------------------------------------------------------------------------
+// Private Constructors
+//------------------------------------------------------------------------------
+
+template <typename Type0, typename Type1, typename...Types>
+template <std::size_t N, typename...Args>
+inline constexpr bpstd::detail::variant_union<false, Type0, Type1, Types...>
+  ::variant_union(std::true_type, variant_index_tag<N>, Args&&...args)
+  : left{variant_index_tag<N>{}, bpstd::forward<Args>(args)...}
+{
+
+}
+
+template <typename Type0, typename Type1, typename...Types>
+template <std::size_t N, typename...Args>
+inline constexpr bpstd::detail::variant_union<false, Type0, Type1, Types...>
+  ::variant_union(std::false_type, variant_index_tag<N>, Args&&...args)
+  : right{variant_index_tag<(N - left_size::value)>{}, bpstd::forward<Args>(args)...}
 {
 
 }
 
 //==============================================================================
-// union : variant_union<B>
+// union : variant_union<false, Type0>
 //==============================================================================
 
 //------------------------------------------------------------------------------
 // Constructors
 //------------------------------------------------------------------------------
 
-template <bool B>
-inline BPSTD_INLINE_VISIBILITY constexpr
-bpstd::detail::variant_union<B>::variant_union()
+template <typename Type0>
+inline constexpr bpstd::detail::variant_union<false, Type0>
+  ::variant_union()
   : empty{}
 {
-  // base-case; should never be executed
+
 }
 
-template <bool B>
+template <typename Type0>
 template <typename...Args>
-inline BPSTD_INLINE_VISIBILITY constexpr
-bpstd::detail::variant_union<B>::variant_union(variant_index_tag<0>)
-  : empty{}
+inline constexpr bpstd::detail::variant_union<false, Type0>
+  ::variant_union(variant_index_tag<0>, Args&&...args)
+  : current(bpstd::forward<Args>(args)...)
 {
-  // base-case; should never be executed
+
 }
 
 //==============================================================================
@@ -398,19 +551,22 @@ namespace bpstd { namespace detail {
                    Fn&& fn,
                    VariantUnion&& v)
   {
-    using size_type = variant_union_size<VariantUnion>;
-
-    if (n == 0) {
-      return bpstd::forward<Fn>(fn)(
-        union_get<0>(bpstd::forward<VariantUnion>(v))
+    using left_size = typename std::decay<VariantUnion>::type::left_size;
+
+    if (n < left_size::value) {
+      return do_visit_union(
+        variant_index_tag<left_size::value>{},
+        n,
+        bpstd::forward<Fn>(fn),
+        static_cast<match_cvref_t<VariantUnion,decltype(v.left)>>(v.left)
       );
     }
 
     return do_visit_union(
-      variant_index_tag<(size_type::value - 1)>{},
-      n-1,
+      variant_index_tag<(N - left_size::value)>{},
+      n - left_size::value,
       bpstd::forward<Fn>(fn),
-      static_cast<match_cvref_t<VariantUnion,decltype(v.next)>>(v.next)
+      static_cast<match_cvref_t<VariantUnion,decltype(v.right)>>(v.right)
     );
   }
 
@@ -442,21 +598,24 @@ namespace bpstd { namespace detail {
                    VariantUnion&& v0,
                    UVariantUnion&& v1)
   {
-    using size_type = variant_union_size<VariantUnion>;
-
-    if (n == 0) {
-      return bpstd::forward<Fn>(fn)(
-        union_get<0>(bpstd::forward<VariantUnion>(v0)),
-        union_get<0>(bpstd::forward<UVariantUnion>(v1))
+    using left_size = typename std::decay<VariantUnion>::type::left_size;
+
+    if (n < left_size::value) {
+      return do_visit_union(
+        variant_index_tag<left_size::value>{},
+        n,
+        bpstd::forward<Fn>(fn),
+        static_cast<match_cvref_t<VariantUnion,decltype(v0.left)>>(v0.left),
+        static_cast<match_cvref_t<UVariantUnion,decltype(v1.left)>>(v1.left)
       );
     }
 
     return do_visit_union(
-      variant_index_tag<(size_type::value - 1)>{},
-      n-1,
+      variant_index_tag<(N - left_size::value)>{},
+      n - left_size::value,
       bpstd::forward<Fn>(fn),
-      static_cast<match_cvref_t<VariantUnion,decltype(v0.next)>>(v0.next),
-      static_cast<match_cvref_t<UVariantUnion,decltype(v1.next)>>(v1.next)
+      static_cast<match_cvref_t<VariantUnion,decltype(v0.right)>>(v0.right),
+      static_cast<match_cvref_t<UVariantUnion,decltype(v1.right)>>(v1.right)
     );
   }
 
@@ -501,36 +660,86 @@ bpstd::detail::variant_visitor_invoke_result_t<Fn, VariantUnion, UVariantUnion>
 
 namespace bpstd { namespace detail {
 
-  // private implementation: recurse on index
+  // private implementation: descend into the half holding index N
+
+  template <bool IsTrivial, typename Type0>
+  inline BPSTD_INLINE_VISIBILITY constexpr
+  Type0& do_union_get(variant_index_tag<0>, variant_union<IsTrivial,Type0>& u)
+  {
+    return u.current;
+  }
+  template <std::size_t N, bool IsTrivial, typename...Types>
+  inline BPSTD_INLINE_VISIBILITY constexpr
+  nth_type_t<N,Types...>&
+    do_union_get(std::true_type,
+                 variant_index_tag<N>,
+                 variant_union<IsTrivial,Types...>& u)
+  {
+    return do_union_get(variant_index_tag<N>{}, u.left);
+  }
+  template <std::size_t N, bool IsTrivial, typename...Types>
+  inline BPSTD_INLINE_VISIBILITY constexpr
+  nth_type_t<N,Types...>&
+    do_union_get(std::false_type,
+                 variant_index_tag<N>,
+                 variant_union<IsTrivial,Types...>& u)
+  {
+    using left_size = typename variant_union<IsTrivial,Types...>::left_size;
 
+    return do_union_get(variant_index_tag<(N - left_size::value)>{}, u.right);
+  }
   template <std::size_t N, bool IsTrivial, typename...Types>
   inline BPSTD_INLINE_VISIBILITY constexpr
   nth_type_t<N,Types...>&
     do_union_get(variant_index_tag<N>, variant_union<IsTrivial,Types...>& u)
   {
-    return do_union_get(variant_index_tag<N-1>{}, u.next);
+    using left_size = typename variant_union<IsTrivial,Types...>::left_size;
+
+    return do_union_get(
+      std::integral_constant<bool,(N < left_size::value)>{},
+      variant_index_tag<N>{},
+      u
+    );
   }
-  template <bool IsTrivial, typename...Types>
+
+  template <bool IsTrivial, typename Type0>
   inline BPSTD_INLINE_VISIBILITY constexpr
-  nth_type_t<0,Types...>&
-    do_union_get(variant_index_tag<0>, variant_union<IsTrivial,Types...>& u)
+  const Type0& do_union_get(variant_index_tag<0>, const variant_union<IsTrivial,Type0>& u)
   {
     return u.current;
   }
-
   template <std::size_t N, bool IsTrivial, typename...Types>
   inline BPSTD_INLINE_VISIBILITY constexpr
   const nth_type_t<N,Types...>&
-    do_union_get(variant_index_tag<N>, const variant_union<IsTrivial,Types...>& u)
+    do_union_get(std::true_type,
+                 variant_index_tag<N>,
+                 const variant_union<IsTrivial,Types...>& u)
   {
-    return do_union_get(variant_index_tag<N-1>{}, u.next);
+    return do_union_get(variant_index_tag<N>{}, u.left);
   }
-  template <bool IsTrivial, typename...Types>
+  template <std::size_t N, bool IsTrivial, typename...Types>
   inline BPSTD_INLINE_VISIBILITY constexpr
-  const nth_type_t<0,Types...>&
-    do_union_get(variant_index_tag<0>, const variant_union<IsTrivial,Types...>& u)
+  const nth_type_t<N,Types...>&
+    do_union_get(std::false_type,
+                 variant_index_tag<N>,
+                 const variant_union<IsTrivial,Types...>& u)
   {
-    return u.current;
+    using left_size = typename variant_union<IsTrivial,Types...>::left_size;
+
+    return do_union_get(variant_index_tag<(N - left_size::value)>{}, u.right);
+  }
+  template <std::size_t N, bool IsTrivial, typename...Types>
+  inline BPSTD_INLINE_VISIBILITY constexpr
+  const nth_type_t<N,Types...>&
+    do_union_get(variant_index_tag<N>, const variant_union<IsTrivial,Types...>& u)
+  {
+    using left_size = typename variant_union<IsTrivial,Types...>::left_size;
+
+    return do_union_get(
+      std::integral_constant<bool,(N < left_size::value)>{},
+      variant_index_tag<N>{},
+      u
+    );
   }
 
 }} // namespace bpstd::detail
@@ -38,8 +38,10 @@
 #include "../tuple.hpp"   // get
 #include "../utility.hpp" // index_sequence
 
-#include <new>     // placement new
-#include <utility> // std::swap
+#include <cstddef>    // std::size_t
+#include <functional> // std::hash
+#include <new>        // placement new
+#include <utility>    // std::swap
 
 BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
 
@@ -116,6 +118,19 @@ namespace bpstd {
       }
     };
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief A visitor for hashing the active variant alternative
+    ////////////////////////////////////////////////////////////////////////////
+    struct variant_hash_visitor
+    {
+      template <typename T>
+      inline BPSTD_INLINE_VISIBILITY
+      std::size_t operator()(const T& value) const
+      {
+        return std::hash<T>{}(value);
+      }
+    };
+
     ////////////////////////////////////////////////////////////////////////////
     /// \brief A visitor for assigning an element from T to the underlying
     ///        active variant alternative
@@ -0,0 +1,319 @@
+/*****************************************************************************
+ * \file work_stealing_deque.hpp
+ *
+ * \brief This internal header provides a lock-free Chase-Lev deque, used by
+ *        the workers of a thread_pool
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_DETAIL_WORK_STEALING_DEQUE_HPP
+#define BPSTD_DETAIL_WORK_STEALING_DEQUE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "config.hpp"
+
+#include <atomic>  // std::atomic, std::atomic_thread_fence
+#include <cstddef> // std::size_t
+#include <cstdint> // std::int64_t
+#include <memory>  // std::unique_ptr
+#include <vector>  // std::vector
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+  namespace detail {
+
+    //==========================================================================
+    // class : work_stealing_deque
+    //==========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A single-producer, multi-consumer deque of pointers, following
+    ///        "Correct and Efficient Work-Stealing for Weak Memory Models"
+    ///        (Lê, Pop, Cohen, Zappa Nardelli; PPoPP 2013)
+    ///
+    /// Only the owning thread may push() and pop(), which operate on the
+    /// bottom of the deque in LIFO order; any thread may steal() from the top
+    /// in FIFO order. The owner only synchronizes with thieves when the deque
+    /// is nearly empty.
+    ///
+    /// Buffers that are outgrown are retired rather than freed, since a thief
+    /// may still be reading from them; they are released with the deque.
+    ///
+    /// \tparam T the pointed-to type
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    class work_stealing_deque
+    {
+      //------------------------------------------------------------------------
+      // Constructors / Destructor / Assignment
+      //------------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an empty deque able to hold \p capacity elements
+      ///        before growing
+      ///
+      /// \param capacity the initial capacity; must be a power of 2
+      explicit work_stealing_deque(std::int64_t capacity = 256);
+
+      work_stealing_deque(const work_stealing_deque&) = delete;
+      work_stealing_deque& operator=(const work_stealing_deque&) = delete;
+
+      //------------------------------------------------------------------------
+      // Modifiers
+      //------------------------------------------------------------------------
+    public:
+
+      /// \brief Pushes \p p onto the bottom of the deque
+      ///
+      /// \pre Only called from the owning thread
+      /// \param p the pointer to push
+      void push(T* p);
+
+      /// \brief Pops the bottom-most pointer from the deque
+      ///
+      /// \pre Only called from the owning thread
+      /// \return the pointer, or nullptr if the deque is empty
+      T* pop() noexcept;
+
+      /// \brief Steals the top-most pointer from the deque
+      ///
+      /// This may fail spuriously if it races with another thread for the
+      /// same element.
+      ///
+      /// \return the pointer, or nullptr if nothing was stolen
+      T* steal() noexcept;
+
+      //------------------------------------------------------------------------
+      // Observers
+      //------------------------------------------------------------------------
+    public:
+
+      /// \brief Queries whether the deque appears empty
+      ///
+      /// \return true if the deque was empty at some point during the call
+      bool empty() const noexcept;
+
+      //------------------------------------------------------------------------
+      // Private Member Types
+      //------------------------------------------------------------------------
+    private:
+
+      class buffer
+      {
+      public:
+        explicit buffer(std::int64_t capacity);
+
+        std::int64_t capacity() const noexcept;
+
+        T* load(std::int64_t i) const noexcept;
+        void store(std::int64_t i, T* p) noexcept;
+
+        /// \brief Creates a buffer of twice the capacity, containing the
+        ///        elements in [top, bottom)
+        std::unique_ptr<buffer> grow(std::int64_t top, std::int64_t bottom) const;
+
+      private:
+        std::int64_t m_mask;
+        std::unique_ptr<std::atomic<T*>[]> m_elements;
+      };
+
+      //------------------------------------------------------------------------
+      // Private Members
+      //------------------------------------------------------------------------
+    private:
+
+      std::atomic<std::int64_t> m_top;
+      std::atomic<std::int64_t> m_bottom;
+      std::atomic<buffer*> m_buffer;
+      std::vector<std::unique_ptr<buffer>> m_buffers; // owned by the owner
+    };
+
+  } // namespace detail
+} // namespace bpstd
+
+//==============================================================================
+// definitions : class : work_stealing_deque::buffer
+//==============================================================================
+
+template <typename T>
+inline bpstd::detail::work_stealing_deque<T>::buffer::buffer(std::int64_t capacity)
+  : m_mask{capacity - 1},
+    m_elements{new std::atomic<T*>[static_cast<std::size_t>(capacity)]}
+{
+
+}
+
+template <typename T>
+inline std::int64_t
+  bpstd::detail::work_stealing_deque<T>::buffer::capacity()
+  const noexcept
+{
+  return m_mask + 1;
+}
+
+template <typename T>
+inline T* bpstd::detail::work_stealing_deque<T>::buffer::load(std::int64_t i)
+  const noexcept
+{
+  return m_elements[static_cast<std::size_t>(i & m_mask)].load(std::memory_order_relaxed);
+}
+
+template <typename T>
+inline void bpstd::detail::work_stealing_deque<T>::buffer::store(std::int64_t i, T* p)
+  noexcept
+{
+  m_elements[static_cast<std::size_t>(i & m_mask)].store(p, std::memory_order_relaxed);
+}
+
+template <typename T>
+inline std::unique_ptr<typename bpstd::detail::work_stealing_deque<T>::buffer>
+  bpstd::detail::work_stealing_deque<T>::buffer::grow(std::int64_t top,
+                                                      std::int64_t bottom)
+  const
+{
+  auto result = std::unique_ptr<buffer>{new buffer{capacity() * 2}};
+  for (auto i = top; i != bottom; ++i) {
+    result->store(i, load(i));
+  }
+  return result;
+}
+
+//==============================================================================
+// definitions : class : work_stealing_deque
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline bpstd::detail::work_stealing_deque<T>::work_stealing_deque(std::int64_t capacity)
+  : m_top{0},
+    m_bottom{0},
+    m_buffer{nullptr},
+    m_buffers{}
+{
+  m_buffers.emplace_back(new buffer{capacity});
+  m_buffer.store(m_buffers.back().get(), std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+// Modifiers
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline void bpstd::detail::work_stealing_deque<T>::push(T* p)
+{
+  const auto b = m_bottom.load(std::memory_order_relaxed);
+  const auto t = m_top.load(std::memory_order_acquire);
+  auto* a = m_buffer.load(std::memory_order_relaxed);
+
+  if (b - t > a->capacity() - 1) {
+    m_buffers.reserve(m_buffers.size() + 1u);
+    m_buffers.push_back(a->grow(t, b));
+    a = m_buffers.back().get();
+    m_buffer.store(a, std::memory_order_release);
+  }
+  a->store(b, p);
+
+  std::atomic_thread_fence(std::memory_order_release);
+  m_bottom.store(b + 1, std::memory_order_relaxed);
+}
+
+template <typename T>
+inline T* bpstd::detail::work_stealing_deque<T>::pop()
+  noexcept
+{
+  const auto b = m_bottom.load(std::memory_order_relaxed) - 1;
+  auto* a = m_buffer.load(std::memory_order_relaxed);
+  m_bottom.store(b, std::memory_order_relaxed);
+
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  auto t = m_top.load(std::memory_order_relaxed);
+
+  if (t > b) {
+    // The deque was already empty
+    m_bottom.store(b + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  auto* result = a->load(b);
+  if (t == b) {
+    // This is the last element, which a thief may be racing to take
+    if (!m_top.compare_exchange_strong(t, t + 1,
+                                       std::memory_order_seq_cst,
+                                       std::memory_order_relaxed)) {
+      result = nullptr;
+    }
+    m_bottom.store(b + 1, std::memory_order_relaxed);
+  }
+  return result;
+}
+
+template <typename T>
+inline T* bpstd::detail::work_stealing_deque<T>::steal()
+  noexcept
+{
+  auto t = m_top.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const auto b = m_bottom.load(std::memory_order_acquire);
+
+  if (t >= b) {
+    return nullptr;
+  }
+
+  // 'consume' is what the paper calls for, but every implementation
+  // promotes it to 'acquire' anyway
+  auto* a = m_buffer.load(std::memory_order_acquire);
+  auto* result = a->load(t);
+  if (!m_top.compare_exchange_strong(t, t + 1,
+                                     std::memory_order_seq_cst,
+                                     std::memory_order_relaxed)) {
+    return nullptr;
+  }
+  return result;
+}
+
+//------------------------------------------------------------------------------
+// Observers
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline bool bpstd::detail::work_stealing_deque<T>::empty()
+  const noexcept
+{
+  const auto b = m_bottom.load(std::memory_order_relaxed);
+  const auto t = m_top.load(std::memory_order_relaxed);
+
+  return b <= t;
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_DETAIL_WORK_STEALING_DEQUE_HPP */
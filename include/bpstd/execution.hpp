@@ -0,0 +1,121 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file execution.hpp
+///
+/// \brief This header provides definitions from the C++ header <execution>
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_EXECUTION_HPP
+#define BPSTD_EXECUTION_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/config.hpp"
+
+#include "type_traits.hpp" // false_type, true_type
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+  namespace execution {
+
+    //==========================================================================
+    // execution policies
+    //==========================================================================
+
+    /// \brief The execution policy type used to require that a parallel
+    ///        algorithm's execution may not be parallelized
+    class sequenced_policy
+    {
+    public:
+      explicit sequenced_policy() = default;
+    };
+
+    /// \brief The execution policy type used to indicate that a parallel
+    ///        algorithm's execution may be parallelized
+    class parallel_policy
+    {
+    public:
+      explicit parallel_policy() = default;
+    };
+
+    /// \brief The execution policy type used to indicate that a parallel
+    ///        algorithm's execution may be parallelized and vectorized
+    class parallel_unsequenced_policy
+    {
+    public:
+      explicit parallel_unsequenced_policy() = default;
+    };
+
+    /// \brief The execution policy type used to indicate that a parallel
+    ///        algorithm's execution may be vectorized, but not parallelized
+    class unsequenced_policy
+    {
+    public:
+      explicit unsequenced_policy() = default;
+    };
+
+    //==========================================================================
+    // constants : execution policies
+    //==========================================================================
+
+    BPSTD_CPP17_INLINE constexpr sequenced_policy seq{};
+    BPSTD_CPP17_INLINE constexpr parallel_policy par{};
+    BPSTD_CPP17_INLINE constexpr parallel_unsequenced_policy par_unseq{};
+    BPSTD_CPP17_INLINE constexpr unsequenced_policy unseq{};
+
+  } // namespace execution
+
+  //============================================================================
+  // trait : is_execution_policy
+  //============================================================================
+
+  /// \brief Determines whether T is an execution policy type
+  ///
+  /// The result is aliased as \c ::value
+  template <typename T>
+  struct is_execution_policy : false_type{};
+
+  template <>
+  struct is_execution_policy<execution::sequenced_policy> : true_type{};
+  template <>
+  struct is_execution_policy<execution::parallel_policy> : true_type{};
+  template <>
+  struct is_execution_policy<execution::parallel_unsequenced_policy> : true_type{};
+  template <>
+  struct is_execution_policy<execution::unsequenced_policy> : true_type{};
+
+#if BPSTD_HAS_TEMPLATE_VARIABLES
+  template <typename T>
+  BPSTD_CPP17_INLINE constexpr auto is_execution_policy_v = is_execution_policy<T>::value;
+#endif
+
+} // namespace bpstd
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_EXECUTION_HPP */
@@ -0,0 +1,2322 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file flat_map.hpp
+///
+/// \brief This header provides definitions from the C++ header <flat_map>
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_FLAT_MAP_HPP
+#define BPSTD_FLAT_MAP_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/config.hpp"
+#include "detail/flat_tree.hpp" // sorted_unique_t, detail::reserve_if_able
+
+#include "functional.hpp"  // less
+#include "span.hpp"        // span
+#include "type_traits.hpp" // enable_if_t, is_convertible
+#include "utility.hpp"     // move, forward, pair
+
+#include <algorithm>        // std::lower_bound, std::stable_sort, etc
+#include <cstddef>          // std::size_t, std::ptrdiff_t
+#include <initializer_list> // std::initializer_list
+#include <iterator>         // std::reverse_iterator, std::random_access_iterator_tag
+#include <stdexcept>        // std::out_of_range
+#include <tuple>            // std::forward_as_tuple
+#include <vector>           // std::vector
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+  namespace detail {
+
+    //==========================================================================
+    // class : flat_map_iterator
+    //==========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A random-access iterator that walks the key and mapped
+    ///        containers of a flat_map in lock-step
+    ///
+    /// Dereferencing this iterator produces a pair of references into the
+    /// two containers, rather than a reference to a stored pair.
+    ///
+    /// \tparam KeyIt the iterator into the key container
+    /// \tparam MappedIt the iterator into the mapped container
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename KeyIt, typename MappedIt>
+    class flat_map_iterator
+    {
+      //------------------------------------------------------------------------
+      // Public Member Types
+      //------------------------------------------------------------------------
+    public:
+
+      using iterator_category = std::random_access_iterator_tag;
+      using value_type = std::pair<
+        typename std::iterator_traits<KeyIt>::value_type,
+        typename std::iterator_traits<MappedIt>::value_type
+      >;
+      using reference = std::pair<
+        typename std::iterator_traits<KeyIt>::reference,
+        typename std::iterator_traits<MappedIt>::reference
+      >;
+      using difference_type = std::ptrdiff_t;
+
+      /// \brief A pointer-like type that owns the proxy reference, so that
+      ///        'operator->' is usable on the iterator
+      class pointer
+      {
+      public:
+        explicit pointer(const reference& r) : m_reference(r){}
+
+        const reference* operator->() const noexcept { return &m_reference; }
+
+      private:
+        reference m_reference;
+      };
+
+      //------------------------------------------------------------------------
+      // Constructors
+      //------------------------------------------------------------------------
+    public:
+
+      flat_map_iterator() = default;
+
+      /// \brief Constructs an iterator from the key and mapped iterators
+      ///
+      /// \param key the key iterator
+      /// \param mapped the mapped iterator
+      flat_map_iterator(KeyIt key, MappedIt mapped) noexcept;
+
+      /// \brief Converts from a flat_map_iterator with a convertible mapped
+      ///        iterator (e.g. iterator to const_iterator)
+      ///
+      /// \param other the other iterator
+      template <typename UMappedIt,
+                typename = enable_if_t<is_convertible<UMappedIt,MappedIt>::value>>
+      // cppcheck-suppress noExplicitConstructor
+      flat_map_iterator(const flat_map_iterator<KeyIt,UMappedIt>& other) noexcept;
+
+      //------------------------------------------------------------------------
+      // Iteration
+      //------------------------------------------------------------------------
+    public:
+
+      flat_map_iterator& operator++() noexcept;
+      flat_map_iterator operator++(int) noexcept;
+      flat_map_iterator& operator--() noexcept;
+      flat_map_iterator operator--(int) noexcept;
+
+      //------------------------------------------------------------------------
+      // Random Access
+      //------------------------------------------------------------------------
+    public:
+
+      flat_map_iterator& operator+=(difference_type n) noexcept;
+      flat_map_iterator& operator-=(difference_type n) noexcept;
+
+      flat_map_iterator operator+(difference_type n) const noexcept;
+      flat_map_iterator operator-(difference_type n) const noexcept;
+
+      template <typename UMappedIt>
+      difference_type operator-(const flat_map_iterator<KeyIt,UMappedIt>& rhs) const noexcept;
+
+      reference operator[](difference_type n) const noexcept;
+
+      //------------------------------------------------------------------------
+      // Observers
+      //------------------------------------------------------------------------
+    public:
+
+      reference operator*() const noexcept;
+      pointer operator->() const noexcept;
+
+      /// \brief Gets the underlying key iterator
+      ///
+      /// \return the key iterator
+      KeyIt key_iterator() const noexcept;
+
+      /// \brief Gets the underlying mapped iterator
+      ///
+      /// \return the mapped iterator
+      MappedIt mapped_iterator() const noexcept;
+
+      //------------------------------------------------------------------------
+      // Comparison
+      //------------------------------------------------------------------------
+    public:
+
+      template <typename UMappedIt>
+      bool operator==(const flat_map_iterator<KeyIt,UMappedIt>& rhs) const noexcept;
+      template <typename UMappedIt>
+      bool operator!=(const flat_map_iterator<KeyIt,UMappedIt>& rhs) const noexcept;
+      template <typename UMappedIt>
+      bool operator<(const flat_map_iterator<KeyIt,UMappedIt>& rhs) const noexcept;
+      template <typename UMappedIt>
+      bool operator<=(const flat_map_iterator<KeyIt,UMappedIt>& rhs) const noexcept;
+      template <typename UMappedIt>
+      bool operator>(const flat_map_iterator<KeyIt,UMappedIt>& rhs) const noexcept;
+      template <typename UMappedIt>
+      bool operator>=(const flat_map_iterator<KeyIt,UMappedIt>& rhs) const noexcept;
+
+      //------------------------------------------------------------------------
+      // Private Members
+      //------------------------------------------------------------------------
+    private:
+
+      KeyIt    m_key;
+      MappedIt m_mapped;
+    };
+
+    template <typename KeyIt, typename MappedIt>
+    flat_map_iterator<KeyIt,MappedIt>
+      operator+(typename flat_map_iterator<KeyIt,MappedIt>::difference_type n,
+                const flat_map_iterator<KeyIt,MappedIt>& it) noexcept;
+
+  } // namespace detail
+
+  //============================================================================
+  // class : flat_map
+  //============================================================================
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief A container adapter that provides the interface of an ordered,
+  ///        unique associative map on top of two sorted, contiguous sequence
+  ///        containers
+  ///
+  /// Keys and mapped values are stored in two separate containers, which keeps
+  /// key lookups -- a binary search over only the keys -- cache-friendly, and
+  /// avoids the per-node allocations that std::map performs. Single-element
+  /// insertion and removal is O(N), which makes flat_map ideal for
+  /// read-mostly maps that are built in bulk.
+  ///
+  /// Bulk construction from a range appends all entries before sorting them
+  /// once, and the sorted_unique tag may be used to skip sorting entirely.
+  ///
+  /// \tparam Key the key type
+  /// \tparam T the mapped type
+  /// \tparam Compare the comparator used to order the keys
+  /// \tparam KeyContainer the random-access container used to store the keys
+  /// \tparam MappedContainer the random-access container used to store the
+  ///         mapped values
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename Key,
+            typename T,
+            typename Compare = less<Key>,
+            typename KeyContainer = std::vector<Key>,
+            typename MappedContainer = std::vector<T>>
+  class flat_map
+  {
+    //--------------------------------------------------------------------------
+    // Public Member Types
+    //--------------------------------------------------------------------------
+  public:
+
+    using key_type        = Key;
+    using mapped_type     = T;
+    using value_type      = std::pair<key_type, mapped_type>;
+    using key_compare     = Compare;
+    using reference       = std::pair<const key_type&, mapped_type&>;
+    using const_reference = std::pair<const key_type&, const mapped_type&>;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using key_container_type    = KeyContainer;
+    using mapped_container_type = MappedContainer;
+
+    using iterator = detail::flat_map_iterator<
+      typename key_container_type::const_iterator,
+      typename mapped_container_type::iterator
+    >;
+    using const_iterator = detail::flat_map_iterator<
+      typename key_container_type::const_iterator,
+      typename mapped_container_type::const_iterator
+    >;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /// \brief A comparator of value_types that compares only the keys
+    class value_compare
+    {
+    public:
+      bool operator()(const_reference lhs, const_reference rhs) const
+      {
+        return m_compare(lhs.first, rhs.first);
+      }
+
+    private:
+      explicit value_compare(const key_compare& comp) : m_compare(comp){}
+
+      key_compare m_compare;
+
+      friend flat_map;
+    };
+
+    /// \brief The pair of containers that make up the flat_map
+    struct containers
+    {
+      key_container_type    keys;
+      mapped_container_type values;
+    };
+
+    //--------------------------------------------------------------------------
+    // Constructors / Assignment
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Default constructs an empty flat_map
+    flat_map();
+
+    /// \brief Constructs an empty flat_map that uses the comparator \p comp
+    ///
+    /// \param comp the comparator
+    explicit flat_map(const key_compare& comp);
+
+    /// \brief Constructs a flat_map from the keys in \p keys and the mapped
+    ///        values in \p values
+    ///
+    /// The entries are sorted and deduplicated after construction. Of all
+    /// entries with equivalent keys, only the first is kept.
+    ///
+    /// \pre \p keys and \p values have the same size
+    ///
+    /// \param keys the container of keys
+    /// \param values the container of mapped values
+    /// \param comp the comparator
+    flat_map(key_container_type keys,
+             mapped_container_type values,
+             const key_compare& comp = key_compare{});
+
+    /// \brief Constructs a flat_map from the sorted, unique keys in \p keys
+    ///        and the mapped values in \p values
+    ///
+    /// \pre \p keys and \p values have the same size
+    /// \pre \p keys is sorted with respect to \p comp and contains no
+    ///      equivalent keys
+    ///
+    /// \param keys the container of keys
+    /// \param values the container of mapped values
+    /// \param comp the comparator
+    flat_map(sorted_unique_t,
+             key_container_type keys,
+             mapped_container_type values,
+             const key_compare& comp = key_compare{});
+
+    /// \brief Constructs a flat_map from the range [first, last) of
+    ///        key-value pairs
+    ///
+    /// \param first the start of the range
+    /// \param last the end of the range
+    /// \param comp the comparator
+    template <typename InputIt>
+    flat_map(InputIt first, InputIt last,
+             const key_compare& comp = key_compare{});
+
+    /// \brief Constructs a flat_map from the sorted, unique range
+    ///        [first, last) of key-value pairs
+    ///
+    /// \pre [first, last) is sorted with respect to \p comp and contains no
+    ///      equivalent keys
+    ///
+    /// \param first the start of the range
+    /// \param last the end of the range
+    /// \param comp the comparator
+    template <typename InputIt>
+    flat_map(sorted_unique_t, InputIt first, InputIt last,
+             const key_compare& comp = key_compare{});
+
+    /// \brief Constructs a flat_map by copying the key-value pairs viewed by
+    ///        \p entries
+    ///
+    /// \param entries the span of key-value pairs
+    /// \param comp the comparator
+    explicit flat_map(span<const value_type> entries,
+                      const key_compare& comp = key_compare{});
+
+    /// \brief Constructs a flat_map by copying the sorted, unique key-value
+    ///        pairs viewed by \p entries
+    ///
+    /// \pre \p entries is sorted with respect to \p comp and contains no
+    ///      equivalent keys
+    ///
+    /// \param entries the span of key-value pairs
+    /// \param comp the comparator
+    flat_map(sorted_unique_t,
+             span<const value_type> entries,
+             const key_compare& comp = key_compare{});
+
+    /// \brief Constructs a flat_map by copying the keys viewed by \p keys and
+    ///        the mapped values viewed by \p values
+    ///
+    /// \pre \p keys and \p values have the same size
+    ///
+    /// \param keys the span of keys
+    /// \param values the span of mapped values
+    /// \param comp the comparator
+    flat_map(span<const key_type> keys,
+             span<const mapped_type> values,
+             const key_compare& comp = key_compare{});
+
+    /// \brief Constructs a flat_map by copying the sorted, unique keys viewed
+    ///        by \p keys and the mapped values viewed by \p values
+    ///
+    /// \pre \p keys and \p values have the same size
+    /// \pre \p keys is sorted with respect to \p comp and contains no
+    ///      equivalent keys
+    ///
+    /// \param keys the span of keys
+    /// \param values the span of mapped values
+    /// \param comp the comparator
+    flat_map(sorted_unique_t,
+             span<const key_type> keys,
+             span<const mapped_type> values,
+             const key_compare& comp = key_compare{});
+
+    /// \brief Constructs a flat_map from an initializer list
+    ///
+    /// \param ilist the initializer list
+    /// \param comp the comparator
+    flat_map(std::initializer_list<value_type> ilist,
+             const key_compare& comp = key_compare{});
+
+    /// \brief Constructs a flat_map from a sorted, unique initializer list
+    ///
+    /// \param ilist the initializer list
+    /// \param comp the comparator
+    flat_map(sorted_unique_t,
+             std::initializer_list<value_type> ilist,
+             const key_compare& comp = key_compare{});
+
+    flat_map(const flat_map& other) = default;
+    flat_map(flat_map&& other) = default;
+
+    //--------------------------------------------------------------------------
+
+    flat_map& operator=(const flat_map& other) = default;
+    flat_map& operator=(flat_map&& other) = default;
+
+    /// \brief Replaces the contents of this flat_map with \p ilist
+    ///
+    /// \param ilist the initializer list
+    /// \return reference to \c (*this)
+    flat_map& operator=(std::initializer_list<value_type> ilist);
+
+    //--------------------------------------------------------------------------
+    // Iterators
+    //--------------------------------------------------------------------------
+  public:
+
+    iterator begin() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator cbegin() const noexcept;
+    iterator end() noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cend() const noexcept;
+
+    reverse_iterator rbegin() noexcept;
+    const_reverse_iterator rbegin() const noexcept;
+    const_reverse_iterator crbegin() const noexcept;
+    reverse_iterator rend() noexcept;
+    const_reverse_iterator rend() const noexcept;
+    const_reverse_iterator crend() const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Capacity
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Queries whether this flat_map is empty
+    ///
+    /// \return true if this flat_map contains no entries
+    bool empty() const noexcept;
+
+    /// \brief Gets the number of entries in this flat_map
+    ///
+    /// \return the number of entries
+    size_type size() const noexcept;
+
+    /// \brief Gets the maximum number of entries this flat_map may hold
+    ///
+    /// \return the maximum number of entries
+    size_type max_size() const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Element Access
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \{
+    /// \brief Gets the mapped value for \p key, default-constructing and
+    ///        inserting one if the key does not exist
+    ///
+    /// \param key the key to access
+    /// \return reference to the mapped value
+    mapped_type& operator[](const key_type& key);
+    mapped_type& operator[](key_type&& key);
+    /// \}
+
+    /// \{
+    /// \brief Gets the mapped value for \p key
+    ///
+    /// \throw std::out_of_range if no key equivalent to \p key exists
+    /// \param key the key to access
+    /// \return reference to the mapped value
+    mapped_type& at(const key_type& key);
+    const mapped_type& at(const key_type& key) const;
+    template <typename K, typename C = Compare,
+              typename = enable_if_t<detail::is_transparent_compare<C>::value>>
+    mapped_type& at(const K& key);
+    template <typename K, typename C = Compare,
+              typename = enable_if_t<detail::is_transparent_compare<C>::value>>
+    const mapped_type& at(const K& key) const;
+    /// \}
+
+    //--------------------------------------------------------------------------
+    // Modifiers
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs an entry from \p args, and inserts it if no entry
+    ///        with an equivalent key exists
+    ///
+    /// \param args the arguments to forward to value_type's constructor
+    /// \return a pair of the iterator to the entry, and whether it was
+    ///         inserted
+    template <typename...Args>
+    std::pair<iterator,bool> emplace(Args&&...args);
+
+    /// \brief Constructs an entry from \p args, using \p hint as a suggestion
+    ///        for where to insert it
+    ///
+    /// \param hint the suggested insertion position
+    /// \param args the arguments to forward to value_type's constructor
+    /// \return an iterator to the entry
+    template <typename...Args>
+    iterator emplace_hint(const_iterator hint, Args&&...args);
+
+    /// \{
+    /// \brief Inserts \p value if no entry with an equivalent key exists
+    ///
+    /// \param value the entry to insert
+    /// \return a pair of the iterator to the entry, and whether it was
+    ///         inserted
+    std::pair<iterator,bool> insert(const value_type& value);
+    std::pair<iterator,bool> insert(value_type&& value);
+    /// \}
+
+    /// \{
+    /// \brief Inserts \p value if no entry with an equivalent key exists,
+    ///        using \p hint as a suggestion for where to insert it
+    ///
+    /// \param hint the suggested insertion position
+    /// \param value the entry to insert
+    /// \return an iterator to the entry
+    iterator insert(const_iterator hint, const value_type& value);
+    iterator insert(const_iterator hint, value_type&& value);
+    /// \}
+
+    /// \brief Inserts all key-value pairs in the range [first, last)
+    ///
+    /// All entries are appended before the result is sorted once, making this
+    /// O(N log N) rather than the O(N^2) of inserting each entry
+    /// individually.
+    ///
+    /// \param first the start of the range
+    /// \param last the end of the range
+    template <typename InputIt>
+    void insert(InputIt first, InputIt last);
+
+    /// \brief Inserts all key-value pairs in the sorted, unique range
+    ///        [first, last)
+    ///
+    /// \pre [first, last) is sorted with respect to key_comp() and contains
+    ///      no equivalent keys
+    ///
+    /// \param first the start of the range
+    /// \param last the end of the range
+    template <typename InputIt>
+    void insert(sorted_unique_t, InputIt first, InputIt last);
+
+    /// \brief Inserts all key-value pairs in \p ilist
+    ///
+    /// \param ilist the initializer list
+    void insert(std::initializer_list<value_type> ilist);
+
+    /// \brief Inserts all key-value pairs in the sorted, unique list \p ilist
+    ///
+    /// \param ilist the initializer list
+    void insert(sorted_unique_t, std::initializer_list<value_type> ilist);
+
+    /// \{
+    /// \brief Constructs a mapped value from \p args for \p key if no entry
+    ///        with an equivalent key exists
+    ///
+    /// Unlike emplace, \p args are left untouched if the key already exists
+    ///
+    /// \param key the key
+    /// \param args the arguments to forward to mapped_type's constructor
+    /// \return a pair of the iterator to the entry, and whether it was
+    ///         inserted
+    template <typename...Args>
+    std::pair<iterator,bool> try_emplace(const key_type& key, Args&&...args);
+    template <typename...Args>
+    std::pair<iterator,bool> try_emplace(key_type&& key, Args&&...args);
+    /// \}
+
+    /// \{
+    /// \brief Assigns \p obj to the mapped value of \p key, inserting a new
+    ///        entry if the key does not exist
+    ///
+    /// \param key the key
+    /// \param obj the value to assign
+    /// \return a pair of the iterator to the entry, and whether it was
+    ///         inserted
+    template <typename M>
+    std::pair<iterator,bool> insert_or_assign(const key_type& key, M&& obj);
+    template <typename M>
+    std::pair<iterator,bool> insert_or_assign(key_type&& key, M&& obj);
+    /// \}
+
+    //--------------------------------------------------------------------------
+
+    /// \brief Extracts the underlying containers, leaving this flat_map empty
+    ///
+    /// \return the underlying containers
+    containers extract() &&;
+
+    /// \brief Replaces the underlying containers with \p keys and \p values
+    ///
+    /// \pre \p keys and \p values have the same size
+    /// \pre \p keys is sorted with respect to key_comp() and contains no
+    ///      equivalent keys
+    ///
+    /// \param keys the new key container
+    /// \param values the new mapped container
+    void replace(key_container_type&& keys, mapped_container_type&& values);
+
+    //--------------------------------------------------------------------------
+
+    /// \{
+    /// \brief Erases the entry at \p pos
+    ///
+    /// \param pos the position of the entry to erase
+    /// \return an iterator to the entry following the erased one
+    iterator erase(iterator pos);
+    iterator erase(const_iterator pos);
+    /// \}
+
+    /// \brief Erases all entries in the range [first, last)
+    ///
+    /// \param first the start of the range
+    /// \param last the end of the range
+    /// \return an iterator to the entry following the erased ones
+    iterator erase(const_iterator first, const_iterator last);
+
+    /// \brief Erases the entry with a key equivalent to \p key, if it exists
+    ///
+    /// \param key the key to erase
+    /// \return the number of entries erased
+    size_type erase(const key_type& key);
+
+    /// \brief Swaps the contents of this flat_map with \p other
+    ///
+    /// \param other the other flat_map to swap with
+    void swap(flat_map& other) noexcept;
+
+    /// \brief Erases all entries from this flat_map
+    void clear() noexcept;
+
+    //--------------------------------------------------------------------------
+    // Lookup
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \{
+    /// \brief Finds the entry with a key equivalent to \p key
+    ///
+    /// The templated overloads only participate in overload resolution if
+    /// the comparator is transparent
+    ///
+    /// \param key the key to search for
+    /// \return an iterator to the entry, or end() if not found
+    iterator find(const key_type& key);
+    const_iterator find(const key_type& key) const;
+    template <typename K, typename C = Compare,
+              typename = enable_if_t<detail::is_transparent_compare<C>::value>>
+    iterator find(const K& key);
+    template <typename K, typename C = Compare,
+              typename = enable_if_t<detail::is_transparent_compare<C>::value>>
+    const_iterator find(const K& key) const;
+    /// \}
+
+    /// \{
+    /// \brief Counts the number of entries with keys equivalent to \p key
+    ///
+    /// \param key the key to search for
+    /// \return the number of equivalent entries
+    size_type count(const key_type& key) const;
+    template <typename K, typename C = Compare,
+              typename = enable_if_t<detail::is_transparent_compare<C>::value>>
+    size_type count(const K& key) const;
+    /// \}
+
+    /// \{
+    /// \brief Queries whether an entry with a key equivalent to \p key exists
+    ///
+    /// \param key the key to search for
+    /// \return true if the key exists
+    bool contains(const key_type& key) const;
+    template <typename K, typename C = Compare,
+              typename = enable_if_t<detail::is_transparent_compare<C>::value>>
+    bool contains(const K& key) const;
+    /// \}
+
+    /// \{
+    /// \brief Gets an iterator to the first entry whose key is not less than
+    ///        \p key
+    ///
+    /// \param key the key to search for
+    /// \return an iterator to the entry
+    iterator lower_bound(const key_type& key);
+    const_iterator lower_bound(const key_type& key) const;
+    template <typename K, typename C = Compare,
+              typename = enable_if_t<detail::is_transparent_compare<C>::value>>
+    iterator lower_bound(const K& key);
+    template <typename K, typename C = Compare,
+              typename = enable_if_t<detail::is_transparent_compare<C>::value>>
+    const_iterator lower_bound(const K& key) const;
+    /// \}
+
+    /// \{
+    /// \brief Gets an iterator to the first entry whose key is greater than
+    ///        \p key
+    ///
+    /// \param key the key to search for
+    /// \return an iterator to the entry
+    iterator upper_bound(const key_type& key);
+    const_iterator upper_bound(const key_type& key) const;
+    template <typename K, typename C = Compare,
+              typename = enable_if_t<detail::is_transparent_compare<C>::value>>
+    iterator upper_bound(const K& key);
+    template <typename K, typename C = Compare,
+              typename = enable_if_t<detail::is_transparent_compare<C>::value>>
+    const_iterator upper_bound(const K& key) const;
+    /// \}
+
+    /// \{
+    /// \brief Gets the range of entries with keys equivalent to \p key
+    ///
+    /// \param key the key to search for
+    /// \return the range of equivalent entries
+    std::pair<iterator,iterator> equal_range(const key_type& key);
+    std::pair<const_iterator,const_iterator> equal_range(const key_type& key) const;
+    template <typename K, typename C = Compare,
+              typename = enable_if_t<detail::is_transparent_compare<C>::value>>
+    std::pair<iterator,iterator> equal_range(const K& key);
+    template <typename K, typename C = Compare,
+              typename = enable_if_t<detail::is_transparent_compare<C>::value>>
+    std::pair<const_iterator,const_iterator> equal_range(const K& key) const;
+    /// \}
+
+    //--------------------------------------------------------------------------
+    // Observers
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets the comparator used to order keys
+    ///
+    /// \return the key comparator
+    key_compare key_comp() const;
+
+    /// \brief Gets the comparator used to order entries
+    ///
+    /// \return the value comparator
+    value_compare value_comp() const;
+
+    /// \brief Gets the sorted container of keys
+    ///
+    /// \return const reference to the keys
+    const key_container_type& keys() const noexcept;
+
+    /// \brief Gets the container of mapped values, ordered by their keys
+    ///
+    /// \return const reference to the mapped values
+    const mapped_container_type& values() const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Member Functions
+    //--------------------------------------------------------------------------
+  private:
+
+    iterator make_iterator(size_type index) noexcept;
+    const_iterator make_iterator(size_type index) const noexcept;
+
+    template <typename K>
+    size_type lower_bound_index(const K& key) const;
+    template <typename K>
+    size_type upper_bound_index(const K& key) const;
+    template <typename K>
+    size_type find_index(const K& key) const;
+
+    /// \brief Sorts and deduplicates the entries beyond the sorted and unique
+    ///        prefix of length \p offset
+    ///
+    /// \param offset the size of the sorted and unique prefix
+    void sort_unique_from(size_type offset);
+
+    /// \brief Appends the key-value pairs in [first, last) to the containers
+    template <typename InputIt>
+    void append(InputIt first, InputIt last);
+
+    template <typename K, typename...Args>
+    std::pair<iterator,bool> try_emplace_unique(K&& key, Args&&...args);
+
+    template <typename K, typename M>
+    std::pair<iterator,bool> insert_or_assign_unique(K&& key, M&& obj);
+
+    //--------------------------------------------------------------------------
+    // Private Members
+    //--------------------------------------------------------------------------
+  private:
+
+    containers  m_containers;
+    key_compare m_compare;
+  };
+
+  //============================================================================
+  // non-member functions : class : flat_map
+  //============================================================================
+
+  //----------------------------------------------------------------------------
+  // Comparison
+  //----------------------------------------------------------------------------
+
+  template <typename Key, typename T, typename Compare,
+            typename KeyContainer, typename MappedContainer>
+  bool operator==(const flat_map<Key,T,Compare,KeyContainer,MappedContainer>& lhs,
+                  const flat_map<Key,T,Compare,KeyContainer,MappedContainer>& rhs);
+  template <typename Key, typename T, typename Compare,
+            typename KeyContainer, typename MappedContainer>
+  bool operator!=(const flat_map<Key,T,Compare,KeyContainer,MappedContainer>& lhs,
+                  const flat_map<Key,T,Compare,KeyContainer,MappedContainer>& rhs);
+
+  //----------------------------------------------------------------------------
+  // Utilities
+  //----------------------------------------------------------------------------
+
+  template <typename Key, typename T, typename Compare,
+            typename KeyContainer, typename MappedContainer>
+  void swap(flat_map<Key,T,Compare,KeyContainer,MappedContainer>& lhs,
+            flat_map<Key,T,Compare,KeyContainer,MappedContainer>& rhs) noexcept;
+
+} // namespace bpstd
+
+//==============================================================================
+// definitions : class : flat_map_iterator
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+template <typename KeyIt, typename MappedIt>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::detail::flat_map_iterator<KeyIt,MappedIt>
+  ::flat_map_iterator(KeyIt key, MappedIt mapped)
+  noexcept
+  : m_key(key),
+    m_mapped(mapped)
+{
+
+}
+
+template <typename KeyIt, typename MappedIt>
+template <typename UMappedIt, typename>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::detail::flat_map_iterator<KeyIt,MappedIt>
+  ::flat_map_iterator(const flat_map_iterator<KeyIt,UMappedIt>& other)
+  noexcept
+  : m_key(other.key_iterator()),
+    m_mapped(other.mapped_iterator())
+{
+
+}
+
+//------------------------------------------------------------------------------
+// Iteration
+//------------------------------------------------------------------------------
+
+template <typename KeyIt, typename MappedIt>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::detail::flat_map_iterator<KeyIt,MappedIt>&
+  bpstd::detail::flat_map_iterator<KeyIt,MappedIt>::operator++()
+  noexcept
+{
+  ++m_key;
+  ++m_mapped;
+  return (*this);
+}
+
+template <typename KeyIt, typename MappedIt>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::detail::flat_map_iterator<KeyIt,MappedIt>
+  bpstd::detail::flat_map_iterator<KeyIt,MappedIt>::operator++(int)
+  noexcept
+{
+  auto copy = (*this);
+  ++(*this);
+  return copy;
+}
+
+template <typename KeyIt, typename MappedIt>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::detail::flat_map_iterator<KeyIt,MappedIt>&
+  bpstd::detail::flat_map_iterator<KeyIt,MappedIt>::operator--()
+  noexcept
+{
+  --m_key;
+  --m_mapped;
+  return (*this);
+}
+
+template <typename KeyIt, typename MappedIt>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::detail::flat_map_iterator<KeyIt,MappedIt>
+  bpstd::detail::flat_map_iterator<KeyIt,MappedIt>::operator--(int)
+  noexcept
+{
+  auto copy = (*this);
+  --(*this);
+  return copy;
+}
+
+//------------------------------------------------------------------------------
+// Random Access
+//------------------------------------------------------------------------------
+
+template <typename KeyIt, typename MappedIt>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::detail::flat_map_iterator<KeyIt,MappedIt>&
+  bpstd::detail::flat_map_iterator<KeyIt,MappedIt>::operator+=(difference_type n)
+  noexcept
+{
+  m_key += n;
+  m_mapped += n;
+  return (*this);
+}
+
+template <typename KeyIt, typename MappedIt>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::detail::flat_map_iterator<KeyIt,MappedIt>&
+  bpstd::detail::flat_map_iterator<KeyIt,MappedIt>::operator-=(difference_type n)
+  noexcept
+{
+  m_key -= n;
+  m_mapped -= n;
+  return (*this);
+}
+
+template <typename KeyIt, typename MappedIt>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::detail::flat_map_iterator<KeyIt,MappedIt>
+  bpstd::detail::flat_map_iterator<KeyIt,MappedIt>::operator+(difference_type n)
+  const noexcept
+{
+  return flat_map_iterator{m_key + n, m_mapped + n};
+}
+
+template <typename KeyIt, typename MappedIt>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::detail::flat_map_iterator<KeyIt,MappedIt>
+  bpstd::detail::flat_map_iterator<KeyIt,MappedIt>::operator-(difference_type n)
+  const noexcept
+{
+  return flat_map_iterator{m_key - n, m_mapped - n};
+}
+
+template <typename KeyIt, typename MappedIt>
+template <typename UMappedIt>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::detail::flat_map_iterator<KeyIt,MappedIt>::difference_type
+  bpstd::detail::flat_map_iterator<KeyIt,MappedIt>
+  ::operator-(const flat_map_iterator<KeyIt,UMappedIt>& rhs)
+  const noexcept
+{
+  return static_cast<difference_type>(m_key - rhs.key_iterator());
+}
+
+template <typename KeyIt, typename MappedIt>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::detail::flat_map_iterator<KeyIt,MappedIt>::reference
+  bpstd::detail::flat_map_iterator<KeyIt,MappedIt>::operator[](difference_type n)
+  const noexcept
+{
+  return reference{m_key[n], m_mapped[n]};
+}
+
+template <typename KeyIt, typename MappedIt>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::detail::flat_map_iterator<KeyIt,MappedIt>
+  bpstd::detail::operator+(typename flat_map_iterator<KeyIt,MappedIt>::difference_type n,
+                           const flat_map_iterator<KeyIt,MappedIt>& it)
+  noexcept
+{
+  return it + n;
+}
+
+//------------------------------------------------------------------------------
+// Observers
+//------------------------------------------------------------------------------
+
+template <typename KeyIt, typename MappedIt>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::detail::flat_map_iterator<KeyIt,MappedIt>::reference
+  bpstd::detail::flat_map_iterator<KeyIt,MappedIt>::operator*()
+  const noexcept
+{
+  return reference{*m_key, *m_mapped};
+}
+
+template <typename KeyIt, typename MappedIt>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::detail::flat_map_iterator<KeyIt,MappedIt>::pointer
+  bpstd::detail::flat_map_iterator<KeyIt,MappedIt>::operator->()
+  const noexcept
+{
+  return pointer{**this};
+}
+
+template <typename KeyIt, typename MappedIt>
+inline BPSTD_INLINE_VISIBILITY
+KeyIt bpstd::detail::flat_map_iterator<KeyIt,MappedIt>::key_iterator()
+  const noexcept
+{
+  return m_key;
+}
+
+template <typename KeyIt, typename MappedIt>
+inline BPSTD_INLINE_VISIBILITY
+MappedIt bpstd::detail::flat_map_iterator<KeyIt,MappedIt>::mapped_iterator()
+  const noexcept
+{
+  return m_mapped;
+}
+
+//------------------------------------------------------------------------------
+// Comparison
+//------------------------------------------------------------------------------
+
+template <typename KeyIt, typename MappedIt>
+template <typename UMappedIt>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::detail::flat_map_iterator<KeyIt,MappedIt>
+  ::operator==(const flat_map_iterator<KeyIt,UMappedIt>& rhs)
+  const noexcept
+{
+  return m_key == rhs.key_iterator();
+}
+
+template <typename KeyIt, typename MappedIt>
+template <typename UMappedIt>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::detail::flat_map_iterator<KeyIt,MappedIt>
+  ::operator!=(const flat_map_iterator<KeyIt,UMappedIt>& rhs)
+  const noexcept
+{
+  return m_key != rhs.key_iterator();
+}
+
+template <typename KeyIt, typename MappedIt>
+template <typename UMappedIt>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::detail::flat_map_iterator<KeyIt,MappedIt>
+  ::operator<(const flat_map_iterator<KeyIt,UMappedIt>& rhs)
+  const noexcept
+{
+  return m_key < rhs.key_iterator();
+}
+
+template <typename KeyIt, typename MappedIt>
+template <typename UMappedIt>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::detail::flat_map_iterator<KeyIt,MappedIt>
+  ::operator<=(const flat_map_iterator<KeyIt,UMappedIt>& rhs)
+  const noexcept
+{
+  return m_key <= rhs.key_iterator();
+}
+
+template <typename KeyIt, typename MappedIt>
+template <typename UMappedIt>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::detail::flat_map_iterator<KeyIt,MappedIt>
+  ::operator>(const flat_map_iterator<KeyIt,UMappedIt>& rhs)
+  const noexcept
+{
+  return m_key > rhs.key_iterator();
+}
+
+template <typename KeyIt, typename MappedIt>
+template <typename UMappedIt>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::detail::flat_map_iterator<KeyIt,MappedIt>
+  ::operator>=(const flat_map_iterator<KeyIt,UMappedIt>& rhs)
+  const noexcept
+{
+  return m_key >= rhs.key_iterator();
+}
+
+//==============================================================================
+// definitions : class : flat_map
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Constructors / Assignment
+//------------------------------------------------------------------------------
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::flat_map()
+  : m_containers{},
+    m_compare{}
+{
+
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::flat_map(const key_compare& comp)
+  : m_containers{},
+    m_compare(comp)
+{
+
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline
+bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::flat_map(key_container_type keys,
+             mapped_container_type values,
+             const key_compare& comp)
+  : m_containers{bpstd::move(keys), bpstd::move(values)},
+    m_compare(comp)
+{
+  sort_unique_from(0u);
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::flat_map(sorted_unique_t,
+             key_container_type keys,
+             mapped_container_type values,
+             const key_compare& comp)
+  : m_containers{bpstd::move(keys), bpstd::move(values)},
+    m_compare(comp)
+{
+
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+template <typename InputIt>
+inline
+bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::flat_map(InputIt first, InputIt last, const key_compare& comp)
+  : m_containers{},
+    m_compare(comp)
+{
+  append(first, last);
+  sort_unique_from(0u);
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+template <typename InputIt>
+inline
+bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::flat_map(sorted_unique_t,
+             InputIt first,
+             InputIt last,
+             const key_compare& comp)
+  : m_containers{},
+    m_compare(comp)
+{
+  append(first, last);
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline
+bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::flat_map(span<const value_type> entries, const key_compare& comp)
+  : m_containers{},
+    m_compare(comp)
+{
+  append(entries.data(), entries.data() + entries.size());
+  sort_unique_from(0u);
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline
+bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::flat_map(sorted_unique_t,
+             span<const value_type> entries,
+             const key_compare& comp)
+  : m_containers{},
+    m_compare(comp)
+{
+  append(entries.data(), entries.data() + entries.size());
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline
+bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::flat_map(span<const key_type> keys,
+             span<const mapped_type> values,
+             const key_compare& comp)
+  : m_containers{
+      key_container_type(keys.data(), keys.data() + keys.size()),
+      mapped_container_type(values.data(), values.data() + values.size())
+    },
+    m_compare(comp)
+{
+  sort_unique_from(0u);
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::flat_map(sorted_unique_t,
+             span<const key_type> keys,
+             span<const mapped_type> values,
+             const key_compare& comp)
+  : m_containers{
+      key_container_type(keys.data(), keys.data() + keys.size()),
+      mapped_container_type(values.data(), values.data() + values.size())
+    },
+    m_compare(comp)
+{
+
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline
+bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::flat_map(std::initializer_list<value_type> ilist, const key_compare& comp)
+  : flat_map(ilist.begin(), ilist.end(), comp)
+{
+
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline
+bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::flat_map(sorted_unique_t,
+             std::initializer_list<value_type> ilist,
+             const key_compare& comp)
+  : flat_map(sorted_unique, ilist.begin(), ilist.end(), comp)
+{
+
+}
+
+//------------------------------------------------------------------------------
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline
+bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>&
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::operator=(std::initializer_list<value_type> ilist)
+{
+  clear();
+  append(ilist.begin(), ilist.end());
+  sort_unique_from(0u);
+
+  return (*this);
+}
+
+//------------------------------------------------------------------------------
+// Iterators
+//------------------------------------------------------------------------------
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::begin()
+  noexcept
+{
+  return iterator{m_containers.keys.cbegin(), m_containers.values.begin()};
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::const_iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::begin()
+  const noexcept
+{
+  return const_iterator{m_containers.keys.cbegin(), m_containers.values.cbegin()};
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::const_iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::cbegin()
+  const noexcept
+{
+  return begin();
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::end()
+  noexcept
+{
+  return iterator{m_containers.keys.cend(), m_containers.values.end()};
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::const_iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::end()
+  const noexcept
+{
+  return const_iterator{m_containers.keys.cend(), m_containers.values.cend()};
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::const_iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::cend()
+  const noexcept
+{
+  return end();
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::reverse_iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::rbegin()
+  noexcept
+{
+  return reverse_iterator{end()};
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::const_reverse_iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::rbegin()
+  const noexcept
+{
+  return const_reverse_iterator{end()};
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::const_reverse_iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::crbegin()
+  const noexcept
+{
+  return rbegin();
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::reverse_iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::rend()
+  noexcept
+{
+  return reverse_iterator{begin()};
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::const_reverse_iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::rend()
+  const noexcept
+{
+  return const_reverse_iterator{begin()};
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::const_reverse_iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::crend()
+  const noexcept
+{
+  return rend();
+}
+
+//------------------------------------------------------------------------------
+// Capacity
+//------------------------------------------------------------------------------
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::empty()
+  const noexcept
+{
+  return m_containers.keys.empty();
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::size_type
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::size()
+  const noexcept
+{
+  return m_containers.keys.size();
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::size_type
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::max_size()
+  const noexcept
+{
+  return (std::min)(
+    static_cast<size_type>(m_containers.keys.max_size()),
+    static_cast<size_type>(m_containers.values.max_size())
+  );
+}
+
+//------------------------------------------------------------------------------
+// Element Access
+//------------------------------------------------------------------------------
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::mapped_type&
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::operator[](const key_type& key)
+{
+  return try_emplace_unique(key).first->second;
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::mapped_type&
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::operator[](key_type&& key)
+{
+  return try_emplace_unique(bpstd::move(key)).first->second;
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::mapped_type&
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::at(const key_type& key)
+{
+  const auto index = find_index(key);
+  if (index == size()) {
+    throw std::out_of_range{"Key not found in flat_map::at"};
+  }
+  return m_containers.values[index];
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+const typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::mapped_type&
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::at(const key_type& key)
+  const
+{
+  const auto index = find_index(key);
+  if (index == size()) {
+    throw std::out_of_range{"Key not found in flat_map::at"};
+  }
+  return m_containers.values[index];
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+template <typename K, typename C, typename>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::mapped_type&
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::at(const K& key)
+{
+  const auto index = find_index(key);
+  if (index == size()) {
+    throw std::out_of_range{"Key not found in flat_map::at"};
+  }
+  return m_containers.values[index];
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+template <typename K, typename C, typename>
+inline BPSTD_INLINE_VISIBILITY
+const typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::mapped_type&
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::at(const K& key)
+  const
+{
+  const auto index = find_index(key);
+  if (index == size()) {
+    throw std::out_of_range{"Key not found in flat_map::at"};
+  }
+  return m_containers.values[index];
+}
+
+//------------------------------------------------------------------------------
+// Modifiers
+//------------------------------------------------------------------------------
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+template <typename...Args>
+inline BPSTD_INLINE_VISIBILITY
+std::pair<typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::iterator,bool>
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::emplace(Args&&...args)
+{
+  auto value = value_type(bpstd::forward<Args>(args)...);
+
+  return try_emplace_unique(bpstd::move(value.first), bpstd::move(value.second));
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+template <typename...Args>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::emplace_hint(const_iterator hint, Args&&...args)
+{
+  // Lookup is a binary search over contiguous keys, so the hint offers little
+  BPSTD_UNUSED(hint);
+
+  return emplace(bpstd::forward<Args>(args)...).first;
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+std::pair<typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::iterator,bool>
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::insert(const value_type& value)
+{
+  return try_emplace_unique(value.first, value.second);
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+std::pair<typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::iterator,bool>
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::insert(value_type&& value)
+{
+  return try_emplace_unique(bpstd::move(value.first), bpstd::move(value.second));
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::insert(const_iterator hint, const value_type& value)
+{
+  BPSTD_UNUSED(hint);
+
+  return insert(value).first;
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::insert(const_iterator hint, value_type&& value)
+{
+  BPSTD_UNUSED(hint);
+
+  return insert(bpstd::move(value)).first;
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+template <typename InputIt>
+inline
+void bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::insert(InputIt first, InputIt last)
+{
+  const auto offset = size();
+  append(first, last);
+  sort_unique_from(offset);
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+template <typename InputIt>
+inline
+void bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::insert(sorted_unique_t, InputIt first, InputIt last)
+{
+  // Merging two sorted sequences across two containers requires the same
+  // permutation pass as the unsorted case, which is stable and keeps the
+  // existing entries
+  insert(first, last);
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::insert(std::initializer_list<value_type> ilist)
+{
+  insert(ilist.begin(), ilist.end());
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::insert(sorted_unique_t, std::initializer_list<value_type> ilist)
+{
+  insert(sorted_unique, ilist.begin(), ilist.end());
+}
+
+//------------------------------------------------------------------------------
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+template <typename...Args>
+inline BPSTD_INLINE_VISIBILITY
+std::pair<typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::iterator,bool>
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::try_emplace(const key_type& key, Args&&...args)
+{
+  return try_emplace_unique(key, bpstd::forward<Args>(args)...);
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+template <typename...Args>
+inline BPSTD_INLINE_VISIBILITY
+std::pair<typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::iterator,bool>
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::try_emplace(key_type&& key, Args&&...args)
+{
+  return try_emplace_unique(bpstd::move(key), bpstd::forward<Args>(args)...);
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+template <typename M>
+inline BPSTD_INLINE_VISIBILITY
+std::pair<typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::iterator,bool>
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::insert_or_assign(const key_type& key, M&& obj)
+{
+  return insert_or_assign_unique(key, bpstd::forward<M>(obj));
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+template <typename M>
+inline BPSTD_INLINE_VISIBILITY
+std::pair<typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::iterator,bool>
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::insert_or_assign(key_type&& key, M&& obj)
+{
+  return insert_or_assign_unique(bpstd::move(key), bpstd::forward<M>(obj));
+}
+
+//------------------------------------------------------------------------------
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::containers
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::extract()
+  &&
+{
+  auto result = bpstd::move(m_containers);
+  clear();
+  return result;
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::replace(key_container_type&& keys, mapped_container_type&& values)
+{
+  m_containers.keys = bpstd::move(keys);
+  m_containers.values = bpstd::move(values);
+}
+
+//------------------------------------------------------------------------------
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::erase(iterator pos)
+{
+  return erase(const_iterator{pos});
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::erase(const_iterator pos)
+{
+  const auto index = static_cast<size_type>(pos - cbegin());
+
+  m_containers.keys.erase(pos.key_iterator());
+  m_containers.values.erase(pos.mapped_iterator());
+
+  return make_iterator(index);
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::erase(const_iterator first, const_iterator last)
+{
+  const auto index = static_cast<size_type>(first - cbegin());
+
+  m_containers.keys.erase(first.key_iterator(), last.key_iterator());
+  m_containers.values.erase(first.mapped_iterator(), last.mapped_iterator());
+
+  return make_iterator(index);
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::size_type
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::erase(const key_type& key)
+{
+  const auto it = find(key);
+  if (it == end()) {
+    return 0u;
+  }
+  erase(it);
+  return 1u;
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::swap(flat_map& other)
+  noexcept
+{
+  using std::swap;
+
+  swap(m_containers.keys, other.m_containers.keys);
+  swap(m_containers.values, other.m_containers.values);
+  swap(m_compare, other.m_compare);
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::clear()
+  noexcept
+{
+  m_containers.keys.clear();
+  m_containers.values.clear();
+}
+
+//------------------------------------------------------------------------------
+// Lookup
+//------------------------------------------------------------------------------
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::find(const key_type& key)
+{
+  return make_iterator(find_index(key));
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::const_iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::find(const key_type& key)
+  const
+{
+  return make_iterator(find_index(key));
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+template <typename K, typename C, typename>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::find(const K& key)
+{
+  return make_iterator(find_index(key));
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+template <typename K, typename C, typename>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::const_iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::find(const K& key)
+  const
+{
+  return make_iterator(find_index(key));
+}
+
+//------------------------------------------------------------------------------
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::size_type
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::count(const key_type& key)
+  const
+{
+  return contains(key) ? 1u : 0u;
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+template <typename K, typename C, typename>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::size_type
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::count(const K& key)
+  const
+{
+  // A heterogeneous key may be equivalent to more than one stored key
+  return upper_bound_index(key) - lower_bound_index(key);
+}
+
+//------------------------------------------------------------------------------
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::contains(const key_type& key)
+  const
+{
+  return find_index(key) != size();
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+template <typename K, typename C, typename>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::contains(const K& key)
+  const
+{
+  return find_index(key) != size();
+}
+
+//------------------------------------------------------------------------------
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::lower_bound(const key_type& key)
+{
+  return make_iterator(lower_bound_index(key));
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::const_iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::lower_bound(const key_type& key)
+  const
+{
+  return make_iterator(lower_bound_index(key));
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+template <typename K, typename C, typename>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::lower_bound(const K& key)
+{
+  return make_iterator(lower_bound_index(key));
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+template <typename K, typename C, typename>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::const_iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::lower_bound(const K& key)
+  const
+{
+  return make_iterator(lower_bound_index(key));
+}
+
+//------------------------------------------------------------------------------
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::upper_bound(const key_type& key)
+{
+  return make_iterator(upper_bound_index(key));
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::const_iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::upper_bound(const key_type& key)
+  const
+{
+  return make_iterator(upper_bound_index(key));
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+template <typename K, typename C, typename>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::upper_bound(const K& key)
+{
+  return make_iterator(upper_bound_index(key));
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+template <typename K, typename C, typename>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::const_iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::upper_bound(const K& key)
+  const
+{
+  return make_iterator(upper_bound_index(key));
+}
+
+//------------------------------------------------------------------------------
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+std::pair<
+  typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::iterator,
+  typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::iterator
+> bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::equal_range(const key_type& key)
+{
+  const auto index = find_index(key);
+  const auto last  = (index == size()) ? index : (index + 1u);
+
+  return {make_iterator(index), make_iterator(last)};
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+std::pair<
+  typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::const_iterator,
+  typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::const_iterator
+> bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::equal_range(const key_type& key)
+  const
+{
+  const auto index = find_index(key);
+  const auto last  = (index == size()) ? index : (index + 1u);
+
+  return {make_iterator(index), make_iterator(last)};
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+template <typename K, typename C, typename>
+inline BPSTD_INLINE_VISIBILITY
+std::pair<
+  typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::iterator,
+  typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::iterator
+> bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::equal_range(const K& key)
+{
+  return {
+    make_iterator(lower_bound_index(key)),
+    make_iterator(upper_bound_index(key))
+  };
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+template <typename K, typename C, typename>
+inline BPSTD_INLINE_VISIBILITY
+std::pair<
+  typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::const_iterator,
+  typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::const_iterator
+> bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::equal_range(const K& key)
+  const
+{
+  return {
+    make_iterator(lower_bound_index(key)),
+    make_iterator(upper_bound_index(key))
+  };
+}
+
+//------------------------------------------------------------------------------
+// Observers
+//------------------------------------------------------------------------------
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::key_compare
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::key_comp()
+  const
+{
+  return m_compare;
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::value_compare
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::value_comp()
+  const
+{
+  return value_compare{m_compare};
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+const typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::key_container_type&
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::keys()
+  const noexcept
+{
+  return m_containers.keys;
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+const typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::mapped_container_type&
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::values()
+  const noexcept
+{
+  return m_containers.values;
+}
+
+//------------------------------------------------------------------------------
+// Private Member Functions
+//------------------------------------------------------------------------------
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::make_iterator(size_type index)
+  noexcept
+{
+  const auto offset = static_cast<difference_type>(index);
+
+  return iterator{
+    m_containers.keys.cbegin() + offset,
+    m_containers.values.begin() + offset
+  };
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::const_iterator
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::make_iterator(size_type index)
+  const noexcept
+{
+  const auto offset = static_cast<difference_type>(index);
+
+  return const_iterator{
+    m_containers.keys.cbegin() + offset,
+    m_containers.values.cbegin() + offset
+  };
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+template <typename K>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::size_type
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::lower_bound_index(const K& key)
+  const
+{
+  const auto& keys = m_containers.keys;
+  const auto it = std::lower_bound(keys.begin(), keys.end(), key, m_compare);
+
+  return static_cast<size_type>(it - keys.begin());
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+template <typename K>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::size_type
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::upper_bound_index(const K& key)
+  const
+{
+  const auto& keys = m_containers.keys;
+  const auto it = std::upper_bound(keys.begin(), keys.end(), key, m_compare);
+
+  return static_cast<size_type>(it - keys.begin());
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+template <typename K>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::size_type
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::find_index(const K& key)
+  const
+{
+  const auto index = lower_bound_index(key);
+  if (index == size() || m_compare(key, m_containers.keys[index])) {
+    return size();
+  }
+  return index;
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline
+void bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::sort_unique_from(size_type offset)
+{
+  auto& keys   = m_containers.keys;
+  auto& values = m_containers.values;
+
+  const auto size = keys.size();
+
+  // Order a permutation of indices rather than the entries themselves, so
+  // that both containers only need to be rebuilt once. The sort is stable,
+  // so that the first of any equivalent entries is the one that survives.
+  auto indices = std::vector<size_type>{};
+  indices.reserve(size);
+  for (auto i = size_type{0}; i < size; ++i) {
+    indices.push_back(i);
+  }
+
+  const auto& compare = m_compare;
+  const auto middle = indices.begin() + static_cast<difference_type>(offset);
+  const auto compare_index = [&](size_type lhs, size_type rhs) {
+    return compare(keys[lhs], keys[rhs]);
+  };
+  std::stable_sort(middle, indices.end(), compare_index);
+  std::inplace_merge(indices.begin(), middle, indices.end(), compare_index);
+
+  auto new_keys   = key_container_type{};
+  auto new_values = mapped_container_type{};
+  detail::reserve_if_able(new_keys, size);
+  detail::reserve_if_able(new_values, size);
+
+  for (auto index : indices) {
+    if (!new_keys.empty() && !compare(new_keys.back(), keys[index])) {
+      continue;
+    }
+    new_keys.push_back(bpstd::move(keys[index]));
+    new_values.push_back(bpstd::move(values[index]));
+  }
+
+  keys   = bpstd::move(new_keys);
+  values = bpstd::move(new_values);
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+template <typename InputIt>
+inline
+void bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::append(InputIt first, InputIt last)
+{
+  for (; first != last; ++first) {
+    m_containers.keys.push_back((*first).first);
+    m_containers.values.push_back((*first).second);
+  }
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+template <typename K, typename...Args>
+inline BPSTD_INLINE_VISIBILITY
+std::pair<typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::iterator,bool>
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::try_emplace_unique(K&& key, Args&&...args)
+{
+  const auto index = lower_bound_index(key);
+  if (index != size() && !m_compare(key, m_containers.keys[index])) {
+    return {make_iterator(index), false};
+  }
+
+  const auto offset = static_cast<difference_type>(index);
+  m_containers.keys.insert(
+    m_containers.keys.begin() + offset,
+    bpstd::forward<K>(key)
+  );
+  m_containers.values.emplace(
+    m_containers.values.begin() + offset,
+    bpstd::forward<Args>(args)...
+  );
+
+  return {make_iterator(index), true};
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+template <typename K, typename M>
+inline BPSTD_INLINE_VISIBILITY
+std::pair<typename bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>::iterator,bool>
+  bpstd::flat_map<Key,T,Compare,KeyContainer,MappedContainer>
+  ::insert_or_assign_unique(K&& key, M&& obj)
+{
+  const auto index = lower_bound_index(key);
+  if (index != size() && !m_compare(key, m_containers.keys[index])) {
+    m_containers.values[index] = bpstd::forward<M>(obj);
+    return {make_iterator(index), false};
+  }
+
+  const auto offset = static_cast<difference_type>(index);
+  m_containers.keys.insert(
+    m_containers.keys.begin() + offset,
+    bpstd::forward<K>(key)
+  );
+  m_containers.values.insert(
+    m_containers.values.begin() + offset,
+    bpstd::forward<M>(obj)
+  );
+
+  return {make_iterator(index), true};
+}
+
+//==============================================================================
+// definitions : non-member functions : class : flat_map
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Comparison
+//------------------------------------------------------------------------------
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::operator==(const flat_map<Key,T,Compare,KeyContainer,MappedContainer>& lhs,
+                       const flat_map<Key,T,Compare,KeyContainer,MappedContainer>& rhs)
+{
+  return lhs.keys() == rhs.keys() && lhs.values() == rhs.values();
+}
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::operator!=(const flat_map<Key,T,Compare,KeyContainer,MappedContainer>& lhs,
+                       const flat_map<Key,T,Compare,KeyContainer,MappedContainer>& rhs)
+{
+  return !(lhs == rhs);
+}
+
+//------------------------------------------------------------------------------
+// Utilities
+//------------------------------------------------------------------------------
+
+template <typename Key, typename T, typename Compare,
+          typename KeyContainer, typename MappedContainer>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::swap(flat_map<Key,T,Compare,KeyContainer,MappedContainer>& lhs,
+                 flat_map<Key,T,Compare,KeyContainer,MappedContainer>& rhs)
+  noexcept
+{
+  lhs.swap(rhs);
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_FLAT_MAP_HPP */
@@ -0,0 +1,1207 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file flat_set.hpp
+///
+/// \brief This header provides definitions from the C++ header <flat_set>
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_FLAT_SET_HPP
+#define BPSTD_FLAT_SET_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/config.hpp"
+#include "detail/flat_tree.hpp" // sorted_unique_t, detail::merge_unique
+
+#include "functional.hpp"  // less
+#include "span.hpp"        // span
+#include "type_traits.hpp" // enable_if_t
+#include "utility.hpp"     // move, forward, pair
+
+#include <algorithm>        // std::lower_bound, std::equal, etc
+#include <cstddef>          // std::size_t, std::ptrdiff_t
+#include <initializer_list> // std::initializer_list
+#include <iterator>         // std::reverse_iterator, std::distance
+#include <vector>           // std::vector
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+
+  //============================================================================
+  // class : flat_set
+  //============================================================================
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief A container adapter that provides the interface of an ordered set
+  ///        on top of a sorted, contiguous sequence container
+  ///
+  /// Unlike std::set, all keys are stored contiguously in a single container,
+  /// which makes lookup and iteration cache-friendly at the cost of O(N)
+  /// single-element insertion and removal. This makes flat_set ideal for
+  /// read-mostly sets that are built in bulk.
+  ///
+  /// Bulk construction from a range appends all entries before sorting them
+  /// once, and the sorted_unique tag may be used to skip sorting entirely.
+  ///
+  /// \tparam Key the key type
+  /// \tparam Compare the comparator used to order the keys
+  /// \tparam KeyContainer the random-access container used to store the keys
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename Key,
+            typename Compare = less<Key>,
+            typename KeyContainer = std::vector<Key>>
+  class flat_set
+  {
+    //--------------------------------------------------------------------------
+    // Public Member Types
+    //--------------------------------------------------------------------------
+  public:
+
+    using key_type        = Key;
+    using value_type      = Key;
+    using key_compare     = Compare;
+    using value_compare   = Compare;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using container_type  = KeyContainer;
+
+    using iterator               = typename container_type::const_iterator;
+    using const_iterator         = typename container_type::const_iterator;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    //--------------------------------------------------------------------------
+    // Constructors / Assignment
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Default constructs an empty flat_set
+    flat_set();
+
+    /// \brief Constructs an empty flat_set that uses the comparator \p comp
+    ///
+    /// \param comp the comparator
+    explicit flat_set(const key_compare& comp);
+
+    /// \brief Constructs a flat_set from the keys in \p cont
+    ///
+    /// The keys are sorted and deduplicated after construction
+    ///
+    /// \param cont the container of keys
+    /// \param comp the comparator
+    explicit flat_set(container_type cont,
+                      const key_compare& comp = key_compare{});
+
+    /// \brief Constructs a flat_set from the sorted, unique keys in \p cont
+    ///
+    /// \pre \p cont is sorted with respect to \p comp and contains no
+    ///      equivalent keys
+    ///
+    /// \param cont the container of keys
+    /// \param comp the comparator
+    flat_set(sorted_unique_t,
+             container_type cont,
+             const key_compare& comp = key_compare{});
+
+    /// \brief Constructs a flat_set from the range [first, last)
+    ///
+    /// \param first the start of the range
+    /// \param last the end of the range
+    /// \param comp the comparator
+    template <typename InputIt>
+    flat_set(InputIt first, InputIt last,
+             const key_compare& comp = key_compare{});
+
+    /// \brief Constructs a flat_set from the sorted, unique range
+    ///        [first, last)
+    ///
+    /// \pre [first, last) is sorted with respect to \p comp and contains no
+    ///      equivalent keys
+    ///
+    /// \param first the start of the range
+    /// \param last the end of the range
+    /// \param comp the comparator
+    template <typename InputIt>
+    flat_set(sorted_unique_t, InputIt first, InputIt last,
+             const key_compare& comp = key_compare{});
+
+    /// \brief Constructs a flat_set by copying the keys viewed by \p keys
+    ///
+    /// \param keys the span of keys
+    /// \param comp the comparator
+    explicit flat_set(span<const value_type> keys,
+                      const key_compare& comp = key_compare{});
+
+    /// \brief Constructs a flat_set by copying the sorted, unique keys viewed
+    ///        by \p keys
+    ///
+    /// \pre \p keys is sorted with respect to \p comp and contains no
+    ///      equivalent keys
+    ///
+    /// \param keys the span of keys
+    /// \param comp the comparator
+    flat_set(sorted_unique_t,
+             span<const value_type> keys,
+             const key_compare& comp = key_compare{});
+
+    /// \brief Constructs a flat_set from an initializer list
+    ///
+    /// \param ilist the initializer list
+    /// \param comp the comparator
+    flat_set(std::initializer_list<value_type> ilist,
+             const key_compare& comp = key_compare{});
+
+    /// \brief Constructs a flat_set from a sorted, unique initializer list
+    ///
+    /// \param ilist the initializer list
+    /// \param comp the comparator
+    flat_set(sorted_unique_t,
+             std::initializer_list<value_type> ilist,
+             const key_compare& comp = key_compare{});
+
+    flat_set(const flat_set& other) = default;
+    flat_set(flat_set&& other) = default;
+
+    //--------------------------------------------------------------------------
+
+    flat_set& operator=(const flat_set& other) = default;
+    flat_set& operator=(flat_set&& other) = default;
+
+    /// \brief Replaces the contents of this flat_set with \p ilist
+    ///
+    /// \param ilist the initializer list
+    /// \return reference to \c (*this)
+    flat_set& operator=(std::initializer_list<value_type> ilist);
+
+    //--------------------------------------------------------------------------
+    // Iterators
+    //--------------------------------------------------------------------------
+  public:
+
+    const_iterator begin() const noexcept;
+    const_iterator cbegin() const noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cend() const noexcept;
+
+    const_reverse_iterator rbegin() const noexcept;
+    const_reverse_iterator crbegin() const noexcept;
+    const_reverse_iterator rend() const noexcept;
+    const_reverse_iterator crend() const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Capacity
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Queries whether this flat_set is empty
+    ///
+    /// \return true if this flat_set contains no keys
+    bool empty() const noexcept;
+
+    /// \brief Gets the number of keys in this flat_set
+    ///
+    /// \return the number of keys
+    size_type size() const noexcept;
+
+    /// \brief Gets the maximum number of keys this flat_set may hold
+    ///
+    /// \return the maximum number of keys
+    size_type max_size() const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Modifiers
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs a key in-place from \p args, and inserts it if no
+    ///        equivalent key exists
+    ///
+    /// \param args the arguments to forward to the key's constructor
+    /// \return a pair of the iterator to the key, and whether it was inserted
+    template <typename...Args>
+    std::pair<iterator,bool> emplace(Args&&...args);
+
+    /// \brief Constructs a key in-place from \p args, using \p hint as a
+    ///        suggestion for where to insert it
+    ///
+    /// \param hint the suggested insertion position
+    /// \param args the arguments to forward to the key's constructor
+    /// \return an iterator to the key
+    template <typename...Args>
+    iterator emplace_hint(const_iterator hint, Args&&...args);
+
+    /// \{
+    /// \brief Inserts \p value if no equivalent key exists
+    ///
+    /// \param value the key to insert
+    /// \return a pair of the iterator to the key, and whether it was inserted
+    std::pair<iterator,bool> insert(const value_type& value);
+    std::pair<iterator,bool> insert(value_type&& value);
+    /// \}
+
+    /// \{
+    /// \brief Inserts \p value if no equivalent key exists, using \p hint as
+    ///        a suggestion for where to insert it
+    ///
+    /// \param hint the suggested insertion position
+    /// \param value the key to insert
+    /// \return an iterator to the key
+    iterator insert(const_iterator hint, const value_type& value);
+    iterator insert(const_iterator hint, value_type&& value);
+    /// \}
+
+    /// \brief Inserts all keys in the range [first, last)
+    ///
+    /// All keys are appended before the result is sorted and merged once,
+    /// making this O(N log N) rather than the O(N^2) of inserting each key
+    /// individually.
+    ///
+    /// \param first the start of the range
+    /// \param last the end of the range
+    template <typename InputIt>
+    void insert(InputIt first, InputIt last);
+
+    /// \brief Inserts all keys in the sorted, unique range [first, last)
+    ///
+    /// \pre [first, last) is sorted with respect to key_comp() and contains
+    ///      no equivalent keys
+    ///
+    /// \param first the start of the range
+    /// \param last the end of the range
+    template <typename InputIt>
+    void insert(sorted_unique_t, InputIt first, InputIt last);
+
+    /// \brief Inserts all keys in \p ilist
+    ///
+    /// \param ilist the initializer list
+    void insert(std::initializer_list<value_type> ilist);
+
+    /// \brief Inserts all keys in the sorted, unique list \p ilist
+    ///
+    /// \param ilist the initializer list
+    void insert(sorted_unique_t, std::initializer_list<value_type> ilist);
+
+    //--------------------------------------------------------------------------
+
+    /// \brief Extracts the underlying container, leaving this flat_set empty
+    ///
+    /// \return the underlying container
+    container_type extract() &&;
+
+    /// \brief Replaces the underlying container with \p cont
+    ///
+    /// \pre \p cont is sorted with respect to key_comp() and contains no
+    ///      equivalent keys
+    ///
+    /// \param cont the new container
+    void replace(container_type&& cont);
+
+    //--------------------------------------------------------------------------
+
+    /// \brief Erases the key at \p pos
+    ///
+    /// \param pos the position of the key to erase
+    /// \return an iterator to the key following the erased one
+    iterator erase(const_iterator pos);
+
+    /// \brief Erases all keys in the range [first, last)
+    ///
+    /// \param first the start of the range
+    /// \param last the end of the range
+    /// \return an iterator to the key following the erased ones
+    iterator erase(const_iterator first, const_iterator last);
+
+    /// \brief Erases the key equivalent to \p key, if it exists
+    ///
+    /// \param key the key to erase
+    /// \return the number of keys erased
+    size_type erase(const key_type& key);
+
+    /// \brief Swaps the contents of this flat_set with \p other
+    ///
+    /// \param other the other flat_set to swap with
+    void swap(flat_set& other) noexcept;
+
+    /// \brief Erases all keys from this flat_set
+    void clear() noexcept;
+
+    //--------------------------------------------------------------------------
+    // Lookup
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \{
+    /// \brief Finds the key equivalent to \p key
+    ///
+    /// The templated overload only participates in overload resolution if
+    /// the comparator is transparent
+    ///
+    /// \param key the key to search for
+    /// \return an iterator to the key, or end() if not found
+    const_iterator find(const key_type& key) const;
+    template <typename K, typename C = Compare,
+              typename = enable_if_t<detail::is_transparent_compare<C>::value>>
+    const_iterator find(const K& key) const;
+    /// \}
+
+    /// \{
+    /// \brief Counts the number of keys equivalent to \p key
+    ///
+    /// \param key the key to search for
+    /// \return 1 if the key exists, 0 otherwise
+    size_type count(const key_type& key) const;
+    template <typename K, typename C = Compare,
+              typename = enable_if_t<detail::is_transparent_compare<C>::value>>
+    size_type count(const K& key) const;
+    /// \}
+
+    /// \{
+    /// \brief Queries whether a key equivalent to \p key exists
+    ///
+    /// \param key the key to search for
+    /// \return true if the key exists
+    bool contains(const key_type& key) const;
+    template <typename K, typename C = Compare,
+              typename = enable_if_t<detail::is_transparent_compare<C>::value>>
+    bool contains(const K& key) const;
+    /// \}
+
+    /// \{
+    /// \brief Gets an iterator to the first key not less than \p key
+    ///
+    /// \param key the key to search for
+    /// \return an iterator to the first key not less than \p key
+    const_iterator lower_bound(const key_type& key) const;
+    template <typename K, typename C = Compare,
+              typename = enable_if_t<detail::is_transparent_compare<C>::value>>
+    const_iterator lower_bound(const K& key) const;
+    /// \}
+
+    /// \{
+    /// \brief Gets an iterator to the first key greater than \p key
+    ///
+    /// \param key the key to search for
+    /// \return an iterator to the first key greater than \p key
+    const_iterator upper_bound(const key_type& key) const;
+    template <typename K, typename C = Compare,
+              typename = enable_if_t<detail::is_transparent_compare<C>::value>>
+    const_iterator upper_bound(const K& key) const;
+    /// \}
+
+    /// \{
+    /// \brief Gets the range of keys equivalent to \p key
+    ///
+    /// \param key the key to search for
+    /// \return the range of equivalent keys
+    std::pair<const_iterator,const_iterator>
+      equal_range(const key_type& key) const;
+    template <typename K, typename C = Compare,
+              typename = enable_if_t<detail::is_transparent_compare<C>::value>>
+    std::pair<const_iterator,const_iterator>
+      equal_range(const K& key) const;
+    /// \}
+
+    //--------------------------------------------------------------------------
+    // Observers
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets the comparator used to order keys
+    ///
+    /// \return the key comparator
+    key_compare key_comp() const;
+
+    /// \brief Gets the comparator used to order values
+    ///
+    /// \return the value comparator
+    value_compare value_comp() const;
+
+    //--------------------------------------------------------------------------
+    // Private Member Functions
+    //--------------------------------------------------------------------------
+  private:
+
+    /// \brief Sorts and deduplicates the keys in [m_keys.begin() + offset,
+    ///        m_keys.end()) into the already sorted prefix
+    ///
+    /// \param offset the size of the sorted and unique prefix
+    void sort_unique_from(size_type offset);
+
+    template <typename U>
+    std::pair<iterator,bool> insert_unique(U&& value);
+
+    template <typename U>
+    iterator insert_unique_hint(const_iterator hint, U&& value);
+
+    //--------------------------------------------------------------------------
+    // Private Members
+    //--------------------------------------------------------------------------
+  private:
+
+    container_type m_keys;
+    key_compare    m_compare;
+  };
+
+  //============================================================================
+  // non-member functions : class : flat_set
+  //============================================================================
+
+  //----------------------------------------------------------------------------
+  // Comparison
+  //----------------------------------------------------------------------------
+
+  template <typename Key, typename Compare, typename KeyContainer>
+  bool operator==(const flat_set<Key,Compare,KeyContainer>& lhs,
+                  const flat_set<Key,Compare,KeyContainer>& rhs);
+  template <typename Key, typename Compare, typename KeyContainer>
+  bool operator!=(const flat_set<Key,Compare,KeyContainer>& lhs,
+                  const flat_set<Key,Compare,KeyContainer>& rhs);
+  template <typename Key, typename Compare, typename KeyContainer>
+  bool operator<(const flat_set<Key,Compare,KeyContainer>& lhs,
+                 const flat_set<Key,Compare,KeyContainer>& rhs);
+  template <typename Key, typename Compare, typename KeyContainer>
+  bool operator>(const flat_set<Key,Compare,KeyContainer>& lhs,
+                 const flat_set<Key,Compare,KeyContainer>& rhs);
+  template <typename Key, typename Compare, typename KeyContainer>
+  bool operator<=(const flat_set<Key,Compare,KeyContainer>& lhs,
+                  const flat_set<Key,Compare,KeyContainer>& rhs);
+  template <typename Key, typename Compare, typename KeyContainer>
+  bool operator>=(const flat_set<Key,Compare,KeyContainer>& lhs,
+                  const flat_set<Key,Compare,KeyContainer>& rhs);
+
+  //----------------------------------------------------------------------------
+  // Utilities
+  //----------------------------------------------------------------------------
+
+  template <typename Key, typename Compare, typename KeyContainer>
+  void swap(flat_set<Key,Compare,KeyContainer>& lhs,
+            flat_set<Key,Compare,KeyContainer>& rhs) noexcept;
+
+} // namespace bpstd
+
+//==============================================================================
+// definitions : class : flat_set
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Constructors / Assignment
+//------------------------------------------------------------------------------
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::flat_set<Key,Compare,KeyContainer>::flat_set()
+  : m_keys{},
+    m_compare{}
+{
+
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::flat_set<Key,Compare,KeyContainer>::flat_set(const key_compare& comp)
+  : m_keys{},
+    m_compare(comp)
+{
+
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline
+bpstd::flat_set<Key,Compare,KeyContainer>::flat_set(container_type cont,
+                                                    const key_compare& comp)
+  : m_keys(bpstd::move(cont)),
+    m_compare(comp)
+{
+  sort_unique_from(0u);
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::flat_set<Key,Compare,KeyContainer>::flat_set(sorted_unique_t,
+                                                    container_type cont,
+                                                    const key_compare& comp)
+  : m_keys(bpstd::move(cont)),
+    m_compare(comp)
+{
+
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+template <typename InputIt>
+inline
+bpstd::flat_set<Key,Compare,KeyContainer>::flat_set(InputIt first,
+                                                    InputIt last,
+                                                    const key_compare& comp)
+  : m_keys(first, last),
+    m_compare(comp)
+{
+  sort_unique_from(0u);
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+template <typename InputIt>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::flat_set<Key,Compare,KeyContainer>::flat_set(sorted_unique_t,
+                                                    InputIt first,
+                                                    InputIt last,
+                                                    const key_compare& comp)
+  : m_keys(first, last),
+    m_compare(comp)
+{
+
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline
+bpstd::flat_set<Key,Compare,KeyContainer>::flat_set(span<const value_type> keys,
+                                                    const key_compare& comp)
+  : m_keys(keys.data(), keys.data() + keys.size()),
+    m_compare(comp)
+{
+  sort_unique_from(0u);
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::flat_set<Key,Compare,KeyContainer>::flat_set(sorted_unique_t,
+                                                    span<const value_type> keys,
+                                                    const key_compare& comp)
+  : m_keys(keys.data(), keys.data() + keys.size()),
+    m_compare(comp)
+{
+
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline
+bpstd::flat_set<Key,Compare,KeyContainer>
+  ::flat_set(std::initializer_list<value_type> ilist, const key_compare& comp)
+  : m_keys(ilist.begin(), ilist.end()),
+    m_compare(comp)
+{
+  sort_unique_from(0u);
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::flat_set<Key,Compare,KeyContainer>
+  ::flat_set(sorted_unique_t,
+             std::initializer_list<value_type> ilist,
+             const key_compare& comp)
+  : m_keys(ilist.begin(), ilist.end()),
+    m_compare(comp)
+{
+
+}
+
+//------------------------------------------------------------------------------
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline
+bpstd::flat_set<Key,Compare,KeyContainer>&
+  bpstd::flat_set<Key,Compare,KeyContainer>
+  ::operator=(std::initializer_list<value_type> ilist)
+{
+  m_keys.assign(ilist.begin(), ilist.end());
+  sort_unique_from(0u);
+
+  return (*this);
+}
+
+//------------------------------------------------------------------------------
+// Iterators
+//------------------------------------------------------------------------------
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_set<Key,Compare,KeyContainer>::const_iterator
+  bpstd::flat_set<Key,Compare,KeyContainer>::begin()
+  const noexcept
+{
+  return m_keys.begin();
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_set<Key,Compare,KeyContainer>::const_iterator
+  bpstd::flat_set<Key,Compare,KeyContainer>::cbegin()
+  const noexcept
+{
+  return m_keys.begin();
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_set<Key,Compare,KeyContainer>::const_iterator
+  bpstd::flat_set<Key,Compare,KeyContainer>::end()
+  const noexcept
+{
+  return m_keys.end();
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_set<Key,Compare,KeyContainer>::const_iterator
+  bpstd::flat_set<Key,Compare,KeyContainer>::cend()
+  const noexcept
+{
+  return m_keys.end();
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_set<Key,Compare,KeyContainer>::const_reverse_iterator
+  bpstd::flat_set<Key,Compare,KeyContainer>::rbegin()
+  const noexcept
+{
+  return const_reverse_iterator{end()};
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_set<Key,Compare,KeyContainer>::const_reverse_iterator
+  bpstd::flat_set<Key,Compare,KeyContainer>::crbegin()
+  const noexcept
+{
+  return const_reverse_iterator{end()};
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_set<Key,Compare,KeyContainer>::const_reverse_iterator
+  bpstd::flat_set<Key,Compare,KeyContainer>::rend()
+  const noexcept
+{
+  return const_reverse_iterator{begin()};
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_set<Key,Compare,KeyContainer>::const_reverse_iterator
+  bpstd::flat_set<Key,Compare,KeyContainer>::crend()
+  const noexcept
+{
+  return const_reverse_iterator{begin()};
+}
+
+//------------------------------------------------------------------------------
+// Capacity
+//------------------------------------------------------------------------------
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::flat_set<Key,Compare,KeyContainer>::empty()
+  const noexcept
+{
+  return m_keys.empty();
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_set<Key,Compare,KeyContainer>::size_type
+  bpstd::flat_set<Key,Compare,KeyContainer>::size()
+  const noexcept
+{
+  return m_keys.size();
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_set<Key,Compare,KeyContainer>::size_type
+  bpstd::flat_set<Key,Compare,KeyContainer>::max_size()
+  const noexcept
+{
+  return m_keys.max_size();
+}
+
+//------------------------------------------------------------------------------
+// Modifiers
+//------------------------------------------------------------------------------
+
+template <typename Key, typename Compare, typename KeyContainer>
+template <typename...Args>
+inline BPSTD_INLINE_VISIBILITY
+std::pair<typename bpstd::flat_set<Key,Compare,KeyContainer>::iterator,bool>
+  bpstd::flat_set<Key,Compare,KeyContainer>::emplace(Args&&...args)
+{
+  return insert_unique(value_type(bpstd::forward<Args>(args)...));
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+template <typename...Args>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_set<Key,Compare,KeyContainer>::iterator
+  bpstd::flat_set<Key,Compare,KeyContainer>::emplace_hint(const_iterator hint,
+                                                          Args&&...args)
+{
+  return insert_unique_hint(hint, value_type(bpstd::forward<Args>(args)...));
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+std::pair<typename bpstd::flat_set<Key,Compare,KeyContainer>::iterator,bool>
+  bpstd::flat_set<Key,Compare,KeyContainer>::insert(const value_type& value)
+{
+  return insert_unique(value);
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+std::pair<typename bpstd::flat_set<Key,Compare,KeyContainer>::iterator,bool>
+  bpstd::flat_set<Key,Compare,KeyContainer>::insert(value_type&& value)
+{
+  return insert_unique(bpstd::move(value));
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_set<Key,Compare,KeyContainer>::iterator
+  bpstd::flat_set<Key,Compare,KeyContainer>::insert(const_iterator hint,
+                                                    const value_type& value)
+{
+  return insert_unique_hint(hint, value);
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_set<Key,Compare,KeyContainer>::iterator
+  bpstd::flat_set<Key,Compare,KeyContainer>::insert(const_iterator hint,
+                                                    value_type&& value)
+{
+  return insert_unique_hint(hint, bpstd::move(value));
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+template <typename InputIt>
+inline
+void bpstd::flat_set<Key,Compare,KeyContainer>::insert(InputIt first,
+                                                       InputIt last)
+{
+  const auto offset = m_keys.size();
+  m_keys.insert(m_keys.end(), first, last);
+  sort_unique_from(offset);
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+template <typename InputIt>
+inline
+void bpstd::flat_set<Key,Compare,KeyContainer>::insert(sorted_unique_t,
+                                                       InputIt first,
+                                                       InputIt last)
+{
+  const auto offset = static_cast<difference_type>(m_keys.size());
+  m_keys.insert(m_keys.end(), first, last);
+
+  // The new range is already sorted, so only a merge is needed
+  const auto begin = m_keys.begin();
+  std::inplace_merge(begin, begin + offset, m_keys.end(), m_compare);
+  m_keys.erase(
+    std::unique(begin, m_keys.end(), detail::sorted_equivalent<Compare>{m_compare}),
+    m_keys.end()
+  );
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::flat_set<Key,Compare,KeyContainer>
+  ::insert(std::initializer_list<value_type> ilist)
+{
+  insert(ilist.begin(), ilist.end());
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::flat_set<Key,Compare,KeyContainer>
+  ::insert(sorted_unique_t, std::initializer_list<value_type> ilist)
+{
+  insert(sorted_unique, ilist.begin(), ilist.end());
+}
+
+//------------------------------------------------------------------------------
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_set<Key,Compare,KeyContainer>::container_type
+  bpstd::flat_set<Key,Compare,KeyContainer>::extract()
+  &&
+{
+  auto result = bpstd::move(m_keys);
+  m_keys.clear();
+  return result;
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::flat_set<Key,Compare,KeyContainer>::replace(container_type&& cont)
+{
+  m_keys = bpstd::move(cont);
+}
+
+//------------------------------------------------------------------------------
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_set<Key,Compare,KeyContainer>::iterator
+  bpstd::flat_set<Key,Compare,KeyContainer>::erase(const_iterator pos)
+{
+  return m_keys.erase(pos);
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_set<Key,Compare,KeyContainer>::iterator
+  bpstd::flat_set<Key,Compare,KeyContainer>::erase(const_iterator first,
+                                                   const_iterator last)
+{
+  return m_keys.erase(first, last);
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_set<Key,Compare,KeyContainer>::size_type
+  bpstd::flat_set<Key,Compare,KeyContainer>::erase(const key_type& key)
+{
+  const auto it = find(key);
+  if (it == end()) {
+    return 0u;
+  }
+  m_keys.erase(it);
+  return 1u;
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::flat_set<Key,Compare,KeyContainer>::swap(flat_set& other)
+  noexcept
+{
+  using std::swap;
+
+  swap(m_keys, other.m_keys);
+  swap(m_compare, other.m_compare);
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::flat_set<Key,Compare,KeyContainer>::clear()
+  noexcept
+{
+  m_keys.clear();
+}
+
+//------------------------------------------------------------------------------
+// Lookup
+//------------------------------------------------------------------------------
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_set<Key,Compare,KeyContainer>::const_iterator
+  bpstd::flat_set<Key,Compare,KeyContainer>::find(const key_type& key)
+  const
+{
+  const auto it = lower_bound(key);
+  if (it == end() || m_compare(key, *it)) {
+    return end();
+  }
+  return it;
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+template <typename K, typename C, typename>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_set<Key,Compare,KeyContainer>::const_iterator
+  bpstd::flat_set<Key,Compare,KeyContainer>::find(const K& key)
+  const
+{
+  const auto it = lower_bound(key);
+  if (it == end() || m_compare(key, *it)) {
+    return end();
+  }
+  return it;
+}
+
+//------------------------------------------------------------------------------
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_set<Key,Compare,KeyContainer>::size_type
+  bpstd::flat_set<Key,Compare,KeyContainer>::count(const key_type& key)
+  const
+{
+  return contains(key) ? 1u : 0u;
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+template <typename K, typename C, typename>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_set<Key,Compare,KeyContainer>::size_type
+  bpstd::flat_set<Key,Compare,KeyContainer>::count(const K& key)
+  const
+{
+  const auto range = equal_range(key);
+  return static_cast<size_type>(range.second - range.first);
+}
+
+//------------------------------------------------------------------------------
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::flat_set<Key,Compare,KeyContainer>::contains(const key_type& key)
+  const
+{
+  return find(key) != end();
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+template <typename K, typename C, typename>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::flat_set<Key,Compare,KeyContainer>::contains(const K& key)
+  const
+{
+  return find(key) != end();
+}
+
+//------------------------------------------------------------------------------
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_set<Key,Compare,KeyContainer>::const_iterator
+  bpstd::flat_set<Key,Compare,KeyContainer>::lower_bound(const key_type& key)
+  const
+{
+  return std::lower_bound(m_keys.begin(), m_keys.end(), key, m_compare);
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+template <typename K, typename C, typename>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_set<Key,Compare,KeyContainer>::const_iterator
+  bpstd::flat_set<Key,Compare,KeyContainer>::lower_bound(const K& key)
+  const
+{
+  return std::lower_bound(m_keys.begin(), m_keys.end(), key, m_compare);
+}
+
+//------------------------------------------------------------------------------
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_set<Key,Compare,KeyContainer>::const_iterator
+  bpstd::flat_set<Key,Compare,KeyContainer>::upper_bound(const key_type& key)
+  const
+{
+  return std::upper_bound(m_keys.begin(), m_keys.end(), key, m_compare);
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+template <typename K, typename C, typename>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_set<Key,Compare,KeyContainer>::const_iterator
+  bpstd::flat_set<Key,Compare,KeyContainer>::upper_bound(const K& key)
+  const
+{
+  return std::upper_bound(m_keys.begin(), m_keys.end(), key, m_compare);
+}
+
+//------------------------------------------------------------------------------
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+std::pair<
+  typename bpstd::flat_set<Key,Compare,KeyContainer>::const_iterator,
+  typename bpstd::flat_set<Key,Compare,KeyContainer>::const_iterator
+> bpstd::flat_set<Key,Compare,KeyContainer>::equal_range(const key_type& key)
+  const
+{
+  const auto it = find(key);
+  if (it == end()) {
+    return {it, it};
+  }
+  return {it, it + 1};
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+template <typename K, typename C, typename>
+inline BPSTD_INLINE_VISIBILITY
+std::pair<
+  typename bpstd::flat_set<Key,Compare,KeyContainer>::const_iterator,
+  typename bpstd::flat_set<Key,Compare,KeyContainer>::const_iterator
+> bpstd::flat_set<Key,Compare,KeyContainer>::equal_range(const K& key)
+  const
+{
+  // A heterogeneous key may be equivalent to more than one stored key
+  return std::equal_range(m_keys.begin(), m_keys.end(), key, m_compare);
+}
+
+//------------------------------------------------------------------------------
+// Observers
+//------------------------------------------------------------------------------
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_set<Key,Compare,KeyContainer>::key_compare
+  bpstd::flat_set<Key,Compare,KeyContainer>::key_comp()
+  const
+{
+  return m_compare;
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_set<Key,Compare,KeyContainer>::value_compare
+  bpstd::flat_set<Key,Compare,KeyContainer>::value_comp()
+  const
+{
+  return m_compare;
+}
+
+//------------------------------------------------------------------------------
+// Private Member Functions
+//------------------------------------------------------------------------------
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline
+void bpstd::flat_set<Key,Compare,KeyContainer>::sort_unique_from(size_type offset)
+{
+  const auto begin = m_keys.begin();
+  const auto new_end = detail::merge_unique(
+    begin,
+    begin + static_cast<difference_type>(offset),
+    m_keys.end(),
+    m_compare
+  );
+  m_keys.erase(new_end, m_keys.end());
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+template <typename U>
+inline BPSTD_INLINE_VISIBILITY
+std::pair<typename bpstd::flat_set<Key,Compare,KeyContainer>::iterator,bool>
+  bpstd::flat_set<Key,Compare,KeyContainer>::insert_unique(U&& value)
+{
+  const auto it = lower_bound(value);
+  if (it != end() && !m_compare(value, *it)) {
+    return {it, false};
+  }
+  return {m_keys.insert(it, bpstd::forward<U>(value)), true};
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+template <typename U>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::flat_set<Key,Compare,KeyContainer>::iterator
+  bpstd::flat_set<Key,Compare,KeyContainer>::insert_unique_hint(const_iterator hint,
+                                                                U&& value)
+{
+  // Only trust the hint if 'value' belongs strictly between its neighbours
+  const auto is_after_prev = (hint == begin()) || m_compare(*(hint - 1), value);
+  const auto is_before_next = (hint == end()) || m_compare(value, *hint);
+
+  if (is_after_prev && is_before_next) {
+    return m_keys.insert(hint, bpstd::forward<U>(value));
+  }
+  return insert_unique(bpstd::forward<U>(value)).first;
+}
+
+//==============================================================================
+// definitions : non-member functions : class : flat_set
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Comparison
+//------------------------------------------------------------------------------
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::operator==(const flat_set<Key,Compare,KeyContainer>& lhs,
+                       const flat_set<Key,Compare,KeyContainer>& rhs)
+{
+  return lhs.size() == rhs.size() &&
+         std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::operator!=(const flat_set<Key,Compare,KeyContainer>& lhs,
+                       const flat_set<Key,Compare,KeyContainer>& rhs)
+{
+  return !(lhs == rhs);
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::operator<(const flat_set<Key,Compare,KeyContainer>& lhs,
+                      const flat_set<Key,Compare,KeyContainer>& rhs)
+{
+  return std::lexicographical_compare(
+    lhs.begin(), lhs.end(),
+    rhs.begin(), rhs.end()
+  );
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::operator>(const flat_set<Key,Compare,KeyContainer>& lhs,
+                      const flat_set<Key,Compare,KeyContainer>& rhs)
+{
+  return rhs < lhs;
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::operator<=(const flat_set<Key,Compare,KeyContainer>& lhs,
+                       const flat_set<Key,Compare,KeyContainer>& rhs)
+{
+  return !(rhs < lhs);
+}
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::operator>=(const flat_set<Key,Compare,KeyContainer>& lhs,
+                       const flat_set<Key,Compare,KeyContainer>& rhs)
+{
+  return !(lhs < rhs);
+}
+
+//------------------------------------------------------------------------------
+// Utilities
+//------------------------------------------------------------------------------
+
+template <typename Key, typename Compare, typename KeyContainer>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::swap(flat_set<Key,Compare,KeyContainer>& lhs,
+                 flat_set<Key,Compare,KeyContainer>& rhs)
+  noexcept
+{
+  lhs.swap(rhs);
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_FLAT_SET_HPP */
@@ -0,0 +1,209 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file hash.hpp
+///
+/// \brief This header provides byte-hashing and hash-combining utilities
+///        that complement std::hash
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_HASH_HPP
+#define BPSTD_HASH_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/config.hpp"
+#include "detail/hash.hpp" // detail::hash_bytes, detail::hash_combine
+
+#include "cstddef.hpp" // byte
+#include "span.hpp"    // span
+#include "utility.hpp" // index_sequence
+
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::uint64_t
+#include <functional> // std::hash
+#include <tuple>      // std::tuple, std::get
+#include <utility>    // std::pair
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+
+  //============================================================================
+  // hashing : bytes
+  //============================================================================
+
+  /// \brief Computes a fast, non-cryptographic 64-bit hash of \p bytes
+  ///
+  /// The result is well-distributed in all 64 bits, but is not stable
+  /// across platforms of differing endianness and must not be persisted.
+  ///
+  /// \param bytes the bytes to hash
+  /// \param seed the seed to start hashing with
+  /// \return the 64-bit hash
+  std::uint64_t hash_bytes(span<const byte> bytes,
+                           std::uint64_t seed = 0u) noexcept;
+
+  //============================================================================
+  // hashing : combining
+  //============================================================================
+
+  /// \brief Combines the already-computed hash \p hash into \p seed
+  ///
+  /// \param seed the hash to combine into
+  /// \param hash the hash to combine
+  void hash_combine(std::size_t& seed, std::size_t hash) noexcept;
+
+  /// \brief Combines the std::hash of \p value into \p seed
+  ///
+  /// \param seed the hash to combine into
+  /// \param value the value to hash
+  template <typename T>
+  void hash_append(std::size_t& seed, const T& value);
+
+  /// \brief Combines the hashes of both members of \p value into \p seed
+  ///
+  /// \param seed the hash to combine into
+  /// \param value the pair to hash
+  template <typename T, typename U>
+  void hash_append(std::size_t& seed, const std::pair<T,U>& value);
+
+  /// \brief Combines the hashes of each element of \p value into \p seed
+  ///
+  /// std::tuple has no std::hash specialization, and one may not be added,
+  /// so tuples are only hashable through this function and hash_value.
+  ///
+  /// \param seed the hash to combine into
+  /// \param value the tuple to hash
+  template <typename...Types>
+  void hash_append(std::size_t& seed, const std::tuple<Types...>& value);
+
+  /// \brief Combines the hashes of each of \p values, in order, into \p seed
+  ///
+  /// \param seed the hash to combine into
+  /// \param v0 the first value to hash
+  /// \param v1 the second value to hash
+  /// \param values the remaining values to hash
+  template <typename T0, typename T1, typename...Types>
+  void hash_append(std::size_t& seed,
+                   const T0& v0,
+                   const T1& v1,
+                   const Types&...values);
+
+  /// \brief Computes the combined hash of each of \p values, in order
+  ///
+  /// \param v0 the first value to hash
+  /// \param values the remaining values to hash
+  /// \return the combined hash
+  template <typename T0, typename...Types>
+  std::size_t hash_value(const T0& v0, const Types&...values);
+
+  namespace detail {
+    template <typename Tuple, std::size_t...Idxs>
+    void hash_append_tuple(std::size_t& seed,
+                           const Tuple& value,
+                           index_sequence<Idxs...>);
+  } // namespace detail
+} // namespace bpstd
+
+//==============================================================================
+// hashing : bytes
+//==============================================================================
+
+inline
+std::uint64_t bpstd::hash_bytes(span<const byte> bytes, std::uint64_t seed)
+  noexcept
+{
+  return detail::hash_bytes(bytes.data(), bytes.size(), seed);
+}
+
+//==============================================================================
+// hashing : combining
+//==============================================================================
+
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::hash_combine(std::size_t& seed, std::size_t hash)
+  noexcept
+{
+  seed = detail::hash_combine(seed, hash);
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::hash_append(std::size_t& seed, const T& value)
+{
+  hash_combine(seed, std::hash<T>{}(value));
+}
+
+template <typename T, typename U>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::hash_append(std::size_t& seed, const std::pair<T,U>& value)
+{
+  hash_append(seed, value.first);
+  hash_append(seed, value.second);
+}
+
+template <typename...Types>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::hash_append(std::size_t& seed, const std::tuple<Types...>& value)
+{
+  detail::hash_append_tuple(seed, value, index_sequence_for<Types...>{});
+}
+
+template <typename T0, typename T1, typename...Types>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::hash_append(std::size_t& seed,
+                        const T0& v0,
+                        const T1& v1,
+                        const Types&...values)
+{
+  hash_append(seed, v0);
+  hash_append(seed, v1, values...);
+}
+
+template <typename T0, typename...Types>
+inline BPSTD_INLINE_VISIBILITY
+std::size_t bpstd::hash_value(const T0& v0, const Types&...values)
+{
+  auto seed = std::size_t{0u};
+  hash_append(seed, v0, values...);
+  return seed;
+}
+
+template <typename Tuple, std::size_t...Idxs>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::detail::hash_append_tuple(std::size_t& seed,
+                                      const Tuple& value,
+                                      index_sequence<Idxs...>)
+{
+  const int expand[] = {0, (hash_append(seed, std::get<Idxs>(value)), 0)...};
+  BPSTD_UNUSED(expand);
+  BPSTD_UNUSED(seed);
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_HASH_HPP */
@@ -0,0 +1,249 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file instrumentation.hpp
+///
+/// \brief This header provides counters for the copies, moves, and other
+///        costly events of the vocabulary types
+////////////////////////////////////////////////////////////////////////////////
+
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_INSTRUMENTATION_HPP
+#define BPSTD_INSTRUMENTATION_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/config.hpp"
+
+#include <atomic>  // std::atomic
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+
+  //============================================================================
+  // enum class : instrumented_type
+  //============================================================================
+
+  /// \brief The types that record instrumentation events
+  enum class instrumented_type : unsigned char
+  {
+    any,
+    optional,
+    variant,
+  };
+
+  //============================================================================
+  // enum class : instrumentation_event
+  //============================================================================
+
+  /// \brief The events recorded by instrumented types
+  enum class instrumentation_event : unsigned char
+  {
+    heap_spill, ///< A value was too large to store inline, and was allocated
+    copy,       ///< A contained value was copied
+    move,       ///< A contained value was moved
+    visit,      ///< A contained value was visited
+    bad_access, ///< An access to a value that isn't contained threw
+    valueless,  ///< An exception left an object without a value
+  };
+
+  //============================================================================
+  // struct : instrumentation_counters
+  //============================================================================
+
+  /// \brief A snapshot of the events recorded for one instrumented type
+  struct instrumentation_counters
+  {
+    std::uint64_t heap_spills;
+    std::uint64_t copies;
+    std::uint64_t moves;
+    std::uint64_t visits;
+    std::uint64_t bad_accesses;
+    std::uint64_t valueless;
+  };
+
+  //============================================================================
+  // class : instrumentation_registry
+  //============================================================================
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The registry of the events recorded by any, optional, and variant
+  ///
+  /// Events are only recorded when BPSTD_ENABLE_INSTRUMENTATION is defined to
+  /// a non-zero value, which must be consistent across every translation unit
+  /// of a program. Otherwise the hooks compile away entirely, and every
+  /// counter reads as zero.
+  ///
+  /// Only copies and moves of a contained value are counted; copying an empty
+  /// optional or a valueless variant is not. Visits are counted once for
+  /// every variant passed to visit.
+  ///
+  /// Counters are updated with relaxed atomics, so they may be read while
+  /// other threads are recording events.
+  //////////////////////////////////////////////////////////////////////////////
+  class instrumentation_registry
+  {
+    //--------------------------------------------------------------------------
+    // Observers
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Queries whether events are being recorded
+    ///
+    /// \return true if BPSTD_ENABLE_INSTRUMENTATION is non-zero
+    static constexpr bool enabled() noexcept;
+
+    /// \brief Gets the events recorded for \p type since the start of the
+    ///        program, or the last call to reset()
+    ///
+    /// \param type the type to get the counters of
+    /// \return the counters
+    static instrumentation_counters counters(instrumented_type type) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Modifiers
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Records an occurrence of \p event for \p type
+    ///
+    /// \param type the type the event occurred in
+    /// \param event the event that occurred
+    static void record(instrumented_type type,
+                       instrumentation_event event) noexcept;
+
+    /// \brief Sets every counter of every type back to zero
+    static void reset() noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Static Member Functions
+    //--------------------------------------------------------------------------
+  private:
+
+    // Enumerators rather than static data members, so that they never need
+    // an out-of-line definition when odr-used
+    enum : std::size_t {
+      type_count = 3u,
+      event_count = 6u,
+    };
+
+    using counter = std::atomic<std::uint64_t>;
+
+    /// \brief Gets the counter for \p event in \p type
+    static counter& counter_for(instrumented_type type,
+                                instrumentation_event event) noexcept;
+  };
+
+} // namespace bpstd
+
+//==============================================================================
+// definitions : class : instrumentation_registry
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Observers
+//------------------------------------------------------------------------------
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::instrumentation_registry::enabled()
+  noexcept
+{
+  return BPSTD_ENABLE_INSTRUMENTATION != 0;
+}
+
+inline
+bpstd::instrumentation_counters
+  bpstd::instrumentation_registry::counters(instrumented_type type)
+  noexcept
+{
+  const auto load = [type](instrumentation_event event) {
+    return counter_for(type, event).load(std::memory_order_relaxed);
+  };
+
+  return {
+    load(instrumentation_event::heap_spill),
+    load(instrumentation_event::copy),
+    load(instrumentation_event::move),
+    load(instrumentation_event::visit),
+    load(instrumentation_event::bad_access),
+    load(instrumentation_event::valueless),
+  };
+}
+
+//------------------------------------------------------------------------------
+// Modifiers
+//------------------------------------------------------------------------------
+
+inline
+void bpstd::instrumentation_registry::record(instrumented_type type,
+                                             instrumentation_event event)
+  noexcept
+{
+  counter_for(type, event).fetch_add(1u, std::memory_order_relaxed);
+}
+
+inline
+void bpstd::instrumentation_registry::reset()
+  noexcept
+{
+  for (auto t = std::size_t{0u}; t < type_count; ++t) {
+    for (auto e = std::size_t{0u}; e < event_count; ++e) {
+      counter_for(
+        static_cast<instrumented_type>(t),
+        static_cast<instrumentation_event>(e)
+      ).store(0u, std::memory_order_relaxed);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Private Static Member Functions
+//------------------------------------------------------------------------------
+
+// Not BPSTD_INLINE_VISIBILITY: the counters must be a single object, even
+// across shared libraries, which hidden visibility would prevent
+inline
+bpstd::instrumentation_registry::counter&
+  bpstd::instrumentation_registry::counter_for(instrumented_type type,
+                                               instrumentation_event event)
+  noexcept
+{
+  // Static storage is zero-initialized before any dynamic initialization, so
+  // this may be recorded into during the static initialization of a program
+  static counter s_counters[type_count * event_count];
+
+  const auto t = static_cast<std::size_t>(type);
+  const auto e = static_cast<std::size_t>(event);
+
+  return s_counters[(t * event_count) + e];
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_INSTRUMENTATION_HPP */
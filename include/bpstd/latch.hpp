@@ -0,0 +1,207 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file latch.hpp
+///
+/// \brief This header provides definitions from the C++ header <latch>
+////////////////////////////////////////////////////////////////////////////////
+
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_LATCH_HPP
+#define BPSTD_LATCH_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/config.hpp"
+#include "detail/atomic_wait.hpp"
+
+#include <atomic>  // std::atomic
+#include <cstddef> // std::ptrdiff_t
+#include <cstdint> // std::int32_t
+#include <limits>  // std::numeric_limits
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+
+  //============================================================================
+  // class : latch
+  //============================================================================
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief A single-use counter that threads can wait on until it reaches
+  ///        zero
+  ///
+  /// Waiting threads spin briefly before parking on the counter itself (a
+  /// futex on Linux), so neither counting down nor waiting takes a lock.
+  /// Counting down only makes a system call when the counter reaches zero
+  /// while threads are parked.
+  //////////////////////////////////////////////////////////////////////////////
+  class latch
+  {
+    //--------------------------------------------------------------------------
+    // Static Member Functions
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets the maximum value of the counter
+    ///
+    /// \return the maximum value
+    static constexpr std::ptrdiff_t max() noexcept;
+
+    //--------------------------------------------------------------------------
+    // Constructors / Destructor / Assignment
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs a latch with its counter set to \p expected
+    ///
+    /// \pre 0 <= expected <= max()
+    /// \param expected the initial value of the counter
+    constexpr explicit latch(std::ptrdiff_t expected) noexcept;
+
+    latch(const latch&) = delete;
+
+    //--------------------------------------------------------------------------
+
+    latch& operator=(const latch&) = delete;
+
+    //--------------------------------------------------------------------------
+    // Modifiers
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Decrements the counter by \p n, unblocking every waiting thread
+    ///        if it reaches zero
+    ///
+    /// \pre 0 <= n <= the value of the counter
+    /// \param n the amount to decrement by
+    void count_down(std::ptrdiff_t n = 1) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Waiting
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Checks whether the counter has reached zero, without blocking
+    ///
+    /// \return true if the counter is zero
+    bool try_wait() const noexcept;
+
+    /// \brief Blocks the calling thread until the counter reaches zero
+    void wait() const noexcept;
+
+    /// \brief Decrements the counter by \p n, and then blocks until it
+    ///        reaches zero
+    ///
+    /// \pre 0 <= n <= the value of the counter
+    /// \param n the amount to decrement by
+    void arrive_and_wait(std::ptrdiff_t n = 1) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Members
+    //--------------------------------------------------------------------------
+  private:
+
+    std::atomic<std::int32_t> m_counter;
+    mutable std::atomic<std::int32_t> m_waiters;
+  };
+
+} // namespace bpstd
+
+//==============================================================================
+// definitions : class : latch
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Static Member Functions
+//------------------------------------------------------------------------------
+
+inline constexpr
+std::ptrdiff_t bpstd::latch::max()
+  noexcept
+{
+  return std::numeric_limits<std::int32_t>::max();
+}
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+inline constexpr
+bpstd::latch::latch(std::ptrdiff_t expected)
+  noexcept
+  : m_counter{static_cast<std::int32_t>(expected)},
+    m_waiters{0}
+{
+
+}
+
+//------------------------------------------------------------------------------
+// Modifiers
+//------------------------------------------------------------------------------
+
+inline void bpstd::latch::count_down(std::ptrdiff_t n)
+  noexcept
+{
+  const auto update = static_cast<std::int32_t>(n);
+
+  // Sequentially consistent, as required by 'notify_waiters'
+  if (m_counter.fetch_sub(update) == update) {
+    detail::notify_waiters(m_counter, m_waiters, true);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Waiting
+//------------------------------------------------------------------------------
+
+inline bool bpstd::latch::try_wait()
+  const noexcept
+{
+  return m_counter.load(std::memory_order_acquire) == 0;
+}
+
+inline void bpstd::latch::wait()
+  const noexcept
+{
+  auto current = m_counter.load(std::memory_order_acquire);
+  while (current != 0) {
+    detail::wait_while_equal(m_counter, current, m_waiters);
+    current = m_counter.load(std::memory_order_acquire);
+  }
+}
+
+inline void bpstd::latch::arrive_and_wait(std::ptrdiff_t n)
+  noexcept
+{
+  count_down(n);
+  wait();
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_LATCH_HPP */
@@ -0,0 +1,648 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file latency_histogram.hpp
+///
+/// \brief This header provides a lock-free histogram of durations, for
+///        computing latency percentiles
+////////////////////////////////////////////////////////////////////////////////
+
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_LATENCY_HISTOGRAM_HPP
+#define BPSTD_LATENCY_HISTOGRAM_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/config.hpp"
+#include "bit.hpp"         // countl_zero
+#include "byte_io.hpp"     // byte_reader, byte_writer, max_varint_size
+#include "chrono.hpp"      // chrono::duration, chrono::nanoseconds
+#include "cstddef.hpp"     // byte
+#include "span.hpp"        // span
+#include "type_traits.hpp" // is_integral
+
+#include <atomic>  // std::atomic
+#include <chrono>  // std::chrono::duration_cast
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t, std::uint64_t
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+  namespace detail {
+
+    /// \brief Gets a small index that is unique to the calling thread, for
+    ///        spreading threads across the shards of a latency_histogram
+    ///
+    /// \return the index of the calling thread
+    std::size_t latency_histogram_thread_index() noexcept;
+
+  } // namespace detail
+
+  //============================================================================
+  // class : latency_histogram
+  //============================================================================
+
+  ////////////////////////////////////////////////////////////////////////////
+  /// \brief A fixed-size, log-linear histogram of durations
+  ///
+  /// Durations are counted in buckets whose width grows with their magnitude,
+  /// in the style of HdrHistogram: each power of two is split into
+  /// 2^(Precision - 1) equal buckets, so that any recorded duration is known
+  /// to within a relative error of 2^-(Precision - 1). Durations below
+  /// 2^Precision ticks are counted exactly. The whole range of a 64-bit count
+  /// of ticks is covered, so recording never overflows a bucket range.
+  ///
+  /// Recording is wait-free: each thread increments a relaxed atomic counter
+  /// in one of \p Shards copies of the buckets, so that threads recording
+  /// concurrently rarely contend over a cache line. Reads sum the shards,
+  /// and may observe recordings that happen concurrently in any order.
+  ///
+  /// All storage is held inline, and nothing allocates; the histogram is
+  /// intended to have static storage duration, or to be owned long-term.
+  ///
+  /// \tparam Duration the duration to count in, which must have an integral
+  ///         representation
+  /// \tparam Precision the number of bits of each duration that are kept
+  /// \tparam Shards the number of copies of the buckets to spread threads
+  ///         across
+  ////////////////////////////////////////////////////////////////////////////
+  template <typename Duration = chrono::nanoseconds,
+            std::size_t Precision = 6u,
+            std::size_t Shards = 8u>
+  class latency_histogram
+  {
+    static_assert(
+      is_integral<typename Duration::rep>::value,
+      "latency_histogram requires a duration with an integral representation"
+    );
+    static_assert(
+      Precision >= 2u && Precision <= 16u,
+      "latency_histogram requires a Precision between 2 and 16 bits"
+    );
+    static_assert(
+      Shards > 0u,
+      "latency_histogram requires at least one shard"
+    );
+
+    //--------------------------------------------------------------------------
+    // Public Member Types
+    //--------------------------------------------------------------------------
+  public:
+
+    using duration  = Duration;
+    using size_type = std::size_t;
+
+    //--------------------------------------------------------------------------
+    // Public Static Members
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief The number of buckets durations are counted in
+    static constexpr size_type bucket_count
+      = (size_type{1u} << Precision)
+      + (64u - Precision) * (size_type{1u} << (Precision - 1u));
+
+    /// \brief The number of shards that threads are spread across
+    static constexpr size_type shard_count = Shards;
+
+    /// \brief The largest number of bytes that serialize() may write
+    static constexpr size_type max_serialized_size
+      = 4u * max_varint_size<std::uint64_t>::value // header: version, precision, period
+      + bucket_count * (
+          max_varint_size<std::uint32_t>::value +
+          max_varint_size<std::uint64_t>::value
+        )
+      + 1u; // terminator
+
+    //--------------------------------------------------------------------------
+    // Constructors / Assignment
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs a histogram with nothing recorded
+    latency_histogram() noexcept;
+    latency_histogram(const latency_histogram&) = delete;
+
+    //--------------------------------------------------------------------------
+
+    latency_histogram& operator=(const latency_histogram&) = delete;
+
+    //--------------------------------------------------------------------------
+    // Recording
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Records a single occurrence of \p d
+    ///
+    /// Negative durations are recorded as zero.
+    ///
+    /// \param d the duration to record
+    template <typename Rep, typename Period>
+    void record(chrono::duration<Rep,Period> d) noexcept;
+
+    /// \brief Records a single occurrence of \p d
+    ///
+    /// This allows the histogram to be the sink of a chrono::scoped_timer.
+    ///
+    /// \param d the duration to record
+    template <typename Rep, typename Period>
+    void operator()(chrono::duration<Rep,Period> d) noexcept;
+
+    /// \brief Discards everything that has been recorded
+    void reset() noexcept;
+
+    //--------------------------------------------------------------------------
+    // Observers
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets the number of durations that have been recorded
+    ///
+    /// \return the number of recorded durations
+    std::uint64_t count() const noexcept;
+
+    /// \brief Gets the duration that \p p percent of the recorded durations
+    ///        are less than or equivalent to
+    ///
+    /// The result is the largest duration equivalent to the one found, so
+    /// that percentiles are never under-reported.
+    ///
+    /// \param p the percentile, which is clamped to [0, 100]
+    /// \return the duration at the percentile, or zero if nothing has been
+    ///         recorded
+    duration percentile(double p) const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Merging
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Adds everything recorded in \p other to this histogram
+    ///
+    /// \param other the histogram to merge
+    void merge(const latency_histogram& other) noexcept;
+
+    /// \brief Adds everything recorded in a histogram serialized by
+    ///        serialize() to this histogram
+    ///
+    /// \param bytes the serialized histogram
+    /// \return true on success, or false if \p bytes is malformed or was
+    ///         serialized by a histogram with a different duration or
+    ///         precision, in which case nothing is merged
+    bool merge(span<const byte> bytes) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Serialization
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Serializes the counts of this histogram into \p buffer
+    ///
+    /// Only the buckets that have been recorded into are written, so the
+    /// result is typically far smaller than max_serialized_size.
+    ///
+    /// \param buffer the buffer to write into
+    /// \return the bytes written, or an empty span if \p buffer is too small
+    span<byte> serialize(span<byte> buffer) const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Member Types
+    //--------------------------------------------------------------------------
+  private:
+
+    using counter = std::atomic<std::uint64_t>;
+
+    struct shard
+    {
+      counter counts[bucket_count];
+    };
+
+    //--------------------------------------------------------------------------
+    // Private Static Members
+    //--------------------------------------------------------------------------
+  private:
+
+    static constexpr std::uint64_t format_version = 1u;
+    static constexpr size_type sub_bucket_count = size_type{1u} << Precision;
+    static constexpr size_type half_count = sub_bucket_count / 2u;
+
+    /// \brief Gets the index of the bucket that \p ticks is counted in
+    static size_type bucket_index(std::uint64_t ticks) noexcept;
+
+    /// \brief Gets the largest number of ticks counted in bucket \p index
+    static std::uint64_t highest_equivalent(size_type index) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Member Functions
+    //--------------------------------------------------------------------------
+  private:
+
+    shard& current_shard() noexcept;
+
+    std::uint64_t bucket_total(size_type index) const noexcept;
+
+    /// \brief Reads a serialized histogram, invoking \p fn with the index
+    ///        and count of every bucket in it
+    ///
+    /// \return false if \p bytes is malformed
+    template <typename Fn>
+    static bool read_serialized(span<const byte> bytes, Fn fn) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Members
+    //--------------------------------------------------------------------------
+  private:
+
+    shard m_shards[Shards];
+  };
+
+} // namespace bpstd
+
+//==============================================================================
+// definitions : detail
+//==============================================================================
+
+// Not BPSTD_INLINE_VISIBILITY: the index must be unique across shared
+// libraries, which hidden visibility would prevent
+inline
+std::size_t bpstd::detail::latency_histogram_thread_index()
+  noexcept
+{
+  static std::atomic<std::size_t> s_next{0u};
+  static thread_local const std::size_t s_index
+    = s_next.fetch_add(1u, std::memory_order_relaxed);
+
+  return s_index;
+}
+
+//==============================================================================
+// definitions : class : latency_histogram
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Public Static Members
+//------------------------------------------------------------------------------
+
+template <typename Duration, std::size_t Precision, std::size_t Shards>
+constexpr typename bpstd::latency_histogram<Duration,Precision,Shards>::size_type
+  bpstd::latency_histogram<Duration,Precision,Shards>::bucket_count;
+
+template <typename Duration, std::size_t Precision, std::size_t Shards>
+constexpr typename bpstd::latency_histogram<Duration,Precision,Shards>::size_type
+  bpstd::latency_histogram<Duration,Precision,Shards>::shard_count;
+
+template <typename Duration, std::size_t Precision, std::size_t Shards>
+constexpr typename bpstd::latency_histogram<Duration,Precision,Shards>::size_type
+  bpstd::latency_histogram<Duration,Precision,Shards>::max_serialized_size;
+
+template <typename Duration, std::size_t Precision, std::size_t Shards>
+constexpr std::uint64_t
+  bpstd::latency_histogram<Duration,Precision,Shards>::format_version;
+
+template <typename Duration, std::size_t Precision, std::size_t Shards>
+constexpr typename bpstd::latency_histogram<Duration,Precision,Shards>::size_type
+  bpstd::latency_histogram<Duration,Precision,Shards>::sub_bucket_count;
+
+template <typename Duration, std::size_t Precision, std::size_t Shards>
+constexpr typename bpstd::latency_histogram<Duration,Precision,Shards>::size_type
+  bpstd::latency_histogram<Duration,Precision,Shards>::half_count;
+
+//------------------------------------------------------------------------------
+// Constructors / Assignment
+//------------------------------------------------------------------------------
+
+template <typename Duration, std::size_t Precision, std::size_t Shards>
+inline
+bpstd::latency_histogram<Duration,Precision,Shards>::latency_histogram()
+  noexcept
+{
+  reset();
+}
+
+//------------------------------------------------------------------------------
+// Recording
+//------------------------------------------------------------------------------
+
+template <typename Duration, std::size_t Precision, std::size_t Shards>
+template <typename Rep, typename Period>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::latency_histogram<Duration,Precision,Shards>
+  ::record(chrono::duration<Rep,Period> d)
+  noexcept
+{
+  const auto ticks = std::chrono::duration_cast<Duration>(d).count();
+  const auto value = (ticks < 0)
+    ? std::uint64_t{0u}
+    : static_cast<std::uint64_t>(ticks);
+
+  current_shard().counts[bucket_index(value)].fetch_add(
+    1u,
+    std::memory_order_relaxed
+  );
+}
+
+template <typename Duration, std::size_t Precision, std::size_t Shards>
+template <typename Rep, typename Period>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::latency_histogram<Duration,Precision,Shards>
+  ::operator()(chrono::duration<Rep,Period> d)
+  noexcept
+{
+  record(d);
+}
+
+template <typename Duration, std::size_t Precision, std::size_t Shards>
+inline
+void bpstd::latency_histogram<Duration,Precision,Shards>::reset()
+  noexcept
+{
+  for (auto& s : m_shards) {
+    for (auto& c : s.counts) {
+      c.store(0u, std::memory_order_relaxed);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Observers
+//------------------------------------------------------------------------------
+
+template <typename Duration, std::size_t Precision, std::size_t Shards>
+inline
+std::uint64_t bpstd::latency_histogram<Duration,Precision,Shards>::count()
+  const noexcept
+{
+  auto total = std::uint64_t{0u};
+  for (const auto& s : m_shards) {
+    for (const auto& c : s.counts) {
+      total += c.load(std::memory_order_relaxed);
+    }
+  }
+  return total;
+}
+
+template <typename Duration, std::size_t Precision, std::size_t Shards>
+inline
+typename bpstd::latency_histogram<Duration,Precision,Shards>::duration
+  bpstd::latency_histogram<Duration,Precision,Shards>::percentile(double p)
+  const noexcept
+{
+  const auto total = count();
+  if (total == 0u) {
+    return duration::zero();
+  }
+
+  const auto clamped = (p < 0.0) ? 0.0 : ((p > 100.0) ? 100.0 : p);
+
+  // The nearest rank of the duration at the percentile, counting from 1
+  const auto exact_rank = (clamped / 100.0) * static_cast<double>(total);
+  auto rank = static_cast<std::uint64_t>(exact_rank);
+  if (static_cast<double>(rank) < exact_rank) {
+    ++rank;
+  }
+  if (rank == 0u) {
+    rank = 1u;
+  } else if (rank > total) {
+    rank = total;
+  }
+
+  // Recordings made while this runs may make the buckets sum past 'total';
+  // the last bucket recorded into is the answer if the rank is never reached
+  auto seen = std::uint64_t{0u};
+  auto last = size_type{0u};
+  for (auto i = size_type{0u}; i < bucket_count; ++i) {
+    const auto n = bucket_total(i);
+    if (n == 0u) {
+      continue;
+    }
+    last = i;
+    seen += n;
+    if (seen >= rank) {
+      break;
+    }
+  }
+
+  using rep = typename duration::rep;
+
+  return duration{static_cast<rep>(highest_equivalent(last))};
+}
+
+//------------------------------------------------------------------------------
+// Merging
+//------------------------------------------------------------------------------
+
+template <typename Duration, std::size_t Precision, std::size_t Shards>
+inline
+void bpstd::latency_histogram<Duration,Precision,Shards>
+  ::merge(const latency_histogram& other)
+  noexcept
+{
+  auto& s = current_shard();
+  for (auto i = size_type{0u}; i < bucket_count; ++i) {
+    const auto n = other.bucket_total(i);
+    if (n != 0u) {
+      s.counts[i].fetch_add(n, std::memory_order_relaxed);
+    }
+  }
+}
+
+template <typename Duration, std::size_t Precision, std::size_t Shards>
+inline
+bool bpstd::latency_histogram<Duration,Precision,Shards>
+  ::merge(span<const byte> bytes)
+  noexcept
+{
+  // Validates everything before merging anything, so that a malformed
+  // histogram is not partially merged
+  const auto validate = [](size_type, std::uint64_t) {};
+  if (!read_serialized(bytes, validate)) {
+    return false;
+  }
+
+  auto& s = current_shard();
+  const auto add = [&s](size_type index, std::uint64_t n) {
+    s.counts[index].fetch_add(n, std::memory_order_relaxed);
+  };
+
+  return read_serialized(bytes, add);
+}
+
+//------------------------------------------------------------------------------
+// Serialization
+//------------------------------------------------------------------------------
+
+template <typename Duration, std::size_t Precision, std::size_t Shards>
+inline
+bpstd::span<bpstd::byte>
+  bpstd::latency_histogram<Duration,Precision,Shards>
+  ::serialize(span<byte> buffer)
+  const noexcept
+{
+  using period = typename Duration::period;
+
+  // The format is a header of varints -- the version, the precision, and the
+  // period of the duration -- followed by a (gap, count) varint pair for
+  // every non-empty bucket, where the gap is the distance from the previous
+  // non-empty bucket. A gap of zero terminates the histogram.
+  auto writer = byte_writer{buffer};
+  auto ok = writer.write_varint(format_version)
+         && writer.write_varint(static_cast<std::uint64_t>(Precision))
+         && writer.write_varint(static_cast<std::uint64_t>(period::num))
+         && writer.write_varint(static_cast<std::uint64_t>(period::den));
+
+  auto previous = size_type{0u};
+  for (auto i = size_type{0u}; ok && i < bucket_count; ++i) {
+    const auto n = bucket_total(i);
+    if (n == 0u) {
+      continue;
+    }
+    // Gaps are counted from one-before-the-first bucket, so they are never 0
+    const auto gap = static_cast<std::uint32_t>(i + 1u - previous);
+    ok = writer.write_varint(gap) && writer.write_varint(n);
+    previous = i + 1u;
+  }
+  ok = ok && writer.write_varint(std::uint32_t{0u});
+
+  if (!ok) {
+    return {};
+  }
+  return writer.written_bytes();
+}
+
+//------------------------------------------------------------------------------
+// Private Static Members
+//------------------------------------------------------------------------------
+
+template <typename Duration, std::size_t Precision, std::size_t Shards>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::latency_histogram<Duration,Precision,Shards>::size_type
+  bpstd::latency_histogram<Duration,Precision,Shards>
+  ::bucket_index(std::uint64_t ticks)
+  noexcept
+{
+  if (ticks < sub_bucket_count) {
+    return static_cast<size_type>(ticks);
+  }
+
+  // Keeps the top 'Precision' bits of the value; the leading bit is implied
+  // by the power of two, so each one is split into 'half_count' buckets
+  const auto msb = static_cast<size_type>(63 - countl_zero(ticks));
+  const auto shift = msb - (Precision - 1u);
+  const auto mantissa = static_cast<size_type>(ticks >> shift);
+
+  return sub_bucket_count + (shift - 1u) * half_count + (mantissa - half_count);
+}
+
+template <typename Duration, std::size_t Precision, std::size_t Shards>
+inline
+std::uint64_t bpstd::latency_histogram<Duration,Precision,Shards>
+  ::highest_equivalent(size_type index)
+  noexcept
+{
+  if (index < sub_bucket_count) {
+    return index;
+  }
+
+  const auto offset = index - sub_bucket_count;
+  const auto shift = offset / half_count + 1u;
+  const auto mantissa = static_cast<std::uint64_t>(offset % half_count + half_count);
+  const auto width = std::uint64_t{1u} << shift;
+
+  return (mantissa << shift) + (width - 1u);
+}
+
+//------------------------------------------------------------------------------
+// Private Member Functions
+//------------------------------------------------------------------------------
+
+template <typename Duration, std::size_t Precision, std::size_t Shards>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::latency_histogram<Duration,Precision,Shards>::shard&
+  bpstd::latency_histogram<Duration,Precision,Shards>::current_shard()
+  noexcept
+{
+  return m_shards[detail::latency_histogram_thread_index() % Shards];
+}
+
+template <typename Duration, std::size_t Precision, std::size_t Shards>
+inline
+std::uint64_t bpstd::latency_histogram<Duration,Precision,Shards>
+  ::bucket_total(size_type index)
+  const noexcept
+{
+  auto total = std::uint64_t{0u};
+  for (const auto& s : m_shards) {
+    total += s.counts[index].load(std::memory_order_relaxed);
+  }
+  return total;
+}
+
+template <typename Duration, std::size_t Precision, std::size_t Shards>
+template <typename Fn>
+inline
+bool bpstd::latency_histogram<Duration,Precision,Shards>
+  ::read_serialized(span<const byte> bytes, Fn fn)
+  noexcept
+{
+  using period = typename Duration::period;
+
+  auto reader = byte_reader{bytes};
+  auto version = std::uint64_t{};
+  auto precision = std::uint64_t{};
+  auto num = std::uint64_t{};
+  auto den = std::uint64_t{};
+  if (!reader.read_varint(version) || version != format_version ||
+      !reader.read_varint(precision) || precision != Precision ||
+      !reader.read_varint(num) || num != static_cast<std::uint64_t>(period::num) ||
+      !reader.read_varint(den) || den != static_cast<std::uint64_t>(period::den)) {
+    return false;
+  }
+
+  auto next = size_type{0u};
+  while (true) {
+    auto gap = std::uint32_t{};
+    if (!reader.read_varint(gap)) {
+      return false;
+    }
+    if (gap == 0u) {
+      return true;
+    }
+    if (gap > bucket_count - next) {
+      return false;
+    }
+    auto n = std::uint64_t{};
+    if (!reader.read_varint(n)) {
+      return false;
+    }
+    next += gap;
+    fn(next - 1u, n);
+  }
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_LATENCY_HISTOGRAM_HPP */
@@ -0,0 +1,2028 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file mdspan.hpp
+///
+/// \brief This header provides definitions from the C++ header <mdspan>
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_MDSPAN_HPP
+#define BPSTD_MDSPAN_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/config.hpp"
+#include "span.hpp"        // dynamic_extent, span, detail::extent_storage
+#include "type_traits.hpp" // enable_if_t, conjunction, is_convertible, ...
+#include "utility.hpp"     // index_sequence, make_index_sequence
+
+#include <array>   // std::array
+#include <cstddef> // std::size_t
+#include <utility> // std::pair
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+
+  template <typename IndexType, std::size_t...Extents>
+  class extents;
+
+  namespace detail {
+
+    //--------------------------------------------------------------------------
+    // Extents
+    //--------------------------------------------------------------------------
+
+    /// \brief A single extent of an 'extents', which stores nothing when the
+    ///        extent is static
+    ///
+    /// The index \p I keeps each element a distinct base of 'extents_storage',
+    /// so that any number of static extents collapse into an empty class.
+    template <std::size_t I, std::size_t Extent>
+    class extent_element : public extent_storage<Extent>
+    {
+    public:
+      constexpr explicit extent_element(std::size_t size) noexcept
+        : extent_storage<Extent>(size)
+      {
+
+      }
+    };
+
+    template <typename Indices, std::size_t...Extents>
+    class extents_storage;
+
+    template <std::size_t...Is, std::size_t...Extents>
+    class extents_storage<index_sequence<Is...>,Extents...>
+      : public extent_element<Is,Extents>...
+    {
+    public:
+      template <typename...Sizes>
+      constexpr explicit extents_storage(Sizes...sizes) noexcept
+        : extent_element<Is,Extents>(sizes)...
+      {
+
+      }
+    };
+
+    /// \brief Gets the static extent at a runtime index \p r
+    template <std::size_t...Extents>
+    struct static_extents;
+
+    template <>
+    struct static_extents<>
+    {
+      static constexpr std::size_t get(std::size_t) noexcept
+      {
+        return 0u;
+      }
+    };
+
+    template <std::size_t Extent, std::size_t...Extents>
+    struct static_extents<Extent,Extents...>
+    {
+      static constexpr std::size_t get(std::size_t r) noexcept
+      {
+        return (r == 0u) ? Extent : static_extents<Extents...>::get(r - 1u);
+      }
+    };
+
+    /// \brief Counts the dynamic extents before the extent at index \p I
+    template <std::size_t I, std::size_t...Extents>
+    struct dynamic_index;
+
+    template <std::size_t I>
+    struct dynamic_index<I> : integral_constant<std::size_t,0u>{};
+
+    template <std::size_t I, std::size_t Extent, std::size_t...Extents>
+    struct dynamic_index<I,Extent,Extents...>
+      : integral_constant<std::size_t,
+          (I == 0u)
+          ? 0u
+          : ((Extent == dynamic_extent) ? 1u : 0u) +
+              dynamic_index<((I == 0u) ? 0u : I - 1u),Extents...>::value
+        >{};
+
+    /// \brief A constexpr-friendly array of indices
+    template <typename T, std::size_t N>
+    struct index_array
+    {
+      T values[(N == 0u) ? 1u : N];
+    };
+
+    /// \brief Gets the value of extent \p I from \p N initializers, which are
+    ///        either every extent or only the dynamic extents
+    template <std::size_t I, std::size_t N, std::size_t...Extents>
+    struct extent_initializer
+    {
+      static constexpr std::size_t extent = static_extents<Extents...>::get(I);
+      static constexpr std::size_t index = (N == sizeof...(Extents))
+        ? I
+        : ((dynamic_index<I,Extents...>::value < N) ? dynamic_index<I,Extents...>::value : 0u);
+
+      template <typename T>
+      static constexpr std::size_t get(const index_array<T,N>& values) noexcept
+      {
+        return (extent != dynamic_extent)
+          ? extent
+          : static_cast<std::size_t>(values.values[index]);
+      }
+    };
+
+    template <typename T, std::size_t N, std::size_t...Is>
+    inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+    index_array<std::size_t,N> to_index_array(const std::array<T,N>& values,
+                                              index_sequence<Is...>)
+      noexcept
+    {
+      return index_array<std::size_t,N>{{static_cast<std::size_t>(values[Is])...}};
+    }
+
+    /// \brief Grants the layouts compile-time access to each extent
+    struct extents_access
+    {
+      template <std::size_t I, typename IndexType, std::size_t...Extents>
+      static constexpr IndexType get(const extents<IndexType,Extents...>& e) noexcept
+      {
+        return static_cast<IndexType>(
+          static_cast<const extent_element<I,static_extents<Extents...>::get(I)>&>(e).size()
+        );
+      }
+    };
+
+    /// \brief Gets the extent at a runtime index \p r by searching from \p I
+    template <std::size_t I, std::size_t Rank>
+    struct extent_lookup
+    {
+      template <typename Extents>
+      static constexpr typename Extents::index_type
+        get(const Extents& e, std::size_t r) noexcept
+      {
+        return (r == I)
+          ? extents_access::get<I>(e)
+          : extent_lookup<I + 1u,Rank>::get(e, r);
+      }
+    };
+
+    template <std::size_t Rank>
+    struct extent_lookup<Rank,Rank>
+    {
+      template <typename Extents>
+      static constexpr typename Extents::index_type
+        get(const Extents&, std::size_t) noexcept
+      {
+        return 0;
+      }
+    };
+
+    /// \brief Computes the product of the extents in [\p first, \p last)
+    template <typename Extents>
+    constexpr typename Extents::index_type
+      extents_product(const Extents& e, std::size_t first, std::size_t last) noexcept;
+
+    template <std::size_t N, typename...Ts>
+    struct are_index_types
+      : bool_constant<
+          (sizeof...(Ts) == N) &&
+          conjunction<is_convertible<Ts,std::size_t>...,true_type>::value
+        >{};
+
+    template <typename Extents, typename Mapping>
+    struct is_mapping_of
+      : is_same<typename Mapping::extents_type,Extents>{};
+
+  } // namespace detail
+
+  //============================================================================
+  // class : extents
+  //============================================================================
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The sizes of each dimension of a multidimensional index space
+  ///
+  /// Each extent is either static, and encoded in the type, or dynamic, and
+  /// stored at runtime. Static extents take no storage, so an 'extents' with
+  /// only static extents is an empty class.
+  ///
+  /// \tparam IndexType the type of each index
+  /// \tparam Extents the static extents, or dynamic_extent for each
+  ///         dynamic extent
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename IndexType, std::size_t...Extents>
+  class extents
+    : private detail::extents_storage<make_index_sequence<sizeof...(Extents)>,Extents...>
+  {
+    static_assert(
+      is_integral<IndexType>::value && !is_same<IndexType,bool>::value,
+      "IndexType must be an integer type"
+    );
+
+    //--------------------------------------------------------------------------
+    // Public Member Types
+    //--------------------------------------------------------------------------
+  public:
+
+    using index_type = IndexType;
+    using size_type  = make_unsigned_t<IndexType>;
+    using rank_type  = std::size_t;
+
+    //--------------------------------------------------------------------------
+    // Observers
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets the number of dimensions
+    static constexpr rank_type rank() noexcept;
+
+    /// \brief Gets the number of dynamic dimensions
+    static constexpr rank_type rank_dynamic() noexcept;
+
+    /// \brief Gets the static extent of dimension \p r
+    ///
+    /// \param r the dimension
+    /// \return the static extent, or dynamic_extent if it is dynamic
+    static constexpr std::size_t static_extent(rank_type r) noexcept;
+
+    /// \brief Gets the extent of dimension \p r
+    ///
+    /// \param r the dimension
+    /// \return the extent
+    constexpr index_type extent(rank_type r) const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Constructors
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs the extents with each dynamic extent as 0
+    constexpr extents() noexcept;
+
+    /// \brief Constructs the extents from either the dynamic extents, or
+    ///        every extent
+    ///
+    /// \pre each static extent given equals the static extent
+    /// \param exts the extents
+    template <typename...OtherIndexTypes,
+              typename = enable_if_t<
+                (sizeof...(OtherIndexTypes) != 0u) &&
+                (detail::are_index_types<sizeof...(Extents),OtherIndexTypes...>::value ||
+                 detail::are_index_types<detail::dynamic_index<sizeof...(Extents),Extents...>::value,OtherIndexTypes...>::value)
+              >>
+    constexpr explicit extents(OtherIndexTypes...exts) noexcept;
+
+    /// \brief Constructs the extents from an array of either the dynamic
+    ///        extents, or every extent
+    ///
+    /// \pre each static extent given equals the static extent
+    /// \param exts the extents
+    template <typename OtherIndexType, std::size_t N,
+              typename = enable_if_t<
+                (N == sizeof...(Extents)) ||
+                (N == detail::dynamic_index<sizeof...(Extents),Extents...>::value)
+              >>
+    BPSTD_CPP14_CONSTEXPR explicit extents(const std::array<OtherIndexType,N>& exts) noexcept;
+
+    /// \brief Constructs the extents from \p other extents of the same rank
+    ///
+    /// \pre each of \p other's extents matches any static extent
+    /// \param other the other extents
+    template <typename OtherIndexType, std::size_t...OtherExtents,
+              typename = enable_if_t<(sizeof...(OtherExtents) == sizeof...(Extents))>>
+    constexpr extents(const extents<OtherIndexType,OtherExtents...>& other) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Constructors
+    //--------------------------------------------------------------------------
+  private:
+
+    template <typename T, std::size_t N, std::size_t...Is>
+    constexpr extents(const detail::index_array<T,N>& exts,
+                      index_sequence<Is...>) noexcept;
+
+    template <typename OtherExtents, std::size_t...Is>
+    constexpr extents(const OtherExtents& other,
+                      index_sequence<Is...>) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Member Types
+    //--------------------------------------------------------------------------
+  private:
+
+    using storage_type = detail::extents_storage<
+      make_index_sequence<sizeof...(Extents)>,
+      Extents...
+    >;
+
+    friend struct detail::extents_access;
+  };
+
+  //============================================================================
+  // non-member functions : class : extents
+  //============================================================================
+
+  //----------------------------------------------------------------------------
+  // Comparison
+  //----------------------------------------------------------------------------
+
+  template <typename IndexType, std::size_t...Extents,
+            typename OtherIndexType, std::size_t...OtherExtents>
+  constexpr bool operator==(const extents<IndexType,Extents...>& lhs,
+                            const extents<OtherIndexType,OtherExtents...>& rhs) noexcept;
+  template <typename IndexType, std::size_t...Extents,
+            typename OtherIndexType, std::size_t...OtherExtents>
+  constexpr bool operator!=(const extents<IndexType,Extents...>& lhs,
+                            const extents<OtherIndexType,OtherExtents...>& rhs) noexcept;
+
+  //============================================================================
+  // alias : dextents
+  //============================================================================
+
+  namespace detail {
+
+    template <typename IndexType, std::size_t Rank, std::size_t...Extents>
+    struct make_dextents
+      : make_dextents<IndexType,Rank - 1u,dynamic_extent,Extents...>{};
+
+    template <typename IndexType, std::size_t...Extents>
+    struct make_dextents<IndexType,0u,Extents...>
+    {
+      using type = extents<IndexType,Extents...>;
+    };
+
+  } // namespace detail
+
+  /// \brief An extents of rank \p Rank where every extent is dynamic
+  template <typename IndexType, std::size_t Rank>
+  using dextents = typename detail::make_dextents<IndexType,Rank>::type;
+
+  //============================================================================
+  // struct : layout_right
+  //============================================================================
+
+  /// \brief A layout where the rightmost index is contiguous in memory, as
+  ///        with C arrays
+  struct layout_right
+  {
+    template <typename Extents>
+    class mapping;
+  };
+
+  //============================================================================
+  // struct : layout_left
+  //============================================================================
+
+  /// \brief A layout where the leftmost index is contiguous in memory, as
+  ///        with Fortran arrays
+  struct layout_left
+  {
+    template <typename Extents>
+    class mapping;
+  };
+
+  //============================================================================
+  // struct : layout_stride
+  //============================================================================
+
+  /// \brief A layout where each index has a user-defined stride
+  struct layout_stride
+  {
+    template <typename Extents>
+    class mapping;
+  };
+
+  //============================================================================
+  // class : layout_right::mapping
+  //============================================================================
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Maps a multidimensional index to an offset in row-major order
+  ///
+  /// \tparam Extents the extents of the index space
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename Extents>
+  class layout_right::mapping : private Extents
+  {
+    //--------------------------------------------------------------------------
+    // Public Member Types
+    //--------------------------------------------------------------------------
+  public:
+
+    using extents_type = Extents;
+    using index_type   = typename extents_type::index_type;
+    using size_type    = typename extents_type::size_type;
+    using rank_type    = typename extents_type::rank_type;
+    using layout_type  = layout_right;
+
+    //--------------------------------------------------------------------------
+    // Constructors
+    //--------------------------------------------------------------------------
+  public:
+
+    constexpr mapping() noexcept = default;
+
+    /// \brief Constructs a mapping over the extents \p e
+    ///
+    /// \param e the extents
+    // cppcheck-suppress noExplicitConstructor
+    constexpr mapping(const extents_type& e) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Observers
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets the extents of this mapping
+    constexpr const extents_type& extents() const noexcept;
+
+    /// \brief Gets the size of the range this mapping indexes into
+    constexpr index_type required_span_size() const noexcept;
+
+    /// \brief Gets the offset of the multidimensional index \p indices
+    ///
+    /// \param indices the index of each dimension
+    /// \return the offset
+    template <typename...Indices,
+              typename = enable_if_t<detail::are_index_types<Extents::rank(),Indices...>::value>>
+    constexpr index_type operator()(Indices...indices) const noexcept;
+
+    /// \brief Gets the distance between consecutive indices of dimension \p r
+    ///
+    /// \param r the dimension
+    /// \return the stride
+    constexpr index_type stride(rank_type r) const noexcept;
+
+    static constexpr bool is_always_unique() noexcept { return true; }
+    static constexpr bool is_always_exhaustive() noexcept { return true; }
+    static constexpr bool is_always_strided() noexcept { return true; }
+
+    static constexpr bool is_unique() noexcept { return true; }
+    static constexpr bool is_exhaustive() noexcept { return true; }
+    static constexpr bool is_strided() noexcept { return true; }
+
+  };
+
+  //============================================================================
+  // class : layout_left::mapping
+  //============================================================================
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Maps a multidimensional index to an offset in column-major order
+  ///
+  /// \tparam Extents the extents of the index space
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename Extents>
+  class layout_left::mapping : private Extents
+  {
+    //--------------------------------------------------------------------------
+    // Public Member Types
+    //--------------------------------------------------------------------------
+  public:
+
+    using extents_type = Extents;
+    using index_type   = typename extents_type::index_type;
+    using size_type    = typename extents_type::size_type;
+    using rank_type    = typename extents_type::rank_type;
+    using layout_type  = layout_left;
+
+    //--------------------------------------------------------------------------
+    // Constructors
+    //--------------------------------------------------------------------------
+  public:
+
+    constexpr mapping() noexcept = default;
+
+    /// \brief Constructs a mapping over the extents \p e
+    ///
+    /// \param e the extents
+    // cppcheck-suppress noExplicitConstructor
+    constexpr mapping(const extents_type& e) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Observers
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets the extents of this mapping
+    constexpr const extents_type& extents() const noexcept;
+
+    /// \brief Gets the size of the range this mapping indexes into
+    constexpr index_type required_span_size() const noexcept;
+
+    /// \brief Gets the offset of the multidimensional index \p indices
+    ///
+    /// \param indices the index of each dimension
+    /// \return the offset
+    template <typename...Indices,
+              typename = enable_if_t<detail::are_index_types<Extents::rank(),Indices...>::value>>
+    constexpr index_type operator()(Indices...indices) const noexcept;
+
+    /// \brief Gets the distance between consecutive indices of dimension \p r
+    ///
+    /// \param r the dimension
+    /// \return the stride
+    constexpr index_type stride(rank_type r) const noexcept;
+
+    static constexpr bool is_always_unique() noexcept { return true; }
+    static constexpr bool is_always_exhaustive() noexcept { return true; }
+    static constexpr bool is_always_strided() noexcept { return true; }
+
+    static constexpr bool is_unique() noexcept { return true; }
+    static constexpr bool is_exhaustive() noexcept { return true; }
+    static constexpr bool is_strided() noexcept { return true; }
+
+  };
+
+  //============================================================================
+  // class : layout_stride::mapping
+  //============================================================================
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Maps a multidimensional index to an offset using a stride for
+  ///        each dimension
+  ///
+  /// \tparam Extents the extents of the index space
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename Extents>
+  class layout_stride::mapping : private Extents
+  {
+    //--------------------------------------------------------------------------
+    // Public Member Types
+    //--------------------------------------------------------------------------
+  public:
+
+    using extents_type = Extents;
+    using index_type   = typename extents_type::index_type;
+    using size_type    = typename extents_type::size_type;
+    using rank_type    = typename extents_type::rank_type;
+    using layout_type  = layout_stride;
+
+    //--------------------------------------------------------------------------
+    // Constructors
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs a mapping with the strides of layout_right
+    constexpr mapping() noexcept;
+
+    /// \brief Constructs a mapping over the extents \p e with the given
+    ///        \p strides
+    ///
+    /// \param e the extents
+    /// \param strides the stride of each dimension
+    template <typename OtherIndexType>
+    BPSTD_CPP14_CONSTEXPR mapping(const extents_type& e,
+                                  const std::array<OtherIndexType,Extents::rank()>& strides) noexcept;
+
+    /// \brief Constructs a mapping with the same strides as \p other
+    ///
+    /// \param other the mapping to copy the strides of
+    template <typename Mapping,
+              typename = enable_if_t<
+                detail::is_mapping_of<Extents,Mapping>::value &&
+                Mapping::is_always_strided()
+              >>
+    // cppcheck-suppress noExplicitConstructor
+    constexpr mapping(const Mapping& other) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Observers
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets the extents of this mapping
+    constexpr const extents_type& extents() const noexcept;
+
+    /// \brief Gets the stride of each dimension
+    BPSTD_CPP14_CONSTEXPR std::array<index_type,Extents::rank()> strides() const noexcept;
+
+    /// \brief Gets the size of the range this mapping indexes into
+    constexpr index_type required_span_size() const noexcept;
+
+    /// \brief Gets the offset of the multidimensional index \p indices
+    ///
+    /// \param indices the index of each dimension
+    /// \return the offset
+    template <typename...Indices,
+              typename = enable_if_t<detail::are_index_types<Extents::rank(),Indices...>::value>>
+    constexpr index_type operator()(Indices...indices) const noexcept;
+
+    /// \brief Gets the distance between consecutive indices of dimension \p r
+    ///
+    /// \param r the dimension
+    /// \return the stride
+    constexpr index_type stride(rank_type r) const noexcept;
+
+    static constexpr bool is_always_unique() noexcept { return true; }
+    static constexpr bool is_always_exhaustive() noexcept { return false; }
+    static constexpr bool is_always_strided() noexcept { return true; }
+
+    static constexpr bool is_unique() noexcept { return true; }
+    constexpr bool is_exhaustive() const noexcept;
+    static constexpr bool is_strided() noexcept { return true; }
+
+    //--------------------------------------------------------------------------
+    // Private Constructors
+    //--------------------------------------------------------------------------
+  private:
+
+    template <typename Mapping, std::size_t...Is>
+    constexpr mapping(const Mapping& other, index_sequence<Is...>) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Members
+    //--------------------------------------------------------------------------
+  private:
+
+    using strides_type = detail::index_array<index_type,Extents::rank()>;
+
+    strides_type m_strides;
+  };
+
+  //============================================================================
+  // non-member functions : class : layout mappings
+  //============================================================================
+
+  template <typename Extents>
+  constexpr bool operator==(const layout_right::mapping<Extents>& lhs,
+                            const layout_right::mapping<Extents>& rhs) noexcept;
+  template <typename Extents>
+  constexpr bool operator!=(const layout_right::mapping<Extents>& lhs,
+                            const layout_right::mapping<Extents>& rhs) noexcept;
+
+  template <typename Extents>
+  constexpr bool operator==(const layout_left::mapping<Extents>& lhs,
+                            const layout_left::mapping<Extents>& rhs) noexcept;
+  template <typename Extents>
+  constexpr bool operator!=(const layout_left::mapping<Extents>& lhs,
+                            const layout_left::mapping<Extents>& rhs) noexcept;
+
+  template <typename Extents>
+  bool operator==(const layout_stride::mapping<Extents>& lhs,
+                  const layout_stride::mapping<Extents>& rhs) noexcept;
+  template <typename Extents>
+  bool operator!=(const layout_stride::mapping<Extents>& lhs,
+                  const layout_stride::mapping<Extents>& rhs) noexcept;
+
+  //============================================================================
+  // struct : default_accessor
+  //============================================================================
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The accessor policy that accesses elements through a plain
+  ///        pointer
+  ///
+  /// \tparam ElementType the type of each element
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename ElementType>
+  struct default_accessor
+  {
+    using offset_policy    = default_accessor;
+    using element_type     = ElementType;
+    using reference        = ElementType&;
+    using data_handle_type = ElementType*;
+
+    constexpr default_accessor() noexcept = default;
+
+    template <typename OtherElementType,
+              typename = enable_if_t<is_convertible<OtherElementType(*)[],ElementType(*)[]>::value>>
+    // cppcheck-suppress noExplicitConstructor
+    constexpr default_accessor(default_accessor<OtherElementType>) noexcept {}
+
+    constexpr reference access(data_handle_type p, std::size_t i) const noexcept
+    {
+      return p[i];
+    }
+
+    constexpr data_handle_type offset(data_handle_type p, std::size_t i) const noexcept
+    {
+      return p + i;
+    }
+  };
+
+  namespace detail {
+
+    /// \brief The storage of an mdspan
+    ///
+    /// The mapping and accessor are stored as bases so that empty ones, such
+    /// as the mapping of a fully static extents, take up no space.
+    template <typename DataHandle, typename Mapping, typename Accessor>
+    struct mdspan_storage : Mapping, Accessor
+    {
+      constexpr mdspan_storage(const DataHandle& p,
+                               const Mapping& m,
+                               const Accessor& a)
+        : Mapping(m),
+          Accessor(a),
+          data_handle(p)
+      {
+
+      }
+
+      DataHandle data_handle;
+    };
+
+  } // namespace detail
+
+  //============================================================================
+  // class : mdspan
+  //============================================================================
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief A non-owning view of a multidimensional array
+  ///
+  /// An mdspan combines a data handle with a layout mapping, which converts a
+  /// multidimensional index into an offset, and an accessor, which converts
+  /// the offset into a reference. With static extents, the mapping takes no
+  /// storage and indexing compiles down to constant strides.
+  ///
+  /// \tparam ElementType the type of each element
+  /// \tparam Extents the extents of the array
+  /// \tparam LayoutPolicy the layout of the array in memory
+  /// \tparam AccessorPolicy the policy for accessing each element
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename ElementType,
+            typename Extents,
+            typename LayoutPolicy = layout_right,
+            typename AccessorPolicy = default_accessor<ElementType>>
+  class mdspan
+  {
+    //--------------------------------------------------------------------------
+    // Public Member Types
+    //--------------------------------------------------------------------------
+  public:
+
+    using extents_type     = Extents;
+    using layout_type      = LayoutPolicy;
+    using accessor_type    = AccessorPolicy;
+    using mapping_type     = typename layout_type::template mapping<extents_type>;
+    using element_type     = ElementType;
+    using value_type       = remove_cv_t<element_type>;
+    using index_type       = typename extents_type::index_type;
+    using size_type        = typename extents_type::size_type;
+    using rank_type        = typename extents_type::rank_type;
+    using data_handle_type = typename accessor_type::data_handle_type;
+    using reference        = typename accessor_type::reference;
+
+    //--------------------------------------------------------------------------
+    // Constructors / Assignment
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs an mdspan with a null data handle
+    constexpr mdspan() noexcept;
+
+    /// \brief Constructs an mdspan over \p p with the extents \p exts
+    ///
+    /// \param p the data handle
+    /// \param exts either the dynamic extents, or every extent
+    template <typename...OtherIndexTypes,
+              typename = enable_if_t<is_constructible<extents_type,OtherIndexTypes...>::value>>
+    constexpr explicit mdspan(data_handle_type p, OtherIndexTypes...exts) noexcept;
+
+    /// \brief Constructs an mdspan over \p p with the extents \p exts
+    ///
+    /// \param p the data handle
+    /// \param exts either the dynamic extents, or every extent
+    template <typename OtherIndexType, std::size_t N,
+              typename = enable_if_t<is_constructible<extents_type,const std::array<OtherIndexType,N>&>::value>>
+    BPSTD_CPP14_CONSTEXPR explicit mdspan(data_handle_type p,
+                                          const std::array<OtherIndexType,N>& exts) noexcept;
+
+    /// \brief Constructs an mdspan over \p p with the extents \p exts
+    ///
+    /// \param p the data handle
+    /// \param exts the extents
+    constexpr mdspan(data_handle_type p, const extents_type& exts) noexcept;
+
+    /// \brief Constructs an mdspan over \p p with the mapping \p m
+    ///
+    /// \param p the data handle
+    /// \param m the layout mapping
+    constexpr mdspan(data_handle_type p, const mapping_type& m) noexcept;
+
+    /// \brief Constructs an mdspan over \p p with the mapping \p m and
+    ///        accessor \p a
+    ///
+    /// \param p the data handle
+    /// \param m the layout mapping
+    /// \param a the accessor
+    constexpr mdspan(data_handle_type p,
+                     const mapping_type& m,
+                     const accessor_type& a) noexcept;
+
+    constexpr mdspan(const mdspan& other) noexcept = default;
+
+    BPSTD_CPP14_CONSTEXPR mdspan& operator=(const mdspan& other) noexcept = default;
+
+    //--------------------------------------------------------------------------
+    // Element Access
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Accesses the element at the multidimensional index \p indices
+    ///
+    /// \pre each index is less than the extent of its dimension
+    /// \param indices the index of each dimension
+    /// \return reference to the element
+    template <typename...OtherIndexTypes,
+              typename = enable_if_t<detail::are_index_types<Extents::rank(),OtherIndexTypes...>::value>>
+    constexpr reference operator()(OtherIndexTypes...indices) const noexcept;
+
+    /// \brief Accesses the element at the multidimensional index \p indices
+    ///
+    /// \pre each index is less than the extent of its dimension
+    /// \param indices the index of each dimension
+    /// \return reference to the element
+    template <typename OtherIndexType>
+    BPSTD_CPP14_CONSTEXPR reference operator[](const std::array<OtherIndexType,Extents::rank()>& indices) const noexcept;
+
+#if defined(__cpp_multidimensional_subscript) && __cpp_multidimensional_subscript >= 202110L
+    template <typename...OtherIndexTypes,
+              typename = enable_if_t<detail::are_index_types<Extents::rank(),OtherIndexTypes...>::value>>
+    constexpr reference operator[](OtherIndexTypes...indices) const noexcept;
+#endif
+
+    //--------------------------------------------------------------------------
+    // Observers
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets the number of dimensions
+    static constexpr rank_type rank() noexcept;
+
+    /// \brief Gets the number of dynamic dimensions
+    static constexpr rank_type rank_dynamic() noexcept;
+
+    /// \brief Gets the static extent of dimension \p r
+    static constexpr std::size_t static_extent(rank_type r) noexcept;
+
+    /// \brief Gets the extent of dimension \p r
+    constexpr index_type extent(rank_type r) const noexcept;
+
+    /// \brief Gets the number of elements in the index space
+    constexpr size_type size() const noexcept;
+
+    /// \brief Checks whether the index space is empty
+    constexpr bool empty() const noexcept;
+
+    /// \brief Gets the extents
+    constexpr const extents_type& extents() const noexcept;
+
+    /// \brief Gets the data handle
+    constexpr const data_handle_type& data_handle() const noexcept;
+
+    /// \brief Gets the layout mapping
+    constexpr const mapping_type& mapping() const noexcept;
+
+    /// \brief Gets the accessor
+    constexpr const accessor_type& accessor() const noexcept;
+
+    /// \brief Gets the distance between consecutive indices of dimension \p r
+    constexpr index_type stride(rank_type r) const noexcept;
+
+    static constexpr bool is_always_unique() noexcept;
+    static constexpr bool is_always_exhaustive() noexcept;
+    static constexpr bool is_always_strided() noexcept;
+
+    constexpr bool is_unique() const noexcept;
+    constexpr bool is_exhaustive() const noexcept;
+    constexpr bool is_strided() const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Members
+    //--------------------------------------------------------------------------
+  private:
+
+    using storage_type = detail::mdspan_storage<
+      data_handle_type,
+      mapping_type,
+      accessor_type
+    >;
+
+    storage_type m_storage;
+  };
+
+  //============================================================================
+  // non-member functions : submdspan
+  //============================================================================
+
+  /// \brief A slice specifier that selects every index of a dimension
+  struct full_extent_t
+  {
+    explicit full_extent_t() = default;
+  };
+
+  BPSTD_CPP17_INLINE constexpr full_extent_t full_extent{};
+
+  namespace detail {
+
+    template <typename Slice, typename IndexType>
+    struct is_index_slice : is_convertible<Slice,IndexType>{};
+
+    /// \brief Computes the extents of a submdspan, by keeping the extent of
+    ///        each dimension that is not sliced by a single index
+    template <typename Result, typename StaticExtents, typename...Slices>
+    struct submdspan_extents;
+
+    template <typename IndexType, std::size_t...Kept>
+    struct submdspan_extents<extents<IndexType,Kept...>,index_sequence<>>
+    {
+      using type = extents<IndexType,Kept...>;
+    };
+
+    template <typename IndexType, std::size_t...Kept,
+              std::size_t Extent, std::size_t...Extents,
+              typename Slice, typename...Slices>
+    struct submdspan_extents<extents<IndexType,Kept...>,index_sequence<Extent,Extents...>,Slice,Slices...>
+      : submdspan_extents<
+          conditional_t<
+            is_index_slice<Slice,IndexType>::value,
+            extents<IndexType,Kept...>,
+            extents<IndexType,Kept...,(is_same<Slice,full_extent_t>::value ? Extent : dynamic_extent)>
+          >,
+          index_sequence<Extents...>,
+          Slices...
+        >{};
+
+    template <typename Extents, typename...Slices>
+    struct submdspan_extents_of;
+
+    template <typename IndexType, std::size_t...Extents, typename...Slices>
+    struct submdspan_extents_of<extents<IndexType,Extents...>,Slices...>
+      : submdspan_extents<extents<IndexType>,index_sequence<Extents...>,Slices...>{};
+
+    template <typename Extents, typename...Slices>
+    using submdspan_extents_t = typename submdspan_extents_of<Extents,Slices...>::type;
+
+  } // namespace detail
+
+  /// \brief Gets a view of a subset of the elements of \p src
+  ///
+  /// Each slice is one of:
+  /// * an index, which removes its dimension from the result
+  /// * full_extent, which keeps the whole dimension
+  /// * a std::pair of indices [first, second), which keeps that range of
+  ///   the dimension
+  ///
+  /// Dimensions kept with full_extent retain their static extent.
+  ///
+  /// \param src the mdspan to view
+  /// \param slices the slice of each dimension
+  /// \return a view of the selected elements, using layout_stride
+  template <typename ElementType, typename Extents, typename LayoutPolicy,
+            typename AccessorPolicy, typename...Slices>
+  mdspan<
+    ElementType,
+    detail::submdspan_extents_t<Extents,Slices...>,
+    layout_stride,
+    typename AccessorPolicy::offset_policy
+  > submdspan(const mdspan<ElementType,Extents,LayoutPolicy,AccessorPolicy>& src,
+              Slices...slices);
+
+} // namespace bpstd
+
+//==============================================================================
+// definitions : detail
+//==============================================================================
+
+template <typename Extents>
+inline constexpr
+typename Extents::index_type
+  bpstd::detail::extents_product(const Extents& e,
+                                 std::size_t first,
+                                 std::size_t last)
+  noexcept
+{
+  return (first >= last)
+    ? static_cast<typename Extents::index_type>(1)
+    : static_cast<typename Extents::index_type>(
+        e.extent(first) * extents_product(e, first + 1u, last)
+      );
+}
+
+namespace bpstd {
+  namespace detail {
+
+    // Each mapping computes the offset with one term per index, using the
+    // extents at compile-time indices so that static extents are constants
+
+    /// \brief Computes a row-major offset by Horner's method
+    template <std::size_t R, typename Extents>
+    inline BPSTD_INLINE_VISIBILITY constexpr
+    typename Extents::index_type
+      offset_right(const Extents&, typename Extents::index_type offset)
+      noexcept
+    {
+      return offset;
+    }
+
+    template <std::size_t R, typename Extents, typename Index, typename...Indices>
+    inline BPSTD_INLINE_VISIBILITY constexpr
+    typename Extents::index_type
+      offset_right(const Extents& e,
+                   typename Extents::index_type offset,
+                   Index index,
+                   Indices...indices)
+      noexcept
+    {
+      return offset_right<R + 1u>(
+        e,
+        static_cast<typename Extents::index_type>(
+          offset * extents_access::get<R>(e) +
+          static_cast<typename Extents::index_type>(index)
+        ),
+        indices...
+      );
+    }
+
+    /// \brief Computes a column-major offset by Horner's method
+    template <std::size_t R, typename Extents>
+    inline BPSTD_INLINE_VISIBILITY constexpr
+    typename Extents::index_type offset_left(const Extents&)
+      noexcept
+    {
+      return 0;
+    }
+
+    template <std::size_t R, typename Extents, typename Index, typename...Indices>
+    inline BPSTD_INLINE_VISIBILITY constexpr
+    typename Extents::index_type
+      offset_left(const Extents& e, Index index, Indices...indices)
+      noexcept
+    {
+      return static_cast<typename Extents::index_type>(
+        static_cast<typename Extents::index_type>(index) +
+        extents_access::get<R>(e) * offset_left<R + 1u>(e, indices...)
+      );
+    }
+
+    /// \brief Computes a strided offset as the sum of each index times its
+    ///        stride
+    template <std::size_t R, typename IndexType, typename Strides>
+    inline BPSTD_INLINE_VISIBILITY constexpr
+    IndexType offset_stride(const Strides&)
+      noexcept
+    {
+      return 0;
+    }
+
+    template <std::size_t R, typename IndexType, typename Strides,
+              typename Index, typename...Indices>
+    inline BPSTD_INLINE_VISIBILITY constexpr
+    IndexType offset_stride(const Strides& strides, Index index, Indices...indices)
+      noexcept
+    {
+      return static_cast<IndexType>(
+        static_cast<IndexType>(index) * strides.values[R] +
+        offset_stride<R + 1u,IndexType>(strides, indices...)
+      );
+    }
+
+    /// \brief Computes the largest offset of a strided mapping plus one,
+    ///        assuming that no extent is zero
+    template <typename Extents, typename Strides>
+    inline constexpr
+    typename Extents::index_type
+      strided_span_size(const Extents& e,
+                        const Strides& strides,
+                        std::size_t r)
+      noexcept
+    {
+      return (r == Extents::rank())
+        ? static_cast<typename Extents::index_type>(1)
+        : static_cast<typename Extents::index_type>(
+            (e.extent(r) - 1) * strides.values[r] +
+            strided_span_size(e, strides, r + 1u)
+          );
+    }
+
+    template <typename Extents>
+    inline constexpr
+    bool has_zero_extent(const Extents& e, std::size_t r)
+      noexcept
+    {
+      return (r != Extents::rank()) &&
+             (e.extent(r) == 0 || has_zero_extent(e, r + 1u));
+    }
+
+    //--------------------------------------------------------------------------
+    // Slices
+    //--------------------------------------------------------------------------
+
+    template <typename IndexType>
+    inline BPSTD_INLINE_VISIBILITY constexpr
+    IndexType slice_first(full_extent_t)
+      noexcept
+    {
+      return 0;
+    }
+
+    template <typename IndexType, typename T, typename U>
+    inline BPSTD_INLINE_VISIBILITY constexpr
+    IndexType slice_first(const std::pair<T,U>& slice)
+      noexcept
+    {
+      return static_cast<IndexType>(slice.first);
+    }
+
+    template <typename IndexType, typename Slice>
+    inline BPSTD_INLINE_VISIBILITY constexpr
+    enable_if_t<is_index_slice<Slice,IndexType>::value,IndexType>
+      slice_first(Slice slice)
+      noexcept
+    {
+      return static_cast<IndexType>(slice);
+    }
+
+    template <typename IndexType>
+    inline BPSTD_INLINE_VISIBILITY constexpr
+    IndexType slice_extent(full_extent_t, IndexType extent)
+      noexcept
+    {
+      return extent;
+    }
+
+    template <typename IndexType, typename T, typename U>
+    inline BPSTD_INLINE_VISIBILITY constexpr
+    IndexType slice_extent(const std::pair<T,U>& slice, IndexType)
+      noexcept
+    {
+      return static_cast<IndexType>(
+        static_cast<IndexType>(slice.second) - static_cast<IndexType>(slice.first)
+      );
+    }
+
+    template <typename IndexType, typename Slice>
+    inline BPSTD_INLINE_VISIBILITY constexpr
+    enable_if_t<is_index_slice<Slice,IndexType>::value,IndexType>
+      slice_extent(Slice, IndexType)
+      noexcept
+    {
+      return 1;
+    }
+
+    template <typename Mapping, typename IndexType, std::size_t N, std::size_t...Is>
+    inline BPSTD_INLINE_VISIBILITY
+    IndexType map_index(const Mapping& m,
+                        const IndexType (&indices)[N],
+                        index_sequence<Is...>)
+      noexcept
+    {
+      return m(indices[Is]...);
+    }
+
+    template <typename ElementType, typename Extents, typename LayoutPolicy,
+              typename AccessorPolicy, std::size_t...Is, typename...Slices>
+    inline
+    mdspan<
+      ElementType,
+      submdspan_extents_t<Extents,Slices...>,
+      layout_stride,
+      typename AccessorPolicy::offset_policy
+    > submdspan_impl(const mdspan<ElementType,Extents,LayoutPolicy,AccessorPolicy>& src,
+                     index_sequence<Is...>,
+                     Slices...slices)
+    {
+      using index_type   = typename Extents::index_type;
+      using sub_extents  = submdspan_extents_t<Extents,Slices...>;
+      using sub_mapping  = layout_stride::mapping<sub_extents>;
+      using sub_accessor = typename AccessorPolicy::offset_policy;
+      using result_type  = mdspan<ElementType,sub_extents,layout_stride,sub_accessor>;
+
+      // Each array holds one extra entry so that rank 0 is not zero-sized
+      const index_type firsts[] = {
+        slice_first<index_type>(slices)..., index_type{0}
+      };
+      const index_type sizes[] = {
+        slice_extent<index_type>(slices, src.extent(Is))..., index_type{0}
+      };
+      const bool dropped[] = {
+        is_index_slice<Slices,index_type>::value..., false
+      };
+
+      auto sub_sizes   = std::array<index_type,sub_extents::rank()>{};
+      auto sub_strides = std::array<index_type,sub_extents::rank()>{};
+      auto k = std::size_t{0u};
+      for (auto r = std::size_t{0u}; r < Extents::rank(); ++r) {
+        if (!dropped[r]) {
+          sub_sizes[k] = sizes[r];
+          sub_strides[k] = src.stride(r);
+          ++k;
+        }
+      }
+
+      const auto offset = map_index(
+        src.mapping(),
+        firsts,
+        index_sequence<Is...>{}
+      );
+
+      return result_type{
+        src.accessor().offset(src.data_handle(), static_cast<std::size_t>(offset)),
+        sub_mapping{sub_extents{sub_sizes}, sub_strides},
+        sub_accessor{src.accessor()}
+      };
+    }
+
+  } // namespace detail
+} // namespace bpstd
+
+//==============================================================================
+// definitions : class : extents
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Observers
+//------------------------------------------------------------------------------
+
+template <typename IndexType, std::size_t...Extents>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::extents<IndexType,Extents...>::rank_type
+  bpstd::extents<IndexType,Extents...>::rank()
+  noexcept
+{
+  return sizeof...(Extents);
+}
+
+template <typename IndexType, std::size_t...Extents>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::extents<IndexType,Extents...>::rank_type
+  bpstd::extents<IndexType,Extents...>::rank_dynamic()
+  noexcept
+{
+  return detail::dynamic_index<sizeof...(Extents),Extents...>::value;
+}
+
+template <typename IndexType, std::size_t...Extents>
+inline BPSTD_INLINE_VISIBILITY constexpr
+std::size_t bpstd::extents<IndexType,Extents...>::static_extent(rank_type r)
+  noexcept
+{
+  return detail::static_extents<Extents...>::get(r);
+}
+
+template <typename IndexType, std::size_t...Extents>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::extents<IndexType,Extents...>::index_type
+  bpstd::extents<IndexType,Extents...>::extent(rank_type r)
+  const noexcept
+{
+  return detail::extent_lookup<0u,sizeof...(Extents)>::get(*this, r);
+}
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+template <typename IndexType, std::size_t...Extents>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::extents<IndexType,Extents...>::extents()
+  noexcept
+  : extents{
+      detail::index_array<std::size_t,detail::dynamic_index<sizeof...(Extents),Extents...>::value>{},
+      make_index_sequence<sizeof...(Extents)>{}
+    }
+{
+
+}
+
+template <typename IndexType, std::size_t...Extents>
+template <typename...OtherIndexTypes, typename>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::extents<IndexType,Extents...>::extents(OtherIndexTypes...exts)
+  noexcept
+  : extents{
+      detail::index_array<std::size_t,sizeof...(OtherIndexTypes)>{{
+        static_cast<std::size_t>(exts)...
+      }},
+      make_index_sequence<sizeof...(Extents)>{}
+    }
+{
+
+}
+
+template <typename IndexType, std::size_t...Extents>
+template <typename OtherIndexType, std::size_t N, typename>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::extents<IndexType,Extents...>::extents(const std::array<OtherIndexType,N>& exts)
+  noexcept
+  : extents{
+      detail::to_index_array(exts, make_index_sequence<N>{}),
+      make_index_sequence<sizeof...(Extents)>{}
+    }
+{
+
+}
+
+
+template <typename IndexType, std::size_t...Extents>
+template <typename OtherIndexType, std::size_t...OtherExtents, typename>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::extents<IndexType,Extents...>::extents(const extents<OtherIndexType,OtherExtents...>& other)
+  noexcept
+  : extents{other, make_index_sequence<sizeof...(Extents)>{}}
+{
+
+}
+
+//------------------------------------------------------------------------------
+// Private Constructors
+//------------------------------------------------------------------------------
+
+template <typename IndexType, std::size_t...Extents>
+template <typename T, std::size_t N, std::size_t...Is>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::extents<IndexType,Extents...>::extents(const detail::index_array<T,N>& exts,
+                                             index_sequence<Is...>)
+  noexcept
+  : storage_type(detail::extent_initializer<Is,N,Extents...>::get(exts)...)
+{
+
+}
+
+template <typename IndexType, std::size_t...Extents>
+template <typename OtherExtents, std::size_t...Is>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::extents<IndexType,Extents...>::extents(const OtherExtents& other,
+                                             index_sequence<Is...>)
+  noexcept
+  : storage_type(static_cast<std::size_t>(other.extent(Is))...)
+{
+
+}
+//==============================================================================
+// definitions : non-member functions : class : extents
+//==============================================================================
+
+namespace bpstd {
+  namespace detail {
+
+    template <typename Extents, typename OtherExtents>
+    inline constexpr
+    bool extents_equal(const Extents& lhs,
+                       const OtherExtents& rhs,
+                       std::size_t r)
+      noexcept
+    {
+      return (r == Extents::rank()) ||
+             (static_cast<std::size_t>(lhs.extent(r)) == static_cast<std::size_t>(rhs.extent(r)) &&
+              extents_equal(lhs, rhs, r + 1u));
+    }
+
+  } // namespace detail
+} // namespace bpstd
+
+//------------------------------------------------------------------------------
+// Comparison
+//------------------------------------------------------------------------------
+
+template <typename IndexType, std::size_t...Extents,
+          typename OtherIndexType, std::size_t...OtherExtents>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::operator==(const extents<IndexType,Extents...>& lhs,
+                       const extents<OtherIndexType,OtherExtents...>& rhs)
+  noexcept
+{
+  return (sizeof...(Extents) == sizeof...(OtherExtents)) &&
+         detail::extents_equal(lhs, rhs, 0u);
+}
+
+template <typename IndexType, std::size_t...Extents,
+          typename OtherIndexType, std::size_t...OtherExtents>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::operator!=(const extents<IndexType,Extents...>& lhs,
+                       const extents<OtherIndexType,OtherExtents...>& rhs)
+  noexcept
+{
+  return !(lhs == rhs);
+}
+
+//==============================================================================
+// definitions : class : layout_right::mapping
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+template <typename Extents>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::layout_right::mapping<Extents>::mapping(const extents_type& e)
+  noexcept
+  : extents_type(e)
+{
+
+}
+
+//------------------------------------------------------------------------------
+// Observers
+//------------------------------------------------------------------------------
+
+template <typename Extents>
+inline BPSTD_INLINE_VISIBILITY constexpr
+const typename bpstd::layout_right::mapping<Extents>::extents_type&
+  bpstd::layout_right::mapping<Extents>::extents()
+  const noexcept
+{
+  return *this;
+}
+
+template <typename Extents>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::layout_right::mapping<Extents>::index_type
+  bpstd::layout_right::mapping<Extents>::required_span_size()
+  const noexcept
+{
+  return detail::extents_product(extents(), 0u, extents_type::rank());
+}
+
+template <typename Extents>
+template <typename...Indices, typename>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::layout_right::mapping<Extents>::index_type
+  bpstd::layout_right::mapping<Extents>::operator()(Indices...indices)
+  const noexcept
+{
+  return detail::offset_right<0u>(extents(), index_type{0}, indices...);
+}
+
+template <typename Extents>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::layout_right::mapping<Extents>::index_type
+  bpstd::layout_right::mapping<Extents>::stride(rank_type r)
+  const noexcept
+{
+  return detail::extents_product(extents(), r + 1u, extents_type::rank());
+}
+
+//==============================================================================
+// definitions : class : layout_left::mapping
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+template <typename Extents>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::layout_left::mapping<Extents>::mapping(const extents_type& e)
+  noexcept
+  : extents_type(e)
+{
+
+}
+
+//------------------------------------------------------------------------------
+// Observers
+//------------------------------------------------------------------------------
+
+template <typename Extents>
+inline BPSTD_INLINE_VISIBILITY constexpr
+const typename bpstd::layout_left::mapping<Extents>::extents_type&
+  bpstd::layout_left::mapping<Extents>::extents()
+  const noexcept
+{
+  return *this;
+}
+
+template <typename Extents>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::layout_left::mapping<Extents>::index_type
+  bpstd::layout_left::mapping<Extents>::required_span_size()
+  const noexcept
+{
+  return detail::extents_product(extents(), 0u, extents_type::rank());
+}
+
+template <typename Extents>
+template <typename...Indices, typename>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::layout_left::mapping<Extents>::index_type
+  bpstd::layout_left::mapping<Extents>::operator()(Indices...indices)
+  const noexcept
+{
+  return detail::offset_left<0u>(extents(), indices...);
+}
+
+template <typename Extents>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::layout_left::mapping<Extents>::index_type
+  bpstd::layout_left::mapping<Extents>::stride(rank_type r)
+  const noexcept
+{
+  return detail::extents_product(extents(), 0u, r);
+}
+
+//==============================================================================
+// definitions : class : layout_stride::mapping
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+template <typename Extents>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::layout_stride::mapping<Extents>::mapping()
+  noexcept
+  : mapping{
+      layout_right::mapping<extents_type>{},
+      make_index_sequence<extents_type::rank()>{}
+    }
+{
+
+}
+
+template <typename Extents>
+template <typename OtherIndexType>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::layout_stride::mapping<Extents>::mapping(const extents_type& e,
+                                               const std::array<OtherIndexType,Extents::rank()>& strides)
+  noexcept
+  : extents_type(e),
+    m_strides{}
+{
+  for (auto r = std::size_t{0u}; r < extents_type::rank(); ++r) {
+    m_strides.values[r] = static_cast<index_type>(strides[r]);
+  }
+}
+
+template <typename Extents>
+template <typename Mapping, typename>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::layout_stride::mapping<Extents>::mapping(const Mapping& other)
+  noexcept
+  : mapping{other, make_index_sequence<extents_type::rank()>{}}
+{
+
+}
+
+//------------------------------------------------------------------------------
+// Observers
+//------------------------------------------------------------------------------
+
+template <typename Extents>
+inline BPSTD_INLINE_VISIBILITY constexpr
+const typename bpstd::layout_stride::mapping<Extents>::extents_type&
+  bpstd::layout_stride::mapping<Extents>::extents()
+  const noexcept
+{
+  return *this;
+}
+
+template <typename Extents>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+std::array<typename bpstd::layout_stride::mapping<Extents>::index_type,Extents::rank()>
+  bpstd::layout_stride::mapping<Extents>::strides()
+  const noexcept
+{
+  auto result = std::array<index_type,Extents::rank()>{};
+  for (auto r = std::size_t{0u}; r < extents_type::rank(); ++r) {
+    result[r] = m_strides.values[r];
+  }
+  return result;
+}
+
+template <typename Extents>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::layout_stride::mapping<Extents>::index_type
+  bpstd::layout_stride::mapping<Extents>::required_span_size()
+  const noexcept
+{
+  return detail::has_zero_extent(extents(), 0u)
+    ? index_type{0}
+    : detail::strided_span_size(extents(), m_strides, 0u);
+}
+
+template <typename Extents>
+template <typename...Indices, typename>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::layout_stride::mapping<Extents>::index_type
+  bpstd::layout_stride::mapping<Extents>::operator()(Indices...indices)
+  const noexcept
+{
+  return detail::offset_stride<0u,index_type>(m_strides, indices...);
+}
+
+template <typename Extents>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::layout_stride::mapping<Extents>::index_type
+  bpstd::layout_stride::mapping<Extents>::stride(rank_type r)
+  const noexcept
+{
+  return m_strides.values[r];
+}
+
+template <typename Extents>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::layout_stride::mapping<Extents>::is_exhaustive()
+  const noexcept
+{
+  return required_span_size() ==
+         detail::extents_product(extents(), 0u, extents_type::rank());
+}
+
+//------------------------------------------------------------------------------
+// Private Constructors
+//------------------------------------------------------------------------------
+
+template <typename Extents>
+template <typename Mapping, std::size_t...Is>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::layout_stride::mapping<Extents>::mapping(const Mapping& other,
+                                               index_sequence<Is...>)
+  noexcept
+  : extents_type(other.extents()),
+    m_strides{{static_cast<index_type>(other.stride(Is))...}}
+{
+
+}
+
+//==============================================================================
+// definitions : non-member functions : class : layout mappings
+//==============================================================================
+
+template <typename Extents>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::operator==(const layout_right::mapping<Extents>& lhs,
+                       const layout_right::mapping<Extents>& rhs)
+  noexcept
+{
+  return lhs.extents() == rhs.extents();
+}
+
+template <typename Extents>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::operator!=(const layout_right::mapping<Extents>& lhs,
+                       const layout_right::mapping<Extents>& rhs)
+  noexcept
+{
+  return !(lhs == rhs);
+}
+
+template <typename Extents>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::operator==(const layout_left::mapping<Extents>& lhs,
+                       const layout_left::mapping<Extents>& rhs)
+  noexcept
+{
+  return lhs.extents() == rhs.extents();
+}
+
+template <typename Extents>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::operator!=(const layout_left::mapping<Extents>& lhs,
+                       const layout_left::mapping<Extents>& rhs)
+  noexcept
+{
+  return !(lhs == rhs);
+}
+
+template <typename Extents>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::operator==(const layout_stride::mapping<Extents>& lhs,
+                       const layout_stride::mapping<Extents>& rhs)
+  noexcept
+{
+  if (lhs.extents() != rhs.extents()) {
+    return false;
+  }
+  for (auto r = std::size_t{0u}; r < Extents::rank(); ++r) {
+    if (lhs.stride(r) != rhs.stride(r)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename Extents>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::operator!=(const layout_stride::mapping<Extents>& lhs,
+                       const layout_stride::mapping<Extents>& rhs)
+  noexcept
+{
+  return !(lhs == rhs);
+}
+
+//==============================================================================
+// definitions : class : mdspan
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Constructors / Assignment
+//------------------------------------------------------------------------------
+
+template <typename T, typename Extents, typename Layout, typename Accessor>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::mdspan<T,Extents,Layout,Accessor>::mdspan()
+  noexcept
+  : m_storage{data_handle_type{}, mapping_type{}, accessor_type{}}
+{
+
+}
+
+template <typename T, typename Extents, typename Layout, typename Accessor>
+template <typename...OtherIndexTypes, typename>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::mdspan<T,Extents,Layout,Accessor>::mdspan(data_handle_type p,
+                                                 OtherIndexTypes...exts)
+  noexcept
+  : m_storage{p, mapping_type{extents_type{exts...}}, accessor_type{}}
+{
+
+}
+
+template <typename T, typename Extents, typename Layout, typename Accessor>
+template <typename OtherIndexType, std::size_t N, typename>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::mdspan<T,Extents,Layout,Accessor>::mdspan(data_handle_type p,
+                                                 const std::array<OtherIndexType,N>& exts)
+  noexcept
+  : m_storage{p, mapping_type{extents_type{exts}}, accessor_type{}}
+{
+
+}
+
+template <typename T, typename Extents, typename Layout, typename Accessor>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::mdspan<T,Extents,Layout,Accessor>::mdspan(data_handle_type p,
+                                                 const extents_type& exts)
+  noexcept
+  : m_storage{p, mapping_type{exts}, accessor_type{}}
+{
+
+}
+
+template <typename T, typename Extents, typename Layout, typename Accessor>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::mdspan<T,Extents,Layout,Accessor>::mdspan(data_handle_type p,
+                                                 const mapping_type& m)
+  noexcept
+  : m_storage{p, m, accessor_type{}}
+{
+
+}
+
+template <typename T, typename Extents, typename Layout, typename Accessor>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::mdspan<T,Extents,Layout,Accessor>::mdspan(data_handle_type p,
+                                                 const mapping_type& m,
+                                                 const accessor_type& a)
+  noexcept
+  : m_storage{p, m, a}
+{
+
+}
+
+//------------------------------------------------------------------------------
+// Element Access
+//------------------------------------------------------------------------------
+
+template <typename T, typename Extents, typename Layout, typename Accessor>
+template <typename...OtherIndexTypes, typename>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::mdspan<T,Extents,Layout,Accessor>::reference
+  bpstd::mdspan<T,Extents,Layout,Accessor>::operator()(OtherIndexTypes...indices)
+  const noexcept
+{
+  return accessor().access(
+    m_storage.data_handle,
+    static_cast<std::size_t>(mapping()(static_cast<index_type>(indices)...))
+  );
+}
+
+template <typename T, typename Extents, typename Layout, typename Accessor>
+template <typename OtherIndexType>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+typename bpstd::mdspan<T,Extents,Layout,Accessor>::reference
+  bpstd::mdspan<T,Extents,Layout,Accessor>::operator[](const std::array<OtherIndexType,Extents::rank()>& indices)
+  const noexcept
+{
+  return accessor().access(
+    m_storage.data_handle,
+    static_cast<std::size_t>(
+      detail::map_index(
+        mapping(),
+        detail::to_index_array(indices, make_index_sequence<Extents::rank()>{}).values,
+        make_index_sequence<Extents::rank()>{}
+      )
+    )
+  );
+}
+
+#if defined(__cpp_multidimensional_subscript) && __cpp_multidimensional_subscript >= 202110L
+template <typename T, typename Extents, typename Layout, typename Accessor>
+template <typename...OtherIndexTypes, typename>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::mdspan<T,Extents,Layout,Accessor>::reference
+  bpstd::mdspan<T,Extents,Layout,Accessor>::operator[](OtherIndexTypes...indices)
+  const noexcept
+{
+  return (*this)(indices...);
+}
+#endif
+
+//------------------------------------------------------------------------------
+// Observers
+//------------------------------------------------------------------------------
+
+template <typename T, typename Extents, typename Layout, typename Accessor>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::mdspan<T,Extents,Layout,Accessor>::rank_type
+  bpstd::mdspan<T,Extents,Layout,Accessor>::rank()
+  noexcept
+{
+  return extents_type::rank();
+}
+
+template <typename T, typename Extents, typename Layout, typename Accessor>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::mdspan<T,Extents,Layout,Accessor>::rank_type
+  bpstd::mdspan<T,Extents,Layout,Accessor>::rank_dynamic()
+  noexcept
+{
+  return extents_type::rank_dynamic();
+}
+
+template <typename T, typename Extents, typename Layout, typename Accessor>
+inline BPSTD_INLINE_VISIBILITY constexpr
+std::size_t bpstd::mdspan<T,Extents,Layout,Accessor>::static_extent(rank_type r)
+  noexcept
+{
+  return extents_type::static_extent(r);
+}
+
+template <typename T, typename Extents, typename Layout, typename Accessor>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::mdspan<T,Extents,Layout,Accessor>::index_type
+  bpstd::mdspan<T,Extents,Layout,Accessor>::extent(rank_type r)
+  const noexcept
+{
+  return extents().extent(r);
+}
+
+template <typename T, typename Extents, typename Layout, typename Accessor>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::mdspan<T,Extents,Layout,Accessor>::size_type
+  bpstd::mdspan<T,Extents,Layout,Accessor>::size()
+  const noexcept
+{
+  return static_cast<size_type>(
+    detail::extents_product(extents(), 0u, extents_type::rank())
+  );
+}
+
+template <typename T, typename Extents, typename Layout, typename Accessor>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::mdspan<T,Extents,Layout,Accessor>::empty()
+  const noexcept
+{
+  return size() == 0u;
+}
+
+template <typename T, typename Extents, typename Layout, typename Accessor>
+inline BPSTD_INLINE_VISIBILITY constexpr
+const typename bpstd::mdspan<T,Extents,Layout,Accessor>::extents_type&
+  bpstd::mdspan<T,Extents,Layout,Accessor>::extents()
+  const noexcept
+{
+  return mapping().extents();
+}
+
+template <typename T, typename Extents, typename Layout, typename Accessor>
+inline BPSTD_INLINE_VISIBILITY constexpr
+const typename bpstd::mdspan<T,Extents,Layout,Accessor>::data_handle_type&
+  bpstd::mdspan<T,Extents,Layout,Accessor>::data_handle()
+  const noexcept
+{
+  return m_storage.data_handle;
+}
+
+template <typename T, typename Extents, typename Layout, typename Accessor>
+inline BPSTD_INLINE_VISIBILITY constexpr
+const typename bpstd::mdspan<T,Extents,Layout,Accessor>::mapping_type&
+  bpstd::mdspan<T,Extents,Layout,Accessor>::mapping()
+  const noexcept
+{
+  return m_storage;
+}
+
+template <typename T, typename Extents, typename Layout, typename Accessor>
+inline BPSTD_INLINE_VISIBILITY constexpr
+const typename bpstd::mdspan<T,Extents,Layout,Accessor>::accessor_type&
+  bpstd::mdspan<T,Extents,Layout,Accessor>::accessor()
+  const noexcept
+{
+  return m_storage;
+}
+
+template <typename T, typename Extents, typename Layout, typename Accessor>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::mdspan<T,Extents,Layout,Accessor>::index_type
+  bpstd::mdspan<T,Extents,Layout,Accessor>::stride(rank_type r)
+  const noexcept
+{
+  return mapping().stride(r);
+}
+
+template <typename T, typename Extents, typename Layout, typename Accessor>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::mdspan<T,Extents,Layout,Accessor>::is_always_unique()
+  noexcept
+{
+  return mapping_type::is_always_unique();
+}
+
+template <typename T, typename Extents, typename Layout, typename Accessor>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::mdspan<T,Extents,Layout,Accessor>::is_always_exhaustive()
+  noexcept
+{
+  return mapping_type::is_always_exhaustive();
+}
+
+template <typename T, typename Extents, typename Layout, typename Accessor>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::mdspan<T,Extents,Layout,Accessor>::is_always_strided()
+  noexcept
+{
+  return mapping_type::is_always_strided();
+}
+
+template <typename T, typename Extents, typename Layout, typename Accessor>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::mdspan<T,Extents,Layout,Accessor>::is_unique()
+  const noexcept
+{
+  return mapping().is_unique();
+}
+
+template <typename T, typename Extents, typename Layout, typename Accessor>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::mdspan<T,Extents,Layout,Accessor>::is_exhaustive()
+  const noexcept
+{
+  return mapping().is_exhaustive();
+}
+
+template <typename T, typename Extents, typename Layout, typename Accessor>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::mdspan<T,Extents,Layout,Accessor>::is_strided()
+  const noexcept
+{
+  return mapping().is_strided();
+}
+
+//==============================================================================
+// definitions : non-member functions : submdspan
+//==============================================================================
+
+template <typename ElementType, typename Extents, typename LayoutPolicy,
+          typename AccessorPolicy, typename...Slices>
+inline
+bpstd::mdspan<
+  ElementType,
+  bpstd::detail::submdspan_extents_t<Extents,Slices...>,
+  bpstd::layout_stride,
+  typename AccessorPolicy::offset_policy
+> bpstd::submdspan(const mdspan<ElementType,Extents,LayoutPolicy,AccessorPolicy>& src,
+                   Slices...slices)
+{
+  static_assert(
+    sizeof...(Slices) == Extents::rank(),
+    "submdspan requires one slice for each dimension"
+  );
+
+  return detail::submdspan_impl(
+    src,
+    make_index_sequence<Extents::rank()>{},
+    slices...
+  );
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_MDSPAN_HPP */
@@ -0,0 +1,833 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file numeric.hpp
+///
+/// \brief This header provides definitions from the C++ header <numeric>
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_NUMERIC_HPP
+#define BPSTD_NUMERIC_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/config.hpp"
+#include "detail/parallel.hpp"
+
+#include "execution.hpp"   // execution::seq, execution::par, etc
+#include "functional.hpp"  // plus, multiplies
+#include "optional.hpp"    // optional
+#include "type_traits.hpp" // true_type, false_type
+
+#include <cstddef>  // std::size_t
+#include <iterator> // std::iterator_traits
+#include <utility>  // std::move
+#include <vector>   // std::vector
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+
+  //============================================================================
+  // algorithms : reduce
+  //============================================================================
+
+  /// \{
+  /// \brief Reduces the range [first, last), along with \p init, using
+  ///        \p op
+  ///
+  /// Unlike std::accumulate, the elements may be grouped and reordered
+  /// arbitrarily, so \p op should be associative and commutative.
+  ///
+  /// \param first the start of the range
+  /// \param last the end of the range
+  /// \param init the initial value of the reduction
+  /// \param op the binary operation to reduce with
+  /// \return the reduction
+  template <typename InputIt>
+  typename std::iterator_traits<InputIt>::value_type
+    reduce(InputIt first, InputIt last);
+  template <typename InputIt, typename T>
+  T reduce(InputIt first, InputIt last, T init);
+  template <typename InputIt, typename T, typename BinaryOp>
+  T reduce(InputIt first, InputIt last, T init, BinaryOp op);
+  /// \}
+
+  /// \{
+  /// \brief Reduces the range [first, last), along with \p init, using
+  ///        \p op under the execution \p policy
+  ///
+  /// \param policy the execution policy to use
+  /// \param first the start of the range
+  /// \param last the end of the range
+  /// \param init the initial value of the reduction
+  /// \param op the binary operation to reduce with
+  /// \return the reduction
+  template <typename ExecutionPolicy, typename ForwardIt,
+            typename = detail::enable_if_execution_policy_t<ExecutionPolicy>>
+  typename std::iterator_traits<ForwardIt>::value_type
+    reduce(ExecutionPolicy&& policy, ForwardIt first, ForwardIt last);
+  template <typename ExecutionPolicy, typename ForwardIt, typename T,
+            typename = detail::enable_if_execution_policy_t<ExecutionPolicy>>
+  T reduce(ExecutionPolicy&& policy, ForwardIt first, ForwardIt last, T init);
+  template <typename ExecutionPolicy, typename ForwardIt, typename T,
+            typename BinaryOp,
+            typename = detail::enable_if_execution_policy_t<ExecutionPolicy>>
+  T reduce(ExecutionPolicy&& policy,
+           ForwardIt first, ForwardIt last,
+           T init,
+           BinaryOp op);
+  /// \}
+
+  //============================================================================
+  // algorithms : transform_reduce
+  //============================================================================
+
+  /// \{
+  /// \brief Reduces the result of \p transform applied to each pair of
+  ///        elements from [first1, last1) and [first2, ...), along with
+  ///        \p init, using \p reduce
+  ///
+  /// By default, this computes the inner product of the two ranges.
+  ///
+  /// \param first1 the start of the first range
+  /// \param last1 the end of the first range
+  /// \param first2 the start of the second range
+  /// \param init the initial value of the reduction
+  /// \param reduce the binary operation to reduce with
+  /// \param transform the binary operation applied to each pair
+  /// \return the reduction
+  template <typename InputIt1, typename InputIt2, typename T>
+  T transform_reduce(InputIt1 first1, InputIt1 last1,
+                     InputIt2 first2,
+                     T init);
+  template <typename InputIt1, typename InputIt2, typename T,
+            typename BinaryReductionOp, typename BinaryTransformOp>
+  T transform_reduce(InputIt1 first1, InputIt1 last1,
+                     InputIt2 first2,
+                     T init,
+                     BinaryReductionOp reduce,
+                     BinaryTransformOp transform);
+  /// \}
+
+  /// \brief Reduces the result of \p transform applied to each element of
+  ///        [first, last), along with \p init, using \p reduce
+  ///
+  /// \param first the start of the range
+  /// \param last the end of the range
+  /// \param init the initial value of the reduction
+  /// \param reduce the binary operation to reduce with
+  /// \param transform the unary operation applied to each element
+  /// \return the reduction
+  template <typename InputIt, typename T,
+            typename BinaryReductionOp, typename UnaryTransformOp>
+  T transform_reduce(InputIt first, InputIt last,
+                     T init,
+                     BinaryReductionOp reduce,
+                     UnaryTransformOp transform);
+
+  /// \{
+  /// \brief Reduces the result of \p transform applied to each pair of
+  ///        elements from [first1, last1) and [first2, ...), along with
+  ///        \p init, using \p reduce under the execution \p policy
+  ///
+  /// \param policy the execution policy to use
+  /// \param first1 the start of the first range
+  /// \param last1 the end of the first range
+  /// \param first2 the start of the second range
+  /// \param init the initial value of the reduction
+  /// \param reduce the binary operation to reduce with
+  /// \param transform the binary operation applied to each pair
+  /// \return the reduction
+  template <typename ExecutionPolicy, typename ForwardIt1, typename ForwardIt2,
+            typename T,
+            typename = detail::enable_if_execution_policy_t<ExecutionPolicy>>
+  T transform_reduce(ExecutionPolicy&& policy,
+                     ForwardIt1 first1, ForwardIt1 last1,
+                     ForwardIt2 first2,
+                     T init);
+  template <typename ExecutionPolicy, typename ForwardIt1, typename ForwardIt2,
+            typename T, typename BinaryReductionOp, typename BinaryTransformOp,
+            typename = detail::enable_if_execution_policy_t<ExecutionPolicy>>
+  T transform_reduce(ExecutionPolicy&& policy,
+                     ForwardIt1 first1, ForwardIt1 last1,
+                     ForwardIt2 first2,
+                     T init,
+                     BinaryReductionOp reduce,
+                     BinaryTransformOp transform);
+  /// \}
+
+  /// \brief Reduces the result of \p transform applied to each element of
+  ///        [first, last), along with \p init, using \p reduce under the
+  ///        execution \p policy
+  ///
+  /// \param policy the execution policy to use
+  /// \param first the start of the range
+  /// \param last the end of the range
+  /// \param init the initial value of the reduction
+  /// \param reduce the binary operation to reduce with
+  /// \param transform the unary operation applied to each element
+  /// \return the reduction
+  template <typename ExecutionPolicy, typename ForwardIt, typename T,
+            typename BinaryReductionOp, typename UnaryTransformOp,
+            typename = detail::enable_if_execution_policy_t<ExecutionPolicy>>
+  T transform_reduce(ExecutionPolicy&& policy,
+                     ForwardIt first, ForwardIt last,
+                     T init,
+                     BinaryReductionOp reduce,
+                     UnaryTransformOp transform);
+
+  //============================================================================
+  // algorithms : inclusive_scan
+  //============================================================================
+
+  /// \{
+  /// \brief Computes the inclusive prefix reduction of [first, last) using
+  ///        \p op, optionally starting from \p init, and writes each result
+  ///        to the range starting at \p d_first
+  ///
+  /// \param first the start of the range
+  /// \param last the end of the range
+  /// \param d_first the start of the destination range
+  /// \param op the binary operation to reduce with
+  /// \param init the initial value of the reduction
+  /// \return an iterator past the last element written
+  template <typename InputIt, typename OutputIt>
+  OutputIt inclusive_scan(InputIt first, InputIt last, OutputIt d_first);
+  template <typename InputIt, typename OutputIt, typename BinaryOp>
+  OutputIt inclusive_scan(InputIt first, InputIt last,
+                          OutputIt d_first,
+                          BinaryOp op);
+  template <typename InputIt, typename OutputIt, typename BinaryOp, typename T>
+  OutputIt inclusive_scan(InputIt first, InputIt last,
+                          OutputIt d_first,
+                          BinaryOp op,
+                          T init);
+  /// \}
+
+  /// \{
+  /// \brief Computes the inclusive prefix reduction of [first, last) using
+  ///        \p op under the execution \p policy
+  ///
+  /// The parallel scan takes two passes over the input: the first reduces
+  /// each chunk concurrently, and the second scans each chunk concurrently
+  /// starting from the reduction of all preceding chunks.
+  ///
+  /// \param policy the execution policy to use
+  /// \param first the start of the range
+  /// \param last the end of the range
+  /// \param d_first the start of the destination range
+  /// \param op the binary operation to reduce with
+  /// \param init the initial value of the reduction
+  /// \return an iterator past the last element written
+  template <typename ExecutionPolicy, typename ForwardIt1, typename ForwardIt2,
+            typename = detail::enable_if_execution_policy_t<ExecutionPolicy>>
+  ForwardIt2 inclusive_scan(ExecutionPolicy&& policy,
+                            ForwardIt1 first, ForwardIt1 last,
+                            ForwardIt2 d_first);
+  template <typename ExecutionPolicy, typename ForwardIt1, typename ForwardIt2,
+            typename BinaryOp,
+            typename = detail::enable_if_execution_policy_t<ExecutionPolicy>>
+  ForwardIt2 inclusive_scan(ExecutionPolicy&& policy,
+                            ForwardIt1 first, ForwardIt1 last,
+                            ForwardIt2 d_first,
+                            BinaryOp op);
+  template <typename ExecutionPolicy, typename ForwardIt1, typename ForwardIt2,
+            typename BinaryOp, typename T,
+            typename = detail::enable_if_execution_policy_t<ExecutionPolicy>>
+  ForwardIt2 inclusive_scan(ExecutionPolicy&& policy,
+                            ForwardIt1 first, ForwardIt1 last,
+                            ForwardIt2 d_first,
+                            BinaryOp op,
+                            T init);
+  /// \}
+
+  namespace detail {
+
+    /// \brief A transformation that forwards each element unchanged, so
+    ///        that reduce may be expressed as a transform_reduce
+    struct reduce_identity
+    {
+      template <typename T>
+      constexpr T&& operator()(T&& value) const noexcept
+      {
+        return static_cast<T&&>(value);
+      }
+    };
+
+    template <typename ForwardIt, typename T, typename BinaryReductionOp,
+              typename UnaryTransformOp>
+    T transform_reduce(false_type,
+                       ForwardIt first, ForwardIt last,
+                       T init,
+                       BinaryReductionOp& reduce,
+                       UnaryTransformOp& transform);
+    template <typename RandomIt, typename T, typename BinaryReductionOp,
+              typename UnaryTransformOp>
+    T transform_reduce(true_type,
+                       RandomIt first, RandomIt last,
+                       T init,
+                       BinaryReductionOp& reduce,
+                       UnaryTransformOp& transform);
+
+    template <typename ForwardIt1, typename ForwardIt2, typename T,
+              typename BinaryReductionOp, typename BinaryTransformOp>
+    T transform_reduce(false_type,
+                       ForwardIt1 first1, ForwardIt1 last1,
+                       ForwardIt2 first2,
+                       T init,
+                       BinaryReductionOp& reduce,
+                       BinaryTransformOp& transform);
+    template <typename RandomIt1, typename RandomIt2, typename T,
+              typename BinaryReductionOp, typename BinaryTransformOp>
+    T transform_reduce(true_type,
+                       RandomIt1 first1, RandomIt1 last1,
+                       RandomIt2 first2,
+                       T init,
+                       BinaryReductionOp& reduce,
+                       BinaryTransformOp& transform);
+
+    template <typename ForwardIt1, typename ForwardIt2, typename BinaryOp,
+              typename T>
+    ForwardIt2 inclusive_scan(false_type,
+                              ForwardIt1 first, ForwardIt1 last,
+                              ForwardIt2 d_first,
+                              BinaryOp& op,
+                              T init);
+    template <typename RandomIt1, typename RandomIt2, typename BinaryOp,
+              typename T>
+    RandomIt2 inclusive_scan(true_type,
+                             RandomIt1 first, RandomIt1 last,
+                             RandomIt2 d_first,
+                             BinaryOp& op,
+                             T init);
+
+    /// \brief Reduces each of \p chunks chunks of [0, size) concurrently
+    ///        with \p reduce_chunk, and then reduces the partial results
+    ///        into \p init with \p reduce in order
+    ///
+    /// \param size the number of elements
+    /// \param chunks the number of chunks, each of at least 2 elements
+    /// \param init the initial value of the reduction
+    /// \param reduce the binary operation to reduce partial results with
+    /// \param reduce_chunk the function that reduces the elements in
+    ///        [first_index, last_index) to a T
+    /// \return the reduction
+    template <typename T, typename BinaryReductionOp, typename ChunkFn>
+    T parallel_reduce(std::size_t size,
+                      std::size_t chunks,
+                      T init,
+                      BinaryReductionOp& reduce,
+                      ChunkFn& reduce_chunk);
+
+  } // namespace detail
+} // namespace bpstd
+
+//==============================================================================
+// definitions : algorithms : reduce
+//==============================================================================
+
+template <typename InputIt>
+inline typename std::iterator_traits<InputIt>::value_type
+  bpstd::reduce(InputIt first, InputIt last)
+{
+  using value_type = typename std::iterator_traits<InputIt>::value_type;
+
+  return bpstd::reduce(first, last, value_type{}, plus<>{});
+}
+
+template <typename InputIt, typename T>
+inline T bpstd::reduce(InputIt first, InputIt last, T init)
+{
+  return bpstd::reduce(first, last, std::move(init), plus<>{});
+}
+
+template <typename InputIt, typename T, typename BinaryOp>
+inline T bpstd::reduce(InputIt first, InputIt last, T init, BinaryOp op)
+{
+  for (; first != last; ++first) {
+    init = op(std::move(init), *first);
+  }
+  return init;
+}
+
+//------------------------------------------------------------------------------
+
+template <typename ExecutionPolicy, typename ForwardIt, typename>
+inline typename std::iterator_traits<ForwardIt>::value_type
+  bpstd::reduce(ExecutionPolicy&& policy, ForwardIt first, ForwardIt last)
+{
+  using value_type = typename std::iterator_traits<ForwardIt>::value_type;
+
+  return bpstd::reduce(
+    static_cast<ExecutionPolicy&&>(policy),
+    first,
+    last,
+    value_type{},
+    plus<>{}
+  );
+}
+
+template <typename ExecutionPolicy, typename ForwardIt, typename T, typename>
+inline T bpstd::reduce(ExecutionPolicy&& policy,
+                       ForwardIt first, ForwardIt last,
+                       T init)
+{
+  return bpstd::reduce(
+    static_cast<ExecutionPolicy&&>(policy),
+    first,
+    last,
+    std::move(init),
+    plus<>{}
+  );
+}
+
+template <typename ExecutionPolicy, typename ForwardIt, typename T,
+          typename BinaryOp, typename>
+inline T bpstd::reduce(ExecutionPolicy&& policy,
+                       ForwardIt first, ForwardIt last,
+                       T init,
+                       BinaryOp op)
+{
+  return bpstd::transform_reduce(
+    static_cast<ExecutionPolicy&&>(policy),
+    first,
+    last,
+    std::move(init),
+    op,
+    detail::reduce_identity{}
+  );
+}
+
+//==============================================================================
+// definitions : algorithms : transform_reduce
+//==============================================================================
+
+template <typename InputIt1, typename InputIt2, typename T>
+inline T bpstd::transform_reduce(InputIt1 first1, InputIt1 last1,
+                                 InputIt2 first2,
+                                 T init)
+{
+  return bpstd::transform_reduce(
+    first1,
+    last1,
+    first2,
+    std::move(init),
+    plus<>{},
+    multiplies<>{}
+  );
+}
+
+template <typename InputIt1, typename InputIt2, typename T,
+          typename BinaryReductionOp, typename BinaryTransformOp>
+inline T bpstd::transform_reduce(InputIt1 first1, InputIt1 last1,
+                                 InputIt2 first2,
+                                 T init,
+                                 BinaryReductionOp reduce,
+                                 BinaryTransformOp transform)
+{
+  for (; first1 != last1; ++first1, ++first2) {
+    init = reduce(std::move(init), transform(*first1, *first2));
+  }
+  return init;
+}
+
+template <typename InputIt, typename T,
+          typename BinaryReductionOp, typename UnaryTransformOp>
+inline T bpstd::transform_reduce(InputIt first, InputIt last,
+                                 T init,
+                                 BinaryReductionOp reduce,
+                                 UnaryTransformOp transform)
+{
+  for (; first != last; ++first) {
+    init = reduce(std::move(init), transform(*first));
+  }
+  return init;
+}
+
+//------------------------------------------------------------------------------
+
+template <typename ExecutionPolicy, typename ForwardIt1, typename ForwardIt2,
+          typename T, typename>
+inline T bpstd::transform_reduce(ExecutionPolicy&& policy,
+                                 ForwardIt1 first1, ForwardIt1 last1,
+                                 ForwardIt2 first2,
+                                 T init)
+{
+  return bpstd::transform_reduce(
+    static_cast<ExecutionPolicy&&>(policy),
+    first1,
+    last1,
+    first2,
+    std::move(init),
+    plus<>{},
+    multiplies<>{}
+  );
+}
+
+template <typename ExecutionPolicy, typename ForwardIt1, typename ForwardIt2,
+          typename T, typename BinaryReductionOp, typename BinaryTransformOp,
+          typename>
+inline T bpstd::transform_reduce(ExecutionPolicy&&,
+                                 ForwardIt1 first1, ForwardIt1 last1,
+                                 ForwardIt2 first2,
+                                 T init,
+                                 BinaryReductionOp reduce,
+                                 BinaryTransformOp transform)
+{
+  using tag = detail::is_parallel_execution<ExecutionPolicy,ForwardIt1,ForwardIt2>;
+
+  return detail::transform_reduce(
+    tag{},
+    first1,
+    last1,
+    first2,
+    std::move(init),
+    reduce,
+    transform
+  );
+}
+
+template <typename ExecutionPolicy, typename ForwardIt, typename T,
+          typename BinaryReductionOp, typename UnaryTransformOp, typename>
+inline T bpstd::transform_reduce(ExecutionPolicy&&,
+                                 ForwardIt first, ForwardIt last,
+                                 T init,
+                                 BinaryReductionOp reduce,
+                                 UnaryTransformOp transform)
+{
+  using tag = detail::is_parallel_execution<ExecutionPolicy,ForwardIt>;
+
+  return detail::transform_reduce(
+    tag{},
+    first,
+    last,
+    std::move(init),
+    reduce,
+    transform
+  );
+}
+
+//==============================================================================
+// definitions : algorithms : inclusive_scan
+//==============================================================================
+
+template <typename InputIt, typename OutputIt>
+inline OutputIt bpstd::inclusive_scan(InputIt first, InputIt last,
+                                      OutputIt d_first)
+{
+  return bpstd::inclusive_scan(first, last, d_first, plus<>{});
+}
+
+template <typename InputIt, typename OutputIt, typename BinaryOp>
+inline OutputIt bpstd::inclusive_scan(InputIt first, InputIt last,
+                                      OutputIt d_first,
+                                      BinaryOp op)
+{
+  using value_type = typename std::iterator_traits<InputIt>::value_type;
+
+  if (first == last) {
+    return d_first;
+  }
+
+  auto sum = value_type(*first);
+  *d_first = sum;
+
+  return bpstd::inclusive_scan(++first, last, ++d_first, op, std::move(sum));
+}
+
+template <typename InputIt, typename OutputIt, typename BinaryOp, typename T>
+inline OutputIt bpstd::inclusive_scan(InputIt first, InputIt last,
+                                      OutputIt d_first,
+                                      BinaryOp op,
+                                      T init)
+{
+  for (; first != last; ++first, ++d_first) {
+    init = op(std::move(init), *first);
+    *d_first = init;
+  }
+  return d_first;
+}
+
+//------------------------------------------------------------------------------
+
+template <typename ExecutionPolicy, typename ForwardIt1, typename ForwardIt2,
+          typename>
+inline ForwardIt2 bpstd::inclusive_scan(ExecutionPolicy&& policy,
+                                        ForwardIt1 first, ForwardIt1 last,
+                                        ForwardIt2 d_first)
+{
+  return bpstd::inclusive_scan(
+    static_cast<ExecutionPolicy&&>(policy),
+    first,
+    last,
+    d_first,
+    plus<>{}
+  );
+}
+
+template <typename ExecutionPolicy, typename ForwardIt1, typename ForwardIt2,
+          typename BinaryOp, typename>
+inline ForwardIt2 bpstd::inclusive_scan(ExecutionPolicy&& policy,
+                                        ForwardIt1 first, ForwardIt1 last,
+                                        ForwardIt2 d_first,
+                                        BinaryOp op)
+{
+  using value_type = typename std::iterator_traits<ForwardIt1>::value_type;
+
+  if (first == last) {
+    return d_first;
+  }
+
+  // A scan without an initial value is the first element, followed by a
+  // scan of the rest that starts from it
+  auto sum = value_type(*first);
+  *d_first = sum;
+
+  return bpstd::inclusive_scan(
+    static_cast<ExecutionPolicy&&>(policy),
+    ++first,
+    last,
+    ++d_first,
+    op,
+    std::move(sum)
+  );
+}
+
+template <typename ExecutionPolicy, typename ForwardIt1, typename ForwardIt2,
+          typename BinaryOp, typename T, typename>
+inline ForwardIt2 bpstd::inclusive_scan(ExecutionPolicy&&,
+                                        ForwardIt1 first, ForwardIt1 last,
+                                        ForwardIt2 d_first,
+                                        BinaryOp op,
+                                        T init)
+{
+  using tag = detail::is_parallel_execution<ExecutionPolicy,ForwardIt1,ForwardIt2>;
+
+  return detail::inclusive_scan(tag{}, first, last, d_first, op, std::move(init));
+}
+
+//==============================================================================
+// definitions : detail algorithms
+//==============================================================================
+
+template <typename ForwardIt, typename T, typename BinaryReductionOp,
+          typename UnaryTransformOp>
+inline T bpstd::detail::transform_reduce(false_type,
+                                         ForwardIt first, ForwardIt last,
+                                         T init,
+                                         BinaryReductionOp& reduce,
+                                         UnaryTransformOp& transform)
+{
+  return bpstd::transform_reduce(first, last, std::move(init), reduce, transform);
+}
+
+template <typename RandomIt, typename T, typename BinaryReductionOp,
+          typename UnaryTransformOp>
+inline T bpstd::detail::transform_reduce(true_type,
+                                         RandomIt first, RandomIt last,
+                                         T init,
+                                         BinaryReductionOp& reduce,
+                                         UnaryTransformOp& transform)
+{
+  const auto size = static_cast<std::size_t>(last - first);
+  const auto chunks = parallel_chunk_count(size);
+
+  if (chunks == 1u) {
+    return bpstd::transform_reduce(first, last, std::move(init), reduce, transform);
+  }
+
+  auto reduce_chunk = [&](std::size_t b, std::size_t e) -> T {
+    auto sum = T(reduce(transform(first[b]), transform(first[b + 1u])));
+    return bpstd::transform_reduce(
+      first + b + 2u,
+      first + e,
+      std::move(sum),
+      reduce,
+      transform
+    );
+  };
+
+  return parallel_reduce(size, chunks, std::move(init), reduce, reduce_chunk);
+}
+
+template <typename ForwardIt1, typename ForwardIt2, typename T,
+          typename BinaryReductionOp, typename BinaryTransformOp>
+inline T bpstd::detail::transform_reduce(false_type,
+                                         ForwardIt1 first1, ForwardIt1 last1,
+                                         ForwardIt2 first2,
+                                         T init,
+                                         BinaryReductionOp& reduce,
+                                         BinaryTransformOp& transform)
+{
+  return bpstd::transform_reduce(
+    first1,
+    last1,
+    first2,
+    std::move(init),
+    reduce,
+    transform
+  );
+}
+
+template <typename RandomIt1, typename RandomIt2, typename T,
+          typename BinaryReductionOp, typename BinaryTransformOp>
+inline T bpstd::detail::transform_reduce(true_type,
+                                         RandomIt1 first1, RandomIt1 last1,
+                                         RandomIt2 first2,
+                                         T init,
+                                         BinaryReductionOp& reduce,
+                                         BinaryTransformOp& transform)
+{
+  const auto size = static_cast<std::size_t>(last1 - first1);
+  const auto chunks = parallel_chunk_count(size);
+
+  if (chunks == 1u) {
+    return bpstd::transform_reduce(
+      first1,
+      last1,
+      first2,
+      std::move(init),
+      reduce,
+      transform
+    );
+  }
+
+  auto reduce_chunk = [&](std::size_t b, std::size_t e) -> T {
+    auto sum = T(reduce(
+      transform(first1[b], first2[b]),
+      transform(first1[b + 1u], first2[b + 1u])
+    ));
+    return bpstd::transform_reduce(
+      first1 + b + 2u,
+      first1 + e,
+      first2 + b + 2u,
+      std::move(sum),
+      reduce,
+      transform
+    );
+  };
+
+  return parallel_reduce(size, chunks, std::move(init), reduce, reduce_chunk);
+}
+
+//------------------------------------------------------------------------------
+
+template <typename ForwardIt1, typename ForwardIt2, typename BinaryOp,
+          typename T>
+inline ForwardIt2 bpstd::detail::inclusive_scan(false_type,
+                                                ForwardIt1 first, ForwardIt1 last,
+                                                ForwardIt2 d_first,
+                                                BinaryOp& op,
+                                                T init)
+{
+  return bpstd::inclusive_scan(first, last, d_first, op, std::move(init));
+}
+
+template <typename RandomIt1, typename RandomIt2, typename BinaryOp,
+          typename T>
+inline RandomIt2 bpstd::detail::inclusive_scan(true_type,
+                                               RandomIt1 first, RandomIt1 last,
+                                               RandomIt2 d_first,
+                                               BinaryOp& op,
+                                               T init)
+{
+  const auto size = static_cast<std::size_t>(last - first);
+  const auto chunks = parallel_chunk_count(size);
+
+  if (chunks == 1u) {
+    return bpstd::inclusive_scan(first, last, d_first, op, std::move(init));
+  }
+
+  // The first pass reduces every chunk but the last, which no other chunk
+  // depends on
+  auto partials = std::vector<optional<T>>(chunks - 1u);
+  auto reduce_chunk = [&](std::size_t i) {
+    const auto b = parallel_chunk_begin(size, chunks, i);
+    const auto e = parallel_chunk_begin(size, chunks, i + 1u);
+
+    partials[i].emplace(bpstd::reduce(
+      first + b + 2u,
+      first + e,
+      T(op(first[b], first[b + 1u])),
+      op
+    ));
+  };
+  parallel_invoke_n(chunks - 1u, reduce_chunk);
+
+  // The carry into each chunk is the reduction of everything before it
+  auto carries = std::vector<optional<T>>(chunks);
+  carries[0].emplace(std::move(init));
+  for (auto i = std::size_t{1u}; i < chunks; ++i) {
+    carries[i].emplace(op(*carries[i - 1u], std::move(*partials[i - 1u])));
+  }
+
+  // The second pass scans every chunk, starting from its carry
+  auto scan_chunk = [&](std::size_t i) {
+    const auto b = parallel_chunk_begin(size, chunks, i);
+    const auto e = parallel_chunk_begin(size, chunks, i + 1u);
+
+    bpstd::inclusive_scan(
+      first + b,
+      first + e,
+      d_first + b,
+      op,
+      std::move(*carries[i])
+    );
+  };
+  parallel_invoke_n(chunks, scan_chunk);
+
+  return d_first + size;
+}
+
+//------------------------------------------------------------------------------
+
+template <typename T, typename BinaryReductionOp, typename ChunkFn>
+inline T bpstd::detail::parallel_reduce(std::size_t size,
+                                        std::size_t chunks,
+                                        T init,
+                                        BinaryReductionOp& reduce,
+                                        ChunkFn& reduce_chunk)
+{
+  auto partials = std::vector<optional<T>>(chunks);
+  auto run_chunk = [&](std::size_t i) {
+    partials[i].emplace(reduce_chunk(
+      parallel_chunk_begin(size, chunks, i),
+      parallel_chunk_begin(size, chunks, i + 1u)
+    ));
+  };
+
+  parallel_invoke_n(chunks, run_chunk);
+
+  for (auto& partial : partials) {
+    init = reduce(std::move(init), std::move(*partial));
+  }
+  return init;
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_NUMERIC_HPP */
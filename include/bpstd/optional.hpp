@@ -36,11 +36,15 @@
 
 #include "detail/config.hpp"
 #include "detail/enable_overload.hpp" // enable_overload_if, disable_overload_if
+#include "detail/hash.hpp"            // hash_combine
+#include "detail/instrumentation.hpp" // BPSTD_INSTRUMENT
 
 #include "utility.hpp"     // in_place_t, forward, move
 #include "functional.hpp"  // invoke_result_t
 #include "type_traits.hpp"
 
+#include <cstddef>          // std::size_t
+#include <functional>       // std::hash
 #include <initializer_list> // std::initializer_list
 #include <type_traits>      // enable_if
 #include <stdexcept>        // std::logic_error
@@ -1086,6 +1090,7 @@ bpstd::optional<T>
 {
   if (other.has_value())
   {
+    BPSTD_INSTRUMENT(optional, copy);
     base_type::construct(*other);
   }
 }
@@ -1098,6 +1103,7 @@ bpstd::optional<T>
 {
   if (other.has_value())
   {
+    BPSTD_INSTRUMENT(optional, move);
     base_type::construct(bpstd::move(*other));
   }
 }
@@ -1113,6 +1119,7 @@ bpstd::optional<T>::optional(const optional<U>& other)
 {
   if (other.has_value())
   {
+    BPSTD_INSTRUMENT(optional, copy);
     base_type::construct(*other);
   }
 }
@@ -1126,6 +1133,7 @@ bpstd::optional<T>::optional(const optional<U>& other)
 {
   if (other.has_value())
   {
+    BPSTD_INSTRUMENT(optional, copy);
     base_type::construct(*other);
   }
 }
@@ -1141,6 +1149,7 @@ bpstd::optional<T>::optional(optional<U>&& other)
 {
   if (other.has_value())
   {
+    BPSTD_INSTRUMENT(optional, move);
     base_type::construct(bpstd::move(*other));
   }
 }
@@ -1153,6 +1162,7 @@ bpstd::optional<T>::optional(optional<U>&& other)
 {
   if (other.has_value())
   {
+    BPSTD_INSTRUMENT(optional, move);
     base_type::construct(bpstd::move(*other));
   }
 }
@@ -1214,10 +1224,12 @@ bpstd::optional<T>&
   bpstd::optional<T>::operator=(detail::enable_overload_if_t<std::is_copy_constructible<T>::value && std::is_copy_assignable<T>::value,const optional&> other)
 {
   if (has_value() && other.has_value()) {
+    BPSTD_INSTRUMENT(optional, copy);
     (*base_type::val()) = (*other);
   } else if (has_value()) {
     base_type::destruct();
   } else if (other.has_value()) {
+    BPSTD_INSTRUMENT(optional, copy);
     base_type::construct(*other);
   }
 
@@ -1230,10 +1242,12 @@ bpstd::optional<T>&
   bpstd::optional<T>::operator=(detail::enable_overload_if_t<std::is_move_constructible<T>::value && std::is_move_assignable<T>::value,optional&&> other)
 {
   if (has_value() && other.has_value()) {
+    BPSTD_INSTRUMENT(optional, move);
     (*base_type::val()) = bpstd::move(*other);
   } else if (has_value()) {
     base_type::destruct();
   } else if (other.has_value()) {
+    BPSTD_INSTRUMENT(optional, move);
     base_type::construct(bpstd::move( *other ));
   }
 
@@ -1344,6 +1358,7 @@ typename bpstd::optional<T>::value_type&
   if (static_cast<bool>(*this)) {
     return *base_type::val();
   }
+  BPSTD_INSTRUMENT(optional, bad_access);
   throw bad_optional_access{};
 }
 
@@ -1356,6 +1371,7 @@ typename bpstd::optional<T>::value_type&&
   if (static_cast<bool>(*this)) {
     return bpstd::move(*base_type::val());
   }
+  BPSTD_INSTRUMENT(optional, bad_access);
   throw bad_optional_access{};
 }
 
@@ -1370,6 +1386,7 @@ const typename bpstd::optional<T>::value_type&
   if (static_cast<bool>(*this)) {
     return *base_type::val();
   }
+  BPSTD_INSTRUMENT(optional, bad_access);
   throw bad_optional_access{};
 }
 
@@ -1382,6 +1399,7 @@ const typename bpstd::optional<T>::value_type&&
   if (static_cast<bool>(*this)) {
     return bpstd::move(*base_type::val());
   }
+  BPSTD_INSTRUMENT(optional, bad_access);
   throw bad_optional_access{};
 }
 
@@ -1769,6 +1787,48 @@ void bpstd::swap(optional<T>& lhs, optional<T>& rhs)
   lhs.swap(rhs);
 }
 
+//==============================================================================
+// struct : hash
+//==============================================================================
+
+namespace bpstd {
+  namespace detail {
+
+    template <typename T,
+              bool Enabled = std::is_default_constructible<
+                std::hash<remove_const_t<T>>
+              >::value>
+    struct optional_hash
+    {
+      std::size_t operator()(const optional<T>& o) const
+      {
+        if (!o.has_value()) {
+          return static_cast<std::size_t>(0x6a09e667f3bcc908ull);
+        }
+        return hash_combine(
+          std::size_t{1u},
+          std::hash<remove_const_t<T>>{}(*o)
+        );
+      }
+    };
+
+    template <typename T>
+    struct optional_hash<T,false> : disabled_hash{};
+
+  } // namespace detail
+} // namespace bpstd
+
+namespace std {
+
+  /// \brief Hashes an optional by combining its engaged state with the hash
+  ///        of the contained value
+  ///
+  /// This is disabled unless std::hash<remove_const_t<T>> is enabled
+  template <typename T>
+  struct hash<bpstd::optional<T>> : bpstd::detail::optional_hash<T>{};
+
+} // namespace std
+
 BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
 
 #endif /* BPSTD_OPTIONAL_HPP */
@@ -0,0 +1,255 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file semaphore.hpp
+///
+/// \brief This header provides definitions from the C++ header <semaphore>
+////////////////////////////////////////////////////////////////////////////////
+
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_SEMAPHORE_HPP
+#define BPSTD_SEMAPHORE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/config.hpp"
+#include "detail/atomic_wait.hpp"
+
+#include <atomic>  // std::atomic
+#include <chrono>  // std::chrono::duration, std::chrono::time_point
+#include <cstddef> // std::ptrdiff_t
+#include <cstdint> // std::int32_t
+#include <limits>  // std::numeric_limits
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+
+  //============================================================================
+  // class : counting_semaphore
+  //============================================================================
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief A lightweight synchronization primitive that controls access to
+  ///        a shared resource through a counter
+  ///
+  /// Acquiring spins briefly before parking on the counter itself (a futex on
+  /// Linux). Releasing only makes a system call while threads are parked.
+  ///
+  /// \tparam LeastMaxValue the least maximum value the counter must support
+  //////////////////////////////////////////////////////////////////////////////
+  template <std::ptrdiff_t LeastMaxValue = std::numeric_limits<std::int32_t>::max()>
+  class counting_semaphore
+  {
+    static_assert(
+      LeastMaxValue >= 0,
+      "The maximum value of a counting_semaphore cannot be negative"
+    );
+    static_assert(
+      LeastMaxValue <= std::numeric_limits<std::int32_t>::max(),
+      "The counter of a counting_semaphore is a 32-bit integer"
+    );
+
+    //--------------------------------------------------------------------------
+    // Static Member Functions
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets the maximum value of the counter
+    ///
+    /// \return the maximum value
+    static constexpr std::ptrdiff_t max() noexcept;
+
+    //--------------------------------------------------------------------------
+    // Constructors / Destructor / Assignment
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs a counting_semaphore with its counter set to
+    ///        \p desired
+    ///
+    /// \pre 0 <= desired <= max()
+    /// \param desired the initial value of the counter
+    constexpr explicit counting_semaphore(std::ptrdiff_t desired) noexcept;
+
+    counting_semaphore(const counting_semaphore&) = delete;
+
+    //--------------------------------------------------------------------------
+
+    counting_semaphore& operator=(const counting_semaphore&) = delete;
+
+    //--------------------------------------------------------------------------
+    // Modifiers
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Increments the counter by \p update, unblocking threads that
+    ///        are waiting to acquire
+    ///
+    /// \pre 0 <= update <= max() - the value of the counter
+    /// \param update the amount to increment by
+    void release(std::ptrdiff_t update = 1) noexcept;
+
+    /// \brief Decrements the counter, blocking until it is greater than zero
+    void acquire() noexcept;
+
+    /// \brief Decrements the counter if it is greater than zero, without
+    ///        blocking
+    ///
+    /// \return true if the counter was decremented
+    bool try_acquire() noexcept;
+
+    /// \brief Decrements the counter, blocking for at most \p rel_time until
+    ///        it is greater than zero
+    ///
+    /// \param rel_time the maximum duration to block for
+    /// \return true if the counter was decremented
+    template <typename Rep, typename Period>
+    bool try_acquire_for(const std::chrono::duration<Rep,Period>& rel_time);
+
+    /// \brief Decrements the counter, blocking until at most \p abs_time
+    ///        until it is greater than zero
+    ///
+    /// \param abs_time the time to stop blocking at
+    /// \return true if the counter was decremented
+    template <typename Clock, typename Duration>
+    bool try_acquire_until(const std::chrono::time_point<Clock,Duration>& abs_time);
+
+    //--------------------------------------------------------------------------
+    // Private Members
+    //--------------------------------------------------------------------------
+  private:
+
+    std::atomic<std::int32_t> m_counter;
+    std::atomic<std::int32_t> m_waiters;
+  };
+
+  //============================================================================
+  // aliases : class : counting_semaphore
+  //============================================================================
+
+  using binary_semaphore = counting_semaphore<1>;
+
+} // namespace bpstd
+
+//==============================================================================
+// definitions : class : counting_semaphore
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Static Member Functions
+//------------------------------------------------------------------------------
+
+template <std::ptrdiff_t LeastMaxValue>
+inline constexpr
+std::ptrdiff_t bpstd::counting_semaphore<LeastMaxValue>::max()
+  noexcept
+{
+  return std::numeric_limits<std::int32_t>::max();
+}
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+template <std::ptrdiff_t LeastMaxValue>
+inline constexpr
+bpstd::counting_semaphore<LeastMaxValue>::counting_semaphore(std::ptrdiff_t desired)
+  noexcept
+  : m_counter{static_cast<std::int32_t>(desired)},
+    m_waiters{0}
+{
+
+}
+
+//------------------------------------------------------------------------------
+// Modifiers
+//------------------------------------------------------------------------------
+
+template <std::ptrdiff_t LeastMaxValue>
+inline void bpstd::counting_semaphore<LeastMaxValue>::release(std::ptrdiff_t update)
+  noexcept
+{
+  // Sequentially consistent, as required by 'notify_waiters'
+  m_counter.fetch_add(static_cast<std::int32_t>(update));
+  detail::notify_waiters(m_counter, m_waiters, update > 1);
+}
+
+template <std::ptrdiff_t LeastMaxValue>
+inline void bpstd::counting_semaphore<LeastMaxValue>::acquire()
+  noexcept
+{
+  while (!try_acquire()) {
+    detail::wait_while_equal(m_counter, 0, m_waiters);
+  }
+}
+
+template <std::ptrdiff_t LeastMaxValue>
+inline bool bpstd::counting_semaphore<LeastMaxValue>::try_acquire()
+  noexcept
+{
+  auto current = m_counter.load(std::memory_order_relaxed);
+  while (current > 0) {
+    if (m_counter.compare_exchange_weak(current, current - 1,
+                                        std::memory_order_acquire,
+                                        std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+template <std::ptrdiff_t LeastMaxValue>
+template <typename Rep, typename Period>
+inline bool bpstd::counting_semaphore<LeastMaxValue>
+  ::try_acquire_for(const std::chrono::duration<Rep,Period>& rel_time)
+{
+  return try_acquire_until(std::chrono::steady_clock::now() + rel_time);
+}
+
+template <std::ptrdiff_t LeastMaxValue>
+template <typename Clock, typename Duration>
+inline bool bpstd::counting_semaphore<LeastMaxValue>
+  ::try_acquire_until(const std::chrono::time_point<Clock,Duration>& abs_time)
+{
+  while (!try_acquire()) {
+    // Waits are measured against the steady clock; 'Clock' is checked again
+    // on every pass, in case the two drift apart
+    const auto now = Clock::now();
+    if (now >= abs_time) {
+      return false;
+    }
+    const auto deadline = std::chrono::steady_clock::now() +
+      std::chrono::duration_cast<std::chrono::steady_clock::duration>(abs_time - now);
+
+    detail::wait_while_equal_until(m_counter, 0, m_waiters, deadline);
+  }
+  return true;
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_SEMAPHORE_HPP */
@@ -151,6 +151,12 @@ namespace bpstd {
           : ((Extent != dynamic_extent) ? (Extent - Offset) : Extent)
         >{};
 
+    template <typename T, std::size_t Extent>
+    struct compute_bytes_extent
+      : integral_constant<std::size_t,
+          (Extent != dynamic_extent) ? (sizeof(T) * Extent) : dynamic_extent
+        >{};
+
     template <typename It>
     using iter_reference = typename std::iterator_traits<It>::reference;
 
@@ -463,14 +469,16 @@ namespace bpstd {
   /// \param s the span to convert
   /// \return a span of the byte range that \p s covered
   template <typename T, std::size_t N>
-  span<const byte, sizeof(T) * N> as_bytes(span<T, N> s) noexcept;
+  span<const byte, detail::compute_bytes_extent<T,N>::value>
+    as_bytes(span<T, N> s) noexcept;
 
   /// \brief Converts a span \p s to a writable byte span
   ///
   /// \param s the span to convert
   /// \return a span of the byte range that \p s covered
   template <typename T, std::size_t N>
-  span<byte, sizeof(T) * N> as_writable_bytes(span<T, N> s) noexcept;
+  span<byte, detail::compute_bytes_extent<T,N>::value>
+    as_writable_bytes(span<T, N> s) noexcept;
 
 } // namespace bpstd
 
@@ -502,7 +510,7 @@ template <typename It,
 inline BPSTD_INLINE_VISIBILITY constexpr
 bpstd::span<T,Extent>::span(It it, size_type count)
   noexcept
-  : m_storage{to_address(it), count}
+  : m_storage{bpstd::to_address(it), count}
 {
 
 }
@@ -514,7 +522,7 @@ template <typename It,
 inline BPSTD_INLINE_VISIBILITY constexpr
 bpstd::span<T,Extent>::span(It it, size_type count)
   noexcept
-  : m_storage{to_address(it), count}
+  : m_storage{bpstd::to_address(it), count}
 {
 
 }
@@ -526,7 +534,7 @@ template <typename It, typename End,
 inline BPSTD_INLINE_VISIBILITY constexpr
 bpstd::span<T,Extent>::span(It it, End end)
   noexcept
-  : m_storage{to_address(it), static_cast<size_type>(end - it)}
+  : m_storage{bpstd::to_address(it), static_cast<size_type>(end - it)}
 {
 
 }
@@ -538,7 +546,7 @@ template <typename It, typename End,
 inline BPSTD_INLINE_VISIBILITY constexpr
 bpstd::span<T,Extent>::span(It it, End end)
   noexcept
-  : m_storage{to_address(it), static_cast<size_type>(end - it)}
+  : m_storage{bpstd::to_address(it), static_cast<size_type>(end - it)}
 {
 
 }
@@ -788,17 +796,23 @@ typename bpstd::span<T,Extent>::reverse_iterator
 //------------------------------------------------------------------------------
 
 template <typename T, std::size_t N>
-inline bpstd::span<const bpstd::byte, sizeof(T) * N> bpstd::as_bytes(span<T, N> s)
+inline bpstd::span<const bpstd::byte, bpstd::detail::compute_bytes_extent<T,N>::value>
+  bpstd::as_bytes(span<T, N> s)
   noexcept
 {
-  return {reinterpret_cast<const byte*>(s.data()), s.size_bytes()};
+  using result_type = span<const byte, detail::compute_bytes_extent<T,N>::value>;
+
+  return result_type{reinterpret_cast<const byte*>(s.data()), s.size_bytes()};
 }
 
 template <typename T, std::size_t N>
-inline bpstd::span<bpstd::byte, sizeof(T) * N> bpstd::as_writable_bytes(span<T, N> s)
+inline bpstd::span<bpstd::byte, bpstd::detail::compute_bytes_extent<T,N>::value>
+  bpstd::as_writable_bytes(span<T, N> s)
   noexcept
 {
-  return {reinterpret_cast<byte*>(s.data()), s.size_bytes()};
+  using result_type = span<byte, detail::compute_bytes_extent<T,N>::value>;
+
+  return result_type{reinterpret_cast<byte*>(s.data()), s.size_bytes()};
 }
 
 BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
@@ -0,0 +1,651 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file split_view.hpp
+///
+/// \brief This header provides a lazy, non-allocating range for splitting a
+///        basic_string_view into tokens
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_SPLIT_VIEW_HPP
+#define BPSTD_SPLIT_VIEW_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/config.hpp"
+
+#include "string_view.hpp" // basic_string_view
+#include "type_traits.hpp" // type_identity
+
+#include <cstddef>  // std::size_t, std::ptrdiff_t
+#include <iterator> // std::forward_iterator_tag
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+  namespace detail {
+
+    //==========================================================================
+    // delimiters : split
+    //==========================================================================
+
+    // Each delimiter type finds the next match at or after 'pos', returning
+    // its position (or npos), and reports the length of a match.
+
+    /// \brief A delimiter that matches a single character
+    template <typename CharT, typename Traits>
+    struct split_char_delimiter
+    {
+      using string_type = basic_string_view<CharT,Traits>;
+      using size_type   = typename string_type::size_type;
+
+      CharT delimiter;
+
+      BPSTD_CPP14_CONSTEXPR size_type find(string_type str, size_type pos) const;
+      constexpr size_type length() const noexcept;
+    };
+
+    /// \brief A delimiter that matches an entire string
+    ///
+    /// An empty delimiter splits between every character
+    template <typename CharT, typename Traits>
+    struct split_string_delimiter
+    {
+      using string_type = basic_string_view<CharT,Traits>;
+      using size_type   = typename string_type::size_type;
+
+      string_type delimiter;
+
+      BPSTD_CPP14_CONSTEXPR size_type find(string_type str, size_type pos) const;
+      constexpr size_type length() const noexcept;
+    };
+
+    /// \brief A delimiter that matches any one character from a set
+    template <typename CharT, typename Traits>
+    struct split_any_of_delimiter
+    {
+      using string_type = basic_string_view<CharT,Traits>;
+      using size_type   = typename string_type::size_type;
+
+      string_type delimiters;
+
+      BPSTD_CPP14_CONSTEXPR size_type find(string_type str, size_type pos) const;
+      constexpr size_type length() const noexcept;
+    };
+
+  } // namespace detail
+
+  //============================================================================
+  // class : basic_split_view
+  //============================================================================
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief A lazy range of the tokens of a string, separated by a delimiter
+  ///
+  /// Tokens are produced on demand as the range is iterated, and each token
+  /// is a view into the original string, so splitting never allocates or
+  /// copies.
+  ///
+  /// Splitting follows the semantics of std::ranges::split_view: adjacent
+  /// delimiters produce empty tokens, a trailing delimiter produces a
+  /// trailing empty token, and an empty string produces no tokens at all.
+  ///
+  /// \tparam CharT the character type
+  /// \tparam Traits the character traits
+  /// \tparam Delimiter the delimiter type
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename CharT, typename Traits, typename Delimiter>
+  class basic_split_view
+  {
+    //--------------------------------------------------------------------------
+    // Public Member Types
+    //--------------------------------------------------------------------------
+  public:
+
+    using string_type    = basic_string_view<CharT,Traits>;
+    using delimiter_type = Delimiter;
+    using size_type      = typename string_type::size_type;
+
+    class iterator;
+    using const_iterator = iterator;
+
+    //--------------------------------------------------------------------------
+    // Constructors
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs a split view of \p str, separated by \p delimiter
+    ///
+    /// \param str the string to split
+    /// \param delimiter the delimiter to split by
+    constexpr basic_split_view(string_type str, delimiter_type delimiter) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Iterators
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets an iterator to the first token
+    ///
+    /// \return the iterator
+    BPSTD_CPP14_CONSTEXPR iterator begin() const;
+
+    /// \brief Gets an iterator past the last token
+    ///
+    /// \return the iterator
+    BPSTD_CPP14_CONSTEXPR iterator end() const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Observers
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets the string being split
+    ///
+    /// \return the string
+    constexpr string_type base() const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Members
+    //--------------------------------------------------------------------------
+  private:
+
+    string_type    m_string;
+    delimiter_type m_delimiter;
+  };
+
+  //============================================================================
+  // class : basic_split_view::iterator
+  //============================================================================
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief A forward iterator over the tokens of a basic_split_view
+  ///
+  /// The iterator holds a copy of the string and delimiter, so it remains
+  /// valid even if the view it came from is destroyed.
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename CharT, typename Traits, typename Delimiter>
+  class basic_split_view<CharT,Traits,Delimiter>::iterator
+  {
+    //--------------------------------------------------------------------------
+    // Public Member Types
+    //--------------------------------------------------------------------------
+  public:
+
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = basic_string_view<CharT,Traits>;
+    using difference_type   = std::ptrdiff_t;
+    using reference         = const value_type&;
+    using pointer           = const value_type*;
+
+    //--------------------------------------------------------------------------
+    // Constructors
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Default-constructs an iterator that is not associated with a
+    ///        range
+    constexpr iterator() noexcept;
+
+    iterator(const iterator& other) = default;
+
+    iterator& operator=(const iterator& other) = default;
+
+    //--------------------------------------------------------------------------
+    // Iteration
+    //--------------------------------------------------------------------------
+  public:
+
+    BPSTD_CPP14_CONSTEXPR iterator& operator++();
+    BPSTD_CPP14_CONSTEXPR iterator operator++(int);
+
+    //--------------------------------------------------------------------------
+    // Observers
+    //--------------------------------------------------------------------------
+  public:
+
+    constexpr reference operator*() const noexcept;
+    constexpr pointer operator->() const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Comparison
+    //--------------------------------------------------------------------------
+  public:
+
+    constexpr bool operator==(const iterator& other) const noexcept;
+    constexpr bool operator!=(const iterator& other) const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Constructors
+    //--------------------------------------------------------------------------
+  private:
+
+    BPSTD_CPP14_CONSTEXPR iterator(value_type str,
+                                   Delimiter delimiter,
+                                   size_type current,
+                                   bool is_end);
+
+    //--------------------------------------------------------------------------
+    // Private Member Functions
+    //--------------------------------------------------------------------------
+  private:
+
+    /// \brief Finds the next delimiter at or after \p pos, updating the
+    ///        current token to end where the delimiter starts
+    BPSTD_CPP14_CONSTEXPR void find_next(size_type pos);
+
+    //--------------------------------------------------------------------------
+    // Private Members
+    //--------------------------------------------------------------------------
+  private:
+
+    value_type m_string;
+    Delimiter  m_delimiter;
+    value_type m_token;
+    size_type  m_current;    // the start of the current token
+    size_type  m_next;       // the start of the next delimiter
+    bool       m_trailing_empty;
+
+    friend basic_split_view;
+  };
+
+  //============================================================================
+  // aliases : class : basic_split_view
+  //============================================================================
+
+  template <typename CharT, typename Traits = std::char_traits<CharT>>
+  using basic_char_split_view
+    = basic_split_view<CharT,Traits,detail::split_char_delimiter<CharT,Traits>>;
+
+  template <typename CharT, typename Traits = std::char_traits<CharT>>
+  using basic_string_split_view
+    = basic_split_view<CharT,Traits,detail::split_string_delimiter<CharT,Traits>>;
+
+  template <typename CharT, typename Traits = std::char_traits<CharT>>
+  using basic_any_of_split_view
+    = basic_split_view<CharT,Traits,detail::split_any_of_delimiter<CharT,Traits>>;
+
+  //============================================================================
+  // non-member functions : class : basic_split_view
+  //============================================================================
+
+  //----------------------------------------------------------------------------
+  // Utilities
+  //----------------------------------------------------------------------------
+
+  /// \brief Lazily splits \p str into the tokens separated by the character
+  ///        \p delimiter
+  ///
+  /// \param str the string to split
+  /// \param delimiter the delimiting character
+  /// \return a range of the tokens
+  template <typename CharT, typename Traits>
+  constexpr basic_char_split_view<CharT,Traits>
+    split(basic_string_view<CharT,Traits> str, CharT delimiter) noexcept;
+
+  /// \brief Lazily splits \p str into the tokens separated by the string
+  ///        \p delimiter
+  ///
+  /// An empty \p delimiter splits \p str into each of its characters.
+  ///
+  /// \note \p delimiter is not deduced, so that it may be anything that
+  ///       converts to a string_view, such as a string literal
+  ///
+  /// \param str the string to split
+  /// \param delimiter the delimiting string
+  /// \return a range of the tokens
+  template <typename CharT, typename Traits>
+  constexpr basic_string_split_view<CharT,Traits>
+    split(basic_string_view<CharT,Traits> str,
+          typename type_identity<basic_string_view<CharT,Traits>>::type delimiter) noexcept;
+
+  /// \brief Lazily splits \p str into the tokens separated by any one of the
+  ///        characters in \p delimiters
+  ///
+  /// \param str the string to split
+  /// \param delimiters the set of delimiting characters
+  /// \return a range of the tokens
+  template <typename CharT, typename Traits>
+  constexpr basic_any_of_split_view<CharT,Traits>
+    split_any_of(basic_string_view<CharT,Traits> str,
+                 typename type_identity<basic_string_view<CharT,Traits>>::type delimiters) noexcept;
+
+} // namespace bpstd
+
+//==============================================================================
+// definitions : delimiters : split
+//==============================================================================
+
+template <typename CharT, typename Traits>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+typename bpstd::detail::split_char_delimiter<CharT,Traits>::size_type
+  bpstd::detail::split_char_delimiter<CharT,Traits>::find(string_type str,
+                                                          size_type pos)
+  const
+{
+  return str.find(delimiter, pos);
+}
+
+template <typename CharT, typename Traits>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::detail::split_char_delimiter<CharT,Traits>::size_type
+  bpstd::detail::split_char_delimiter<CharT,Traits>::length()
+  const noexcept
+{
+  return 1u;
+}
+
+//------------------------------------------------------------------------------
+
+template <typename CharT, typename Traits>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+typename bpstd::detail::split_string_delimiter<CharT,Traits>::size_type
+  bpstd::detail::split_string_delimiter<CharT,Traits>::find(string_type str,
+                                                            size_type pos)
+  const
+{
+  // An empty delimiter would otherwise match at 'pos' forever; matching
+  // after each character instead splits between every character
+  if (delimiter.empty()) {
+    return (pos + 1u < str.size()) ? (pos + 1u) : string_type::npos;
+  }
+  return str.find(delimiter, pos);
+}
+
+template <typename CharT, typename Traits>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::detail::split_string_delimiter<CharT,Traits>::size_type
+  bpstd::detail::split_string_delimiter<CharT,Traits>::length()
+  const noexcept
+{
+  return delimiter.size();
+}
+
+//------------------------------------------------------------------------------
+
+template <typename CharT, typename Traits>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+typename bpstd::detail::split_any_of_delimiter<CharT,Traits>::size_type
+  bpstd::detail::split_any_of_delimiter<CharT,Traits>::find(string_type str,
+                                                            size_type pos)
+  const
+{
+  return str.find_first_of(delimiters, pos);
+}
+
+template <typename CharT, typename Traits>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::detail::split_any_of_delimiter<CharT,Traits>::size_type
+  bpstd::detail::split_any_of_delimiter<CharT,Traits>::length()
+  const noexcept
+{
+  return 1u;
+}
+
+//==============================================================================
+// definitions : class : basic_split_view
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+template <typename CharT, typename Traits, typename Delimiter>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::basic_split_view<CharT,Traits,Delimiter>
+  ::basic_split_view(string_type str, delimiter_type delimiter)
+  noexcept
+  : m_string{str},
+    m_delimiter(delimiter)
+{
+
+}
+
+//------------------------------------------------------------------------------
+// Iterators
+//------------------------------------------------------------------------------
+
+template <typename CharT, typename Traits, typename Delimiter>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+typename bpstd::basic_split_view<CharT,Traits,Delimiter>::iterator
+  bpstd::basic_split_view<CharT,Traits,Delimiter>::begin()
+  const
+{
+  return iterator{m_string, m_delimiter, 0u, m_string.empty()};
+}
+
+template <typename CharT, typename Traits, typename Delimiter>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+typename bpstd::basic_split_view<CharT,Traits,Delimiter>::iterator
+  bpstd::basic_split_view<CharT,Traits,Delimiter>::end()
+  const noexcept
+{
+  return iterator{m_string, m_delimiter, m_string.size(), true};
+}
+
+//------------------------------------------------------------------------------
+// Observers
+//------------------------------------------------------------------------------
+
+template <typename CharT, typename Traits, typename Delimiter>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::basic_split_view<CharT,Traits,Delimiter>::string_type
+  bpstd::basic_split_view<CharT,Traits,Delimiter>::base()
+  const noexcept
+{
+  return m_string;
+}
+
+//==============================================================================
+// definitions : class : basic_split_view::iterator
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+template <typename CharT, typename Traits, typename Delimiter>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::basic_split_view<CharT,Traits,Delimiter>::iterator::iterator()
+  noexcept
+  : m_string{},
+    m_delimiter{},
+    m_token{},
+    m_current{0u},
+    m_next{0u},
+    m_trailing_empty{false}
+{
+
+}
+
+template <typename CharT, typename Traits, typename Delimiter>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::basic_split_view<CharT,Traits,Delimiter>::iterator
+  ::iterator(value_type str,
+             Delimiter delimiter,
+             size_type current,
+             bool is_end)
+  : m_string{str},
+    m_delimiter(delimiter),
+    m_token{},
+    m_current{current},
+    m_next{current},
+    m_trailing_empty{false}
+{
+  if (!is_end) {
+    find_next(current);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Iteration
+//------------------------------------------------------------------------------
+
+template <typename CharT, typename Traits, typename Delimiter>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+typename bpstd::basic_split_view<CharT,Traits,Delimiter>::iterator&
+  bpstd::basic_split_view<CharT,Traits,Delimiter>::iterator::operator++()
+{
+  const auto size = m_string.size();
+
+  if (m_next == size) {
+    // The last token has been consumed
+    m_current = size;
+    m_trailing_empty = false;
+    return (*this);
+  }
+
+  m_current = m_next + m_delimiter.length();
+  if (m_current == size) {
+    // A delimiter at the very end of the string produces one empty token
+    m_trailing_empty = true;
+    m_next = size;
+    m_token = m_string.substr(size, 0u);
+  } else {
+    find_next(m_current);
+  }
+  return (*this);
+}
+
+template <typename CharT, typename Traits, typename Delimiter>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+typename bpstd::basic_split_view<CharT,Traits,Delimiter>::iterator
+  bpstd::basic_split_view<CharT,Traits,Delimiter>::iterator::operator++(int)
+{
+  auto copy = (*this);
+  ++(*this);
+  return copy;
+}
+
+//------------------------------------------------------------------------------
+// Observers
+//------------------------------------------------------------------------------
+
+template <typename CharT, typename Traits, typename Delimiter>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::basic_split_view<CharT,Traits,Delimiter>::iterator::reference
+  bpstd::basic_split_view<CharT,Traits,Delimiter>::iterator::operator*()
+  const noexcept
+{
+  return m_token;
+}
+
+template <typename CharT, typename Traits, typename Delimiter>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::basic_split_view<CharT,Traits,Delimiter>::iterator::pointer
+  bpstd::basic_split_view<CharT,Traits,Delimiter>::iterator::operator->()
+  const noexcept
+{
+  return &m_token;
+}
+
+//------------------------------------------------------------------------------
+// Comparison
+//------------------------------------------------------------------------------
+
+template <typename CharT, typename Traits, typename Delimiter>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::basic_split_view<CharT,Traits,Delimiter>::iterator
+  ::operator==(const iterator& other)
+  const noexcept
+{
+  return m_current == other.m_current &&
+         m_trailing_empty == other.m_trailing_empty;
+}
+
+template <typename CharT, typename Traits, typename Delimiter>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::basic_split_view<CharT,Traits,Delimiter>::iterator
+  ::operator!=(const iterator& other)
+  const noexcept
+{
+  return !(*this == other);
+}
+
+//------------------------------------------------------------------------------
+// Private Member Functions
+//------------------------------------------------------------------------------
+
+template <typename CharT, typename Traits, typename Delimiter>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+void bpstd::basic_split_view<CharT,Traits,Delimiter>::iterator
+  ::find_next(size_type pos)
+{
+  const auto next = m_delimiter.find(m_string, pos);
+
+  m_next  = (next == value_type::npos) ? m_string.size() : next;
+  m_token = m_string.substr(m_current, m_next - m_current);
+}
+
+//==============================================================================
+// definitions : non-member functions : class : basic_split_view
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Utilities
+//------------------------------------------------------------------------------
+
+template <typename CharT, typename Traits>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::basic_char_split_view<CharT,Traits>
+  bpstd::split(basic_string_view<CharT,Traits> str, CharT delimiter)
+  noexcept
+{
+  return basic_char_split_view<CharT,Traits>{
+    str,
+    detail::split_char_delimiter<CharT,Traits>{delimiter}
+  };
+}
+
+template <typename CharT, typename Traits>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::basic_string_split_view<CharT,Traits>
+  bpstd::split(basic_string_view<CharT,Traits> str,
+               typename type_identity<basic_string_view<CharT,Traits>>::type delimiter)
+  noexcept
+{
+  return basic_string_split_view<CharT,Traits>{
+    str,
+    detail::split_string_delimiter<CharT,Traits>{delimiter}
+  };
+}
+
+template <typename CharT, typename Traits>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::basic_any_of_split_view<CharT,Traits>
+  bpstd::split_any_of(basic_string_view<CharT,Traits> str,
+                      typename type_identity<basic_string_view<CharT,Traits>>::type delimiters)
+  noexcept
+{
+  return basic_any_of_split_view<CharT,Traits>{
+    str,
+    detail::split_any_of_delimiter<CharT,Traits>{delimiters}
+  };
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_SPLIT_VIEW_HPP */
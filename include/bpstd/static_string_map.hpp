@@ -0,0 +1,528 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file static_string_map.hpp
+///
+/// \brief This header provides a compile-time perfect-hash map from string
+///        keys to values
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_STATIC_STRING_MAP_HPP
+#define BPSTD_STATIC_STRING_MAP_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/config.hpp"
+
+#include "string_view.hpp" // string_view, hash_string
+#include "utility.hpp"     // index_sequence
+
+#include <cstddef>   // std::size_t, std::ptrdiff_t
+#include <cstdint>   // std::uint64_t
+#include <stdexcept> // std::out_of_range, std::invalid_argument
+#include <utility>   // std::pair
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+
+  //============================================================================
+  // class : static_string_map
+  //============================================================================
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief An immutable map from a fixed set of string keys to values, which
+  ///        uses a minimal perfect hash that may be built at compile-time
+  ///
+  /// Each lookup performs exactly one hash of the key, followed by a single
+  /// string comparison against the only entry that the key could match.
+  ///
+  /// The hash table is built with the "hash and displace" technique: keys are
+  /// first grouped into N buckets; then, from the largest bucket to the
+  /// smallest, a displacement seed is searched for that places every key of
+  /// the bucket into an unoccupied slot. Buckets with a single key are placed
+  /// directly into the remaining free slots.
+  ///
+  /// In C++14 and above, construction is a constant expression, so a
+  /// 'constexpr' static_string_map carries no runtime initialization cost:
+  ///
+  /// \code
+  /// constexpr std::pair<bpstd::string_view,int> entries[] = {
+  ///   {"GET", 1}, {"PUT", 2}, {"POST", 3}
+  /// };
+  /// constexpr auto methods = bpstd::make_static_string_map(entries);
+  /// \endcode
+  ///
+  /// In C++11 the map is built at runtime.
+  ///
+  /// \tparam T the mapped type. This must be a literal type to construct the
+  ///           map in a constant expression
+  /// \tparam N the number of entries
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename T, std::size_t N>
+  class static_string_map
+  {
+    static_assert(N > 0u, "static_string_map must contain at least one entry");
+
+    //--------------------------------------------------------------------------
+    // Public Member Types
+    //--------------------------------------------------------------------------
+  public:
+
+    using key_type        = string_view;
+    using mapped_type     = T;
+    using value_type      = std::pair<key_type, mapped_type>;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using const_reference = const value_type&;
+    using reference       = const_reference;
+    using const_pointer   = const value_type*;
+    using pointer         = const_pointer;
+    using const_iterator  = const value_type*;
+    using iterator        = const_iterator;
+
+    //--------------------------------------------------------------------------
+    // Constructors
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs a static_string_map from an array of entries
+    ///
+    /// \throw std::invalid_argument if \p entries contains duplicate keys. In
+    ///        a constant expression, this is a compile-time error instead.
+    /// \param entries the entries of the map
+    BPSTD_CPP14_CONSTEXPR explicit static_string_map(const value_type (&entries)[N]);
+
+    static_string_map(const static_string_map& other) = default;
+
+    static_string_map& operator=(const static_string_map& other) = default;
+
+    //--------------------------------------------------------------------------
+    // Iterators
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets an iterator to the first entry, in construction order
+    ///
+    /// \return the iterator
+    constexpr const_iterator begin() const noexcept;
+    constexpr const_iterator cbegin() const noexcept;
+
+    /// \brief Gets an iterator past the last entry, in construction order
+    ///
+    /// \return the iterator
+    constexpr const_iterator end() const noexcept;
+    constexpr const_iterator cend() const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Capacity
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Queries whether this map is empty
+    ///
+    /// \return false
+    constexpr bool empty() const noexcept;
+
+    /// \brief Gets the number of entries in this map
+    ///
+    /// \return the number of entries
+    constexpr size_type size() const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Lookup
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Finds the entry with the key \p key
+    ///
+    /// \param key the key to search for
+    /// \return an iterator to the entry, or end() if not found
+    BPSTD_CPP14_CONSTEXPR const_iterator find(key_type key) const noexcept;
+
+    /// \brief Queries whether an entry with the key \p key exists
+    ///
+    /// \param key the key to search for
+    /// \return true if the key exists
+    BPSTD_CPP14_CONSTEXPR bool contains(key_type key) const noexcept;
+
+    /// \brief Counts the number of entries with the key \p key
+    ///
+    /// \param key the key to search for
+    /// \return 1 if the key exists, 0 otherwise
+    BPSTD_CPP14_CONSTEXPR size_type count(key_type key) const noexcept;
+
+    /// \brief Gets the mapped value for the key \p key
+    ///
+    /// \throw std::out_of_range if the key does not exist
+    /// \param key the key to search for
+    /// \return reference to the mapped value
+    BPSTD_CPP14_CONSTEXPR const mapped_type& at(key_type key) const;
+
+    //--------------------------------------------------------------------------
+    // Private Constructors
+    //--------------------------------------------------------------------------
+  private:
+
+    template <std::size_t...Idxs>
+    BPSTD_CPP14_CONSTEXPR static_string_map(const value_type (&entries)[N],
+                                            index_sequence<Idxs...>);
+
+    //--------------------------------------------------------------------------
+    // Private Member Functions
+    //--------------------------------------------------------------------------
+  private:
+
+    /// \brief Builds the perfect hash table over m_entries
+    BPSTD_CPP14_CONSTEXPR void build_table();
+
+    /// \brief Hashes \p key; this is the only pass over the key's characters
+    static BPSTD_CPP14_CONSTEXPR std::uint64_t hash_key(key_type key) noexcept;
+
+    /// \brief Mixes \p hash with \p seed, producing a well-distributed value
+    static BPSTD_CPP14_CONSTEXPR std::uint64_t mix(std::uint64_t hash,
+                                                   std::uint64_t seed) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Members
+    //--------------------------------------------------------------------------
+  private:
+
+    // Marks a bucket seed as directly encoding the slot of a single key
+    static constexpr std::uint64_t direct_slot = 1ull << 63u;
+
+    value_type    m_entries[N]; // entries in construction order
+    size_type     m_slots[N];   // maps a slot to an index in m_entries
+    std::uint64_t m_seeds[N];   // maps a bucket to its displacement seed
+  };
+
+  template <typename T, std::size_t N>
+  constexpr std::uint64_t static_string_map<T,N>::direct_slot;
+
+  //============================================================================
+  // non-member functions : class : static_string_map
+  //============================================================================
+
+  //----------------------------------------------------------------------------
+  // Utilities
+  //----------------------------------------------------------------------------
+
+  /// \brief Makes a static_string_map from an array of entries, deducing the
+  ///        mapped type and the number of entries
+  ///
+  /// \param entries the entries of the map
+  /// \return the static_string_map
+  template <typename T, std::size_t N>
+  BPSTD_CPP14_CONSTEXPR static_string_map<T,N>
+    make_static_string_map(const std::pair<string_view,T> (&entries)[N]);
+
+} // namespace bpstd
+
+//==============================================================================
+// definitions : class : static_string_map
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+inline BPSTD_CPP14_CONSTEXPR
+bpstd::static_string_map<T,N>::static_string_map(const value_type (&entries)[N])
+  : static_string_map(entries, make_index_sequence<N>{})
+{
+
+}
+
+template <typename T, std::size_t N>
+template <std::size_t...Idxs>
+inline BPSTD_CPP14_CONSTEXPR
+bpstd::static_string_map<T,N>::static_string_map(const value_type (&entries)[N],
+                                                 index_sequence<Idxs...>)
+  : m_entries{entries[Idxs]...},
+    m_slots{},
+    m_seeds{}
+{
+  build_table();
+}
+
+//------------------------------------------------------------------------------
+// Iterators
+//------------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::static_string_map<T,N>::const_iterator
+  bpstd::static_string_map<T,N>::begin()
+  const noexcept
+{
+  return &m_entries[0];
+}
+
+template <typename T, std::size_t N>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::static_string_map<T,N>::const_iterator
+  bpstd::static_string_map<T,N>::cbegin()
+  const noexcept
+{
+  return begin();
+}
+
+template <typename T, std::size_t N>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::static_string_map<T,N>::const_iterator
+  bpstd::static_string_map<T,N>::end()
+  const noexcept
+{
+  return &m_entries[0] + N;
+}
+
+template <typename T, std::size_t N>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::static_string_map<T,N>::const_iterator
+  bpstd::static_string_map<T,N>::cend()
+  const noexcept
+{
+  return end();
+}
+
+//------------------------------------------------------------------------------
+// Capacity
+//------------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::static_string_map<T,N>::empty()
+  const noexcept
+{
+  return false;
+}
+
+template <typename T, std::size_t N>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::static_string_map<T,N>::size_type
+  bpstd::static_string_map<T,N>::size()
+  const noexcept
+{
+  return N;
+}
+
+//------------------------------------------------------------------------------
+// Lookup
+//------------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+typename bpstd::static_string_map<T,N>::const_iterator
+  bpstd::static_string_map<T,N>::find(key_type key)
+  const noexcept
+{
+  const auto hash = hash_key(key);
+  const auto seed = m_seeds[mix(hash, 0u) % N];
+  const auto slot = (seed & direct_slot)
+    ? static_cast<size_type>(seed & ~direct_slot)
+    : static_cast<size_type>(mix(hash, seed) % N);
+
+  const auto& entry = m_entries[m_slots[slot]];
+
+  return (entry.first == key) ? &entry : end();
+}
+
+template <typename T, std::size_t N>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bool bpstd::static_string_map<T,N>::contains(key_type key)
+  const noexcept
+{
+  return find(key) != end();
+}
+
+template <typename T, std::size_t N>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+typename bpstd::static_string_map<T,N>::size_type
+  bpstd::static_string_map<T,N>::count(key_type key)
+  const noexcept
+{
+  return contains(key) ? 1u : 0u;
+}
+
+template <typename T, std::size_t N>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+const typename bpstd::static_string_map<T,N>::mapped_type&
+  bpstd::static_string_map<T,N>::at(key_type key)
+  const
+{
+  const auto it = find(key);
+  if (it == end()) {
+    throw std::out_of_range{"Key not found in static_string_map::at"};
+  }
+  return it->second;
+}
+
+//------------------------------------------------------------------------------
+// Private Member Functions
+//------------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+inline BPSTD_CPP14_CONSTEXPR
+void bpstd::static_string_map<T,N>::build_table()
+{
+  // Group the entries by bucket with a counting sort, so that each bucket's
+  // entries are contiguous in 'members'
+  std::uint64_t hashes[N] = {};
+  size_type bucket_of[N] = {};
+  size_type bucket_size[N] = {};
+  for (auto i = size_type{0}; i < N; ++i) {
+    hashes[i] = hash_key(m_entries[i].first);
+    bucket_of[i] = static_cast<size_type>(mix(hashes[i], 0u) % N);
+    ++bucket_size[bucket_of[i]];
+  }
+
+  size_type bucket_begin[N] = {};
+  for (auto b = size_type{1}; b < N; ++b) {
+    bucket_begin[b] = bucket_begin[b - 1] + bucket_size[b - 1];
+  }
+
+  size_type members[N] = {};
+  size_type filled[N] = {};
+  for (auto i = size_type{0}; i < N; ++i) {
+    const auto b = bucket_of[i];
+    members[bucket_begin[b] + filled[b]] = i;
+    ++filled[b];
+  }
+
+  // Order buckets from largest to smallest, since the largest buckets are the
+  // hardest to place once the table starts to fill
+  size_type order[N] = {};
+  for (auto b = size_type{0}; b < N; ++b) {
+    auto j = b;
+    for (; j > 0u && bucket_size[order[j - 1]] < bucket_size[b]; --j) {
+      order[j] = order[j - 1];
+    }
+    order[j] = b;
+  }
+
+  bool occupied[N] = {};
+  size_type candidates[N] = {};
+  auto free_slot = size_type{0};
+
+  for (auto i = size_type{0}; i < N; ++i) {
+    const auto b = order[i];
+    const auto size = bucket_size[b];
+    const auto first = bucket_begin[b];
+
+    if (size == 0u) {
+      break;
+    }
+
+    // Equal keys always share a bucket, so duplicates only need to be
+    // detected here -- and must be, since they can never be separated
+    for (auto j = size_type{0}; j < size; ++j) {
+      for (auto k = j + 1u; k < size; ++k) {
+        if (m_entries[members[first + j]].first == m_entries[members[first + k]].first) {
+          throw std::invalid_argument{"Duplicate key in static_string_map"};
+        }
+      }
+    }
+
+    if (size == 1u) {
+      while (occupied[free_slot]) {
+        ++free_slot;
+      }
+      occupied[free_slot] = true;
+      m_slots[free_slot] = members[first];
+      m_seeds[b] = direct_slot | free_slot;
+      continue;
+    }
+
+    for (auto seed = std::uint64_t{1u};; ++seed) {
+      auto placed = true;
+      for (auto j = size_type{0}; placed && j < size; ++j) {
+        const auto slot = static_cast<size_type>(mix(hashes[members[first + j]], seed) % N);
+        placed = !occupied[slot];
+        for (auto k = size_type{0}; placed && k < j; ++k) {
+          placed = (candidates[k] != slot);
+        }
+        candidates[j] = slot;
+      }
+      if (placed) {
+        for (auto j = size_type{0}; j < size; ++j) {
+          occupied[candidates[j]] = true;
+          m_slots[candidates[j]] = members[first + j];
+        }
+        m_seeds[b] = seed;
+        break;
+      }
+      if (seed == (1u << 20u)) {
+        // Only possible with a full 64-bit collision between distinct keys
+        throw std::invalid_argument{"Unable to build perfect hash for static_string_map"};
+      }
+    }
+  }
+}
+
+template <typename T, std::size_t N>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+std::uint64_t bpstd::static_string_map<T,N>::hash_key(key_type key)
+  noexcept
+{
+  return hash_string(key);
+}
+
+template <typename T, std::size_t N>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+std::uint64_t bpstd::static_string_map<T,N>::mix(std::uint64_t hash,
+                                                 std::uint64_t seed)
+  noexcept
+{
+  // The 'fmix64' finalizer of MurmurHash3, applied to the seeded hash
+  auto h = hash ^ (seed * 0x9e3779b97f4a7c15ull);
+  h ^= h >> 33u;
+  h *= 0xff51afd7ed558ccdull;
+  h ^= h >> 33u;
+  h *= 0xc4ceb9fe1a85ec53ull;
+  h ^= h >> 33u;
+  return h;
+}
+
+//==============================================================================
+// definitions : non-member functions : class : static_string_map
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Utilities
+//------------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+inline BPSTD_CPP14_CONSTEXPR
+bpstd::static_string_map<T,N>
+  bpstd::make_static_string_map(const std::pair<string_view,T> (&entries)[N])
+{
+  return static_string_map<T,N>{entries};
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_STATIC_STRING_MAP_HPP */
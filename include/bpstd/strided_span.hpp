@@ -0,0 +1,887 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file strided_span.hpp
+///
+/// \brief This header provides a non-owning view over every k-th element of
+///        a contiguous sequence, or a single member of each element
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_STRIDED_SPAN_HPP
+#define BPSTD_STRIDED_SPAN_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/config.hpp"
+#include "detail/proxy_iterator.hpp"
+
+#include "span.hpp"        // span, dynamic_extent, detail::span_storage_type
+#include "type_traits.hpp" // conditional_t, enable_if_t, remove_cv_t, etc
+
+#include <cstddef>  // std::size_t, std::ptrdiff_t
+#include <iterator> // std::random_access_iterator_tag, std::reverse_iterator
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+  namespace detail {
+
+    //==========================================================================
+    // class : strided_pointer
+    //==========================================================================
+
+    /// \brief A char type with the same cv-qualification as T, used for
+    ///        stepping through memory a byte at a time
+    template <typename T>
+    using strided_byte_t = conditional_t<
+      is_const<T>::value,
+      conditional_t<is_volatile<T>::value, const volatile char, const char>,
+      conditional_t<is_volatile<T>::value, volatile char, char>
+    >;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A random-access iterator over elements that are a fixed number
+    ///        of bytes apart
+    ///
+    /// The iterator holds the first element and an index rather than a
+    /// moving pointer, so the end iterator of a member projection never forms
+    /// a pointer beyond the underlying sequence, and the distance between two
+    /// iterators needs no division by the stride.
+    ///
+    /// \tparam T the element type
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    class strided_pointer
+    {
+      //------------------------------------------------------------------------
+      // Public Member Types
+      //------------------------------------------------------------------------
+    public:
+
+      using iterator_category = std::random_access_iterator_tag;
+      using value_type        = remove_cv_t<T>;
+      using pointer           = T*;
+      using reference         = T&;
+      using difference_type   = std::ptrdiff_t;
+
+      //------------------------------------------------------------------------
+      // Constructors
+      //------------------------------------------------------------------------
+    public:
+
+      constexpr strided_pointer() noexcept = default;
+
+      /// \brief Constructs a strided_pointer to the \p index'th element of a
+      ///        sequence starting at \p first
+      ///
+      /// \param first the first element of the sequence
+      /// \param stride the distance in bytes between consecutive elements
+      /// \param index the index of the element to point to
+      constexpr strided_pointer(pointer first,
+                                difference_type stride,
+                                difference_type index) noexcept;
+
+      //------------------------------------------------------------------------
+      // Iteration
+      //------------------------------------------------------------------------
+    public:
+
+      BPSTD_CPP14_CONSTEXPR strided_pointer& operator++() noexcept;
+      BPSTD_CPP14_CONSTEXPR strided_pointer operator++(int) noexcept;
+      BPSTD_CPP14_CONSTEXPR strided_pointer& operator--() noexcept;
+      BPSTD_CPP14_CONSTEXPR strided_pointer operator--(int) noexcept;
+
+      BPSTD_CPP14_CONSTEXPR strided_pointer& operator+=(difference_type n) noexcept;
+      BPSTD_CPP14_CONSTEXPR strided_pointer& operator-=(difference_type n) noexcept;
+
+      constexpr difference_type operator-(const strided_pointer& rhs) const noexcept;
+      reference operator[](difference_type n) const noexcept;
+
+      //------------------------------------------------------------------------
+      // Observers
+      //------------------------------------------------------------------------
+    public:
+
+      pointer operator->() const noexcept;
+      reference operator*() const noexcept;
+
+      //------------------------------------------------------------------------
+      // Comparison
+      //------------------------------------------------------------------------
+    public:
+
+      constexpr bool operator==(const strided_pointer& rhs) const noexcept;
+      constexpr bool operator!=(const strided_pointer& rhs) const noexcept;
+      constexpr bool operator< (const strided_pointer& rhs) const noexcept;
+      constexpr bool operator<=(const strided_pointer& rhs) const noexcept;
+      constexpr bool operator> (const strided_pointer& rhs) const noexcept;
+      constexpr bool operator>=(const strided_pointer& rhs) const noexcept;
+
+      //------------------------------------------------------------------------
+      // Private Members
+      //------------------------------------------------------------------------
+    private:
+
+      pointer m_first = nullptr;
+      difference_type m_stride = 0;
+      difference_type m_index = 0;
+    };
+
+    /// \brief Gets the element \p n strides of \p stride bytes from \p p
+    ///
+    /// \param p the pointer to advance
+    /// \param stride the distance in bytes between consecutive elements
+    /// \param n the number of elements to advance by
+    /// \return the advanced pointer
+    template <typename T>
+    T* strided_advance(T* p, std::ptrdiff_t stride, std::ptrdiff_t n) noexcept;
+
+    //==========================================================================
+    // class : strided_span_storage_type
+    //==========================================================================
+
+    template <typename T>
+    class strided_span_storage_type
+      : public span_storage_type<T,dynamic_extent>
+    {
+      //------------------------------------------------------------------------
+      // Constructors
+      //------------------------------------------------------------------------
+    public:
+
+      constexpr strided_span_storage_type(T* data,
+                                          std::size_t size,
+                                          std::ptrdiff_t stride)
+        : span_storage_type<T,dynamic_extent>(data, size),
+          m_stride{stride}
+      {
+
+      }
+
+      //------------------------------------------------------------------------
+      // Observers
+      //------------------------------------------------------------------------
+    public:
+
+      constexpr std::ptrdiff_t stride() const noexcept { return m_stride; }
+
+      //------------------------------------------------------------------------
+      // Private Members
+      //------------------------------------------------------------------------
+    private:
+
+      std::ptrdiff_t m_stride;
+    };
+
+    template <typename U, typename T>
+    using is_strided_span_convertible = is_convertible<U(*)[],T(*)[]>;
+
+    /// \brief The type of member M in an object of type U, with the
+    ///        cv-qualification of U
+    template <typename U, typename M>
+    using strided_member_t = conditional_t<
+      is_const<U>::value,
+      conditional_t<is_volatile<U>::value, const volatile M, const M>,
+      conditional_t<is_volatile<U>::value, volatile M, M>
+    >;
+
+  } // namespace detail
+
+  //============================================================================
+  // class : strided_span
+  //============================================================================
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief A non-owning view of elements that are a fixed number of bytes
+  ///        apart in memory
+  ///
+  /// A strided_span views every k-th element of a contiguous sequence, or a
+  /// single data member of every object in an array-of-structs, in place. This
+  /// allows a single field to be scanned or modified without first copying it
+  /// out into a temporary container:
+  ///
+  /// \code
+  /// auto points = std::vector<point>{...};
+  /// auto xs = bpstd::strided_span<float>{
+  ///   bpstd::span<point>{points.data(), points.size()}, &point::x
+  /// };
+  /// std::sort(xs.begin(), xs.end()); // sorts the 'x' of every point
+  /// \endcode
+  ///
+  /// The stride is measured in bytes so that it may be any multiple of the
+  /// enclosing object's size; it must be a multiple of alignof(T), and it may
+  /// be negative to view a sequence in reverse.
+  ///
+  /// \tparam T the element type of the view
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  class strided_span
+  {
+    //--------------------------------------------------------------------------
+    // Public Member Types
+    //--------------------------------------------------------------------------
+  public:
+
+    using element_type    = T;
+    using value_type      = remove_cv_t<T>;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using pointer         = element_type*;
+    using const_pointer   = const element_type*;
+    using reference       = element_type&;
+    using const_reference = const element_type&;
+
+    using iterator         = detail::proxy_iterator<detail::strided_pointer<T>,detail::strided_span_storage_type<T>>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+
+    //--------------------------------------------------------------------------
+    // Constructors / Assignment
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Default-constructs an empty strided_span
+    constexpr strided_span() noexcept;
+
+    /// \brief Constructs a strided_span of \p count elements, each \p stride
+    ///        bytes after the last, starting at \p data
+    ///
+    /// \pre \p stride is a multiple of alignof(T)
+    /// \param data a pointer to the first element
+    /// \param count the number of elements
+    /// \param stride the distance in bytes between consecutive elements
+    constexpr strided_span(pointer data,
+                           size_type count,
+                           difference_type stride) noexcept;
+
+    /// \brief Constructs a strided_span that views every element of \p s
+    ///
+    /// \param s the span to view
+    template <typename U, std::size_t N,
+              typename = enable_if_t<detail::is_strided_span_convertible<U,T>::value>>
+    // cppcheck-suppress noExplicitConstructor
+    constexpr strided_span(span<U,N> s) noexcept;
+
+    /// \brief Constructs a strided_span that views every \p step'th element
+    ///        of \p s, starting with the first
+    ///
+    /// \pre \p step is greater than 0
+    /// \param s the span to view
+    /// \param step the number of elements to advance between each element
+    template <typename U, std::size_t N,
+              typename = enable_if_t<detail::is_strided_span_convertible<U,T>::value>>
+    constexpr strided_span(span<U,N> s, size_type step) noexcept;
+
+    /// \brief Constructs a strided_span that views the \p member of every
+    ///        object in \p s
+    ///
+    /// This constructor only participates in overload resolution if a
+    /// pointer to the member of a U is convertible to a pointer to T
+    ///
+    /// \param s the span of objects to project
+    /// \param member the data member to view
+    template <typename U, std::size_t N, typename M, typename C,
+              typename = enable_if_t<
+                is_same<remove_cv_t<U>,C>::value &&
+                detail::is_strided_span_convertible<detail::strided_member_t<U,M>,T>::value
+              >>
+    constexpr strided_span(span<U,N> s, M C::* member) noexcept;
+
+    /// \brief Constructs a strided_span from a different strided_span
+    ///
+    /// This constructor only participates in overload resolution if U is at
+    /// most less cv-qualified than T
+    ///
+    /// \param other the strided_span to convert
+    template <typename U,
+              typename = enable_if_t<detail::is_strided_span_convertible<U,T>::value &&
+                                     !is_same<U,T>::value>>
+    // cppcheck-suppress noExplicitConstructor
+    constexpr strided_span(const strided_span<U>& other) noexcept;
+
+    /// \brief Constructs a strided_span by copying \p other
+    ///
+    /// \param other the other strided_span to copy
+    constexpr strided_span(const strided_span& other) noexcept = default;
+
+    //--------------------------------------------------------------------------
+
+    /// \brief Assigns a strided_span from \p other
+    ///
+    /// \param other the other strided_span to copy
+    /// \return reference to this
+    BPSTD_CPP14_CONSTEXPR strided_span& operator=(const strided_span& other) noexcept = default;
+
+    //--------------------------------------------------------------------------
+    // Element Access
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets a reference to the front element of this strided_span
+    ///
+    /// \pre empty() is false
+    /// \return reference to front element
+    constexpr reference front() const noexcept;
+
+    /// \brief Gets a reference to the back element of this strided_span
+    ///
+    /// \pre empty() is false
+    /// \return reference to back element
+    reference back() const noexcept;
+
+    /// \brief Gets a reference to the element at \p idx
+    ///
+    /// \pre \p idx is less than size()
+    /// \param idx the index
+    /// \return reference to the element at \p idx
+    reference operator[](size_type idx) const noexcept;
+
+    /// \brief Gets a pointer to the first element
+    ///
+    /// \return pointer to the first element
+    constexpr pointer data() const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Observers
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets the number of elements in this strided_span
+    ///
+    /// \return the number of elements in this strided_span
+    constexpr size_type size() const noexcept;
+
+    /// \brief Gets the distance in bytes between consecutive elements
+    ///
+    /// \return the stride, in bytes
+    constexpr difference_type stride() const noexcept;
+
+    /// \brief Queries whether this strided_span is empty
+    ///
+    /// \return true if this strided_span is empty
+    constexpr bool empty() const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Subviews
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Creates a strided_span from the first \p count elements
+    ///
+    /// \pre It is undefined behavior if \p count > size()
+    ///
+    /// \param count the number of elements to view
+    /// \return the first \p count elements
+    constexpr strided_span first(size_type count) const noexcept;
+
+    /// \brief Creates a strided_span from the last \p count elements
+    ///
+    /// \pre It is undefined behavior if \p count > size()
+    ///
+    /// \param count the number of elements to view
+    /// \return the last \p count elements
+    strided_span last(size_type count) const noexcept;
+
+    /// \brief Creates a strided_span that is \p count elements long,
+    ///        \p offset from the start of this strided_span
+    ///
+    /// \param offset the number of elements to offset by
+    /// \param count the number of elements to view
+    /// \return the created strided_span
+    strided_span subspan(size_type offset,
+                         size_type count = dynamic_extent) const noexcept;
+
+    /// \brief Creates a strided_span that views every \p step'th element of
+    ///        this strided_span, starting with the first
+    ///
+    /// \pre \p step is greater than 0
+    /// \param step the number of elements to advance between each element
+    /// \return the created strided_span
+    constexpr strided_span every(size_type step) const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Iterators
+    //--------------------------------------------------------------------------
+  public:
+
+    constexpr iterator begin() const noexcept;
+    constexpr iterator end() const noexcept;
+    constexpr reverse_iterator rbegin() const noexcept;
+    constexpr reverse_iterator rend() const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Members
+    //--------------------------------------------------------------------------
+  private:
+
+    using storage_type = detail::strided_span_storage_type<element_type>;
+
+    storage_type m_storage;
+  };
+
+} // namespace bpstd
+
+//==============================================================================
+// definitions : class : strided_pointer
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::detail::strided_pointer<T>::strided_pointer(pointer first,
+                                                   difference_type stride,
+                                                   difference_type index)
+  noexcept
+  : m_first{first},
+    m_stride{stride},
+    m_index{index}
+{
+
+}
+
+//------------------------------------------------------------------------------
+// Iteration
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::detail::strided_pointer<T>&
+  bpstd::detail::strided_pointer<T>::operator++()
+  noexcept
+{
+  ++m_index;
+  return (*this);
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::detail::strided_pointer<T>
+  bpstd::detail::strided_pointer<T>::operator++(int)
+  noexcept
+{
+  const auto copy = (*this);
+  ++m_index;
+  return copy;
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::detail::strided_pointer<T>&
+  bpstd::detail::strided_pointer<T>::operator--()
+  noexcept
+{
+  --m_index;
+  return (*this);
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::detail::strided_pointer<T>
+  bpstd::detail::strided_pointer<T>::operator--(int)
+  noexcept
+{
+  const auto copy = (*this);
+  --m_index;
+  return copy;
+}
+
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::detail::strided_pointer<T>&
+  bpstd::detail::strided_pointer<T>::operator+=(difference_type n)
+  noexcept
+{
+  m_index += n;
+  return (*this);
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::detail::strided_pointer<T>&
+  bpstd::detail::strided_pointer<T>::operator-=(difference_type n)
+  noexcept
+{
+  m_index -= n;
+  return (*this);
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::detail::strided_pointer<T>::difference_type
+  bpstd::detail::strided_pointer<T>::operator-(const strided_pointer& rhs)
+  const noexcept
+{
+  return m_index - rhs.m_index;
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::detail::strided_pointer<T>::reference
+  bpstd::detail::strided_pointer<T>::operator[](difference_type n)
+  const noexcept
+{
+  return *strided_advance(m_first, m_stride, m_index + n);
+}
+
+//------------------------------------------------------------------------------
+// Observers
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::detail::strided_pointer<T>::pointer
+  bpstd::detail::strided_pointer<T>::operator->()
+  const noexcept
+{
+  return strided_advance(m_first, m_stride, m_index);
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::detail::strided_pointer<T>::reference
+  bpstd::detail::strided_pointer<T>::operator*()
+  const noexcept
+{
+  return *strided_advance(m_first, m_stride, m_index);
+}
+
+//------------------------------------------------------------------------------
+// Comparison
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::detail::strided_pointer<T>::operator==(const strided_pointer& rhs)
+  const noexcept
+{
+  return m_index == rhs.m_index;
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::detail::strided_pointer<T>::operator!=(const strided_pointer& rhs)
+  const noexcept
+{
+  return m_index != rhs.m_index;
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::detail::strided_pointer<T>::operator<(const strided_pointer& rhs)
+  const noexcept
+{
+  return m_index < rhs.m_index;
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::detail::strided_pointer<T>::operator<=(const strided_pointer& rhs)
+  const noexcept
+{
+  return m_index <= rhs.m_index;
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::detail::strided_pointer<T>::operator>(const strided_pointer& rhs)
+  const noexcept
+{
+  return m_index > rhs.m_index;
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::detail::strided_pointer<T>::operator>=(const strided_pointer& rhs)
+  const noexcept
+{
+  return m_index >= rhs.m_index;
+}
+
+//==============================================================================
+// definitions : non-member functions : class : strided_pointer
+//==============================================================================
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+T* bpstd::detail::strided_advance(T* p, std::ptrdiff_t stride, std::ptrdiff_t n)
+  noexcept
+{
+  using byte_type = strided_byte_t<T>;
+
+  return reinterpret_cast<T*>(reinterpret_cast<byte_type*>(p) + (stride * n));
+}
+
+//==============================================================================
+// definitions : class : strided_span
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::strided_span<T>::strided_span()
+  noexcept
+  : m_storage{nullptr, 0u, static_cast<difference_type>(sizeof(T))}
+{
+
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::strided_span<T>::strided_span(pointer data,
+                                     size_type count,
+                                     difference_type stride)
+  noexcept
+  : m_storage{data, count, stride}
+{
+
+}
+
+template <typename T>
+template <typename U, std::size_t N, typename>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::strided_span<T>::strided_span(span<U,N> s)
+  noexcept
+  : m_storage{s.data(), s.size(), static_cast<difference_type>(sizeof(U))}
+{
+
+}
+
+template <typename T>
+template <typename U, std::size_t N, typename>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::strided_span<T>::strided_span(span<U,N> s, size_type step)
+  noexcept
+  : m_storage{
+      s.data(),
+      (s.size() + step - 1u) / step,
+      static_cast<difference_type>(sizeof(U) * step)
+    }
+{
+
+}
+
+template <typename T>
+template <typename U, std::size_t N, typename M, typename C, typename>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::strided_span<T>::strided_span(span<U,N> s, M C::* member)
+  noexcept
+  : m_storage{
+      s.empty() ? nullptr : &(s.data()->*member),
+      s.size(),
+      static_cast<difference_type>(sizeof(U))
+    }
+{
+
+}
+
+template <typename T>
+template <typename U, typename>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::strided_span<T>::strided_span(const strided_span<U>& other)
+  noexcept
+  : m_storage{other.data(), other.size(), other.stride()}
+{
+
+}
+
+//------------------------------------------------------------------------------
+// Element Access
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::strided_span<T>::reference
+  bpstd::strided_span<T>::front()
+  const noexcept
+{
+  return *data();
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::strided_span<T>::reference
+  bpstd::strided_span<T>::back()
+  const noexcept
+{
+  return (*this)[size() - 1u];
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::strided_span<T>::reference
+  bpstd::strided_span<T>::operator[](size_type idx)
+  const noexcept
+{
+  return *detail::strided_advance(
+    data(),
+    stride(),
+    static_cast<difference_type>(idx)
+  );
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::strided_span<T>::pointer
+  bpstd::strided_span<T>::data()
+  const noexcept
+{
+  return m_storage.data();
+}
+
+//------------------------------------------------------------------------------
+// Observers
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::strided_span<T>::size_type
+  bpstd::strided_span<T>::size()
+  const noexcept
+{
+  return m_storage.size();
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::strided_span<T>::difference_type
+  bpstd::strided_span<T>::stride()
+  const noexcept
+{
+  return m_storage.stride();
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::strided_span<T>::empty()
+  const noexcept
+{
+  return size() == 0u;
+}
+
+//------------------------------------------------------------------------------
+// Subviews
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::strided_span<T> bpstd::strided_span<T>::first(size_type count)
+  const noexcept
+{
+  return strided_span{data(), count, stride()};
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::strided_span<T> bpstd::strided_span<T>::last(size_type count)
+  const noexcept
+{
+  return subspan(size() - count, count);
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::strided_span<T>
+  bpstd::strided_span<T>::subspan(size_type offset, size_type count)
+  const noexcept
+{
+  // Don't advance the pointer for an empty result, since it may already be
+  // past the end of the underlying sequence
+  return (offset == size())
+    ? strided_span{data(), 0u, stride()}
+    : strided_span{
+        detail::strided_advance(data(), stride(), static_cast<difference_type>(offset)),
+        (count == dynamic_extent) ? (size() - offset) : count,
+        stride()
+      };
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::strided_span<T> bpstd::strided_span<T>::every(size_type step)
+  const noexcept
+{
+  return strided_span{
+    data(),
+    (size() + step - 1u) / step,
+    stride() * static_cast<difference_type>(step)
+  };
+}
+
+//------------------------------------------------------------------------------
+// Iterators
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::strided_span<T>::iterator
+  bpstd::strided_span<T>::begin()
+  const noexcept
+{
+  return iterator{detail::strided_pointer<T>{data(), stride(), 0}};
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::strided_span<T>::iterator
+  bpstd::strided_span<T>::end()
+  const noexcept
+{
+  return iterator{detail::strided_pointer<T>{
+    data(),
+    stride(),
+    static_cast<difference_type>(size())
+  }};
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::strided_span<T>::reverse_iterator
+  bpstd::strided_span<T>::rbegin()
+  const noexcept
+{
+  return reverse_iterator(end());
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::strided_span<T>::reverse_iterator
+  bpstd::strided_span<T>::rend()
+  const noexcept
+{
+  return reverse_iterator(begin());
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_STRIDED_SPAN_HPP */
@@ -35,11 +35,14 @@
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
 #include "detail/config.hpp" // BPSTD_CPP14_CONSTEXPR
+#include "detail/hash.hpp"   // hash_bytes
 
 #include <algorithm>  // std::min, std::max
 #include <string>     // std::char_traits
 #include <ostream>    // std::basic_ostream
 #include <cstddef>    // std::size_t
+#include <cstdint>    // std::uint64_t
+#include <functional> // std::hash
 #include <memory>     // std::allocator
 #include <stdexcept>  // std::out_of_range
 #include <iterator>   // std::reverse_iterator
@@ -510,6 +513,82 @@ namespace bpstd { // back-port std
   using u16string_view = basic_string_view<char16_t>;
   using u32string_view = basic_string_view<char32_t>;
 
+  //----------------------------------------------------------------------------
+  // Hashing
+  //----------------------------------------------------------------------------
+
+  /// \brief Computes a constant-expression hash of the characters in \p str
+  ///
+  /// This computes the 64-bit FNV-1a hash of each character, which allows
+  /// strings to be hashed at compile-time -- such as for 'case' labels when
+  /// switching over a string:
+  ///
+  /// \code
+  /// switch (bpstd::hash_string(cmd)) {
+  ///   case "GET"_hash: ...
+  ///   case "PUT"_hash: ...
+  /// }
+  /// \endcode
+  ///
+  /// \note This is a different hash from std::hash<basic_string_view>, which
+  ///       is faster for long strings but is not usable in constant
+  ///       expressions.
+  ///
+  /// \note In C++11, this is evaluated recursively, one character per call,
+  ///       so it should be limited to short strings
+  ///
+  /// \param str the string to hash
+  /// \return the hash of \p str
+  template <typename CharT, typename Traits>
+  constexpr std::uint64_t hash_string(basic_string_view<CharT,Traits> str) noexcept;
+
+  namespace detail {
+    template <typename Traits, typename CharT>
+    BPSTD_CPP14_CONSTEXPR std::size_t constexpr_length(const CharT* str) noexcept;
+
+    template <typename Traits, typename CharT>
+    BPSTD_CPP14_CONSTEXPR int constexpr_compare(const CharT* lhs,
+                                                const CharT* rhs,
+                                                std::size_t count) noexcept;
+
+    template <typename Traits, typename CharT>
+    constexpr std::uint64_t fnv1a_hash(const CharT* str,
+                                       std::size_t size,
+                                       std::uint64_t hash) noexcept;
+
+#if !defined(__cplusplus) || __cplusplus < 201402L
+    /// \brief The recursive C++11 form of fnv1a_hash
+    ///
+    /// This is not BPSTD_INLINE_VISIBILITY, since a recursive function cannot
+    /// be always_inline.
+    template <typename Traits, typename CharT>
+    constexpr std::uint64_t fnv1a_hash_recursive(const CharT* str,
+                                                 std::size_t size,
+                                                 std::uint64_t hash) noexcept;
+#endif
+  } // namespace detail
+
+  //----------------------------------------------------------------------------
+  // Literals
+  //----------------------------------------------------------------------------
+
+  inline namespace literals {
+    inline namespace string_view_literals {
+
+      constexpr string_view operator""_sv(const char* s, std::size_t len) noexcept;
+      constexpr wstring_view operator""_sv(const wchar_t* s, std::size_t len) noexcept;
+      constexpr u16string_view operator""_sv(const char16_t* s, std::size_t len) noexcept;
+      constexpr u32string_view operator""_sv(const char32_t* s, std::size_t len) noexcept;
+
+      /// \brief Computes hash_string of the string literal at compile-time
+      constexpr std::uint64_t operator""_hash(const char* s, std::size_t len) noexcept;
+      constexpr std::uint64_t operator""_hash(const wchar_t* s, std::size_t len) noexcept;
+      constexpr std::uint64_t operator""_hash(const char16_t* s, std::size_t len) noexcept;
+      constexpr std::uint64_t operator""_hash(const char32_t* s, std::size_t len) noexcept;
+
+    } // inline namespace string_view_literals
+  } // inline namespace literals
+
 } // namespace bpstd
 
 //==============================================================================
@@ -548,7 +627,12 @@ bpstd::basic_string_view<CharT,Traits>
   ::basic_string_view(const char_type* str)
   noexcept
   : m_str{str},
+#if defined(__cplusplus) && __cplusplus >= 201402L && __cplusplus < 201703L
+    // char_traits::length only becomes constexpr in C++17
+    m_size{detail::constexpr_length<traits_type>(str)}
+#else
     m_size{traits_type::length(str)}
+#endif
 {
 
 }
@@ -749,7 +833,12 @@ int
   const noexcept
 {
   const size_type rlen = std::min(m_size,v.m_size);
+#if defined(__cplusplus) && __cplusplus >= 201402L && __cplusplus < 201703L
+  // char_traits::compare only becomes constexpr in C++17
+  const int compare = detail::constexpr_compare<Traits>(m_str,v.m_str,rlen);
+#else
   const int compare = Traits::compare(m_str,v.m_str,rlen);
+#endif
 
   if (compare != 0) {
     return compare;
@@ -836,11 +925,9 @@ typename bpstd::basic_string_view<CharT,Traits>::size_type
     return npos;
   }
 
-  const auto offset = pos;
-  const auto increments = size() - v.size();
+  const auto last = size() - v.size();
 
-  for (auto i = 0u; i <= increments; ++i) {
-    const auto j = i + offset;
+  for (auto j = pos; j <= last; ++j) {
     if (substr(j, v.size()) == v) {
       return j;
     }
@@ -1524,6 +1611,204 @@ namespace bpstd {
 
 } // namespace bpstd
 
+//------------------------------------------------------------------------------
+// Utilities
+//------------------------------------------------------------------------------
+
+template <typename Traits, typename CharT>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+std::size_t bpstd::detail::constexpr_length(const CharT* str)
+  noexcept
+{
+#if defined(BPSTD_DETAIL_HAS_IS_CONSTANT_EVALUATED) && \
+    defined(__cplusplus) && (__cplusplus >= 201402L)
+  // Traits::length is not constexpr until C++17, but is usually optimized
+  // well beyond this loop, so it is preferred outside of constant evaluation
+  if (!__builtin_is_constant_evaluated()) {
+    return Traits::length(str);
+  }
+#endif
+  auto size = std::size_t{0u};
+  while (!Traits::eq(str[size], CharT{})) {
+    ++size;
+  }
+  return size;
+}
+
+template <typename Traits, typename CharT>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+int bpstd::detail::constexpr_compare(const CharT* lhs,
+                                     const CharT* rhs,
+                                     std::size_t count)
+  noexcept
+{
+#if defined(BPSTD_DETAIL_HAS_IS_CONSTANT_EVALUATED) && \
+    defined(__cplusplus) && (__cplusplus >= 201402L)
+  if (!__builtin_is_constant_evaluated()) {
+    return Traits::compare(lhs, rhs, count);
+  }
+#endif
+  for (auto i = std::size_t{0u}; i < count; ++i) {
+    if (Traits::lt(lhs[i], rhs[i])) {
+      return -1;
+    }
+    if (Traits::lt(rhs[i], lhs[i])) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Hashing
+//------------------------------------------------------------------------------
+
+template <typename CharT, typename Traits>
+inline BPSTD_INLINE_VISIBILITY constexpr
+std::uint64_t bpstd::hash_string(basic_string_view<CharT,Traits> str)
+  noexcept
+{
+  return detail::fnv1a_hash<Traits>(
+    str.data(),
+    str.size(),
+    0xcbf29ce484222325ull // FNV-1a 64-bit offset basis
+  );
+}
+
+#if defined(__cplusplus) && __cplusplus >= 201402L
+
+template <typename Traits, typename CharT>
+inline BPSTD_INLINE_VISIBILITY constexpr
+std::uint64_t bpstd::detail::fnv1a_hash(const CharT* str,
+                                        std::size_t size,
+                                        std::uint64_t hash)
+  noexcept
+{
+  for (auto i = std::size_t{0u}; i < size; ++i) {
+    hash ^= static_cast<std::uint64_t>(Traits::to_int_type(str[i]));
+    hash *= 0x100000001b3ull; // FNV-1a 64-bit prime
+  }
+  return hash;
+}
+
+#else
+
+template <typename Traits, typename CharT>
+inline BPSTD_INLINE_VISIBILITY constexpr
+std::uint64_t bpstd::detail::fnv1a_hash(const CharT* str,
+                                        std::size_t size,
+                                        std::uint64_t hash)
+  noexcept
+{
+  return fnv1a_hash_recursive<Traits>(str, size, hash);
+}
+
+template <typename Traits, typename CharT>
+inline constexpr
+std::uint64_t bpstd::detail::fnv1a_hash_recursive(const CharT* str,
+                                                  std::size_t size,
+                                                  std::uint64_t hash)
+  noexcept
+{
+  return (size == 0u)
+    ? hash
+    : fnv1a_hash_recursive<Traits>(
+        str + 1,
+        size - 1u,
+        (hash ^ static_cast<std::uint64_t>(Traits::to_int_type(*str))) * 0x100000001b3ull
+      );
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// Literals
+//------------------------------------------------------------------------------
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::string_view
+  bpstd::literals::string_view_literals::operator""_sv(const char* s, std::size_t len)
+  noexcept
+{
+  return string_view{s, len};
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::wstring_view
+  bpstd::literals::string_view_literals::operator""_sv(const wchar_t* s, std::size_t len)
+  noexcept
+{
+  return wstring_view{s, len};
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::u16string_view
+  bpstd::literals::string_view_literals::operator""_sv(const char16_t* s, std::size_t len)
+  noexcept
+{
+  return u16string_view{s, len};
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::u32string_view
+  bpstd::literals::string_view_literals::operator""_sv(const char32_t* s, std::size_t len)
+  noexcept
+{
+  return u32string_view{s, len};
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+std::uint64_t
+  bpstd::literals::string_view_literals::operator""_hash(const char* s, std::size_t len)
+  noexcept
+{
+  return hash_string(string_view{s, len});
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+std::uint64_t
+  bpstd::literals::string_view_literals::operator""_hash(const wchar_t* s, std::size_t len)
+  noexcept
+{
+  return hash_string(wstring_view{s, len});
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+std::uint64_t
+  bpstd::literals::string_view_literals::operator""_hash(const char16_t* s, std::size_t len)
+  noexcept
+{
+  return hash_string(u16string_view{s, len});
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+std::uint64_t
+  bpstd::literals::string_view_literals::operator""_hash(const char32_t* s, std::size_t len)
+  noexcept
+{
+  return hash_string(u32string_view{s, len});
+}
+
+//==============================================================================
+// struct : hash
+//==============================================================================
+
+namespace std {
+
+  /// \brief Hashes the characters viewed by a basic_string_view
+  template <typename CharT, typename Traits>
+  struct hash<bpstd::basic_string_view<CharT,Traits>>
+  {
+    std::size_t operator()(bpstd::basic_string_view<CharT,Traits> sv) const noexcept
+    {
+      return static_cast<std::size_t>(
+        bpstd::detail::hash_bytes(sv.data(), sv.size() * sizeof(CharT), 0u)
+      );
+    }
+  };
+
+} // namespace std
+
 BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
 
 #endif /* BPSTD_STRING_VIEW_HPP */
@@ -0,0 +1,518 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file thread_pool.hpp
+///
+/// \brief This header provides a work-stealing pool of threads for running
+///        tasks asynchronously
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_THREAD_POOL_HPP
+#define BPSTD_THREAD_POOL_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/config.hpp"
+#include "detail/work_stealing_deque.hpp"
+
+#include "tuple.hpp"       // apply
+#include "type_traits.hpp" // invoke_result_t, decay_t
+
+#include <atomic>             // std::atomic
+#include <condition_variable> // std::condition_variable
+#include <cstddef>            // std::size_t
+#include <cstdint>            // std::uint32_t
+#include <deque>              // std::deque
+#include <future>             // std::future, std::packaged_task
+#include <memory>             // std::unique_ptr
+#include <mutex>              // std::mutex, std::lock_guard, std::unique_lock
+#include <thread>             // std::thread
+#include <tuple>              // std::tuple
+#include <utility>            // std::move, std::forward
+#include <vector>             // std::vector
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+
+  //============================================================================
+  // class : thread_pool
+  //============================================================================
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief A fixed-size pool of worker threads that run submitted tasks,
+  ///        balancing the load between them by work stealing
+  ///
+  /// Every worker owns a Chase-Lev deque. Tasks submitted from a worker (such
+  /// as the subtasks of a task) are pushed onto that worker's own deque and
+  /// popped in LIFO order, which keeps recently touched data hot in its
+  /// cache. Tasks submitted from any other thread enter a shared queue. A
+  /// worker that runs out of tasks takes from the shared queue, and then
+  /// steals the oldest task from another worker's deque; idle workers sleep
+  /// until more tasks are submitted.
+  ///
+  /// Tasks may be any callable that is invocable with bpstd::invoke, along
+  /// with arguments that are decay-copied into the task, like std::thread.
+  /// Neither the callable nor the arguments need to be copyable.
+  ///
+  /// Destroying the pool waits for every submitted task to complete.
+  //////////////////////////////////////////////////////////////////////////////
+  class thread_pool
+  {
+    //--------------------------------------------------------------------------
+    // Constructors / Destructor / Assignment
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs a thread_pool with one worker per hardware thread
+    thread_pool();
+
+    /// \brief Constructs a thread_pool with \p threads workers
+    ///
+    /// \param threads the number of workers; at least one is always created
+    explicit thread_pool(std::size_t threads);
+
+    thread_pool(const thread_pool&) = delete;
+
+    //--------------------------------------------------------------------------
+
+    /// \brief Waits for every submitted task to complete, and then joins
+    ///        every worker
+    ~thread_pool();
+
+    //--------------------------------------------------------------------------
+
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    //--------------------------------------------------------------------------
+    // Submission
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Submits a task that invokes \p fn with \p args, returning a
+    ///        future for its result
+    ///
+    /// An exception thrown by the task is stored in the future.
+    ///
+    /// \param fn the function to invoke
+    /// \param args the arguments to invoke \p fn with
+    /// \return a future for the result of the invocation
+    template <typename Fn, typename...Args>
+    std::future<invoke_result_t<decay_t<Fn>,decay_t<Args>...>>
+      submit(Fn&& fn, Args&&...args);
+
+    /// \brief Submits a task that invokes \p fn with \p args, without any
+    ///        means of observing its completion
+    ///
+    /// This avoids the shared state of a future. As with std::thread, an
+    /// exception escaping the task calls std::terminate.
+    ///
+    /// \param fn the function to invoke
+    /// \param args the arguments to invoke \p fn with
+    template <typename Fn, typename...Args>
+    void execute(Fn&& fn, Args&&...args);
+
+    //--------------------------------------------------------------------------
+    // Execution
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Runs one pending task on the calling thread, if any can be
+    ///        found
+    ///
+    /// A thread that must wait for tasks it submitted can call this in a loop
+    /// to help the pool along, rather than blocking; this is what allows a
+    /// task to safely wait on its own subtasks.
+    ///
+    /// \return true if a task was run
+    bool run_pending_task();
+
+    //--------------------------------------------------------------------------
+    // Observers
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets the number of workers in this pool
+    ///
+    /// \return the number of workers
+    std::size_t size() const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Member Types
+    //--------------------------------------------------------------------------
+  private:
+
+    class task
+    {
+    public:
+      virtual ~task() = default;
+      virtual void run() = 0;
+    };
+
+    template <typename Fn>
+    class task_impl final : public task
+    {
+    public:
+      template <typename UFn>
+      explicit task_impl(UFn&& fn) : m_fn(std::forward<UFn>(fn)){}
+
+      void run() override { m_fn(); }
+
+    private:
+      Fn m_fn;
+    };
+
+    template <typename Fn, typename...Args>
+    struct bound_call
+    {
+      Fn fn;
+      std::tuple<Args...> args;
+
+      invoke_result_t<Fn,Args...> operator()()
+      {
+        return bpstd::apply(std::move(fn), std::move(args));
+      }
+    };
+
+    struct worker
+    {
+      explicit worker(std::uint32_t seed) : tasks{}, seed{seed}, thread{}{}
+
+      detail::work_stealing_deque<task> tasks;
+      std::uint32_t seed; // only touched by the worker, for picking victims
+      std::thread thread;
+    };
+
+    struct worker_context
+    {
+      const thread_pool* pool;
+      std::size_t index;
+    };
+
+    //--------------------------------------------------------------------------
+    // Private Member Functions
+    //--------------------------------------------------------------------------
+  private:
+
+    /// \brief Gets the pool and worker index of the calling thread, if it is
+    ///        a worker
+    static worker_context& current_context() noexcept;
+
+    template <typename Fn>
+    static std::unique_ptr<task> make_task(Fn&& fn);
+
+    void push(std::unique_ptr<task> t);
+    task* find_task(std::size_t index) noexcept;
+    task* steal_task(std::size_t index) noexcept;
+    void run_task(task* t) noexcept;
+    void work(std::size_t index) noexcept;
+    void stop() noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Members
+    //--------------------------------------------------------------------------
+  private:
+
+    std::vector<std::unique_ptr<worker>> m_workers;
+
+    std::mutex m_queue_mutex;
+    std::deque<task*> m_queue; // tasks submitted from outside the pool
+
+    std::atomic<std::size_t> m_pending;  // tasks not yet taken by a thread
+    std::atomic<std::size_t> m_sleepers; // workers waiting on 'm_wake'
+    std::atomic<bool> m_stopping;
+
+    std::mutex m_wake_mutex;
+    std::condition_variable m_wake;
+  };
+
+} // namespace bpstd
+
+//==============================================================================
+// definitions : class : thread_pool
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Constructors / Destructor
+//------------------------------------------------------------------------------
+
+inline bpstd::thread_pool::thread_pool()
+  : thread_pool{static_cast<std::size_t>(std::thread::hardware_concurrency())}
+{
+
+}
+
+inline bpstd::thread_pool::thread_pool(std::size_t threads)
+  : m_workers{},
+    m_queue_mutex{},
+    m_queue{},
+    m_pending{0u},
+    m_sleepers{0u},
+    m_stopping{false},
+    m_wake_mutex{},
+    m_wake{}
+{
+  const auto count = (threads == 0u) ? std::size_t{1u} : threads;
+
+  // Every deque must exist before any worker starts stealing from them
+  m_workers.reserve(count);
+  for (auto i = std::size_t{0u}; i < count; ++i) {
+    m_workers.emplace_back(new worker{
+      static_cast<std::uint32_t>(i * 2654435761u) | 1u
+    });
+  }
+
+  try {
+    for (auto i = std::size_t{0u}; i < count; ++i) {
+      m_workers[i]->thread = std::thread{&thread_pool::work, this, i};
+    }
+  } catch (...) {
+    stop();
+    throw;
+  }
+}
+
+inline bpstd::thread_pool::~thread_pool()
+{
+  stop();
+}
+
+//------------------------------------------------------------------------------
+// Submission
+//------------------------------------------------------------------------------
+
+template <typename Fn, typename...Args>
+inline std::future<bpstd::invoke_result_t<bpstd::decay_t<Fn>,bpstd::decay_t<Args>...>>
+  bpstd::thread_pool::submit(Fn&& fn, Args&&...args)
+{
+  using call_type   = bound_call<decay_t<Fn>,decay_t<Args>...>;
+  using result_type = invoke_result_t<decay_t<Fn>,decay_t<Args>...>;
+
+  auto call = std::packaged_task<result_type()>{call_type{
+    std::forward<Fn>(fn),
+    std::tuple<decay_t<Args>...>(std::forward<Args>(args)...)
+  }};
+  auto result = call.get_future();
+
+  push(make_task(std::move(call)));
+
+  return result;
+}
+
+template <typename Fn, typename...Args>
+inline void bpstd::thread_pool::execute(Fn&& fn, Args&&...args)
+{
+  using call_type = bound_call<decay_t<Fn>,decay_t<Args>...>;
+
+  push(make_task(call_type{
+    std::forward<Fn>(fn),
+    std::tuple<decay_t<Args>...>(std::forward<Args>(args)...)
+  }));
+}
+
+//------------------------------------------------------------------------------
+// Execution
+//------------------------------------------------------------------------------
+
+inline bool bpstd::thread_pool::run_pending_task()
+{
+  const auto& context = current_context();
+  const auto index = (context.pool == this) ? context.index : m_workers.size();
+
+  auto* const t = find_task(index);
+  if (t == nullptr) {
+    return false;
+  }
+  run_task(t);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// Observers
+//------------------------------------------------------------------------------
+
+inline std::size_t bpstd::thread_pool::size()
+  const noexcept
+{
+  return m_workers.size();
+}
+
+//------------------------------------------------------------------------------
+// Private Member Functions
+//------------------------------------------------------------------------------
+
+inline bpstd::thread_pool::worker_context&
+  bpstd::thread_pool::current_context()
+  noexcept
+{
+  static thread_local worker_context context{nullptr, 0u};
+
+  return context;
+}
+
+template <typename Fn>
+inline std::unique_ptr<bpstd::thread_pool::task>
+  bpstd::thread_pool::make_task(Fn&& fn)
+{
+  return std::unique_ptr<task>{
+    new task_impl<decay_t<Fn>>{std::forward<Fn>(fn)}
+  };
+}
+
+inline void bpstd::thread_pool::push(std::unique_ptr<task> t)
+{
+  // 'm_pending' is raised before the task is visible, so that it can never
+  // be taken (and the count lowered) before it is counted
+  m_pending.fetch_add(1u);
+
+  try {
+    const auto& context = current_context();
+    if (context.pool == this) {
+      m_workers[context.index]->tasks.push(t.get());
+    } else {
+      std::lock_guard<std::mutex> lock{m_queue_mutex};
+      m_queue.push_back(t.get());
+    }
+  } catch (...) {
+    m_pending.fetch_sub(1u);
+    throw;
+  }
+  t.release();
+
+  // A worker raises 'm_sleepers' before checking 'm_pending' and sleeping,
+  // so either it sees this task, or this sees that it must be woken. Taking
+  // the mutex ensures it is already waiting before it is notified.
+  if (m_sleepers.load() > 0u) {
+    { std::lock_guard<std::mutex> lock{m_wake_mutex}; }
+    m_wake.notify_one();
+  }
+}
+
+inline bpstd::thread_pool::task*
+  bpstd::thread_pool::find_task(std::size_t index)
+  noexcept
+{
+  task* result = nullptr;
+
+  if (index < m_workers.size()) {
+    result = m_workers[index]->tasks.pop();
+  }
+  if (result == nullptr) {
+    std::lock_guard<std::mutex> lock{m_queue_mutex};
+    if (!m_queue.empty()) {
+      result = m_queue.front();
+      m_queue.pop_front();
+    }
+  }
+  if (result == nullptr) {
+    result = steal_task(index);
+  }
+  if (result != nullptr) {
+    m_pending.fetch_sub(1u);
+  }
+  return result;
+}
+
+inline bpstd::thread_pool::task*
+  bpstd::thread_pool::steal_task(std::size_t index)
+  noexcept
+{
+  const auto count = m_workers.size();
+
+  // Workers start from a random victim so that thieves spread out, rather
+  // than all contending for the same deque
+  auto start = std::size_t{0u};
+  if (index < count) {
+    auto& seed = m_workers[index]->seed;
+    seed ^= seed << 13u;
+    seed ^= seed >> 17u;
+    seed ^= seed << 5u;
+    start = static_cast<std::size_t>(seed) % count;
+  }
+
+  for (auto i = std::size_t{0u}; i < count; ++i) {
+    const auto victim = (start + i) % count;
+    if (victim == index) {
+      continue;
+    }
+    if (auto* const result = m_workers[victim]->tasks.steal()) {
+      return result;
+    }
+  }
+  return nullptr;
+}
+
+inline void bpstd::thread_pool::run_task(task* t)
+  noexcept
+{
+  const auto owned = std::unique_ptr<task>{t};
+
+  owned->run();
+}
+
+inline void bpstd::thread_pool::work(std::size_t index)
+  noexcept
+{
+  current_context() = worker_context{this, index};
+
+  while (true) {
+    if (auto* const t = find_task(index)) {
+      run_task(t);
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock{m_wake_mutex};
+    m_sleepers.fetch_add(1u);
+    m_wake.wait(lock, [this]{
+      return m_stopping.load() || m_pending.load() > 0u;
+    });
+    m_sleepers.fetch_sub(1u);
+
+    if (m_stopping.load() && m_pending.load() == 0u) {
+      return;
+    }
+  }
+}
+
+inline void bpstd::thread_pool::stop()
+  noexcept
+{
+  {
+    std::lock_guard<std::mutex> lock{m_wake_mutex};
+    m_stopping.store(true);
+  }
+  m_wake.notify_all();
+
+  for (auto& w : m_workers) {
+    if (w->thread.joinable()) {
+      w->thread.join();
+    }
+  }
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_THREAD_POOL_HPP */
@@ -34,12 +34,14 @@
 # pragma once
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
-#include "type_traits.hpp" // invoke_result
-#include "utility.hpp"     // index_sequence, forward
-#include "functional.hpp"  // invoke
+#include "detail/nth_type.hpp" // detail::index_in_pack
+#include "type_traits.hpp"     // invoke_result
+#include "utility.hpp"         // index_sequence, forward
+#include "functional.hpp"      // invoke
 
-#include <tuple>   // std::tuple_element, and to proxy API
+#include <tuple>   // std::tuple_element, std::get, and to proxy API
 #include <cstddef> // std::size_t
+#include <utility> // std::declval
 
 BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
 
@@ -123,9 +125,11 @@ namespace bpstd {
     template <typename Fn, typename Seq, typename Tuple>
     struct apply_result_impl;
 
+    // The elements are named through 'get' so that they carry the value
+    // category of the tuple, which may be an lvalue
     template <typename Fn, std::size_t...Idx, typename Tuple>
     struct apply_result_impl<Fn, index_sequence<Idx...>, Tuple>
-      : invoke_result<Fn, tuple_element_t<Idx, Tuple>...>{};
+      : invoke_result<Fn, decltype(std::get<Idx>(std::declval<Tuple>()))...>{};
 
     template <typename Fn, typename Tuple>
     struct apply_result : apply_result_impl<
@@ -168,19 +172,14 @@ namespace bpstd {
 
 namespace bpstd { namespace detail {
 
-  template <typename T, std::size_t Index, typename...Types>
-  struct index_of_impl;
-
-  template <typename T, std::size_t Index, typename Type0, typename...Types>
-  struct index_of_impl<T, Index, Type0, Types...>
-    : index_of_impl<T, Index + 1, Types...>{};
-
-  template <typename T, std::size_t Index, typename...Types>
-  struct index_of_impl<T, Index, T, Types...>
-    : integral_constant<std::size_t, Index>{};
-
   template <typename T, typename...Types>
-  struct index_of : index_of_impl<T,0,Types...>{};
+  struct index_of : index_in_pack<T,Types...>
+  {
+    static_assert(
+      index_in_pack<T,Types...>::value != static_cast<std::size_t>(-1),
+      "T must occur exactly once in Types..."
+    );
+  };
 
 }} // namespace bpstd::detail
 
@@ -195,20 +195,57 @@ namespace bpstd {
   template <std::size_t... Ints>
   using index_sequence = integer_sequence<std::size_t, Ints...>;
 
+#if defined(BPSTD_DETAIL_HAS_MAKE_INTEGER_SEQ)
+
+  template <typename T, T N>
+  using make_integer_sequence = __make_integer_seq<integer_sequence, T, N>;
+
+#elif defined(BPSTD_DETAIL_HAS_INTEGER_PACK)
+
+  template <typename T, T N>
+  using make_integer_sequence = integer_sequence<T, __integer_pack(N)...>;
+
+#else
+
   namespace detail {
-    template <typename T, bool End, T N, T...Tails>
+
+    // Builds a sequence of length N from one of length N/2, so that only
+    // O(log N) instantiations (and template recursion depth) are needed
+
+    template <typename T, typename Seq, bool Odd>
+    struct double_integer_sequence;
+
+    template <typename T, T...Ints>
+    struct double_integer_sequence<T, integer_sequence<T, Ints...>, false>
+      : type_identity<integer_sequence<
+          T, Ints..., (T(sizeof...(Ints)) + Ints)...
+        >>{};
+
+    template <typename T, T...Ints>
+    struct double_integer_sequence<T, integer_sequence<T, Ints...>, true>
+      : type_identity<integer_sequence<
+          T, Ints..., (T(sizeof...(Ints)) + Ints)..., T(2u * sizeof...(Ints))
+        >>{};
+
+    template <typename T, std::size_t N>
     struct make_integer_sequence_impl
-      : make_integer_sequence_impl<T,((N-1) == T(0)), N-1, N-1, Tails...>{};
+      : double_integer_sequence<
+          T,
+          typename make_integer_sequence_impl<T, N / 2u>::type,
+          (N % 2u) != 0u
+        >{};
 
-    template <typename T, T N, T...Tails>
-    struct make_integer_sequence_impl<T, true, N, Tails...>
-      : type_identity<integer_sequence<T, Tails...>>{};
+    template <typename T>
+    struct make_integer_sequence_impl<T, 0u>
+      : type_identity<integer_sequence<T>>{};
 
   } // namespace detail
 
   template <typename T, T N>
   using make_integer_sequence
-    = typename detail::make_integer_sequence_impl<T, (N==T(0)), N>::type;
+    = typename detail::make_integer_sequence_impl<T, static_cast<std::size_t>(N)>::type;
+
+#endif
 
   template<std::size_t N>
   using make_index_sequence = make_integer_sequence<std::size_t, N>;
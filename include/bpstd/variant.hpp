@@ -36,6 +36,8 @@
 
 #include "detail/config.hpp"
 #include "detail/enable_overload.hpp" // enable_overload_if
+#include "detail/hash.hpp"            // hash_combine
+#include "detail/instrumentation.hpp" // BPSTD_INSTRUMENT
 #include "detail/nth_type.hpp"
 #include "detail/variant_base.hpp"
 #include "detail/variant_visitors.hpp"
@@ -49,6 +51,7 @@
 #include <memory>           // std::uses_allocator
 #include <exception>        // std::exception
 #include <cstddef>          // std::size_t
+#include <functional>       // std::hash
 #include <utility>          // std::forward, std::move
 
 BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
@@ -203,24 +206,11 @@ namespace bpstd {
     // trait : index_from
     //==========================================================================
 
-    template <std::size_t I, typename T, typename...Ts>
-    struct index_from_impl;
-
-    template <std::size_t I, typename T>
-    struct index_from_impl<I, T>
-      : integral_constant<std::size_t,variant_npos>{};
-
-    template <std::size_t I, typename T, typename T0, typename...Ts>
-    struct index_from_impl<I,T,T0,Ts...>
-      : index_from_impl<I+1,T,Ts...>{};
-
-    template <std::size_t I, typename T, typename...Ts>
-    struct index_from_impl<I,T,T,Ts...>
-      : integral_constant<std::size_t,I>{};
-
     /// \brief Type-trait to get the index of T in a list of Ts
+    ///
+    /// The index result is 'variant_npos' if T does not occur exactly once
     template <typename T, typename...Ts>
-    struct index_from : index_from_impl<0,T,Ts...>{};
+    struct index_from : index_in_pack<T,Ts...>{};
 
     //==========================================================================
     // trait : is_not_in_place
@@ -352,6 +342,44 @@ namespace bpstd {
     using can_assign_alternative
       = can_assign_alternative_impl<has_constructible_alternative<T,Types...>::value,T,Types...>;
 
+    //==========================================================================
+    // class : variant_valueless_recorder
+    //==========================================================================
+
+    /// \brief Records that an exception left a variant valueless, when
+    ///        instrumentation is enabled
+    ///
+    /// This is constructed after the active alternative is destroyed, and
+    /// before the next one is constructed; if that construction throws, the
+    /// index is still 'variant_npos' when this is destroyed.
+#if BPSTD_ENABLE_INSTRUMENTATION
+    class variant_valueless_recorder
+    {
+    public:
+      explicit variant_valueless_recorder(const std::size_t& index) noexcept
+        : m_index(index)
+      {
+
+      }
+
+      ~variant_valueless_recorder()
+      {
+        if (m_index == variant_npos) {
+          BPSTD_INSTRUMENT(variant, valueless);
+        }
+      }
+
+    private:
+      const std::size_t& m_index;
+    };
+#else
+    class variant_valueless_recorder
+    {
+    public:
+      explicit variant_valueless_recorder(const std::size_t&) noexcept {}
+    };
+#endif
+
   } // namespace detail
 
   //============================================================================
@@ -1107,6 +1135,7 @@ bpstd::variant<Types...>::variant(detail::enable_overload_if_t<is_copy_construct
   if (other.valueless_by_exception()) {
     return;
   }
+  BPSTD_INSTRUMENT(variant, copy);
   detail::visit_union(
     other.base_type::m_index,
     detail::variant_copy_construct_visitor{},
@@ -1125,6 +1154,7 @@ bpstd::variant<Types...>::variant(detail::enable_overload_if_t<is_move_construct
   if (other.valueless_by_exception()) {
     return;
   }
+  BPSTD_INSTRUMENT(variant, move);
   detail::visit_union(
     other.base_type::m_index,
     detail::variant_move_construct_visitor{},
@@ -1208,6 +1238,7 @@ bpstd::variant<Types...>&
   }
 
   if (other.base_type::m_index == base_type::m_index) {
+    BPSTD_INSTRUMENT(variant, copy);
     detail::visit_union(
       other.base_type::m_index,
       detail::variant_copy_assign_visitor{},
@@ -1222,7 +1253,9 @@ bpstd::variant<Types...>&
     !alternative_is_nothrow_move_constructible(other.index());
 
   if (should_copy) {
+    BPSTD_INSTRUMENT(variant, copy);
     base_type::destroy_active_object();
+    const detail::variant_valueless_recorder recorder{base_type::m_index};
     detail::visit_union(
       other.base_type::m_index,
       detail::variant_copy_construct_visitor{},
@@ -1248,6 +1281,8 @@ bpstd::variant<Types...>&
     return (*this);
   }
 
+  BPSTD_INSTRUMENT(variant, move);
+
   if (other.base_type::m_index == base_type::m_index) {
     detail::visit_union(
       other.base_type::m_index,
@@ -1259,6 +1294,7 @@ bpstd::variant<Types...>&
   }
 
   base_type::destroy_active_object();
+  const detail::variant_valueless_recorder recorder{base_type::m_index};
   detail::visit_union(
     other.base_type::m_index,
     detail::variant_move_construct_visitor{},
@@ -1359,6 +1395,7 @@ bpstd::variant_alternative_t<I, bpstd::variant<Types...>>&
   using type = detail::nth_type_t<I,Types...>;
 
   base_type::destroy_active_object();
+  const detail::variant_valueless_recorder recorder{base_type::m_index};
 
   using tuple_type = decltype(std::forward_as_tuple(bpstd::forward<Args>(args)...));
 
@@ -1382,6 +1419,7 @@ bpstd::variant_alternative_t<I, bpstd::variant<Types...>>&
   using type = detail::nth_type_t<I,Types...>;
 
   base_type::destroy_active_object();
+  const detail::variant_valueless_recorder recorder{base_type::m_index};
 
   using tuple_type = decltype(std::forward_as_tuple(il, bpstd::forward<Args>(args)...));
 
@@ -1586,9 +1624,12 @@ bpstd::detail::variant_visitor_invoke_result_t<Visitor,Variant>
   using union_type = detail::match_cvref_t<Variant, decltype(v.m_union)>;
 
   if (v.valueless_by_exception()) {
+    BPSTD_INSTRUMENT(variant, bad_access);
     throw bad_variant_access{};
   }
 
+  BPSTD_CPP14_CONSTEXPR_INSTRUMENT(variant, visit);
+
   return detail::visit_union(
     v.index(),
     bpstd::forward<Visitor>(visitor),
@@ -1731,7 +1772,7 @@ public:
   inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
   Return operator()(T&& v)
   {
-    return apply(
+    return bpstd::apply(
       bpstd::forward<Visitor>(m_visitor),
       tuple_push_back(m_args, bpstd::forward<T>(v))
     );
@@ -1765,6 +1806,7 @@ bpstd::detail::variant_visitor_invoke_result_t<Visitor,Variant0, Variants...>
   using type = bpstd::detail::variant_visitor_invoke_result_t<Visitor,Variant0, Variants...>;
 
   if (detail::are_any_valueless_by_exception(variant0, variants...)) {
+    BPSTD_INSTRUMENT(variant, bad_access);
     throw bad_variant_access{};
   }
 
@@ -1801,6 +1843,7 @@ bpstd::variant_alternative_t<I, bpstd::variant<Types...>>&
   );
 
   if (v.index() != I) {
+    BPSTD_INSTRUMENT(variant, bad_access);
     throw bad_variant_access{};
   }
   return detail::union_get<I>(v.m_union);
@@ -1817,6 +1860,7 @@ bpstd::variant_alternative_t<I, bpstd::variant<Types...>>&&
   );
 
   if (v.index() != I) {
+    BPSTD_INSTRUMENT(variant, bad_access);
     throw bad_variant_access{};
   }
   return bpstd::move(detail::union_get<I>(v.m_union));
@@ -1833,6 +1877,7 @@ const bpstd::variant_alternative_t<I, bpstd::variant<Types...>>&
   );
 
   if (v.index() != I) {
+    BPSTD_INSTRUMENT(variant, bad_access);
     throw bad_variant_access{};
   }
   return detail::union_get<I>(v.m_union);
@@ -1849,6 +1894,7 @@ const bpstd::variant_alternative_t<I, bpstd::variant<Types...>>&&
   );
 
   if (v.index() != I) {
+    BPSTD_INSTRUMENT(variant, bad_access);
     throw bad_variant_access{};
   }
   return bpstd::move(detail::union_get<I>(v.m_union));
@@ -1951,6 +1997,61 @@ bpstd::add_pointer_t<const T>
   return get_if<index_type::value>(pv);
 }
 
+//==============================================================================
+// struct : hash
+//==============================================================================
+
+namespace bpstd {
+  namespace detail {
+
+    template <bool Enabled, typename...Types>
+    struct variant_hash
+    {
+      std::size_t operator()(const variant<Types...>& v) const
+      {
+        if (v.valueless_by_exception()) {
+          return static_cast<std::size_t>(-1);
+        }
+        return hash_combine(
+          v.index(),
+          bpstd::visit(variant_hash_visitor{}, v)
+        );
+      }
+    };
+
+    template <typename...Types>
+    struct variant_hash<false,Types...> : disabled_hash{};
+
+  } // namespace detail
+} // namespace bpstd
+
+namespace std {
+
+  template <>
+  struct hash<bpstd::monostate>
+  {
+    std::size_t operator()(bpstd::monostate) const noexcept
+    {
+      return static_cast<std::size_t>(0x9e3779b97f4a7c15ull);
+    }
+  };
+
+  /// \brief Hashes a variant by combining the index of the active
+  ///        alternative with the hash of its value
+  ///
+  /// This is disabled unless std::hash<remove_const_t<T>> is enabled for
+  /// every alternative T
+  template <typename...Types>
+  struct hash<bpstd::variant<Types...>>
+    : bpstd::detail::variant_hash<
+        bpstd::conjunction<
+          std::is_default_constructible<hash<bpstd::remove_const_t<Types>>>...
+        >::value,
+        Types...
+      >{};
+
+} // namespace std
+
 BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
 
 #endif /* BPSTD_VARIANT_HPP */
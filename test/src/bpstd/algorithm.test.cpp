@@ -0,0 +1,221 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#include <bpstd/algorithm.hpp>
+
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <vector>
+
+// MSVC 2015 seems to emit an error that __forceinline'd functions may not be
+// __forceinline'd at the *end of the translation unit* using it, for some
+// stupid reason.
+#if defined(_MSC_VER)
+# pragma warning(disable:4714)
+#endif
+
+namespace {
+
+  static_assert(bpstd::is_execution_policy<bpstd::execution::parallel_policy>::value, "");
+  static_assert(!bpstd::is_execution_policy<int>::value, "");
+
+  // Enough elements to be split across several threads
+  constexpr auto large_size = std::size_t{100000u};
+
+  // A deterministic sequence of unordered values with many duplicates
+  std::vector<int> make_unordered(std::size_t size)
+  {
+    auto result = std::vector<int>(size);
+    auto state = 12345u;
+    for (auto& v : result) {
+      state = state * 1103515245u + 12345u;
+      v = static_cast<int>((state >> 16u) % 1000u);
+    }
+    return result;
+  }
+
+} // anonymous namespace
+
+//=============================================================================
+// algorithms : execution policy overloads
+//=============================================================================
+
+TEST_CASE("for_each( ExecutionPolicy&&, ForwardIt, ForwardIt, UnaryFunction )", "[algorithm]")
+{
+  SECTION("Policy is parallel")
+  {
+    auto values = std::vector<int>(large_size, 1);
+    std::atomic<std::size_t> count{0u};
+
+    bpstd::for_each(bpstd::execution::par, values.begin(), values.end(), [&](int& v) {
+      v *= 2;
+      ++count;
+    });
+
+    SECTION("Applies the function to every element exactly once")
+    {
+      REQUIRE( count.load() == large_size );
+      REQUIRE( std::all_of(values.begin(), values.end(), [](int v){ return v == 2; }) );
+    }
+  }
+
+  SECTION("Iterators are not random access")
+  {
+    auto values = std::list<int>{1, 2, 3};
+
+    bpstd::for_each(bpstd::execution::par, values.begin(), values.end(), [](int& v) {
+      v += 1;
+    });
+
+    SECTION("Applies the function to every element")
+    {
+      REQUIRE( values == (std::list<int>{2, 3, 4}) );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("transform( ExecutionPolicy&&, ForwardIt1, ForwardIt1, ForwardIt2, UnaryOperation )", "[algorithm]")
+{
+  const auto input = make_unordered(large_size);
+  auto output = std::vector<long>(large_size);
+
+  const auto result = bpstd::transform(bpstd::execution::par_unseq,
+                                       input.begin(), input.end(),
+                                       output.begin(),
+                                       [](int v) { return v * 3L; });
+
+  SECTION("Returns the end of the output")
+  {
+    REQUIRE( result == output.end() );
+  }
+
+  SECTION("Writes each transformed element in order")
+  {
+    auto expected = std::vector<long>(large_size);
+    std::transform(input.begin(), input.end(), expected.begin(), [](int v) {
+      return v * 3L;
+    });
+
+    REQUIRE( output == expected );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("transform( ExecutionPolicy&&, ForwardIt1, ForwardIt1, ForwardIt2, ForwardIt3, BinaryOperation )", "[algorithm]")
+{
+  const auto lhs = make_unordered(large_size);
+  const auto rhs = std::vector<int>(large_size, 7);
+  auto output = std::vector<int>(large_size);
+
+  SECTION("Policy is sequenced")
+  {
+    bpstd::transform(bpstd::execution::seq,
+                     lhs.begin(), lhs.end(), rhs.begin(),
+                     output.begin(),
+                     std::minus<int>{});
+
+    REQUIRE( output[large_size - 1u] == lhs[large_size - 1u] - 7 );
+  }
+
+  SECTION("Policy is parallel")
+  {
+    bpstd::transform(bpstd::execution::par,
+                     lhs.begin(), lhs.end(), rhs.begin(),
+                     output.begin(),
+                     std::minus<int>{});
+
+    SECTION("Writes each transformed pair in order")
+    {
+      auto expected = std::vector<int>(large_size);
+      std::transform(lhs.begin(), lhs.end(), rhs.begin(), expected.begin(), std::minus<int>{});
+
+      REQUIRE( output == expected );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("sort( ExecutionPolicy&&, RandomIt, RandomIt )", "[algorithm]")
+{
+  SECTION("Policy is parallel")
+  {
+    auto values = make_unordered(large_size);
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    bpstd::sort(bpstd::execution::par, values.begin(), values.end());
+
+    SECTION("Sorts the range")
+    {
+      REQUIRE( values == expected );
+    }
+  }
+
+  SECTION("Range is smaller than a single chunk")
+  {
+    auto values = std::vector<int>{5, 3, 1, 4, 2};
+
+    bpstd::sort(bpstd::execution::par, values.begin(), values.end());
+
+    SECTION("Sorts the range")
+    {
+      REQUIRE( values == (std::vector<int>{1, 2, 3, 4, 5}) );
+    }
+  }
+
+  SECTION("Range is empty")
+  {
+    auto values = std::vector<int>{};
+
+    bpstd::sort(bpstd::execution::par, values.begin(), values.end());
+
+    REQUIRE( values.empty() );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("sort( ExecutionPolicy&&, RandomIt, RandomIt, Compare )", "[algorithm]")
+{
+  // An uneven size leaves an odd run to be carried between merge rounds
+  auto values = make_unordered(large_size + 12345u);
+  auto expected = values;
+  std::sort(expected.begin(), expected.end(), std::greater<int>{});
+
+  bpstd::sort(bpstd::execution::par, values.begin(), values.end(), std::greater<int>{});
+
+  SECTION("Sorts the range by the comparison")
+  {
+    REQUIRE( values == expected );
+  }
+}
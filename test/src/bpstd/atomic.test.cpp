@@ -0,0 +1,365 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#include <bpstd/atomic.hpp>
+
+#include <catch2/catch.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+// MSVC 2015 seems to emit an error that __forceinline'd functions may not be
+// __forceinline'd at the *end of the translation unit* using it, for some
+// stupid reason.
+#if defined(_MSC_VER)
+# pragma warning(disable:4714)
+#endif
+
+namespace {
+
+  // A type too large to be waited on directly as a futex
+  struct wide
+  {
+    std::uint32_t low;
+    std::uint32_t high;
+  };
+
+  // Waits on 'object' until it changes from 'old', on another thread, and
+  // returns the value the waiting thread observed
+  template <typename T, typename Modify>
+  T wait_for_change(std::atomic<T>& object, T old, Modify modify)
+  {
+    auto observed = old;
+    auto waiter = std::thread{[&]{
+      bpstd::atomic_wait(&object, old);
+      observed = object.load();
+    }};
+
+    // Give the waiter a chance to park before modifying the object
+    std::this_thread::sleep_for(std::chrono::milliseconds{5});
+    modify(object);
+    bpstd::atomic_notify_all(&object);
+    waiter.join();
+
+    return observed;
+  }
+
+} // anonymous namespace
+
+//=============================================================================
+// non-member functions : atomic waiting
+//=============================================================================
+
+TEST_CASE("atomic_wait( const std::atomic<T>*, T )", "[waiting]")
+{
+  SECTION("Value differs from old")
+  {
+    std::atomic<int> object{1};
+
+    bpstd::atomic_wait(&object, 0);
+
+    SECTION("Returns immediately")
+    {
+      SUCCEED();
+    }
+  }
+
+  SECTION("Value is a futex word")
+  {
+    std::atomic<int> object{0};
+
+    const auto result = wait_for_change(object, 0, [](std::atomic<int>& o){
+      o.store(42);
+    });
+
+    SECTION("Unblocks once notified of the change")
+    {
+      REQUIRE( result == 42 );
+    }
+  }
+
+  SECTION("Value is not a futex word")
+  {
+    std::atomic<wide> object{wide{0u, 0u}};
+
+    const auto result = wait_for_change(object, wide{0u, 0u}, [](std::atomic<wide>& o){
+      o.store(wide{0u, 1u});
+    });
+
+    SECTION("Unblocks once notified of the change")
+    {
+      REQUIRE( result.high == 1u );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("atomic_notify_one( std::atomic<T>* )", "[waiting]")
+{
+  static constexpr auto thread_count = 4;
+
+  std::atomic<int> object{0};
+  std::atomic<int> woken{0};
+  auto threads = std::vector<std::thread>{};
+
+  for (auto i = 0; i < thread_count; ++i) {
+    threads.emplace_back([&]{
+      bpstd::atomic_wait(&object, 0);
+      ++woken;
+    });
+  }
+
+  object.store(1);
+  for (auto i = 0; i < thread_count; ++i) {
+    bpstd::atomic_notify_one(&object);
+  }
+  // Notifying once per thread is not enough if a thread was not yet parked
+  // when it was notified; it will observe the new value instead
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  SECTION("Every waiting thread is eventually unblocked")
+  {
+    REQUIRE( woken == thread_count );
+  }
+}
+
+//=============================================================================
+// class : atomic_ref
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Operations
+//-----------------------------------------------------------------------------
+
+TEST_CASE("atomic_ref<T>::load( std::memory_order )", "[operations]")
+{
+  auto value = 42;
+  const auto sut = bpstd::atomic_ref<int>{value};
+
+  SECTION("Loads the referenced object")
+  {
+    REQUIRE( sut.load() == 42 );
+  }
+
+  SECTION("Observes plain writes made before it was bound")
+  {
+    value = 7;
+
+    REQUIRE( static_cast<int>(bpstd::atomic_ref<int>{value}) == 7 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("atomic_ref<T>::store( T, std::memory_order )", "[operations]")
+{
+  auto value = 0;
+
+  {
+    const auto sut = bpstd::atomic_ref<int>{value};
+    sut.store(42);
+  }
+
+  SECTION("Modifies the referenced object")
+  {
+    REQUIRE( value == 42 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("atomic_ref<T>::exchange( T, std::memory_order )", "[operations]")
+{
+  alignas(bpstd::atomic_ref<wide>::required_alignment) auto value = wide{1u, 2u};
+  const auto sut = bpstd::atomic_ref<wide>{value};
+
+  const auto result = sut.exchange(wide{3u, 4u});
+
+  SECTION("Returns the previous value")
+  {
+    REQUIRE( result.low == 1u );
+    REQUIRE( result.high == 2u );
+  }
+  SECTION("Modifies the referenced object")
+  {
+    REQUIRE( value.low == 3u );
+    REQUIRE( value.high == 4u );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("atomic_ref<T>::compare_exchange_strong( T&, T, std::memory_order )", "[operations]")
+{
+  auto value = 1;
+  const auto sut = bpstd::atomic_ref<int>{value};
+
+  SECTION("Expected value matches")
+  {
+    auto expected = 1;
+    const auto result = sut.compare_exchange_strong(expected, 2);
+
+    SECTION("Exchanges the value")
+    {
+      REQUIRE( result );
+      REQUIRE( value == 2 );
+    }
+  }
+
+  SECTION("Expected value does not match")
+  {
+    auto expected = 5;
+    const auto result = sut.compare_exchange_strong(expected, 2);
+
+    SECTION("Loads the current value into expected")
+    {
+      REQUIRE_FALSE( result );
+      REQUIRE( expected == 1 );
+      REQUIRE( value == 1 );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("atomic_ref<T>::fetch_add( T, std::memory_order )", "[operations]")
+{
+  SECTION("Type is integral")
+  {
+    static constexpr auto thread_count = 4;
+    static constexpr auto iterations = 10000;
+
+    // Counters embedded in a plain array, as through a span
+    auto counters = std::vector<long>(8u, 0);
+    auto threads = std::vector<std::thread>{};
+
+    for (auto i = 0; i < thread_count; ++i) {
+      threads.emplace_back([&]{
+        for (auto j = 0; j < iterations; ++j) {
+          bpstd::atomic_ref<long>{counters[static_cast<std::size_t>(j) % counters.size()]}.fetch_add(1);
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    auto total = 0l;
+    for (auto counter : counters) {
+      total += counter;
+    }
+
+    SECTION("Increments atomically")
+    {
+      REQUIRE( total == thread_count * iterations );
+    }
+  }
+
+  SECTION("Type is floating point")
+  {
+    auto value = 1.5;
+    const auto sut = bpstd::atomic_ref<double>{value};
+
+    const auto result = sut.fetch_add(2.0);
+
+    SECTION("Returns the previous value")
+    {
+      REQUIRE( result == 1.5 );
+    }
+    SECTION("Increments the referenced object")
+    {
+      REQUIRE( value == 3.5 );
+    }
+  }
+
+  SECTION("Type is a pointer")
+  {
+    int array[4] = {};
+    auto* value = &array[0];
+    const auto sut = bpstd::atomic_ref<int*>{value};
+
+    const auto result = sut.fetch_add(3);
+
+    SECTION("Returns the previous value")
+    {
+      REQUIRE( result == &array[0] );
+    }
+    SECTION("Advances the referenced pointer")
+    {
+      REQUIRE( value == &array[3] );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("atomic_ref<T>::operator++()", "[operations]")
+{
+  auto value = 1u;
+  const auto sut = bpstd::atomic_ref<unsigned>{value};
+
+  const auto result = ++sut;
+
+  SECTION("Returns the new value")
+  {
+    REQUIRE( result == 2u );
+    REQUIRE( value == 2u );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Waiting
+//-----------------------------------------------------------------------------
+
+TEST_CASE("atomic_ref<T>::wait( T, std::memory_order )", "[waiting]")
+{
+  auto value = 0;
+  auto observed = 0;
+
+  auto waiter = std::thread{[&]{
+    const auto ref = bpstd::atomic_ref<int>{value};
+    ref.wait(0);
+    observed = ref.load();
+  }};
+
+  std::this_thread::sleep_for(std::chrono::milliseconds{5});
+  {
+    const auto sut = bpstd::atomic_ref<int>{value};
+    sut.store(42);
+    sut.notify_one();
+  }
+  waiter.join();
+
+  SECTION("Unblocks once notified of the change")
+  {
+    REQUIRE( observed == 42 );
+  }
+}
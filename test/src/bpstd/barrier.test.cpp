@@ -0,0 +1,172 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#include <bpstd/barrier.hpp>
+
+#include <catch2/catch.hpp>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// MSVC 2015 seems to emit an error that __forceinline'd functions may not be
+// __forceinline'd at the *end of the translation unit* using it, for some
+// stupid reason.
+#if defined(_MSC_VER)
+# pragma warning(disable:4714)
+#endif
+
+namespace {
+
+  // Counts completed phases, and checks that every thread arrived in each
+  struct phase_counter
+  {
+    const std::vector<int>* arrivals;
+    int* phases;
+    bool* consistent;
+
+    void operator()() noexcept
+    {
+      ++*phases;
+      for (auto arrival : *arrivals) {
+        if (arrival != *phases) {
+          *consistent = false;
+        }
+      }
+    }
+  };
+
+} // anonymous namespace
+
+//=============================================================================
+// class : barrier
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Arrival
+//-----------------------------------------------------------------------------
+
+TEST_CASE("barrier::arrive_and_wait()", "[arrival]")
+{
+  static constexpr auto thread_count = 4;
+  static constexpr auto phase_count = 100;
+
+  auto arrivals = std::vector<int>(thread_count, 0);
+  auto phases = 0;
+  auto consistent = true;
+
+  bpstd::barrier<phase_counter> sut{
+    thread_count,
+    phase_counter{&arrivals, &phases, &consistent}
+  };
+  auto threads = std::vector<std::thread>{};
+
+  for (auto i = 0; i < thread_count; ++i) {
+    threads.emplace_back([&, i]{
+      for (auto j = 0; j < phase_count; ++j) {
+        ++arrivals[static_cast<std::size_t>(i)];
+        sut.arrive_and_wait();
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  SECTION("Invokes the completion function once per phase")
+  {
+    REQUIRE( phases == phase_count );
+  }
+  SECTION("Completes a phase only once every thread arrives")
+  {
+    REQUIRE( consistent );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("barrier::arrive( std::ptrdiff_t )", "[arrival]")
+{
+  SECTION("Arrives on behalf of every expected thread")
+  {
+    auto completions = 0;
+    auto completion = [&completions]() noexcept { ++completions; };
+
+    bpstd::barrier<decltype(completion)> sut{3, completion};
+    sut.wait(sut.arrive(3));
+
+    SECTION("Completes the phase")
+    {
+      REQUIRE( completions == 1 );
+    }
+  }
+
+  SECTION("Phase is completed by another thread")
+  {
+    bpstd::barrier<> sut{2};
+    auto value = 0;
+
+    auto token = sut.arrive();
+    auto thread = std::thread{[&]{
+      value = 42;
+      sut.arrive();
+    }};
+    sut.wait(std::move(token));
+
+    const auto result = value;
+    thread.join();
+
+    SECTION("Observes writes made before arriving")
+    {
+      REQUIRE( result == 42 );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("barrier::arrive_and_drop()", "[arrival]")
+{
+  std::atomic<int> completions{0};
+  auto completion = [&completions]() noexcept { ++completions; };
+
+  bpstd::barrier<decltype(completion)> sut{2, completion};
+
+  auto thread = std::thread{[&]{
+    sut.arrive_and_drop();
+  }};
+  sut.arrive_and_wait();
+  thread.join();
+
+  // Only this thread is expected in later phases
+  sut.arrive_and_wait();
+  sut.arrive_and_wait();
+
+  SECTION("Removes the thread from later phases")
+  {
+    REQUIRE( completions == 3 );
+  }
+}
@@ -0,0 +1,322 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#include <bpstd/bit.hpp>
+
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <limits>
+
+// MSVC 2015 seems to emit an error that __forceinline'd functions may not be
+// __forceinline'd at the *end of the translation unit* using it, for some
+// stupid reason.
+#if defined(_MSC_VER)
+# pragma warning(disable:4714)
+#endif
+
+namespace {
+
+  static_assert(bpstd::popcount(0xf0f0u) == 8, "");
+  static_assert(bpstd::countl_zero(std::uint16_t{1u}) == 15, "");
+  static_assert(bpstd::countr_zero(std::uint64_t{0u}) == 64, "");
+  static_assert(bpstd::bit_ceil(5u) == 8u, "");
+  static_assert(bpstd::rotl(std::uint8_t{0x81u}, 1) == 0x03u, "");
+  static_assert(bpstd::byteswap(std::uint32_t{0x01020304u}) == 0x04030201u, "");
+  static_assert(bpstd::endian::native == bpstd::endian::little ||
+                bpstd::endian::native == bpstd::endian::big, "");
+
+#if BPSTD_HAS_BUILTIN_BIT_CAST
+  static_assert(bpstd::bit_cast<std::uint64_t>(1.0) == 0x3ff0000000000000ull, "");
+#endif
+
+} // anonymous namespace
+
+//=============================================================================
+// non-member functions
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Casting
+//-----------------------------------------------------------------------------
+
+TEST_CASE("bit_cast<To>( const From& )", "[casting]")
+{
+  SECTION("Reinterprets the object representation")
+  {
+    REQUIRE( bpstd::bit_cast<std::uint32_t>(1.0f) == 0x3f800000u );
+    REQUIRE( bpstd::bit_cast<float>(0xc0000000u) == -2.0f );
+  }
+
+  SECTION("Round-trips through the other type")
+  {
+    const auto value = 0.1;
+
+    REQUIRE( bpstd::bit_cast<double>(bpstd::bit_cast<std::uint64_t>(value)) == value );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Byte Ordering
+//-----------------------------------------------------------------------------
+
+TEST_CASE("byteswap( T )", "[byte ordering]")
+{
+  SECTION("Value is a single byte")
+  {
+    SECTION("Returns the value unchanged")
+    {
+      REQUIRE( bpstd::byteswap(std::uint8_t{0xabu}) == 0xabu );
+    }
+  }
+
+  SECTION("Value is unsigned")
+  {
+    SECTION("Reverses the bytes")
+    {
+      REQUIRE( bpstd::byteswap(std::uint16_t{0x0102u}) == 0x0201u );
+      REQUIRE( bpstd::byteswap(std::uint32_t{0x01020304u}) == 0x04030201u );
+      REQUIRE( bpstd::byteswap(std::uint64_t{0x0102030405060708ull}) == 0x0807060504030201ull );
+    }
+  }
+
+  SECTION("Value is signed")
+  {
+    SECTION("Reverses the bytes of the representation")
+    {
+      REQUIRE( bpstd::byteswap(std::int16_t{-2}) == std::int16_t{-257} );
+      REQUIRE( bpstd::byteswap(std::int32_t{0x7f}) == std::int32_t{0x7f000000} );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Integral Powers of 2
+//-----------------------------------------------------------------------------
+
+TEST_CASE("has_single_bit( T )", "[powers of 2]")
+{
+  SECTION("Value is a power of two")
+  {
+    SECTION("Returns true")
+    {
+      REQUIRE( bpstd::has_single_bit(1u) );
+      REQUIRE( bpstd::has_single_bit(std::uint64_t{1u} << 63u) );
+    }
+  }
+
+  SECTION("Value is not a power of two")
+  {
+    SECTION("Returns false")
+    {
+      REQUIRE_FALSE( bpstd::has_single_bit(0u) );
+      REQUIRE_FALSE( bpstd::has_single_bit(6u) );
+      REQUIRE_FALSE( bpstd::has_single_bit(std::uint8_t{0xffu}) );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("bit_ceil( T )", "[powers of 2]")
+{
+  SECTION("Returns the smallest power of two not less than the value")
+  {
+    REQUIRE( bpstd::bit_ceil(0u) == 1u );
+    REQUIRE( bpstd::bit_ceil(1u) == 1u );
+    REQUIRE( bpstd::bit_ceil(3u) == 4u );
+    REQUIRE( bpstd::bit_ceil(4u) == 4u );
+    REQUIRE( bpstd::bit_ceil(std::uint8_t{100u}) == 128u );
+    REQUIRE( bpstd::bit_ceil(std::uint64_t{0x100000001ull}) == 0x200000000ull );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("bit_floor( T )", "[powers of 2]")
+{
+  SECTION("Returns the largest power of two not greater than the value")
+  {
+    REQUIRE( bpstd::bit_floor(0u) == 0u );
+    REQUIRE( bpstd::bit_floor(1u) == 1u );
+    REQUIRE( bpstd::bit_floor(7u) == 4u );
+    REQUIRE( bpstd::bit_floor(std::uint16_t{0xffffu}) == 0x8000u );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("bit_width( T )", "[powers of 2]")
+{
+  SECTION("Returns the number of bits needed to represent the value")
+  {
+    REQUIRE( bpstd::bit_width(0u) == 0 );
+    REQUIRE( bpstd::bit_width(1u) == 1 );
+    REQUIRE( bpstd::bit_width(8u) == 4 );
+    REQUIRE( bpstd::bit_width(std::numeric_limits<std::uint64_t>::max()) == 64 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Rotating
+//-----------------------------------------------------------------------------
+
+TEST_CASE("rotl( T, int )", "[rotating]")
+{
+  const auto value = std::uint8_t{0x1du};
+
+  SECTION("Shift is positive")
+  {
+    SECTION("Rotates left")
+    {
+      REQUIRE( bpstd::rotl(value, 0) == 0x1du );
+      REQUIRE( bpstd::rotl(value, 1) == 0x3au );
+      REQUIRE( bpstd::rotl(value, 4) == 0xd1u );
+      REQUIRE( bpstd::rotl(value, 9) == 0x3au );
+    }
+  }
+
+  SECTION("Shift is negative")
+  {
+    SECTION("Rotates right")
+    {
+      REQUIRE( bpstd::rotl(value, -1) == 0x8eu );
+      REQUIRE( bpstd::rotl(value, -9) == 0x8eu );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("rotr( T, int )", "[rotating]")
+{
+  const auto value = std::uint32_t{0x1du};
+
+  SECTION("Shift is positive")
+  {
+    SECTION("Rotates right")
+    {
+      REQUIRE( bpstd::rotr(value, 0) == 0x1du );
+      REQUIRE( bpstd::rotr(value, 1) == 0x8000000eu );
+      REQUIRE( bpstd::rotr(value, 33) == 0x8000000eu );
+    }
+  }
+
+  SECTION("Shift is negative")
+  {
+    SECTION("Rotates left")
+    {
+      REQUIRE( bpstd::rotr(value, -1) == 0x3au );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Counting
+//-----------------------------------------------------------------------------
+
+TEST_CASE("countl_zero( T )", "[counting]")
+{
+  SECTION("Counts leading zeros relative to the width of the type")
+  {
+    REQUIRE( bpstd::countl_zero(std::uint8_t{0u}) == 8 );
+    REQUIRE( bpstd::countl_zero(std::uint8_t{0x10u}) == 3 );
+    REQUIRE( bpstd::countl_zero(std::uint16_t{1u}) == 15 );
+    REQUIRE( bpstd::countl_zero(std::uint32_t{0x80000000u}) == 0 );
+    REQUIRE( bpstd::countl_zero(std::uint64_t{0u}) == 64 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("countl_one( T )", "[counting]")
+{
+  SECTION("Counts leading ones relative to the width of the type")
+  {
+    REQUIRE( bpstd::countl_one(std::uint8_t{0xf0u}) == 4 );
+    REQUIRE( bpstd::countl_one(std::uint16_t{0xffffu}) == 16 );
+    REQUIRE( bpstd::countl_one(0u) == 0 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("countr_zero( T )", "[counting]")
+{
+  SECTION("Counts trailing zeros")
+  {
+    REQUIRE( bpstd::countr_zero(std::uint8_t{0u}) == 8 );
+    REQUIRE( bpstd::countr_zero(std::uint32_t{0u}) == 32 );
+    REQUIRE( bpstd::countr_zero(0x100u) == 8 );
+    REQUIRE( bpstd::countr_zero(std::uint64_t{1u} << 63u) == 63 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("countr_one( T )", "[counting]")
+{
+  SECTION("Counts trailing ones")
+  {
+    REQUIRE( bpstd::countr_one(std::uint8_t{0xffu}) == 8 );
+    REQUIRE( bpstd::countr_one(0x17u) == 3 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("popcount( T )", "[counting]")
+{
+  SECTION("Counts the set bits")
+  {
+    REQUIRE( bpstd::popcount(std::uint8_t{0u}) == 0 );
+    REQUIRE( bpstd::popcount(std::uint8_t{0xffu}) == 8 );
+    REQUIRE( bpstd::popcount(0x12345678u) == 13 );
+    REQUIRE( bpstd::popcount(std::numeric_limits<std::uint64_t>::max()) == 64 );
+  }
+}
+
+//=============================================================================
+// non-member functions : enum class : byte
+//=============================================================================
+
+TEST_CASE("bit operations on byte", "[byte]")
+{
+  const auto value = static_cast<bpstd::byte>(0x28);
+
+  SECTION("Operates on the byte as an unsigned char")
+  {
+    REQUIRE( bpstd::popcount(value) == 2 );
+    REQUIRE( bpstd::countl_zero(value) == 2 );
+    REQUIRE( bpstd::countr_zero(value) == 3 );
+    REQUIRE( bpstd::countl_one(~value) == 2 );
+    REQUIRE( bpstd::countr_one(~value) == 3 );
+    REQUIRE( bpstd::bit_width(value) == 6 );
+    REQUIRE( bpstd::bit_floor(value) == static_cast<bpstd::byte>(0x20) );
+    REQUIRE( bpstd::bit_ceil(value) == static_cast<bpstd::byte>(0x40) );
+    REQUIRE_FALSE( bpstd::has_single_bit(value) );
+    REQUIRE( bpstd::rotl(value, 3) == static_cast<bpstd::byte>(0x41) );
+    REQUIRE( bpstd::rotr(value, 4) == static_cast<bpstd::byte>(0x82) );
+  }
+}
@@ -0,0 +1,411 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#include <bpstd/byte_io.hpp>
+
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <limits>
+
+// MSVC 2015 seems to emit an error that __forceinline'd functions may not be
+// __forceinline'd at the *end of the translation unit* using it, for some
+// stupid reason.
+#if defined(_MSC_VER)
+# pragma warning(disable:4714)
+#endif
+
+namespace {
+
+  template <std::size_t N>
+  bpstd::span<const bpstd::byte> as_byte_span(const unsigned char (&bytes)[N])
+  {
+    return bpstd::as_bytes(bpstd::span<const unsigned char>{bytes});
+  }
+
+  template <typename T>
+  void check_varint_round_trip(T value)
+  {
+    bpstd::byte buffer[bpstd::max_varint_size<T>::value] = {};
+    auto writer = bpstd::byte_writer{buffer};
+    REQUIRE( writer.write_varint(value) );
+
+    auto reader = bpstd::byte_reader{writer.written_bytes()};
+    auto result = T{};
+    REQUIRE( reader.read_varint(result) );
+    REQUIRE( result == value );
+    REQUIRE( reader.empty() );
+  }
+
+} // anonymous namespace
+
+//=============================================================================
+// class : byte_reader
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Fixed-width Reads
+//-----------------------------------------------------------------------------
+
+TEST_CASE("byte_reader::read( T&, endian )", "[read]")
+{
+  const unsigned char bytes[] = {0x01, 0x02, 0x03, 0x04, 0x05};
+  auto sut = bpstd::byte_reader{as_byte_span(bytes)};
+
+  SECTION("Enough bytes remain")
+  {
+    auto value = std::uint32_t{};
+
+    SECTION("Reads little-endian values")
+    {
+      REQUIRE( sut.read(value, bpstd::endian::little) );
+      REQUIRE( value == 0x04030201u );
+      REQUIRE( sut.position() == 4u );
+      REQUIRE( sut.remaining() == 1u );
+    }
+
+    SECTION("Reads big-endian values")
+    {
+      REQUIRE( sut.read(value, bpstd::endian::big) );
+      REQUIRE( value == 0x01020304u );
+    }
+  }
+
+  SECTION("Too few bytes remain")
+  {
+    auto value = std::uint64_t{42u};
+
+    SECTION("Returns false without consuming any bytes")
+    {
+      REQUIRE_FALSE( sut.read(value, bpstd::endian::little) );
+      REQUIRE( value == 42u );
+      REQUIRE( sut.position() == 0u );
+    }
+  }
+
+  SECTION("Value is floating-point")
+  {
+    const unsigned char float_bytes[] = {0x3f, 0xc0, 0x00, 0x00};
+    auto reader = bpstd::byte_reader{as_byte_span(float_bytes)};
+    auto value = 0.0f;
+
+    SECTION("Reads the IEEE-754 representation")
+    {
+      REQUIRE( reader.read(value, bpstd::endian::big) );
+      REQUIRE( value == 1.5f );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("byte_reader::read( span<T>, endian )", "[read]")
+{
+  const unsigned char bytes[] = {0x00, 0x01, 0x00, 0x02, 0x00, 0x03};
+  auto sut = bpstd::byte_reader{as_byte_span(bytes)};
+
+  SECTION("Enough bytes remain")
+  {
+    std::uint16_t values[3] = {};
+
+    SECTION("Reads every value")
+    {
+      REQUIRE( sut.read(bpstd::span<std::uint16_t>{values}, bpstd::endian::big) );
+      REQUIRE( values[0] == 1u );
+      REQUIRE( values[1] == 2u );
+      REQUIRE( values[2] == 3u );
+      REQUIRE( sut.empty() );
+    }
+  }
+
+  SECTION("Too few bytes remain")
+  {
+    std::uint16_t values[4] = {};
+
+    SECTION("Returns false without consuming any bytes")
+    {
+      REQUIRE_FALSE( sut.read(bpstd::span<std::uint16_t>{values}, bpstd::endian::big) );
+      REQUIRE( sut.position() == 0u );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("byte_reader::read_unchecked<T>( endian )", "[read]")
+{
+  const unsigned char bytes[] = {0xff, 0xfe, 0x12, 0x34, 0x56, 0x78};
+  auto sut = bpstd::byte_reader{as_byte_span(bytes)};
+
+  SECTION("Reads consecutive values")
+  {
+    REQUIRE( sut.can_read(6u) );
+    REQUIRE( sut.read_unchecked<std::int16_t>(bpstd::endian::big) == -2 );
+    REQUIRE( sut.read_unchecked<std::uint32_t>(bpstd::endian::little) == 0x78563412u );
+    REQUIRE( sut.empty() );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Variable-length Reads
+//-----------------------------------------------------------------------------
+
+TEST_CASE("byte_reader::read_varint( T& )", "[read]")
+{
+  SECTION("Input is unsigned LEB128")
+  {
+    const unsigned char bytes[] = {0xe5, 0x8e, 0x26};
+    auto sut = bpstd::byte_reader{as_byte_span(bytes)};
+    auto value = std::uint32_t{};
+
+    SECTION("Decodes the value")
+    {
+      REQUIRE( sut.read_varint(value) );
+      REQUIRE( value == 624485u );
+      REQUIRE( sut.empty() );
+    }
+  }
+
+  SECTION("Input is signed LEB128")
+  {
+    const unsigned char bytes[] = {0xc0, 0xbb, 0x78};
+    auto sut = bpstd::byte_reader{as_byte_span(bytes)};
+    auto value = std::int32_t{};
+
+    SECTION("Decodes the sign-extended value")
+    {
+      REQUIRE( sut.read_varint(value) );
+      REQUIRE( value == -123456 );
+    }
+  }
+
+  SECTION("Input is truncated")
+  {
+    const unsigned char bytes[] = {0x80, 0x80};
+    auto sut = bpstd::byte_reader{as_byte_span(bytes)};
+    auto value = std::uint32_t{7u};
+
+    SECTION("Returns false without consuming any bytes")
+    {
+      REQUIRE_FALSE( sut.read_varint(value) );
+      REQUIRE( value == 7u );
+      REQUIRE( sut.position() == 0u );
+    }
+  }
+
+  SECTION("Input is too large for the type")
+  {
+    SECTION("Returns false")
+    {
+      // 2^32, and 2^63
+      const unsigned char u32_bytes[] = {0x80, 0x80, 0x80, 0x80, 0x10};
+      const unsigned char i64_bytes[] = {0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01};
+      // 128 and -129
+      const unsigned char i8_large[] = {0x80, 0x01};
+      const unsigned char i8_small[] = {0xff, 0x7e};
+
+      auto u32 = std::uint32_t{};
+      auto i64 = std::int64_t{};
+      auto i8 = std::int8_t{};
+
+      REQUIRE_FALSE( bpstd::byte_reader{as_byte_span(u32_bytes)}.read_varint(u32) );
+      REQUIRE_FALSE( bpstd::byte_reader{as_byte_span(i64_bytes)}.read_varint(i64) );
+      REQUIRE_FALSE( bpstd::byte_reader{as_byte_span(i8_large)}.read_varint(i8) );
+      REQUIRE_FALSE( bpstd::byte_reader{as_byte_span(i8_small)}.read_varint(i8) );
+    }
+  }
+
+  SECTION("Encoding is longer than the type allows")
+  {
+    const unsigned char bytes[] = {0x80, 0x80, 0x80, 0x80, 0x80, 0x00};
+    auto sut = bpstd::byte_reader{as_byte_span(bytes)};
+    auto value = std::uint32_t{};
+
+    SECTION("Returns false")
+    {
+      REQUIRE_FALSE( sut.read_varint(value) );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Byte Reads
+//-----------------------------------------------------------------------------
+
+TEST_CASE("byte_reader::read_bytes( size_type, span<const byte>& )", "[read]")
+{
+  const unsigned char bytes[] = {0x01, 0x02, 0x03};
+  const auto input = as_byte_span(bytes);
+  auto sut = bpstd::byte_reader{input};
+
+  SECTION("Enough bytes remain")
+  {
+    auto result = bpstd::span<const bpstd::byte>{};
+
+    SECTION("Views the bytes in place")
+    {
+      REQUIRE( sut.skip(1u) );
+      REQUIRE( sut.read_bytes(2u, result) );
+      REQUIRE( result.data() == input.data() + 1 );
+      REQUIRE( result.size() == 2u );
+    }
+  }
+
+  SECTION("Too few bytes remain")
+  {
+    auto result = bpstd::span<const bpstd::byte>{};
+
+    SECTION("Returns false")
+    {
+      REQUIRE_FALSE( sut.read_bytes(4u, result) );
+      REQUIRE( sut.position() == 0u );
+    }
+  }
+}
+
+//=============================================================================
+// class : byte_writer
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Fixed-width Writes
+//-----------------------------------------------------------------------------
+
+TEST_CASE("byte_writer::write( T, endian )", "[write]")
+{
+  bpstd::byte buffer[6] = {};
+  auto sut = bpstd::byte_writer{buffer};
+
+  SECTION("Enough room remains")
+  {
+    SECTION("Writes values in the given byte order")
+    {
+      REQUIRE( sut.write(std::uint16_t{0x0102u}, bpstd::endian::big) );
+      REQUIRE( sut.write(std::uint32_t{0x03040506u}, bpstd::endian::little) );
+
+      const auto written = sut.written_bytes();
+      REQUIRE( written.size() == 6u );
+      REQUIRE( written[0] == static_cast<bpstd::byte>(0x01) );
+      REQUIRE( written[1] == static_cast<bpstd::byte>(0x02) );
+      REQUIRE( written[2] == static_cast<bpstd::byte>(0x06) );
+      REQUIRE( written[5] == static_cast<bpstd::byte>(0x03) );
+    }
+  }
+
+  SECTION("Too little room remains")
+  {
+    SECTION("Returns false without writing")
+    {
+      REQUIRE_FALSE( sut.write(std::uint64_t{1u}, bpstd::endian::big) );
+      REQUIRE( sut.position() == 0u );
+      REQUIRE( buffer[0] == static_cast<bpstd::byte>(0) );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("byte_writer::write( span<T>, endian )", "[write]")
+{
+  bpstd::byte buffer[16] = {};
+  auto sut = bpstd::byte_writer{buffer};
+
+  SECTION("Values round-trip through byte_reader")
+  {
+    const double values[] = {0.1, -2.5};
+    REQUIRE( sut.write(bpstd::span<const double>{values}, bpstd::endian::big) );
+
+    double result[2] = {};
+    auto reader = bpstd::byte_reader{sut.written_bytes()};
+    REQUIRE( reader.read(bpstd::span<double>{result}, bpstd::endian::big) );
+    REQUIRE( result[0] == 0.1 );
+    REQUIRE( result[1] == -2.5 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Variable-length Writes
+//-----------------------------------------------------------------------------
+
+TEST_CASE("byte_writer::write_varint( T )", "[write]")
+{
+  SECTION("Value is unsigned")
+  {
+    bpstd::byte buffer[4] = {};
+    auto sut = bpstd::byte_writer{buffer};
+
+    SECTION("Writes unsigned LEB128")
+    {
+      REQUIRE( sut.write_varint(624485u) );
+      REQUIRE( sut.position() == 3u );
+      REQUIRE( buffer[0] == static_cast<bpstd::byte>(0xe5) );
+      REQUIRE( buffer[1] == static_cast<bpstd::byte>(0x8e) );
+      REQUIRE( buffer[2] == static_cast<bpstd::byte>(0x26) );
+    }
+  }
+
+  SECTION("Value is signed")
+  {
+    bpstd::byte buffer[4] = {};
+    auto sut = bpstd::byte_writer{buffer};
+
+    SECTION("Writes signed LEB128")
+    {
+      REQUIRE( sut.write_varint(-123456) );
+      REQUIRE( sut.position() == 3u );
+      REQUIRE( buffer[0] == static_cast<bpstd::byte>(0xc0) );
+      REQUIRE( buffer[1] == static_cast<bpstd::byte>(0xbb) );
+      REQUIRE( buffer[2] == static_cast<bpstd::byte>(0x78) );
+    }
+  }
+
+  SECTION("Too little room remains")
+  {
+    bpstd::byte buffer[2] = {};
+    auto sut = bpstd::byte_writer{buffer};
+
+    SECTION("Returns false without writing")
+    {
+      REQUIRE_FALSE( sut.write_varint(std::uint32_t{1u} << 14u) );
+      REQUIRE( sut.position() == 0u );
+    }
+  }
+
+  SECTION("Values round-trip through byte_reader")
+  {
+    using u64 = std::numeric_limits<std::uint64_t>;
+    using i64 = std::numeric_limits<std::int64_t>;
+
+    check_varint_round_trip(std::uint8_t{255u});
+    check_varint_round_trip(std::int8_t{-128});
+    check_varint_round_trip(std::int8_t{63});
+    check_varint_round_trip(std::int8_t{64});
+    check_varint_round_trip(std::int8_t{-65});
+    check_varint_round_trip(std::uint32_t{0u});
+    check_varint_round_trip(u64::max());
+    check_varint_round_trip(i64::max());
+    check_varint_round_trip(i64::min());
+    check_varint_round_trip(std::int64_t{-1});
+  }
+}
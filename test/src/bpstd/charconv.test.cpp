@@ -0,0 +1,678 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#include <bpstd/charconv.hpp>
+
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <system_error>
+
+// MSVC 2015 seems to emit an error that __forceinline'd functions may not be
+// __forceinline'd at the *end of the translation unit* using it, for some
+// stupid reason.
+#if defined(_MSC_VER)
+# pragma warning(disable:4714)
+#endif
+
+namespace {
+
+  template <typename T>
+  std::string format(T value, int base = 10)
+  {
+    char buffer[80] = {};
+    const auto result = bpstd::to_chars(buffer, buffer + sizeof(buffer), value, base);
+    REQUIRE( result.ec == std::errc{} );
+    return std::string(buffer, result.ptr);
+  }
+
+  template <typename T>
+  void require_round_trip(T value, int base)
+  {
+    const auto str = format(value, base);
+
+    T parsed{};
+    const auto result = bpstd::from_chars(str.data(), str.data() + str.size(), parsed, base);
+
+    REQUIRE( result.ec == std::errc{} );
+    REQUIRE( result.ptr == str.data() + str.size() );
+    REQUIRE( parsed == value );
+  }
+
+  template <typename T>
+  void require_round_trip_limits()
+  {
+    for (auto base = 2; base <= 36; ++base) {
+      require_round_trip((std::numeric_limits<T>::min)(), base);
+      require_round_trip((std::numeric_limits<T>::max)(), base);
+      require_round_trip(T{0}, base);
+      require_round_trip(T{1}, base);
+    }
+  }
+
+} // anonymous namespace
+
+#if defined(__cplusplus) && __cplusplus >= 201402L
+namespace {
+  constexpr int parse_int(bpstd::string_view str)
+  {
+    auto result = 0;
+    bpstd::from_chars(str, result);
+    return result;
+  }
+
+  static_assert(parse_int("-1234") == -1234, "");
+} // anonymous namespace
+#endif
+
+//=============================================================================
+// non-member functions : <charconv>
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Formatting
+//-----------------------------------------------------------------------------
+
+TEST_CASE("to_chars( char*, char*, T, int )", "[formatting]")
+{
+  SECTION("Base is 10")
+  {
+    SECTION("Formats zero")
+    {
+      REQUIRE( format(0) == "0" );
+    }
+
+    SECTION("Formats every digit count")
+    {
+      auto expected = std::string{"1"};
+      auto value = std::uint64_t{1u};
+      for (auto i = 0; i < 19; ++i) {
+        REQUIRE( format(value) == expected );
+        REQUIRE( format(value * 9u + (value - 1u)) == std::string(expected.size(), '9') );
+        value *= 10u;
+        expected += '0';
+      }
+    }
+
+    SECTION("Formats negative values")
+    {
+      REQUIRE( format(-42) == "-42" );
+    }
+
+    SECTION("Formats the minimum signed values")
+    {
+      REQUIRE( format(std::int8_t{-128}) == "-128" );
+      REQUIRE( format((std::numeric_limits<std::int64_t>::min)()) == "-9223372036854775808" );
+    }
+
+    SECTION("Formats the maximum unsigned value")
+    {
+      REQUIRE( format((std::numeric_limits<std::uint64_t>::max)()) == "18446744073709551615" );
+    }
+  }
+
+  SECTION("Base is a power of two")
+  {
+    SECTION("Formats with lowercase digits")
+    {
+      REQUIRE( format(0xdeadbeefu, 16) == "deadbeef" );
+      REQUIRE( format(-255, 16) == "-ff" );
+      REQUIRE( format(5, 2) == "101" );
+      REQUIRE( format(0777, 8) == "777" );
+    }
+  }
+
+  SECTION("Base is not a power of two")
+  {
+    SECTION("Formats with lowercase digits")
+    {
+      REQUIRE( format(35, 36) == "z" );
+      REQUIRE( format(36, 36) == "10" );
+      REQUIRE( format(-8, 3) == "-22" );
+    }
+  }
+
+  SECTION("Output range is too small")
+  {
+    char buffer[4] = {'x', 'x', 'x', 'x'};
+
+    SECTION("Returns value_too_large with the end of the range")
+    {
+      const auto result = bpstd::to_chars(buffer, buffer + 4, 12345);
+
+      REQUIRE( result.ec == std::errc::value_too_large );
+      REQUIRE( result.ptr == buffer + 4 );
+    }
+
+    SECTION("Returns value_too_large for a lone sign")
+    {
+      const auto result = bpstd::to_chars(buffer, buffer, -1);
+
+      REQUIRE( result.ec == std::errc::value_too_large );
+      REQUIRE( result.ptr == buffer );
+    }
+  }
+
+  SECTION("Output range is exactly large enough")
+  {
+    char buffer[4] = {};
+    const auto result = bpstd::to_chars(buffer, buffer + 4, -123);
+
+    SECTION("Fills the range")
+    {
+      REQUIRE( result.ec == std::errc{} );
+      REQUIRE( result.ptr == buffer + 4 );
+      REQUIRE( std::string(buffer, 4) == "-123" );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("to_chars( span<char>, T, int )", "[formatting]")
+{
+  char buffer[8] = {};
+  const auto result = bpstd::to_chars(bpstd::span<char>{buffer}, 255u, 16);
+
+  SECTION("Formats into the buffer")
+  {
+    REQUIRE( result.ec == std::errc{} );
+    REQUIRE( std::string(buffer, result.ptr) == "ff" );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Parsing
+//-----------------------------------------------------------------------------
+
+TEST_CASE("from_chars( const char*, const char*, T&, int )", "[parsing]")
+{
+  SECTION("Input is a valid number")
+  {
+    const auto input = std::string{"-1234xyz"};
+    auto value = 0;
+    const auto result = bpstd::from_chars(input.data(), input.data() + input.size(), value);
+
+    SECTION("Parses up to the first non-digit")
+    {
+      REQUIRE( result.ec == std::errc{} );
+      REQUIRE( result.ptr == input.data() + 5 );
+      REQUIRE( value == -1234 );
+    }
+  }
+
+  SECTION("Input uses letters for digits")
+  {
+    auto value = 0u;
+
+    SECTION("Accepts either case")
+    {
+      REQUIRE( bpstd::from_chars("fF", value, 16).ec == std::errc{} );
+      REQUIRE( value == 255u );
+      REQUIRE( bpstd::from_chars("Zz", value, 36).ec == std::errc{} );
+      REQUIRE( value == 35u * 36u + 35u );
+    }
+
+    SECTION("Stops at digits not valid in the base")
+    {
+      const auto input = bpstd::string_view{"129"};
+      const auto result = bpstd::from_chars(input, value, 8);
+
+      REQUIRE( result.ptr == input.data() + 2 );
+      REQUIRE( value == 10u );
+    }
+  }
+
+  SECTION("Input has no digits")
+  {
+    const auto input = bpstd::string_view{"+12"};
+    auto value = 7;
+    const auto result = bpstd::from_chars(input, value);
+
+    SECTION("Returns invalid_argument and leaves value unmodified")
+    {
+      REQUIRE( result.ec == std::errc::invalid_argument );
+      REQUIRE( result.ptr == input.data() );
+      REQUIRE( value == 7 );
+    }
+  }
+
+  SECTION("Input is only a minus sign")
+  {
+    const auto input = bpstd::string_view{"-"};
+    auto value = 7;
+    const auto result = bpstd::from_chars(input, value);
+
+    SECTION("Returns invalid_argument pointing to the start")
+    {
+      REQUIRE( result.ec == std::errc::invalid_argument );
+      REQUIRE( result.ptr == input.data() );
+    }
+  }
+
+  SECTION("Input is negative for an unsigned type")
+  {
+    auto value = 7u;
+    const auto result = bpstd::from_chars("-1", value);
+
+    SECTION("Returns invalid_argument")
+    {
+      REQUIRE( result.ec == std::errc::invalid_argument );
+      REQUIRE( value == 7u );
+    }
+  }
+
+  SECTION("Input is out of range")
+  {
+    const auto input = bpstd::string_view{"300,"};
+    auto value = std::uint8_t{7u};
+    const auto result = bpstd::from_chars(input, value);
+
+    SECTION("Returns result_out_of_range past all digits")
+    {
+      REQUIRE( result.ec == std::errc::result_out_of_range );
+      REQUIRE( result.ptr == input.data() + 3 );
+      REQUIRE( value == 7u );
+    }
+  }
+
+  SECTION("Input overflows the widest type")
+  {
+    auto value = std::uint64_t{7u};
+
+    SECTION("Returns result_out_of_range")
+    {
+      REQUIRE( bpstd::from_chars("18446744073709551616", value).ec == std::errc::result_out_of_range );
+      REQUIRE( bpstd::from_chars("99999999999999999999999", value).ec == std::errc::result_out_of_range );
+      REQUIRE( bpstd::from_chars("10000000000000000", value, 16).ec == std::errc::result_out_of_range );
+      REQUIRE( value == 7u );
+    }
+  }
+
+  SECTION("Input has many leading zeros")
+  {
+    auto value = std::uint8_t{0u};
+    const auto result = bpstd::from_chars("0000000000000000000000000255", value);
+
+    SECTION("Parses the value")
+    {
+      REQUIRE( result.ec == std::errc{} );
+      REQUIRE( value == 255u );
+    }
+  }
+
+  SECTION("Input is the limits of the type")
+  {
+    SECTION("Round-trips in every base")
+    {
+      require_round_trip_limits<signed char>();
+      require_round_trip_limits<unsigned char>();
+      require_round_trip_limits<short>();
+      require_round_trip_limits<unsigned short>();
+      require_round_trip_limits<int>();
+      require_round_trip_limits<unsigned>();
+      require_round_trip_limits<long>();
+      require_round_trip_limits<unsigned long>();
+      require_round_trip_limits<long long>();
+      require_round_trip_limits<unsigned long long>();
+    }
+
+    SECTION("One past the limits is out of range")
+    {
+      auto value = std::int8_t{0};
+
+      REQUIRE( bpstd::from_chars("128", value).ec == std::errc::result_out_of_range );
+      REQUIRE( bpstd::from_chars("-129", value).ec == std::errc::result_out_of_range );
+      REQUIRE( bpstd::from_chars("-128", value).ec == std::errc{} );
+      REQUIRE( value == -128 );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Floating-point Formatting
+//-----------------------------------------------------------------------------
+
+namespace {
+
+  template <typename T>
+  std::string format_float(T value)
+  {
+    char buffer[400] = {};
+    const auto result = bpstd::to_chars(buffer, buffer + sizeof(buffer), value);
+    REQUIRE( result.ec == std::errc{} );
+    return std::string(buffer, result.ptr);
+  }
+
+  template <typename T>
+  std::string format_float(T value, bpstd::chars_format fmt)
+  {
+    char buffer[400] = {};
+    const auto result = bpstd::to_chars(buffer, buffer + sizeof(buffer), value, fmt);
+    REQUIRE( result.ec == std::errc{} );
+    return std::string(buffer, result.ptr);
+  }
+
+  template <typename T>
+  T parse_float(const std::string& str,
+                bpstd::chars_format fmt = bpstd::chars_format::general)
+  {
+    auto value = T{};
+    const auto result = bpstd::from_chars(str.data(), str.data() + str.size(), value, fmt);
+    REQUIRE( result.ec == std::errc{} );
+    REQUIRE( result.ptr == str.data() + str.size() );
+    return value;
+  }
+
+} // anonymous namespace
+
+TEST_CASE("to_chars( char*, char*, double )", "[formatting]")
+{
+  SECTION("Value has a short decimal representation")
+  {
+    SECTION("Formats the fewest digits that round-trip")
+    {
+      REQUIRE( format_float(0.1) == "0.1" );
+      REQUIRE( format_float(0.3) == "0.3" );
+      REQUIRE( format_float(1.5) == "1.5" );
+      REQUIRE( format_float(-2.25) == "-2.25" );
+      REQUIRE( format_float(5e-324) == "5e-324" );
+      REQUIRE( format_float(1.7976931348623157e308) == "1.7976931348623157e+308" );
+    }
+  }
+
+  SECTION("Fixed and scientific notation differ in length")
+  {
+    SECTION("Formats the shorter, preferring fixed")
+    {
+      REQUIRE( format_float(100.0) == "100" );
+      REQUIRE( format_float(1e-5) == "1e-05" );
+      REQUIRE( format_float(1e-4) == "1e-04" );
+      REQUIRE( format_float(0.001) == "0.001" );
+      REQUIRE( format_float(1e22) == "1e+22" );
+      REQUIRE( format_float(123456.0) == "123456" );
+    }
+  }
+
+  SECTION("Value is integral and larger than 2^53")
+  {
+    SECTION("Formats the exact value in fixed notation")
+    {
+      REQUIRE( format_float(123456789012345678901.0) == "123456789012345683968" );
+    }
+  }
+
+  SECTION("Value is zero, infinite, or NaN")
+  {
+    SECTION("Formats the value and its sign")
+    {
+      REQUIRE( format_float(0.0) == "0" );
+      REQUIRE( format_float(-0.0) == "-0" );
+      REQUIRE( format_float(std::numeric_limits<double>::infinity()) == "inf" );
+      REQUIRE( format_float(-std::numeric_limits<double>::infinity()) == "-inf" );
+      REQUIRE( format_float(std::numeric_limits<double>::quiet_NaN()) == "nan" );
+    }
+  }
+
+  SECTION("Output range is too small")
+  {
+    char buffer[4] = {};
+    const auto result = bpstd::to_chars(buffer, buffer + 4, 1.25e100);
+
+    SECTION("Returns value_too_large with the end of the range")
+    {
+      REQUIRE( result.ec == std::errc::value_too_large );
+      REQUIRE( result.ptr == buffer + 4 );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("to_chars( char*, char*, float )", "[formatting]")
+{
+  SECTION("Formats the fewest digits that round-trip as a float")
+  {
+    REQUIRE( format_float(0.1f) == "0.1" );
+    REQUIRE( format_float(3.4028235e38f) == "3.4028235e+38" );
+    REQUIRE( format_float(1e-45f) == "1e-45" );
+    REQUIRE( format_float(16777216.0f) == "16777216" );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("to_chars( char*, char*, double, chars_format )", "[formatting]")
+{
+  SECTION("Format is scientific")
+  {
+    SECTION("Formats with a two-digit exponent at least")
+    {
+      REQUIRE( format_float(100.0, bpstd::chars_format::scientific) == "1e+02" );
+      REQUIRE( format_float(0.0, bpstd::chars_format::scientific) == "0e+00" );
+      REQUIRE( format_float(1.5e-300, bpstd::chars_format::scientific) == "1.5e-300" );
+    }
+  }
+
+  SECTION("Format is fixed")
+  {
+    SECTION("Formats without an exponent")
+    {
+      REQUIRE( format_float(1e-5, bpstd::chars_format::fixed) == "0.00001" );
+      REQUIRE( format_float(1e22, bpstd::chars_format::fixed) == "10000000000000000000000" );
+      REQUIRE( format_float(1e23, bpstd::chars_format::fixed) == "99999999999999991611392" );
+      REQUIRE( format_float(12.5, bpstd::chars_format::fixed) == "12.5" );
+    }
+  }
+
+  SECTION("Format is general")
+  {
+    SECTION("Formats fixed when the exponent is in [-4, 6)")
+    {
+      REQUIRE( format_float(123456.0, bpstd::chars_format::general) == "123456" );
+      REQUIRE( format_float(1234567.0, bpstd::chars_format::general) == "1.234567e+06" );
+      REQUIRE( format_float(0.0001, bpstd::chars_format::general) == "0.0001" );
+      REQUIRE( format_float(0.00001234, bpstd::chars_format::general) == "1.234e-05" );
+    }
+  }
+
+  SECTION("Format is hex")
+  {
+    SECTION("Formats the significand in hex and the exponent in decimal")
+    {
+      REQUIRE( format_float(1.0, bpstd::chars_format::hex) == "1p+0" );
+      REQUIRE( format_float(-3.0, bpstd::chars_format::hex) == "-1.8p+1" );
+      REQUIRE( format_float(0.1, bpstd::chars_format::hex) == "1.999999999999ap-4" );
+      REQUIRE( format_float(5e-324, bpstd::chars_format::hex) == "0.0000000000001p-1022" );
+      REQUIRE( format_float(0.1f, bpstd::chars_format::hex) == "1.99999ap-4" );
+      REQUIRE( format_float(0.0, bpstd::chars_format::hex) == "0p+0" );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Floating-point Parsing
+//-----------------------------------------------------------------------------
+
+TEST_CASE("from_chars( const char*, const char*, double&, chars_format )", "[parsing]")
+{
+  SECTION("Input is a decimal number")
+  {
+    SECTION("Parses the correctly rounded value")
+    {
+      REQUIRE( parse_float<double>("0.1") == 0.1 );
+      REQUIRE( parse_float<double>("-1.5e3") == -1500.0 );
+      REQUIRE( parse_float<double>(".5") == 0.5 );
+      REQUIRE( parse_float<double>("5.") == 5.0 );
+      REQUIRE( parse_float<double>("1E+2") == 100.0 );
+      REQUIRE( parse_float<double>("4.9406564584124654e-324") == 5e-324 );
+      REQUIRE( parse_float<double>(std::string("17976931348623157") + std::string(292u, '0')) == 1.7976931348623157e308 );
+    }
+  }
+
+  SECTION("Input lies exactly halfway between two values")
+  {
+    SECTION("Rounds to even")
+    {
+      // 2^53 + 1 and 2^53 + 3
+      REQUIRE( parse_float<double>("9007199254740993") == 9007199254740992.0 );
+      REQUIRE( parse_float<double>("9007199254740995") == 9007199254740996.0 );
+    }
+
+    SECTION("Digits far beyond the halfway point break the tie")
+    {
+      REQUIRE( parse_float<double>("9007199254740993.00000000000000000000000000000000001") == 9007199254740994.0 );
+      REQUIRE( parse_float<double>("9007199254740992.99999999999999999999999999999999999") == 9007199254740992.0 );
+    }
+  }
+
+  SECTION("Input has a trailing exponent character")
+  {
+    const auto input = std::string{"1.5e"};
+    auto value = 0.0;
+    const auto result = bpstd::from_chars(input.data(), input.data() + input.size(), value);
+
+    SECTION("Does not consume the incomplete exponent")
+    {
+      REQUIRE( result.ec == std::errc{} );
+      REQUIRE( result.ptr == input.data() + 3 );
+      REQUIRE( value == 1.5 );
+    }
+  }
+
+  SECTION("Format is fixed")
+  {
+    const auto input = std::string{"2e3"};
+    auto value = 0.0;
+    const auto result = bpstd::from_chars(input.data(), input.data() + input.size(), value, bpstd::chars_format::fixed);
+
+    SECTION("Does not consume an exponent")
+    {
+      REQUIRE( result.ptr == input.data() + 1 );
+      REQUIRE( value == 2.0 );
+    }
+  }
+
+  SECTION("Format is scientific and there is no exponent")
+  {
+    const auto input = std::string{"2"};
+    auto value = 7.0;
+    const auto result = bpstd::from_chars(input.data(), input.data() + input.size(), value, bpstd::chars_format::scientific);
+
+    SECTION("Returns invalid_argument")
+    {
+      REQUIRE( result.ec == std::errc::invalid_argument );
+      REQUIRE( value == 7.0 );
+    }
+  }
+
+  SECTION("Format is hex")
+  {
+    SECTION("Parses hex digits and a binary exponent")
+    {
+      REQUIRE( parse_float<double>("1.8p1", bpstd::chars_format::hex) == 3.0 );
+      REQUIRE( parse_float<double>("-Ap-1", bpstd::chars_format::hex) == -5.0 );
+      REQUIRE( parse_float<double>("0.0000000000001p-1022", bpstd::chars_format::hex) == 5e-324 );
+    }
+  }
+
+  SECTION("Input is infinity or NaN")
+  {
+    SECTION("Parses the special value, ignoring case")
+    {
+      REQUIRE( parse_float<double>("-Infinity") == -std::numeric_limits<double>::infinity() );
+      REQUIRE( parse_float<double>("inf") == std::numeric_limits<double>::infinity() );
+
+      const auto nan = parse_float<double>("nan(123)");
+      REQUIRE( nan != nan );
+    }
+  }
+
+  SECTION("Input has no digits")
+  {
+    auto value = 7.0;
+
+    SECTION("Returns invalid_argument and leaves value unmodified")
+    {
+      REQUIRE( bpstd::from_chars(".e5", value).ec == std::errc::invalid_argument );
+      REQUIRE( bpstd::from_chars("-", value).ec == std::errc::invalid_argument );
+      REQUIRE( bpstd::from_chars("+1", value).ec == std::errc::invalid_argument );
+      REQUIRE( value == 7.0 );
+    }
+  }
+
+  SECTION("Input is out of range")
+  {
+    auto value = 7.0;
+
+    SECTION("Returns result_out_of_range and leaves value unmodified")
+    {
+      REQUIRE( bpstd::from_chars("1e400", value).ec == std::errc::result_out_of_range );
+      REQUIRE( bpstd::from_chars("-1e-400", value).ec == std::errc::result_out_of_range );
+      REQUIRE( value == 7.0 );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("from_chars( string_view, float&, chars_format )", "[parsing]")
+{
+  SECTION("Parses the value correctly rounded to a float")
+  {
+    auto value = 0.0f;
+    REQUIRE( bpstd::from_chars("0.1", value).ec == std::errc{} );
+    REQUIRE( value == 0.1f );
+    REQUIRE( bpstd::from_chars("3.4028235e38", value).ec == std::errc{} );
+    REQUIRE( value == 3.4028235e38f );
+    REQUIRE( bpstd::from_chars("3.5e38", value).ec == std::errc::result_out_of_range );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("to_chars/from_chars round-trip", "[formatting][parsing]")
+{
+  // Walk a spread of bit patterns across every exponent
+  auto bits = std::uint64_t{0x0123456789abcdefull};
+  for (auto i = 0; i < 20000; ++i) {
+    bits = bits * 6364136223846793005ull + 1442695040888963407ull;
+
+    auto value = 0.0;
+    const auto double_bits = bits & 0x7fefffffffffffffull;
+    std::memcpy(&value, &double_bits, sizeof(value));
+
+    const auto text = format_float(value);
+    REQUIRE( parse_float<double>(text) == value );
+
+    auto single = 0.0f;
+    const auto float_bits = static_cast<std::uint32_t>(bits >> 32u) & 0x7f7fffffu;
+    std::memcpy(&single, &float_bits, sizeof(single));
+
+    REQUIRE( parse_float<float>(format_float(single)) == single );
+  }
+}
@@ -0,0 +1,690 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#include <bpstd/chrono.hpp>
+
+#include <catch2/catch.hpp>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+// MSVC 2015 seems to emit an error that __forceinline'd functions may not be
+// __forceinline'd at the *end of the translation unit* using it, for some
+// stupid reason.
+#if defined(_MSC_VER)
+# pragma warning(disable:4714)
+#endif
+
+namespace {
+
+  struct recording_sink
+  {
+    int calls;
+    bpstd::chrono::tsc_clock::duration last;
+
+    void operator()(bpstd::chrono::tsc_clock::duration d)
+    {
+      ++calls;
+      last = d;
+    }
+  };
+
+  template <typename Duration>
+  std::string format(bpstd::chrono::sys_time<Duration> tp)
+  {
+    char buffer[64];
+    const auto result = bpstd::chrono::format_iso8601(buffer, tp);
+
+    return std::string{result.data(), result.size()};
+  }
+
+  bpstd::chrono::year_month_day make_date(int y, unsigned m, unsigned d)
+  {
+    return bpstd::chrono::year_month_day{
+      bpstd::chrono::year{y},
+      bpstd::chrono::month{m},
+      bpstd::chrono::day{d}
+    };
+  }
+
+} // anonymous namespace
+
+//==============================================================================
+// Static Tests
+//==============================================================================
+
+static_assert(
+  bpstd::chrono::tsc_clock::is_steady,
+  "tsc_clock must be usable wherever a steady clock is required"
+);
+static_assert(
+  std::is_same<bpstd::chrono::tsc_clock::duration,bpstd::chrono::nanoseconds>::value,
+  "tsc_clock measures in nanoseconds"
+);
+
+static_assert(
+  bpstd::chrono::floor<std::chrono::seconds>(std::chrono::milliseconds{-1500}).count() == -2,
+  "floor is usable in constant expressions"
+);
+static_assert(
+  bpstd::chrono::ceil<std::chrono::seconds>(std::chrono::milliseconds{-1500}).count() == -1,
+  "ceil is usable in constant expressions"
+);
+static_assert(
+  bpstd::chrono::round<std::chrono::seconds>(std::chrono::milliseconds{2500}).count() == 2,
+  "round is usable in constant expressions"
+);
+static_assert(
+  bpstd::chrono::abs(std::chrono::milliseconds{-3}).count() == 3,
+  "abs is usable in constant expressions"
+);
+
+static_assert(
+  bpstd::chrono::year_month_day{
+    bpstd::chrono::year{2000},
+    bpstd::chrono::month{2},
+    bpstd::chrono::day{29}
+  }.ok(),
+  "year_month_day::ok() is usable in constant expressions"
+);
+
+//=============================================================================
+// non-member functions : rounding
+//=============================================================================
+
+TEST_CASE("floor<To>( const duration<Rep,Period>& )", "[rounding]")
+{
+  using std::chrono::milliseconds;
+  using std::chrono::seconds;
+
+  SECTION("Duration is positive")
+  {
+    REQUIRE( bpstd::chrono::floor<seconds>(milliseconds{1999}) == seconds{1} );
+  }
+  SECTION("Duration is negative")
+  {
+    REQUIRE( bpstd::chrono::floor<seconds>(milliseconds{-1}) == seconds{-1} );
+    REQUIRE( bpstd::chrono::floor<seconds>(milliseconds{-1000}) == seconds{-1} );
+  }
+  SECTION("Duration is an exact multiple")
+  {
+    REQUIRE( bpstd::chrono::floor<seconds>(milliseconds{3000}) == seconds{3} );
+  }
+  SECTION("Duration is larger than a double can represent exactly")
+  {
+    const auto d = std::chrono::nanoseconds{9007199254740993};
+
+    REQUIRE( bpstd::chrono::floor<std::chrono::microseconds>(d).count() == 9007199254740 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("ceil<To>( const duration<Rep,Period>& )", "[rounding]")
+{
+  using std::chrono::milliseconds;
+  using std::chrono::seconds;
+
+  SECTION("Duration is positive")
+  {
+    REQUIRE( bpstd::chrono::ceil<seconds>(milliseconds{1001}) == seconds{2} );
+  }
+  SECTION("Duration is negative")
+  {
+    REQUIRE( bpstd::chrono::ceil<seconds>(milliseconds{-1999}) == seconds{-1} );
+  }
+  SECTION("Duration is an exact multiple")
+  {
+    REQUIRE( bpstd::chrono::ceil<seconds>(milliseconds{-2000}) == seconds{-2} );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("round<To>( const duration<Rep,Period>& )", "[rounding]")
+{
+  using std::chrono::milliseconds;
+  using std::chrono::seconds;
+
+  SECTION("Duration is nearer the lower multiple")
+  {
+    REQUIRE( bpstd::chrono::round<seconds>(milliseconds{1499}) == seconds{1} );
+    REQUIRE( bpstd::chrono::round<seconds>(milliseconds{-1501}) == seconds{-2} );
+  }
+  SECTION("Duration is nearer the upper multiple")
+  {
+    REQUIRE( bpstd::chrono::round<seconds>(milliseconds{1501}) == seconds{2} );
+    REQUIRE( bpstd::chrono::round<seconds>(milliseconds{-1499}) == seconds{-1} );
+  }
+  SECTION("Duration is halfway")
+  {
+    SECTION("Rounds to even")
+    {
+      REQUIRE( bpstd::chrono::round<seconds>(milliseconds{1500}) == seconds{2} );
+      REQUIRE( bpstd::chrono::round<seconds>(milliseconds{2500}) == seconds{2} );
+      REQUIRE( bpstd::chrono::round<seconds>(milliseconds{-2500}) == seconds{-2} );
+      REQUIRE( bpstd::chrono::round<seconds>(milliseconds{-1500}) == seconds{-2} );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("abs( duration<Rep,Period> )", "[rounding]")
+{
+  using std::chrono::milliseconds;
+
+  REQUIRE( bpstd::chrono::abs(milliseconds{-5}) == milliseconds{5} );
+  REQUIRE( bpstd::chrono::abs(milliseconds{5}) == milliseconds{5} );
+  REQUIRE( bpstd::chrono::abs(milliseconds{0}) == milliseconds{0} );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("floor<To>( const time_point<Clock,Duration>& )", "[rounding]")
+{
+  using std::chrono::minutes;
+  using std::chrono::seconds;
+
+  SECTION("Time point is within a minute")
+  {
+    const auto tp = bpstd::chrono::sys_seconds{seconds{3599}};
+    const auto result = bpstd::chrono::floor<minutes>(tp);
+
+    SECTION("Buckets it to the start of the minute")
+    {
+      REQUIRE( result.time_since_epoch() == minutes{59} );
+    }
+  }
+
+  SECTION("Time point is before the epoch")
+  {
+    const auto tp = bpstd::chrono::sys_seconds{seconds{-1}};
+    const auto result = bpstd::chrono::floor<minutes>(tp);
+
+    SECTION("Buckets it to the start of the minute")
+    {
+      REQUIRE( result.time_since_epoch() == minutes{-1} );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("ceil<To>( const time_point<Clock,Duration>& )", "[rounding]")
+{
+  using std::chrono::minutes;
+  using std::chrono::seconds;
+
+  const auto tp = bpstd::chrono::sys_seconds{seconds{3541}};
+
+  REQUIRE( bpstd::chrono::ceil<minutes>(tp).time_since_epoch() == minutes{60} );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("round<To>( const time_point<Clock,Duration>& )", "[rounding]")
+{
+  using std::chrono::minutes;
+  using std::chrono::seconds;
+
+  const auto tp = bpstd::chrono::sys_seconds{seconds{90}};
+
+  REQUIRE( bpstd::chrono::round<minutes>(tp).time_since_epoch() == minutes{2} );
+}
+
+//-----------------------------------------------------------------------------
+
+#if __cplusplus >= 201703L
+// std::chrono has its own rounding functions from C++17, which argument
+// dependent lookup finds alongside bpstd's for std::chrono types
+TEST_CASE("floor<To>( const time_point<Clock,Duration>& ) called unqualified", "[rounding]")
+{
+  using namespace bpstd::chrono;
+
+  const auto tp = sys_seconds{std::chrono::seconds{-1}};
+
+  SECTION("Rounding functions")
+  {
+    SECTION("Are not ambiguous")
+    {
+      REQUIRE( floor<days>(tp).time_since_epoch() == days{-1} );
+      REQUIRE( ceil<days>(tp).time_since_epoch() == days{0} );
+      REQUIRE( round<days>(tp).time_since_epoch() == days{0} );
+      REQUIRE( abs(tp.time_since_epoch()) == std::chrono::seconds{1} );
+    }
+  }
+}
+#endif
+
+//=============================================================================
+// class : tsc_clock
+//=============================================================================
+
+TEST_CASE("tsc_clock::is_steady", "[clock]")
+{
+  SECTION("Bound to a reference")
+  {
+    const bool& is_steady = bpstd::chrono::tsc_clock::is_steady;
+
+    SECTION("Is true")
+    {
+      REQUIRE( is_steady );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("tsc_clock::now()", "[clock]")
+{
+  using clock = bpstd::chrono::tsc_clock;
+
+  SECTION("Called repeatedly")
+  {
+    auto previous = clock::now();
+    auto monotonic = true;
+    for (auto i = 0; i < 100000; ++i) {
+      const auto current = clock::now();
+      monotonic = monotonic && (current >= previous);
+      previous = current;
+    }
+
+    SECTION("Never goes backwards")
+    {
+      REQUIRE( monotonic );
+    }
+  }
+
+  SECTION("Measuring a sleep")
+  {
+    const auto steady_start = std::chrono::steady_clock::now();
+    const auto start = clock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    const auto end = clock::now();
+    const auto steady_end = std::chrono::steady_clock::now();
+
+    const auto elapsed = end - start;
+    const auto steady_elapsed = steady_end - steady_start;
+
+    SECTION("Measures at least as long as the sleep")
+    {
+      // Allows for a small error in the calibrated rate
+      REQUIRE( elapsed >= std::chrono::microseconds{19000} );
+    }
+    SECTION("Agrees with steady_clock")
+    {
+      const auto tolerance = std::chrono::milliseconds{1};
+
+      REQUIRE( elapsed <= steady_elapsed + tolerance );
+    }
+  }
+}
+
+//=============================================================================
+// class : scoped_timer
+//=============================================================================
+
+TEST_CASE("scoped_timer::~scoped_timer()", "[dtor]")
+{
+  auto sink = recording_sink{0, bpstd::chrono::tsc_clock::duration{}};
+
+  SECTION("Timer is alive")
+  {
+    bpstd::chrono::scoped_timer<recording_sink> sut{sink};
+
+    SECTION("Sink is not invoked")
+    {
+      REQUIRE( sink.calls == 0 );
+    }
+  }
+
+  SECTION("Timer goes out of scope")
+  {
+    {
+      bpstd::chrono::scoped_timer<recording_sink> sut{sink};
+      std::this_thread::sleep_for(std::chrono::milliseconds{2});
+    }
+
+    SECTION("Sink is invoked once")
+    {
+      REQUIRE( sink.calls == 1 );
+    }
+    SECTION("Sink receives the elapsed time")
+    {
+      REQUIRE( sink.last >= std::chrono::microseconds{1900} );
+    }
+  }
+
+  SECTION("Timer uses another clock")
+  {
+    auto calls = 0;
+    auto last = std::chrono::steady_clock::duration{};
+    auto lambda = [&](std::chrono::steady_clock::duration d) {
+      ++calls;
+      last = d;
+    };
+    {
+      bpstd::chrono::scoped_timer<decltype(lambda), std::chrono::steady_clock> sut{lambda};
+      std::this_thread::sleep_for(std::chrono::milliseconds{2});
+    }
+
+    SECTION("Sink receives that clock's duration")
+    {
+      REQUIRE( calls == 1 );
+      REQUIRE( last >= std::chrono::milliseconds{2} );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("scoped_timer::elapsed()", "[observers]")
+{
+  auto sink = recording_sink{0, bpstd::chrono::tsc_clock::duration{}};
+  bpstd::chrono::scoped_timer<recording_sink> sut{sink};
+
+  const auto first = sut.elapsed();
+  std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  const auto second = sut.elapsed();
+
+  SECTION("Increases over time")
+  {
+    REQUIRE( second > first );
+  }
+}
+
+//=============================================================================
+// class : year_month_day
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+TEST_CASE("year_month_day::year_month_day( const sys_days& )", "[ctor]")
+{
+  using bpstd::chrono::days;
+  using bpstd::chrono::sys_days;
+
+  SECTION("Days are the epoch")
+  {
+    const auto sut = bpstd::chrono::year_month_day{sys_days{days{0}}};
+
+    SECTION("Date is 1970-01-01")
+    {
+      REQUIRE( sut == make_date(1970, 1u, 1u) );
+    }
+  }
+
+  SECTION("Days are before the epoch")
+  {
+    const auto sut = bpstd::chrono::year_month_day{sys_days{days{-1}}};
+
+    SECTION("Date is in the previous year")
+    {
+      REQUIRE( sut == make_date(1969, 12u, 31u) );
+    }
+  }
+
+  SECTION("Days are a leap day")
+  {
+    const auto sut = bpstd::chrono::year_month_day{sys_days{days{11016}}};
+
+    SECTION("Date is February 29th")
+    {
+      REQUIRE( sut == make_date(2000, 2u, 29u) );
+    }
+  }
+
+  SECTION("Days span several eras")
+  {
+    auto round_trips = true;
+    for (auto z = -800000; z <= 800000; z += 7) {
+      const auto dp = sys_days{days{z}};
+      const auto ymd = bpstd::chrono::year_month_day{dp};
+      round_trips = round_trips && ymd.ok() && sys_days{ymd} == dp;
+    }
+
+    SECTION("Converts back to the same days")
+    {
+      REQUIRE( round_trips );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+TEST_CASE("year_month_day::ok()", "[observers]")
+{
+  SECTION("Date is valid")
+  {
+    REQUIRE( make_date(2024, 2u, 29u).ok() );
+    REQUIRE( make_date(2023, 12u, 31u).ok() );
+  }
+
+  SECTION("Day is past the end of the month")
+  {
+    REQUIRE_FALSE( make_date(2023, 2u, 29u).ok() );
+    REQUIRE_FALSE( make_date(1900, 2u, 29u).ok() );
+    REQUIRE_FALSE( make_date(2023, 4u, 31u).ok() );
+  }
+
+  SECTION("Month is out of range")
+  {
+    REQUIRE_FALSE( make_date(2023, 13u, 1u).ok() );
+    REQUIRE_FALSE( make_date(2023, 0u, 1u).ok() );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Conversions
+//-----------------------------------------------------------------------------
+
+TEST_CASE("year_month_day::operator sys_days()", "[conversions]")
+{
+  using bpstd::chrono::sys_days;
+
+  SECTION("Date is the epoch")
+  {
+    REQUIRE( sys_days{make_date(1970, 1u, 1u)}.time_since_epoch().count() == 0 );
+  }
+
+  SECTION("Date is after the epoch")
+  {
+    REQUIRE( sys_days{make_date(2000, 3u, 1u)}.time_since_epoch().count() == 11017 );
+  }
+
+  SECTION("Date is before the epoch")
+  {
+    REQUIRE( sys_days{make_date(1600, 1u, 1u)}.time_since_epoch().count() == -135140 );
+  }
+}
+
+//=============================================================================
+// non-member functions : ISO-8601
+//=============================================================================
+
+TEST_CASE("format_iso8601( span<char>, sys_time<Duration> )", "[iso8601]")
+{
+  using namespace std::chrono;
+
+  SECTION("Duration is seconds")
+  {
+    const auto tp = bpstd::chrono::sys_seconds{seconds{951782400}};
+
+    SECTION("Formats without a fraction")
+    {
+      REQUIRE( format(tp) == "2000-02-29T00:00:00Z" );
+    }
+  }
+
+  SECTION("Duration is milliseconds")
+  {
+    const auto tp = bpstd::chrono::sys_time<milliseconds>{milliseconds{1234}};
+
+    SECTION("Formats 3 fractional digits")
+    {
+      REQUIRE( format(tp) == "1970-01-01T00:00:01.234Z" );
+    }
+  }
+
+  SECTION("Duration is days")
+  {
+    const auto tp = bpstd::chrono::sys_days{bpstd::chrono::days{1}};
+
+    SECTION("Formats midnight")
+    {
+      REQUIRE( format(tp) == "1970-01-02T00:00:00Z" );
+    }
+  }
+
+  SECTION("Time is before the epoch")
+  {
+    const auto tp = bpstd::chrono::sys_time<nanoseconds>{nanoseconds{-1}};
+
+    SECTION("Rounds the date down")
+    {
+      REQUIRE( format(tp) == "1969-12-31T23:59:59.999999999Z" );
+    }
+  }
+
+  SECTION("Buffer is too small")
+  {
+    char buffer[19];
+    const auto result = bpstd::chrono::format_iso8601(
+      buffer,
+      bpstd::chrono::sys_seconds{seconds{0}}
+    );
+
+    SECTION("Returns an empty span")
+    {
+      REQUIRE( result.empty() );
+    }
+  }
+
+  SECTION("Year is not 4 digits")
+  {
+    const auto tp = bpstd::chrono::sys_days{make_date(-1, 1u, 1u)};
+
+    SECTION("Returns an empty span")
+    {
+      REQUIRE( format(tp).empty() );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("parse_iso8601( string_view, sys_time<Duration>& )", "[iso8601]")
+{
+  using namespace std::chrono;
+
+  auto sut = bpstd::chrono::sys_time<milliseconds>{milliseconds{42}};
+
+  SECTION("String is a date")
+  {
+    const auto result = bpstd::chrono::parse_iso8601("2000-02-29", sut);
+
+    SECTION("Parses midnight of that date")
+    {
+      REQUIRE( result );
+      REQUIRE( sut.time_since_epoch() == seconds{951782400} );
+    }
+  }
+
+  SECTION("String has a time and fraction")
+  {
+    const auto result = bpstd::chrono::parse_iso8601("1970-01-01T00:00:01.2345Z", sut);
+
+    SECTION("Rounds the fraction down to the duration")
+    {
+      REQUIRE( result );
+      REQUIRE( sut.time_since_epoch() == milliseconds{1234} );
+    }
+  }
+
+  SECTION("String has a UTC offset")
+  {
+    const auto result = bpstd::chrono::parse_iso8601("1970-01-01T01:30:00+01:30", sut);
+
+    SECTION("Converts the time to UTC")
+    {
+      REQUIRE( result );
+      REQUIRE( sut.time_since_epoch() == milliseconds{0} );
+    }
+  }
+
+  SECTION("String is before the epoch, for a coarse duration")
+  {
+    auto days = bpstd::chrono::sys_days{};
+    const auto result = bpstd::chrono::parse_iso8601("1969-12-31T12:00:00Z", days);
+
+    SECTION("Rounds the time down")
+    {
+      REQUIRE( result );
+      REQUIRE( days.time_since_epoch().count() == -1 );
+    }
+  }
+
+  SECTION("String is a formatted time")
+  {
+    const auto tp = bpstd::chrono::sys_time<milliseconds>{milliseconds{1583015399123}};
+    const auto str = format(tp);
+    const auto result = bpstd::chrono::parse_iso8601(str, sut);
+
+    SECTION("Round trips")
+    {
+      REQUIRE( result );
+      REQUIRE( sut == tp );
+    }
+  }
+
+  SECTION("String is malformed")
+  {
+    const char* const strings[] = {
+      "",
+      "2000-02-30",
+      "2000-2-28",
+      "2000-02-28T24:00:00",
+      "2000-02-28T12:00",
+      "2000-02-28T12:00:00.",
+      "2000-02-28T12:00:00Q",
+      "2000-02-28T12:00:00Z ",
+    };
+
+    SECTION("Returns false, leaving the time point unchanged")
+    {
+      for (const auto* str : strings) {
+        INFO( str );
+        REQUIRE_FALSE( bpstd::chrono::parse_iso8601(str, sut) );
+        REQUIRE( sut.time_since_epoch() == milliseconds{42} );
+      }
+    }
+  }
+}
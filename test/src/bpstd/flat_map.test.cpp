@@ -0,0 +1,447 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#include <bpstd/flat_map.hpp>
+
+#include <bpstd/string_view.hpp>
+
+#include <catch2/catch.hpp>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// MSVC 2015 seems to emit an error that __forceinline'd functions may not be
+// __forceinline'd at the *end of the translation unit* using it, for some
+// stupid reason.
+#if defined(_MSC_VER)
+# pragma warning(disable:4714)
+#endif
+
+//=============================================================================
+// class : flat_map
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors / Assignment
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_map::flat_map()", "[ctor]")
+{
+  const auto sut = bpstd::flat_map<int,int>{};
+
+  SECTION("Is empty")
+  {
+    REQUIRE( sut.empty() );
+    REQUIRE( sut.size() == 0u );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_map::flat_map( key_container_type, mapped_container_type )", "[ctor]")
+{
+  const auto sut = bpstd::flat_map<int,char>{
+    std::vector<int>{3, 1, 2, 1},
+    std::vector<char>{'c', 'a', 'b', 'x'}
+  };
+
+  SECTION("Keys are sorted and unique")
+  {
+    const auto expected = std::vector<int>{1, 2, 3};
+
+    REQUIRE( sut.keys() == expected );
+  }
+
+  SECTION("Values follow their keys")
+  {
+    const auto expected = std::vector<char>{'a', 'b', 'c'};
+
+    REQUIRE( sut.values() == expected );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_map::flat_map( sorted_unique_t, key_container_type, mapped_container_type )", "[ctor]")
+{
+  const auto keys = std::vector<int>{1, 2, 3};
+  const auto values = std::vector<char>{'a', 'b', 'c'};
+  const auto sut = bpstd::flat_map<int,char>{bpstd::sorted_unique, keys, values};
+
+  SECTION("Containers are unchanged")
+  {
+    REQUIRE( sut.keys() == keys );
+    REQUIRE( sut.values() == values );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_map::flat_map( span<const value_type> )", "[ctor]")
+{
+  const std::pair<int,char> entries[] = {
+    {5, 'e'}, {2, 'b'}, {5, 'x'}, {1, 'a'}
+  };
+  const auto sut = bpstd::flat_map<int,char>{
+    bpstd::span<const std::pair<int,char>>{entries}
+  };
+
+  SECTION("Keys are sorted and unique")
+  {
+    const auto expected = std::vector<int>{1, 2, 5};
+
+    REQUIRE( sut.keys() == expected );
+  }
+
+  SECTION("First of equivalent entries is kept")
+  {
+    REQUIRE( sut.at(5) == 'e' );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_map::flat_map( span<const key_type>, span<const mapped_type> )", "[ctor]")
+{
+  const int keys[] = {3, 1, 2};
+  const char values[] = {'c', 'a', 'b'};
+  const auto sut = bpstd::flat_map<int,char>{
+    bpstd::span<const int>{keys},
+    bpstd::span<const char>{values}
+  };
+
+  SECTION("Entries are sorted by key")
+  {
+    const auto expected = std::vector<char>{'a', 'b', 'c'};
+
+    REQUIRE( sut.values() == expected );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_map::flat_map( std::initializer_list<value_type> )", "[ctor]")
+{
+  const auto sut = bpstd::flat_map<int,char>{{2, 'b'}, {1, 'a'}};
+
+  SECTION("Entries are sorted by key")
+  {
+    REQUIRE( sut.begin()->first == 1 );
+    REQUIRE( sut.begin()->second == 'a' );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Element Access
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_map::operator[]( const key_type& )", "[element access]")
+{
+  auto sut = bpstd::flat_map<int,int>{{1, 10}, {3, 30}};
+
+  SECTION("Key exists")
+  {
+    SECTION("Returns existing value")
+    {
+      REQUIRE( sut[3] == 30 );
+      REQUIRE( sut.size() == 2u );
+    }
+  }
+
+  SECTION("Key does not exist")
+  {
+    sut[2] = 20;
+
+    SECTION("Inserts value in order")
+    {
+      const auto expected = std::vector<int>{10, 20, 30};
+
+      REQUIRE( sut.values() == expected );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_map::at( const key_type& )", "[element access]")
+{
+  const auto sut = bpstd::flat_map<int,int>{{1, 10}};
+
+  SECTION("Key exists")
+  {
+    SECTION("Returns value")
+    {
+      REQUIRE( sut.at(1) == 10 );
+    }
+  }
+
+  SECTION("Key does not exist")
+  {
+    SECTION("Throws std::out_of_range")
+    {
+      REQUIRE_THROWS_AS( sut.at(2), std::out_of_range );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_map::try_emplace( const key_type&, Args&&... )", "[modifiers]")
+{
+  auto sut = bpstd::flat_map<int,std::string>{{1, "one"}};
+
+  SECTION("Key does not exist")
+  {
+    const auto result = sut.try_emplace(2, 3u, 'x');
+
+    SECTION("Inserts value")
+    {
+      REQUIRE( result.second );
+      REQUIRE( result.first->second == "xxx" );
+    }
+  }
+
+  SECTION("Key already exists")
+  {
+    const auto result = sut.try_emplace(1, "uno");
+
+    SECTION("Does not replace value")
+    {
+      REQUIRE_FALSE( result.second );
+      REQUIRE( result.first->second == "one" );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_map::insert_or_assign( const key_type&, M&& )", "[modifiers]")
+{
+  auto sut = bpstd::flat_map<int,int>{{1, 10}};
+
+  SECTION("Key already exists")
+  {
+    const auto result = sut.insert_or_assign(1, 11);
+
+    SECTION("Assigns value")
+    {
+      REQUIRE_FALSE( result.second );
+      REQUIRE( sut.at(1) == 11 );
+    }
+  }
+
+  SECTION("Key does not exist")
+  {
+    const auto result = sut.insert_or_assign(0, 0);
+
+    SECTION("Inserts value")
+    {
+      REQUIRE( result.second );
+      REQUIRE( sut.begin()->first == 0 );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_map::insert( InputIt, InputIt )", "[modifiers]")
+{
+  auto sut = bpstd::flat_map<int,char>{{2, 'b'}, {4, 'd'}};
+  const auto entries = std::vector<std::pair<int,char>>{
+    {3, 'c'}, {2, 'x'}, {1, 'a'}
+  };
+
+  sut.insert(entries.begin(), entries.end());
+
+  SECTION("Entries are merged in order")
+  {
+    const auto expected = std::vector<int>{1, 2, 3, 4};
+
+    REQUIRE( sut.keys() == expected );
+  }
+
+  SECTION("Existing entries are kept")
+  {
+    REQUIRE( sut.at(2) == 'b' );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_map::erase( const_iterator )", "[modifiers]")
+{
+  auto sut = bpstd::flat_map<int,char>{{1, 'a'}, {2, 'b'}, {3, 'c'}};
+
+  const auto it = sut.erase(sut.find(2));
+
+  SECTION("Returns iterator to next entry")
+  {
+    REQUIRE( it->first == 3 );
+  }
+
+  SECTION("Removes key and value")
+  {
+    const auto expected = std::vector<char>{'a', 'c'};
+
+    REQUIRE_FALSE( sut.contains(2) );
+    REQUIRE( sut.values() == expected );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_map::extract() &&", "[modifiers]")
+{
+  auto sut = bpstd::flat_map<int,char>{{2, 'b'}, {1, 'a'}};
+
+  const auto containers = std::move(sut).extract();
+
+  SECTION("Returns sorted containers")
+  {
+    REQUIRE( containers.keys == (std::vector<int>{1, 2}) );
+    REQUIRE( containers.values == (std::vector<char>{'a', 'b'}) );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Iterators
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_map::begin()", "[iterators]")
+{
+  auto sut = bpstd::flat_map<int,int>{{1, 1}, {2, 2}};
+
+  SECTION("Values are mutable through the iterator")
+  {
+    for (auto entry : sut) {
+      entry.second *= 10;
+    }
+    const auto expected = std::vector<int>{10, 20};
+
+    REQUIRE( sut.values() == expected );
+  }
+
+  SECTION("Iterator converts to const_iterator")
+  {
+    const bpstd::flat_map<int,int>::const_iterator it = sut.begin();
+
+    REQUIRE( it == sut.cbegin() );
+    REQUIRE( (sut.end() - it) == 2 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Lookup
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_map::find( const key_type& )", "[lookup]")
+{
+  const auto sut = bpstd::flat_map<int,char>{{1, 'a'}, {3, 'c'}};
+
+  SECTION("Key exists")
+  {
+    SECTION("Returns iterator to entry")
+    {
+      const auto it = sut.find(3);
+
+      REQUIRE( it != sut.end() );
+      REQUIRE( it->second == 'c' );
+    }
+  }
+
+  SECTION("Key does not exist")
+  {
+    SECTION("Returns end")
+    {
+      REQUIRE( sut.find(2) == sut.end() );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_map::find( const K& )", "[lookup]")
+{
+  using map_type = bpstd::flat_map<std::string, int, bpstd::less<void>>;
+
+  const auto sut = map_type{{"hello", 1}, {"world", 2}};
+
+  SECTION("Key is transparently compared")
+  {
+    const auto key = bpstd::string_view{"world"};
+
+    REQUIRE( sut.find(key)->second == 2 );
+    REQUIRE( sut.contains(key) );
+    REQUIRE( sut.count(key) == 1u );
+    REQUIRE( sut.at(key) == 2 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_map::equal_range( const key_type& )", "[lookup]")
+{
+  const auto sut = bpstd::flat_map<int,char>{{1, 'a'}, {3, 'c'}};
+
+  SECTION("Key exists")
+  {
+    const auto range = sut.equal_range(3);
+
+    REQUIRE( (range.second - range.first) == 1 );
+  }
+
+  SECTION("Key does not exist")
+  {
+    const auto range = sut.equal_range(2);
+
+    REQUIRE( range.first == range.second );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Comparison
+//-----------------------------------------------------------------------------
+
+TEST_CASE("operator==( const flat_map&, const flat_map& )", "[comparison]")
+{
+  const auto lhs = bpstd::flat_map<int,char>{{1, 'a'}, {2, 'b'}};
+
+  SECTION("Maps contain the same entries")
+  {
+    const auto rhs = bpstd::flat_map<int,char>{{2, 'b'}, {1, 'a'}};
+
+    REQUIRE( lhs == rhs );
+  }
+
+  SECTION("Maps contain different values")
+  {
+    const auto rhs = bpstd::flat_map<int,char>{{1, 'a'}, {2, 'c'}};
+
+    REQUIRE( lhs != rhs );
+  }
+}
@@ -0,0 +1,324 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#include <bpstd/flat_set.hpp>
+
+#include <bpstd/string_view.hpp>
+
+#include <catch2/catch.hpp>
+#include <string>
+#include <vector>
+
+// MSVC 2015 seems to emit an error that __forceinline'd functions may not be
+// __forceinline'd at the *end of the translation unit* using it, for some
+// stupid reason.
+#if defined(_MSC_VER)
+# pragma warning(disable:4714)
+#endif
+
+//=============================================================================
+// class : flat_set
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors / Assignment
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_set::flat_set()", "[ctor]")
+{
+  const auto sut = bpstd::flat_set<int>{};
+
+  SECTION("Is empty")
+  {
+    REQUIRE( sut.empty() );
+    REQUIRE( sut.size() == 0u );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_set::flat_set( container_type )", "[ctor]")
+{
+  const auto sut = bpstd::flat_set<int>{std::vector<int>{5, 1, 3, 1, 5, 2}};
+
+  SECTION("Keys are sorted and unique")
+  {
+    const auto expected = std::vector<int>{1, 2, 3, 5};
+
+    REQUIRE( std::vector<int>(sut.begin(), sut.end()) == expected );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_set::flat_set( sorted_unique_t, container_type )", "[ctor]")
+{
+  const auto keys = std::vector<int>{1, 2, 3, 5};
+  const auto sut = bpstd::flat_set<int>{bpstd::sorted_unique, keys};
+
+  SECTION("Keys are unchanged")
+  {
+    REQUIRE( std::vector<int>(sut.begin(), sut.end()) == keys );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_set::flat_set( span<const value_type> )", "[ctor]")
+{
+  const int values[] = {9, 4, 4, 7, 1, 9};
+  const auto sut = bpstd::flat_set<int>{bpstd::span<const int>{values}};
+
+  SECTION("Keys are sorted and unique")
+  {
+    const auto expected = std::vector<int>{1, 4, 7, 9};
+
+    REQUIRE( std::vector<int>(sut.begin(), sut.end()) == expected );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_set::flat_set( std::initializer_list<value_type> )", "[ctor]")
+{
+  const auto sut = bpstd::flat_set<int>{3, 2, 1, 2, 3};
+
+  SECTION("Keys are sorted and unique")
+  {
+    const auto expected = std::vector<int>{1, 2, 3};
+
+    REQUIRE( std::vector<int>(sut.begin(), sut.end()) == expected );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_set::insert( const value_type& )", "[modifiers]")
+{
+  auto sut = bpstd::flat_set<int>{1, 3};
+
+  SECTION("Key does not exist")
+  {
+    const auto result = sut.insert(2);
+
+    SECTION("Inserts key")
+    {
+      REQUIRE( result.second );
+      REQUIRE( *result.first == 2 );
+    }
+
+    SECTION("Keys remain sorted")
+    {
+      const auto expected = std::vector<int>{1, 2, 3};
+
+      REQUIRE( std::vector<int>(sut.begin(), sut.end()) == expected );
+    }
+  }
+
+  SECTION("Key already exists")
+  {
+    const auto result = sut.insert(3);
+
+    SECTION("Does not insert key")
+    {
+      REQUIRE_FALSE( result.second );
+      REQUIRE( *result.first == 3 );
+      REQUIRE( sut.size() == 2u );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_set::insert( InputIt, InputIt )", "[modifiers]")
+{
+  auto sut = bpstd::flat_set<int>{2, 4, 6};
+  const auto values = std::vector<int>{5, 4, 3, 1, 3};
+
+  sut.insert(values.begin(), values.end());
+
+  SECTION("Keys are merged, sorted, and unique")
+  {
+    const auto expected = std::vector<int>{1, 2, 3, 4, 5, 6};
+
+    REQUIRE( std::vector<int>(sut.begin(), sut.end()) == expected );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_set::insert( sorted_unique_t, InputIt, InputIt )", "[modifiers]")
+{
+  auto sut = bpstd::flat_set<int>{2, 4, 6};
+  const auto values = std::vector<int>{1, 4, 5};
+
+  sut.insert(bpstd::sorted_unique, values.begin(), values.end());
+
+  SECTION("Keys are merged, sorted, and unique")
+  {
+    const auto expected = std::vector<int>{1, 2, 4, 5, 6};
+
+    REQUIRE( std::vector<int>(sut.begin(), sut.end()) == expected );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_set::erase( const key_type& )", "[modifiers]")
+{
+  auto sut = bpstd::flat_set<int>{1, 2, 3};
+
+  SECTION("Key exists")
+  {
+    SECTION("Erases key")
+    {
+      REQUIRE( sut.erase(2) == 1u );
+      REQUIRE_FALSE( sut.contains(2) );
+      REQUIRE( sut.size() == 2u );
+    }
+  }
+
+  SECTION("Key does not exist")
+  {
+    SECTION("Erases nothing")
+    {
+      REQUIRE( sut.erase(4) == 0u );
+      REQUIRE( sut.size() == 3u );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_set::extract() &&", "[modifiers]")
+{
+  auto sut = bpstd::flat_set<int>{3, 1, 2};
+
+  const auto keys = std::move(sut).extract();
+
+  SECTION("Returns sorted keys")
+  {
+    const auto expected = std::vector<int>{1, 2, 3};
+
+    REQUIRE( keys == expected );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Lookup
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_set::find( const key_type& )", "[lookup]")
+{
+  const auto sut = bpstd::flat_set<int>{1, 3, 5};
+
+  SECTION("Key exists")
+  {
+    SECTION("Returns iterator to key")
+    {
+      const auto it = sut.find(3);
+
+      REQUIRE( it != sut.end() );
+      REQUIRE( *it == 3 );
+    }
+  }
+
+  SECTION("Key does not exist")
+  {
+    SECTION("Returns end")
+    {
+      REQUIRE( sut.find(2) == sut.end() );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_set::find( const K& )", "[lookup]")
+{
+  using set_type = bpstd::flat_set<std::string, bpstd::less<void>>;
+
+  const auto sut = set_type{"hello", "world"};
+
+  SECTION("Key is transparently compared")
+  {
+    const auto key = bpstd::string_view{"world"};
+
+    REQUIRE( sut.find(key) != sut.end() );
+    REQUIRE( sut.contains(key) );
+    REQUIRE( sut.count(key) == 1u );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_set::lower_bound( const key_type& )", "[lookup]")
+{
+  const auto sut = bpstd::flat_set<int>{1, 3, 5};
+
+  SECTION("Returns first key not less than input")
+  {
+    REQUIRE( *sut.lower_bound(2) == 3 );
+    REQUIRE( *sut.lower_bound(3) == 3 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("flat_set::upper_bound( const key_type& )", "[lookup]")
+{
+  const auto sut = bpstd::flat_set<int>{1, 3, 5};
+
+  SECTION("Returns first key greater than input")
+  {
+    REQUIRE( *sut.upper_bound(3) == 5 );
+    REQUIRE( sut.upper_bound(5) == sut.end() );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Comparison
+//-----------------------------------------------------------------------------
+
+TEST_CASE("operator==( const flat_set&, const flat_set& )", "[comparison]")
+{
+  const auto lhs = bpstd::flat_set<int>{1, 2, 3};
+
+  SECTION("Sets contain the same keys")
+  {
+    const auto rhs = bpstd::flat_set<int>{3, 2, 1};
+
+    REQUIRE( lhs == rhs );
+  }
+
+  SECTION("Sets contain different keys")
+  {
+    const auto rhs = bpstd::flat_set<int>{1, 2};
+
+    REQUIRE( lhs != rhs );
+  }
+}
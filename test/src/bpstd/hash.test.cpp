@@ -0,0 +1,229 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#include <bpstd/hash.hpp>
+
+#include <bpstd/optional.hpp>
+#include <bpstd/string_view.hpp>
+#include <bpstd/variant.hpp>
+
+#include <catch2/catch.hpp>
+#include <array>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+// MSVC 2015 seems to emit an error that __forceinline'd functions may not be
+// __forceinline'd at the *end of the translation unit* using it, for some
+// stupid reason.
+#if defined(_MSC_VER)
+# pragma warning(disable:4714)
+#endif
+
+//==============================================================================
+// Static Tests
+//==============================================================================
+
+static_assert(
+  std::is_default_constructible<std::hash<bpstd::optional<const int>>>::value,
+  "hash<optional<T>> is enabled when hash<remove_const_t<T>> is"
+);
+static_assert(
+  !std::is_default_constructible<std::hash<bpstd::optional<std::vector<int>>>>::value,
+  "hash<optional<T>> is disabled when hash<remove_const_t<T>> is"
+);
+static_assert(
+  !std::is_copy_constructible<std::hash<bpstd::optional<std::vector<int>>>>::value,
+  "A disabled hash<optional<T>> is not copyable"
+);
+
+static_assert(
+  std::is_default_constructible<std::hash<bpstd::variant<int,const long>>>::value,
+  "hash<variant<Types...>> is enabled when every hash<remove_const_t<T>> is"
+);
+static_assert(
+  !std::is_default_constructible<std::hash<bpstd::variant<int,std::vector<int>>>>::value,
+  "hash<variant<Types...>> is disabled when any hash<remove_const_t<T>> is"
+);
+
+//==============================================================================
+// hashing : bytes
+//==============================================================================
+
+TEST_CASE("hash_bytes(span<const byte>, std::uint64_t)", "[hash]")
+{
+  auto buffer = std::vector<unsigned char>(128u);
+  for (auto i = 0u; i < buffer.size(); ++i) {
+    buffer[i] = static_cast<unsigned char>(i * 31u);
+  }
+  const auto bytes = bpstd::as_bytes(bpstd::span<const unsigned char>{
+    buffer.data(), buffer.size()
+  });
+
+  SECTION("Hash is deterministic")
+  {
+    REQUIRE( bpstd::hash_bytes(bytes) == bpstd::hash_bytes(bytes) );
+  }
+
+  SECTION("Seed changes the hash")
+  {
+    REQUIRE( bpstd::hash_bytes(bytes, 1u) != bpstd::hash_bytes(bytes, 2u) );
+  }
+
+  SECTION("Each prefix length produces a distinct hash")
+  {
+    // Covers each of the short, medium, and bulk code-paths
+    auto hashes = std::set<std::uint64_t>{};
+    for (auto i = 0u; i <= bytes.size(); ++i) {
+      hashes.insert(bpstd::hash_bytes(bytes.first(i)));
+    }
+
+    REQUIRE( hashes.size() == bytes.size() + 1u );
+  }
+
+  SECTION("Single bit change changes the hash")
+  {
+    auto copy = buffer;
+    copy[100] ^= 1u;
+    const auto other = bpstd::as_bytes(bpstd::span<const unsigned char>{
+      copy.data(), copy.size()
+    });
+
+    REQUIRE( bpstd::hash_bytes(bytes) != bpstd::hash_bytes(other) );
+  }
+}
+
+//==============================================================================
+// hashing : combining
+//==============================================================================
+
+TEST_CASE("hash_combine(std::size_t&, std::size_t)", "[hash]")
+{
+  SECTION("Combination is order dependent")
+  {
+    auto lhs = std::size_t{0u};
+    bpstd::hash_combine(lhs, 1u);
+    bpstd::hash_combine(lhs, 2u);
+
+    auto rhs = std::size_t{0u};
+    bpstd::hash_combine(rhs, 2u);
+    bpstd::hash_combine(rhs, 1u);
+
+    REQUIRE( lhs != rhs );
+  }
+}
+
+//------------------------------------------------------------------------------
+
+TEST_CASE("hash_append(std::size_t&, const std::tuple<Types...>&)", "[hash]")
+{
+  const auto value = std::make_tuple(42, std::string{"hello"}, 'x');
+
+  SECTION("Hash is the same as appending each element")
+  {
+    auto expected = std::size_t{0u};
+    bpstd::hash_append(expected, 42, std::string{"hello"}, 'x');
+
+    auto result = std::size_t{0u};
+    bpstd::hash_append(result, value);
+
+    REQUIRE( result == expected );
+  }
+}
+
+//------------------------------------------------------------------------------
+
+TEST_CASE("hash_value(const T0&, const Types&...)", "[hash]")
+{
+  SECTION("Equal values produce equal hashes")
+  {
+    REQUIRE( bpstd::hash_value(1, 2.0, 'c') == bpstd::hash_value(1, 2.0, 'c') );
+  }
+
+  SECTION("Different values produce different hashes")
+  {
+    REQUIRE( bpstd::hash_value(1, 2) != bpstd::hash_value(2, 1) );
+  }
+}
+
+//==============================================================================
+// struct : hash
+//==============================================================================
+
+TEST_CASE("hash<basic_string_view>", "[hash]")
+{
+  const auto lhs = std::string{"hello world"};
+  const auto rhs = std::string{"hello world"};
+  const auto hasher = std::hash<bpstd::string_view>{};
+
+  SECTION("Equal strings in different buffers produce equal hashes")
+  {
+    REQUIRE( hasher(lhs) == hasher(rhs) );
+  }
+
+  SECTION("Different strings produce different hashes")
+  {
+    REQUIRE( hasher(bpstd::string_view{lhs}.substr(1)) != hasher(lhs) );
+  }
+}
+
+//------------------------------------------------------------------------------
+
+TEST_CASE("hash<optional<T>>", "[hash]")
+{
+  const auto hasher = std::hash<bpstd::optional<int>>{};
+
+  SECTION("Disengaged optionals produce equal hashes")
+  {
+    REQUIRE( hasher(bpstd::nullopt) == hasher(bpstd::optional<int>{}) );
+  }
+
+  SECTION("Engaged optional differs from disengaged optional")
+  {
+    REQUIRE( hasher(0) != hasher(bpstd::nullopt) );
+  }
+}
+
+//------------------------------------------------------------------------------
+
+TEST_CASE("hash<variant<Types...>>", "[hash]")
+{
+  using variant_type = bpstd::variant<int,long,bpstd::monostate>;
+
+  const auto hasher = std::hash<variant_type>{};
+
+  SECTION("Equal variants produce equal hashes")
+  {
+    REQUIRE( hasher(variant_type{5}) == hasher(variant_type{5}) );
+  }
+
+  SECTION("Same value in different alternatives produces different hashes")
+  {
+    REQUIRE( hasher(variant_type{5}) != hasher(variant_type{5L}) );
+  }
+}
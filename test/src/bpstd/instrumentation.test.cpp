@@ -0,0 +1,263 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#include <bpstd/instrumentation.hpp>
+
+#include <bpstd/any.hpp>
+#include <bpstd/optional.hpp>
+#include <bpstd/variant.hpp>
+
+#include <catch2/catch.hpp>
+#include <stdexcept>
+#include <string>
+
+// MSVC 2015 seems to emit an error that __forceinline'd functions may not be
+// __forceinline'd at the *end of the translation unit* using it, for some
+// stupid reason.
+#if defined(_MSC_VER)
+# pragma warning(disable:4714)
+#endif
+
+namespace {
+
+  struct large_object
+  {
+    char data[128];
+  };
+
+  struct throw_on_construct
+  {
+    throw_on_construct() { throw std::runtime_error{"error"}; }
+  };
+
+  struct identity_visitor
+  {
+    template <typename T>
+    int operator()(const T&) const { return 0; }
+  };
+
+} // anonymous namespace
+
+//=============================================================================
+// class : instrumentation_registry
+//=============================================================================
+
+TEST_CASE("instrumentation_registry::enabled()", "[observers]")
+{
+  SECTION("BPSTD_ENABLE_INSTRUMENTATION is non-zero")
+  {
+    SECTION("Is true")
+    {
+      REQUIRE( bpstd::instrumentation_registry::enabled() );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("instrumentation_registry::reset()", "[modifiers]")
+{
+  bpstd::instrumentation_registry::record(
+    bpstd::instrumented_type::optional,
+    bpstd::instrumentation_event::copy
+  );
+  bpstd::instrumentation_registry::record(
+    bpstd::instrumented_type::variant,
+    bpstd::instrumentation_event::valueless
+  );
+
+  bpstd::instrumentation_registry::reset();
+
+  SECTION("Sets every counter to zero")
+  {
+    const auto o = bpstd::instrumentation_registry::counters(bpstd::instrumented_type::optional);
+    const auto v = bpstd::instrumentation_registry::counters(bpstd::instrumented_type::variant);
+
+    REQUIRE( o.copies == 0u );
+    REQUIRE( v.valueless == 0u );
+  }
+}
+
+//=============================================================================
+// class : any
+//=============================================================================
+
+TEST_CASE("instrumentation_registry::counters( instrumented_type::any )", "[observers]")
+{
+  bpstd::instrumentation_registry::reset();
+
+  const auto counters = []{
+    return bpstd::instrumentation_registry::counters(bpstd::instrumented_type::any);
+  };
+
+  SECTION("Value fits in the small buffer")
+  {
+    auto sut = bpstd::any{42};
+    auto copy = sut;
+    auto moved = bpstd::move(sut);
+
+    SECTION("Counts copies and moves, without heap spills")
+    {
+      REQUIRE( counters().copies == 1u );
+      REQUIRE( counters().moves == 1u );
+      REQUIRE( counters().heap_spills == 0u );
+    }
+  }
+
+  SECTION("Value is too large for the small buffer")
+  {
+    auto sut = bpstd::any{large_object{}};
+    auto copy = sut;
+
+    SECTION("Counts a heap spill for every allocation")
+    {
+      REQUIRE( counters().heap_spills == 2u );
+      REQUIRE( counters().copies == 1u );
+    }
+  }
+
+  SECTION("Value is cast to the wrong type")
+  {
+    const auto sut = bpstd::any{42};
+
+    REQUIRE_THROWS_AS( bpstd::any_cast<float>(sut), bpstd::bad_any_cast );
+
+    SECTION("Counts a bad access")
+    {
+      REQUIRE( counters().bad_accesses == 1u );
+    }
+  }
+}
+
+//=============================================================================
+// class : optional
+//=============================================================================
+
+TEST_CASE("instrumentation_registry::counters( instrumented_type::optional )", "[observers]")
+{
+  bpstd::instrumentation_registry::reset();
+
+  const auto counters = []{
+    return bpstd::instrumentation_registry::counters(bpstd::instrumented_type::optional);
+  };
+
+  SECTION("Optional contains a value")
+  {
+    auto sut = bpstd::optional<std::string>{"hello world"};
+    auto copy = sut;
+    auto moved = bpstd::move(sut);
+    copy = moved;
+
+    SECTION("Counts copies and moves")
+    {
+      REQUIRE( counters().copies == 2u );
+      REQUIRE( counters().moves == 1u );
+    }
+  }
+
+  SECTION("Optional does not contain a value")
+  {
+    // A disengaged optional<std::string> trips GCC's bogus
+    // -Wmaybe-uninitialized at -O3 (GCC bug 80635), as std::optional does
+    auto sut = bpstd::optional<int>{};
+    auto copy = sut;
+
+    REQUIRE_THROWS_AS( copy.value(), bpstd::bad_optional_access );
+
+    SECTION("Does not count copies")
+    {
+      REQUIRE( counters().copies == 0u );
+    }
+    SECTION("Counts a bad access")
+    {
+      REQUIRE( counters().bad_accesses == 1u );
+    }
+  }
+}
+
+//=============================================================================
+// class : variant
+//=============================================================================
+
+TEST_CASE("instrumentation_registry::counters( instrumented_type::variant )", "[observers]")
+{
+  bpstd::instrumentation_registry::reset();
+
+  const auto counters = []{
+    return bpstd::instrumentation_registry::counters(bpstd::instrumented_type::variant);
+  };
+
+  SECTION("Variant is copied, moved, and visited")
+  {
+    auto sut = bpstd::variant<int, std::string>{std::string{"hello world"}};
+    auto copy = sut;
+    auto moved = bpstd::move(sut);
+    bpstd::visit(identity_visitor{}, copy);
+
+    SECTION("Counts copies, moves, and visits")
+    {
+      REQUIRE( counters().copies == 1u );
+      REQUIRE( counters().moves == 1u );
+      REQUIRE( counters().visits == 1u );
+    }
+  }
+
+  SECTION("Inactive alternative is accessed")
+  {
+    auto sut = bpstd::variant<int, std::string>{42};
+
+    REQUIRE_THROWS_AS( bpstd::get<1>(sut), bpstd::bad_variant_access );
+
+    SECTION("Counts a bad access")
+    {
+      REQUIRE( counters().bad_accesses == 1u );
+    }
+  }
+
+  SECTION("Emplacing an alternative throws")
+  {
+    auto sut = bpstd::variant<int, throw_on_construct>{42};
+
+    REQUIRE_THROWS_AS( sut.emplace<1>(), std::runtime_error );
+
+    SECTION("Counts the variant becoming valueless")
+    {
+      REQUIRE( sut.valueless_by_exception() );
+      REQUIRE( counters().valueless == 1u );
+    }
+  }
+
+  SECTION("Emplacing an alternative succeeds")
+  {
+    auto sut = bpstd::variant<int, std::string>{42};
+
+    sut.emplace<1>("hello world");
+
+    SECTION("Does not count the variant becoming valueless")
+    {
+      REQUIRE( counters().valueless == 0u );
+    }
+  }
+}
@@ -0,0 +1,166 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#include <bpstd/latch.hpp>
+
+#include <catch2/catch.hpp>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+// MSVC 2015 seems to emit an error that __forceinline'd functions may not be
+// __forceinline'd at the *end of the translation unit* using it, for some
+// stupid reason.
+#if defined(_MSC_VER)
+# pragma warning(disable:4714)
+#endif
+
+//=============================================================================
+// class : latch
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+TEST_CASE("latch::latch( std::ptrdiff_t )", "[ctor]")
+{
+  SECTION("Expected count is zero")
+  {
+    const bpstd::latch sut{0};
+
+    SECTION("Latch is already released")
+    {
+      REQUIRE( sut.try_wait() );
+    }
+  }
+
+  SECTION("Expected count is non-zero")
+  {
+    const bpstd::latch sut{2};
+
+    SECTION("Latch is not released")
+    {
+      REQUIRE_FALSE( sut.try_wait() );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+TEST_CASE("latch::count_down( std::ptrdiff_t )", "[modifiers]")
+{
+  bpstd::latch sut{3};
+
+  SECTION("Counter does not reach zero")
+  {
+    sut.count_down(2);
+
+    SECTION("Latch is not released")
+    {
+      REQUIRE_FALSE( sut.try_wait() );
+    }
+  }
+
+  SECTION("Counter reaches zero")
+  {
+    sut.count_down();
+    sut.count_down(2);
+
+    SECTION("Latch is released")
+    {
+      REQUIRE( sut.try_wait() );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Waiting
+//-----------------------------------------------------------------------------
+
+TEST_CASE("latch::wait()", "[waiting]")
+{
+  static constexpr auto thread_count = 4;
+
+  bpstd::latch sut{thread_count};
+  auto results = std::vector<int>(thread_count, 0);
+  auto threads = std::vector<std::thread>{};
+
+  for (auto i = 0; i < thread_count; ++i) {
+    threads.emplace_back([&sut, &results, i]{
+      results[static_cast<std::size_t>(i)] = i + 1;
+      sut.count_down();
+    });
+  }
+  sut.wait();
+
+  const auto expected = std::vector<int>{1, 2, 3, 4};
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  SECTION("Observes every write made before counting down")
+  {
+    REQUIRE( results == expected );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("latch::arrive_and_wait( std::ptrdiff_t )", "[waiting]")
+{
+  static constexpr auto thread_count = 4;
+
+  bpstd::latch sut{thread_count};
+  auto arrivals = std::vector<int>(thread_count, 0);
+  auto observed = std::vector<int>(thread_count, 0);
+  auto threads = std::vector<std::thread>{};
+
+  for (auto i = 0; i < thread_count; ++i) {
+    threads.emplace_back([&, i]{
+      arrivals[static_cast<std::size_t>(i)] = 1;
+      sut.arrive_and_wait();
+
+      auto sum = 0;
+      for (auto arrival : arrivals) {
+        sum += arrival;
+      }
+      observed[static_cast<std::size_t>(i)] = sum;
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  const auto expected = std::vector<int>(thread_count, thread_count);
+
+  SECTION("Unblocks every thread once all have arrived")
+  {
+    REQUIRE( observed == expected );
+  }
+}
@@ -0,0 +1,346 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#include <bpstd/latency_histogram.hpp>
+
+#include <catch2/catch.hpp>
+#include <bpstd/chrono.hpp>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+// MSVC 2015 seems to emit an error that __forceinline'd functions may not be
+// __forceinline'd at the *end of the translation unit* using it, for some
+// stupid reason.
+#if defined(_MSC_VER)
+# pragma warning(disable:4714)
+#endif
+
+namespace {
+
+  using histogram = bpstd::latency_histogram<>;
+  using bpstd::chrono::nanoseconds;
+
+  // Records every duration in [1, n] nanoseconds
+  void record_sequence(histogram& h, int n)
+  {
+    for (auto i = 1; i <= n; ++i) {
+      h.record(nanoseconds{i});
+    }
+  }
+
+  // Checks that 'actual' is no less than 'expected', and within the
+  // histogram's relative error of it
+  bool is_equivalent(nanoseconds actual, nanoseconds expected)
+  {
+    const auto tolerance = expected.count() / 32 + 1;
+
+    return actual >= expected && (actual - expected).count() <= tolerance;
+  }
+
+} // anonymous namespace
+
+//=============================================================================
+// class : latency_histogram
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+TEST_CASE("latency_histogram::latency_histogram()", "[ctor]")
+{
+  const histogram sut{};
+
+  SECTION("Has nothing recorded")
+  {
+    REQUIRE( sut.count() == 0u );
+  }
+  SECTION("Percentiles are zero")
+  {
+    REQUIRE( sut.percentile(50.0) == nanoseconds::zero() );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Recording
+//-----------------------------------------------------------------------------
+
+TEST_CASE("latency_histogram::record( duration<Rep,Period> )", "[recording]")
+{
+  histogram sut{};
+
+  SECTION("Duration is below the exact range")
+  {
+    sut.record(nanoseconds{42});
+
+    SECTION("Records it exactly")
+    {
+      REQUIRE( sut.count() == 1u );
+      REQUIRE( sut.percentile(100.0) == nanoseconds{42} );
+    }
+  }
+
+  SECTION("Duration is large")
+  {
+    const auto d = std::chrono::hours{10000};
+    sut.record(d);
+
+    SECTION("Records it within the relative error")
+    {
+      REQUIRE( is_equivalent(sut.percentile(100.0), d) );
+    }
+  }
+
+  SECTION("Duration is in a coarser unit")
+  {
+    sut.record(std::chrono::microseconds{3});
+
+    SECTION("Converts it to the histogram's duration")
+    {
+      REQUIRE( is_equivalent(sut.percentile(100.0), nanoseconds{3000}) );
+    }
+  }
+
+  SECTION("Duration is negative")
+  {
+    sut.record(nanoseconds{-5});
+
+    SECTION("Records it as zero")
+    {
+      REQUIRE( sut.count() == 1u );
+      REQUIRE( sut.percentile(100.0) == nanoseconds::zero() );
+    }
+  }
+
+  SECTION("Threads record concurrently")
+  {
+    const auto threads = 4;
+    const auto per_thread = 10000;
+
+    auto workers = std::vector<std::thread>{};
+    for (auto t = 0; t < threads; ++t) {
+      workers.emplace_back([&sut, per_thread]{
+        record_sequence(sut, per_thread);
+      });
+    }
+    for (auto& w : workers) {
+      w.join();
+    }
+
+    SECTION("Every duration is counted")
+    {
+      REQUIRE( sut.count() == static_cast<std::uint64_t>(threads * per_thread) );
+    }
+    SECTION("Percentiles span the shards")
+    {
+      REQUIRE( is_equivalent(sut.percentile(50.0), nanoseconds{per_thread / 2}) );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("latency_histogram::operator()( duration<Rep,Period> )", "[recording]")
+{
+  histogram sut{};
+
+  {
+    bpstd::chrono::scoped_timer<histogram> timer{sut};
+  }
+
+  SECTION("Records as the sink of a scoped_timer")
+  {
+    REQUIRE( sut.count() == 1u );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("latency_histogram::reset()", "[recording]")
+{
+  histogram sut{};
+  record_sequence(sut, 100);
+
+  sut.reset();
+
+  SECTION("Discards all recordings")
+  {
+    REQUIRE( sut.count() == 0u );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+TEST_CASE("latency_histogram::percentile( double )", "[observers]")
+{
+  histogram sut{};
+  record_sequence(sut, 100000);
+
+  SECTION("Percentile is within range")
+  {
+    SECTION("Returns the duration at that rank")
+    {
+      REQUIRE( is_equivalent(sut.percentile(50.0), nanoseconds{50000}) );
+      REQUIRE( is_equivalent(sut.percentile(90.0), nanoseconds{90000}) );
+      REQUIRE( is_equivalent(sut.percentile(99.9), nanoseconds{99900}) );
+    }
+  }
+
+  SECTION("Percentile is 0")
+  {
+    SECTION("Returns the smallest duration")
+    {
+      REQUIRE( sut.percentile(0.0) == nanoseconds{1} );
+    }
+  }
+
+  SECTION("Percentile is out of range")
+  {
+    SECTION("Clamps it to [0, 100]")
+    {
+      REQUIRE( sut.percentile(-10.0) == sut.percentile(0.0) );
+      REQUIRE( sut.percentile(200.0) == sut.percentile(100.0) );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Merging
+//-----------------------------------------------------------------------------
+
+TEST_CASE("latency_histogram::merge( const latency_histogram& )", "[merging]")
+{
+  histogram sut{};
+  histogram other{};
+  sut.record(nanoseconds{10});
+  other.record(nanoseconds{20});
+  other.record(nanoseconds{30});
+
+  sut.merge(other);
+
+  SECTION("Adds the other histogram's recordings")
+  {
+    REQUIRE( sut.count() == 3u );
+    REQUIRE( sut.percentile(100.0) == nanoseconds{30} );
+  }
+  SECTION("Leaves the other histogram unchanged")
+  {
+    REQUIRE( other.count() == 2u );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("latency_histogram::merge( span<const byte> )", "[merging]")
+{
+  histogram source{};
+  record_sequence(source, 1000);
+
+  bpstd::byte buffer[histogram::max_serialized_size];
+  const auto bytes = source.serialize(buffer);
+
+  histogram sut{};
+  sut.record(nanoseconds{5000});
+
+  SECTION("Bytes were serialized by a matching histogram")
+  {
+    const auto result = sut.merge(bytes);
+
+    SECTION("Returns true")
+    {
+      REQUIRE( result );
+    }
+    SECTION("Adds the serialized recordings")
+    {
+      REQUIRE( sut.count() == 1001u );
+      REQUIRE( is_equivalent(sut.percentile(50.0), nanoseconds{501}) );
+    }
+  }
+
+  SECTION("Bytes are truncated")
+  {
+    const auto result = sut.merge(bytes.first(bytes.size() - 2u));
+
+    SECTION("Returns false")
+    {
+      REQUIRE_FALSE( result );
+    }
+    SECTION("Merges nothing")
+    {
+      REQUIRE( sut.count() == 1u );
+    }
+  }
+
+  SECTION("Bytes were serialized with a different duration")
+  {
+    bpstd::latency_histogram<bpstd::chrono::microseconds> micro{};
+    micro.record(std::chrono::microseconds{1});
+    bpstd::byte micro_buffer[histogram::max_serialized_size];
+
+    const auto result = sut.merge(micro.serialize(micro_buffer));
+
+    SECTION("Returns false")
+    {
+      REQUIRE_FALSE( result );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Serialization
+//-----------------------------------------------------------------------------
+
+TEST_CASE("latency_histogram::serialize( span<byte> )", "[serialization]")
+{
+  histogram sut{};
+  record_sequence(sut, 1000);
+
+  SECTION("Buffer is large enough")
+  {
+    bpstd::byte buffer[histogram::max_serialized_size];
+    const auto bytes = sut.serialize(buffer);
+
+    SECTION("Writes only the recorded buckets")
+    {
+      REQUIRE_FALSE( bytes.empty() );
+      REQUIRE( bytes.size() < histogram::max_serialized_size );
+    }
+  }
+
+  SECTION("Buffer is too small")
+  {
+    bpstd::byte buffer[8];
+    const auto bytes = sut.serialize(buffer);
+
+    SECTION("Returns an empty span")
+    {
+      REQUIRE( bytes.empty() );
+    }
+  }
+}
@@ -0,0 +1,452 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#include <bpstd/mdspan.hpp>
+
+#include <catch2/catch.hpp>
+#include <array>
+#include <type_traits>
+#include <utility>
+
+// MSVC 2015 seems to emit an error that __forceinline'd functions may not be
+// __forceinline'd at the *end of the translation unit* using it, for some
+// stupid reason.
+#if defined(_MSC_VER)
+# pragma warning(disable:4714)
+#endif
+
+namespace {
+
+  using static_extents  = bpstd::extents<int,3,4>;
+  using mixed_extents   = bpstd::extents<int,bpstd::dynamic_extent,4>;
+  using dynamic_extents = bpstd::dextents<int,2>;
+
+  // Static extents take no storage, so neither do their mappings
+  static_assert(std::is_empty<static_extents>::value, "");
+  static_assert(std::is_empty<bpstd::layout_right::mapping<static_extents>>::value, "");
+  static_assert(std::is_empty<bpstd::layout_left::mapping<static_extents>>::value, "");
+  static_assert(sizeof(bpstd::mdspan<int,static_extents>) == sizeof(int*), "");
+
+  static_assert(std::is_same<dynamic_extents,bpstd::extents<int,bpstd::dynamic_extent,bpstd::dynamic_extent>>::value, "");
+
+  constexpr auto constexpr_extents = mixed_extents{5};
+  static_assert(constexpr_extents.extent(0) == 5, "");
+  static_assert(constexpr_extents.extent(1) == 4, "");
+  static_assert(bpstd::layout_right::mapping<mixed_extents>{constexpr_extents}(2, 3) == 11, "");
+  static_assert(bpstd::layout_left::mapping<mixed_extents>{constexpr_extents}(2, 3) == 17, "");
+
+  // A 3x4 matrix where each element is 10 * row + column
+  struct matrix
+  {
+    int data[12];
+
+    matrix()
+    {
+      for (auto i = 0; i < 12; ++i) {
+        data[i] = (i / 4) * 10 + (i % 4);
+      }
+    }
+  };
+
+} // anonymous namespace
+
+//=============================================================================
+// class : extents
+//=============================================================================
+
+TEST_CASE("extents::rank()", "[observers]")
+{
+  SECTION("Returns the number of dimensions")
+  {
+    REQUIRE( static_extents::rank() == 2u );
+    REQUIRE( bpstd::extents<int>::rank() == 0u );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("extents::rank_dynamic()", "[observers]")
+{
+  SECTION("Returns the number of dynamic dimensions")
+  {
+    REQUIRE( static_extents::rank_dynamic() == 0u );
+    REQUIRE( mixed_extents::rank_dynamic() == 1u );
+    REQUIRE( dynamic_extents::rank_dynamic() == 2u );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("extents::static_extent( rank_type )", "[observers]")
+{
+  SECTION("Returns the static extent, or dynamic_extent")
+  {
+    REQUIRE( mixed_extents::static_extent(0) == bpstd::dynamic_extent );
+    REQUIRE( mixed_extents::static_extent(1) == 4u );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("extents::extents( OtherIndexTypes... )", "[ctor]")
+{
+  SECTION("Constructed from the dynamic extents")
+  {
+    const auto sut = bpstd::extents<int,2,bpstd::dynamic_extent,3,bpstd::dynamic_extent>{5, 7};
+
+    SECTION("Dynamic extents are assigned in order")
+    {
+      REQUIRE( sut.extent(0) == 2 );
+      REQUIRE( sut.extent(1) == 5 );
+      REQUIRE( sut.extent(2) == 3 );
+      REQUIRE( sut.extent(3) == 7 );
+    }
+  }
+
+  SECTION("Constructed from every extent")
+  {
+    const auto sut = mixed_extents{6, 4};
+
+    SECTION("Dynamic extents take their value")
+    {
+      REQUIRE( sut.extent(0) == 6 );
+      REQUIRE( sut.extent(1) == 4 );
+    }
+  }
+
+  SECTION("Default constructed")
+  {
+    const auto sut = mixed_extents{};
+
+    SECTION("Dynamic extents are 0")
+    {
+      REQUIRE( sut.extent(0) == 0 );
+      REQUIRE( sut.extent(1) == 4 );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("extents::extents( const std::array<OtherIndexType,N>& )", "[ctor]")
+{
+  const auto sut = mixed_extents{std::array<long,1>{{9}}};
+
+  SECTION("Dynamic extents take their value")
+  {
+    REQUIRE( sut.extent(0) == 9 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("operator==( const extents&, const extents& )", "[comparison]")
+{
+  SECTION("Extents have the same values")
+  {
+    SECTION("Returns true, regardless of which are static")
+    {
+      REQUIRE( static_extents{} == (dynamic_extents{3, 4}) );
+    }
+  }
+
+  SECTION("Extents have different values")
+  {
+    SECTION("Returns false")
+    {
+      REQUIRE( static_extents{} != (dynamic_extents{4, 3}) );
+      REQUIRE( static_extents{} != bpstd::extents<int,3>{} );
+    }
+  }
+}
+
+//=============================================================================
+// class : layout_right::mapping
+//=============================================================================
+
+TEST_CASE("layout_right::mapping::operator()( Indices... )", "[mapping]")
+{
+  const auto sut = bpstd::layout_right::mapping<bpstd::dextents<int,3>>{
+    bpstd::dextents<int,3>{2, 3, 4}
+  };
+
+  SECTION("Rightmost index is contiguous")
+  {
+    REQUIRE( sut(0, 0, 0) == 0 );
+    REQUIRE( sut(0, 0, 1) == 1 );
+    REQUIRE( sut(0, 1, 0) == 4 );
+    REQUIRE( sut(1, 0, 0) == 12 );
+    REQUIRE( sut(1, 2, 3) == 23 );
+  }
+
+  SECTION("Strides are the product of the extents to the right")
+  {
+    REQUIRE( sut.stride(0) == 12 );
+    REQUIRE( sut.stride(1) == 4 );
+    REQUIRE( sut.stride(2) == 1 );
+  }
+
+  SECTION("Required span size is every element")
+  {
+    REQUIRE( sut.required_span_size() == 24 );
+  }
+}
+
+//=============================================================================
+// class : layout_left::mapping
+//=============================================================================
+
+TEST_CASE("layout_left::mapping::operator()( Indices... )", "[mapping]")
+{
+  const auto sut = bpstd::layout_left::mapping<bpstd::dextents<int,3>>{
+    bpstd::dextents<int,3>{2, 3, 4}
+  };
+
+  SECTION("Leftmost index is contiguous")
+  {
+    REQUIRE( sut(0, 0, 0) == 0 );
+    REQUIRE( sut(1, 0, 0) == 1 );
+    REQUIRE( sut(0, 1, 0) == 2 );
+    REQUIRE( sut(0, 0, 1) == 6 );
+    REQUIRE( sut(1, 2, 3) == 23 );
+  }
+
+  SECTION("Strides are the product of the extents to the left")
+  {
+    REQUIRE( sut.stride(0) == 1 );
+    REQUIRE( sut.stride(1) == 2 );
+    REQUIRE( sut.stride(2) == 6 );
+  }
+}
+
+//=============================================================================
+// class : layout_stride::mapping
+//=============================================================================
+
+TEST_CASE("layout_stride::mapping::operator()( Indices... )", "[mapping]")
+{
+  SECTION("Constructed from extents and strides")
+  {
+    const auto sut = bpstd::layout_stride::mapping<static_extents>{
+      static_extents{},
+      std::array<int,2>{{1, 5}}
+    };
+
+    SECTION("Offset is the sum of each index times its stride")
+    {
+      REQUIRE( sut(2, 3) == 17 );
+    }
+
+    SECTION("Required span size spans the largest offset")
+    {
+      REQUIRE( sut.required_span_size() == 18 );
+      REQUIRE_FALSE( sut.is_exhaustive() );
+    }
+  }
+
+  SECTION("Constructed from a layout_left mapping")
+  {
+    const auto left = bpstd::layout_left::mapping<static_extents>{};
+    const auto sut = bpstd::layout_stride::mapping<static_extents>{left};
+
+    SECTION("Maps indices identically")
+    {
+      for (auto i = 0; i < 3; ++i) {
+        for (auto j = 0; j < 4; ++j) {
+          REQUIRE( sut(i, j) == left(i, j) );
+        }
+      }
+      REQUIRE( sut.is_exhaustive() );
+    }
+  }
+
+  SECTION("An extent is zero")
+  {
+    const auto sut = bpstd::layout_stride::mapping<dynamic_extents>{
+      dynamic_extents{0, 4},
+      std::array<int,2>{{4, 1}}
+    };
+
+    SECTION("Required span size is zero")
+    {
+      REQUIRE( sut.required_span_size() == 0 );
+    }
+  }
+}
+
+//=============================================================================
+// class : mdspan
+//=============================================================================
+
+TEST_CASE("mdspan::operator()( OtherIndexTypes... )", "[element access]")
+{
+  auto m = matrix{};
+
+  SECTION("Extents are static")
+  {
+    const auto sut = bpstd::mdspan<int,static_extents>{m.data};
+
+    SECTION("Accesses the element at the index")
+    {
+      REQUIRE( sut(0, 0) == 0 );
+      REQUIRE( sut(1, 2) == 12 );
+      REQUIRE( sut(2, 3) == 23 );
+    }
+
+    SECTION("Returns a mutable reference")
+    {
+      sut(1, 1) = 42;
+
+      REQUIRE( m.data[5] == 42 );
+    }
+  }
+
+  SECTION("Extents are dynamic")
+  {
+    const auto sut = bpstd::mdspan<int,dynamic_extents>{m.data, 3, 4};
+
+    SECTION("Accesses the element at the index")
+    {
+      REQUIRE( sut(2, 1) == 21 );
+      REQUIRE( sut.size() == 12u );
+      REQUIRE( sut.extent(0) == 3 );
+    }
+  }
+
+  SECTION("Layout is layout_left")
+  {
+    const auto sut = bpstd::mdspan<int,bpstd::extents<int,4,3>,bpstd::layout_left>{m.data};
+
+    SECTION("Views the transpose")
+    {
+      REQUIRE( sut(3, 1) == 13 );
+      REQUIRE( sut(1, 2) == 21 );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("mdspan::operator[]( const std::array<OtherIndexType,rank>& )", "[element access]")
+{
+  auto m = matrix{};
+  const auto sut = bpstd::mdspan<const int,static_extents>{m.data};
+
+  SECTION("Accesses the element at the index")
+  {
+    REQUIRE( sut[std::array<int,2>{{2, 2}}] == 22 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("mdspan::empty()", "[observers]")
+{
+  SECTION("An extent is zero")
+  {
+    SECTION("Returns true")
+    {
+      const auto sut = bpstd::mdspan<int,dynamic_extents>{nullptr, 0, 4};
+
+      REQUIRE( sut.empty() );
+    }
+  }
+
+  SECTION("No extent is zero")
+  {
+    SECTION("Returns false")
+    {
+      auto m = matrix{};
+      const auto sut = bpstd::mdspan<int,static_extents>{m.data};
+
+      REQUIRE_FALSE( sut.empty() );
+    }
+  }
+}
+
+//=============================================================================
+// non-member functions : submdspan
+//=============================================================================
+
+TEST_CASE("submdspan( const mdspan&, Slices... )", "[submdspan]")
+{
+  auto m = matrix{};
+  const auto source = bpstd::mdspan<int,static_extents>{m.data};
+
+  SECTION("Slices a row")
+  {
+    const auto sut = bpstd::submdspan(source, 1, bpstd::full_extent);
+
+    SECTION("Keeps the static extent of the full dimension")
+    {
+      REQUIRE( decltype(sut)::rank() == 1u );
+      REQUIRE( decltype(sut)::static_extent(0) == 4u );
+    }
+
+    SECTION("Views the row")
+    {
+      REQUIRE( sut(0) == 10 );
+      REQUIRE( sut(3) == 13 );
+    }
+  }
+
+  SECTION("Slices a column")
+  {
+    const auto sut = bpstd::submdspan(source, bpstd::full_extent, 2);
+
+    SECTION("Views the column")
+    {
+      REQUIRE( sut.extent(0) == 3 );
+      REQUIRE( sut.stride(0) == 4 );
+      REQUIRE( sut(0) == 2 );
+      REQUIRE( sut(2) == 22 );
+    }
+  }
+
+  SECTION("Slices a range of each dimension")
+  {
+    const auto sut = bpstd::submdspan(source, std::make_pair(1, 3), std::make_pair(2, 4));
+
+    SECTION("Views the block")
+    {
+      REQUIRE( decltype(sut)::rank_dynamic() == 2u );
+      REQUIRE( sut.extent(0) == 2 );
+      REQUIRE( sut.extent(1) == 2 );
+      REQUIRE( sut(0, 0) == 12 );
+      REQUIRE( sut(1, 1) == 23 );
+    }
+  }
+
+  SECTION("Slices a single element")
+  {
+    const auto sut = bpstd::submdspan(source, 2, 1);
+
+    SECTION("Views a rank 0 mdspan")
+    {
+      REQUIRE( decltype(sut)::rank() == 0u );
+      REQUIRE( sut() == 21 );
+    }
+  }
+}
@@ -0,0 +1,258 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#include <bpstd/numeric.hpp>
+
+#include <catch2/catch.hpp>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <numeric>
+#include <string>
+#include <vector>
+
+// MSVC 2015 seems to emit an error that __forceinline'd functions may not be
+// __forceinline'd at the *end of the translation unit* using it, for some
+// stupid reason.
+#if defined(_MSC_VER)
+# pragma warning(disable:4714)
+#endif
+
+namespace {
+
+  // Enough elements to be split across several threads
+  constexpr auto large_size = std::size_t{100003u};
+
+  std::vector<long long> make_sequence(std::size_t size)
+  {
+    auto result = std::vector<long long>(size);
+    std::iota(result.begin(), result.end(), 1LL);
+    return result;
+  }
+
+} // anonymous namespace
+
+//=============================================================================
+// algorithms : reduce
+//=============================================================================
+
+TEST_CASE("reduce( InputIt, InputIt, T, BinaryOp )", "[numeric]")
+{
+  SECTION("Range is empty")
+  {
+    const auto values = std::vector<int>{};
+
+    SECTION("Returns init")
+    {
+      REQUIRE( bpstd::reduce(values.begin(), values.end(), 42) == 42 );
+    }
+  }
+
+  SECTION("Range is not empty")
+  {
+    const auto values = std::list<int>{1, 2, 3, 4};
+
+    SECTION("Returns the reduction")
+    {
+      REQUIRE( bpstd::reduce(values.begin(), values.end()) == 10 );
+      REQUIRE( bpstd::reduce(values.begin(), values.end(), 2, std::multiplies<int>{}) == 48 );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("reduce( ExecutionPolicy&&, ForwardIt, ForwardIt, T, BinaryOp )", "[numeric]")
+{
+  const auto values = make_sequence(large_size);
+  const auto expected = static_cast<long long>(large_size) * (large_size + 1) / 2;
+
+  SECTION("Policy is parallel")
+  {
+    SECTION("Returns the reduction")
+    {
+      REQUIRE( bpstd::reduce(bpstd::execution::par, values.begin(), values.end()) == expected );
+      REQUIRE( bpstd::reduce(bpstd::execution::par, values.begin(), values.end(), 5LL) == expected + 5 );
+    }
+  }
+
+  SECTION("Operation is associative, but not commutative")
+  {
+    auto words = std::vector<std::string>(large_size, "a");
+    words.back() = "z";
+
+    const auto result = bpstd::reduce(bpstd::execution::par,
+                                      words.begin(), words.end(),
+                                      std::string{">"},
+                                      std::plus<std::string>{});
+
+    SECTION("Preserves the order of elements")
+    {
+      REQUIRE( result.size() == large_size + 1u );
+      REQUIRE( result.front() == '>' );
+      REQUIRE( result.back() == 'z' );
+    }
+  }
+}
+
+//=============================================================================
+// algorithms : transform_reduce
+//=============================================================================
+
+TEST_CASE("transform_reduce( InputIt1, InputIt1, InputIt2, T )", "[numeric]")
+{
+  const auto lhs = std::vector<int>{1, 2, 3};
+  const auto rhs = std::vector<int>{4, 5, 6};
+
+  SECTION("Returns the inner product")
+  {
+    REQUIRE( bpstd::transform_reduce(lhs.begin(), lhs.end(), rhs.begin(), 0) == 32 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("transform_reduce( ExecutionPolicy&&, ForwardIt1, ForwardIt1, ForwardIt2, T )", "[numeric]")
+{
+  const auto lhs = make_sequence(large_size);
+  const auto rhs = std::vector<long long>(large_size, 2LL);
+  const auto expected = static_cast<long long>(large_size) * (large_size + 1);
+
+  SECTION("Returns the inner product")
+  {
+    REQUIRE( bpstd::transform_reduce(bpstd::execution::par,
+                                     lhs.begin(), lhs.end(),
+                                     rhs.begin(),
+                                     0LL) == expected );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("transform_reduce( ExecutionPolicy&&, ForwardIt, ForwardIt, T, BinaryReductionOp, UnaryTransformOp )", "[numeric]")
+{
+  const auto values = make_sequence(large_size);
+  const auto expected = static_cast<long long>(large_size);
+
+  SECTION("Reduces the transformed elements")
+  {
+    const auto count_odd = [](long long v) { return v % 2; };
+
+    REQUIRE( bpstd::transform_reduce(bpstd::execution::par,
+                                     values.begin(), values.end(),
+                                     0LL,
+                                     std::plus<long long>{},
+                                     count_odd) == (expected + 1) / 2 );
+  }
+}
+
+//=============================================================================
+// algorithms : inclusive_scan
+//=============================================================================
+
+TEST_CASE("inclusive_scan( InputIt, InputIt, OutputIt, BinaryOp, T )", "[numeric]")
+{
+  const auto values = std::list<int>{1, 2, 3, 4};
+  auto output = std::vector<int>(4u);
+
+  SECTION("No initial value")
+  {
+    const auto result = bpstd::inclusive_scan(values.begin(), values.end(), output.begin());
+
+    SECTION("Writes each prefix sum")
+    {
+      REQUIRE( result == output.end() );
+      REQUIRE( output == (std::vector<int>{1, 3, 6, 10}) );
+    }
+  }
+
+  SECTION("Initial value")
+  {
+    bpstd::inclusive_scan(values.begin(), values.end(), output.begin(), std::multiplies<int>{}, 2);
+
+    SECTION("Includes the initial value in every prefix")
+    {
+      REQUIRE( output == (std::vector<int>{2, 4, 12, 48}) );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("inclusive_scan( ExecutionPolicy&&, ForwardIt1, ForwardIt1, ForwardIt2, BinaryOp, T )", "[numeric]")
+{
+  const auto values = make_sequence(large_size);
+  auto expected = std::vector<long long>(large_size);
+  std::partial_sum(values.begin(), values.end(), expected.begin());
+
+  SECTION("No initial value")
+  {
+    auto output = std::vector<long long>(large_size);
+
+    const auto result = bpstd::inclusive_scan(bpstd::execution::par,
+                                              values.begin(), values.end(),
+                                              output.begin());
+
+    SECTION("Writes each prefix sum")
+    {
+      REQUIRE( result == output.end() );
+      REQUIRE( output == expected );
+    }
+  }
+
+  SECTION("Initial value")
+  {
+    auto output = std::vector<long long>(large_size);
+
+    bpstd::inclusive_scan(bpstd::execution::par,
+                          values.begin(), values.end(),
+                          output.begin(),
+                          std::plus<long long>{},
+                          10LL);
+
+    SECTION("Includes the initial value in every prefix")
+    {
+      for (auto& v : expected) {
+        v += 10;
+      }
+
+      REQUIRE( output == expected );
+    }
+  }
+
+  SECTION("Output is the input")
+  {
+    auto output = values;
+
+    bpstd::inclusive_scan(bpstd::execution::par,
+                          output.begin(), output.end(),
+                          output.begin());
+
+    SECTION("Scans in place")
+    {
+      REQUIRE( output == expected );
+    }
+  }
+}
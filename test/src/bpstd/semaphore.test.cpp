@@ -0,0 +1,239 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#include <bpstd/semaphore.hpp>
+
+#include <catch2/catch.hpp>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+// MSVC 2015 seems to emit an error that __forceinline'd functions may not be
+// __forceinline'd at the *end of the translation unit* using it, for some
+// stupid reason.
+#if defined(_MSC_VER)
+# pragma warning(disable:4714)
+#endif
+
+//=============================================================================
+// class : counting_semaphore
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Static Member Functions
+//-----------------------------------------------------------------------------
+
+TEST_CASE("counting_semaphore::max()", "[observers]")
+{
+  SECTION("Semaphore is binary")
+  {
+    SECTION("Supports a count of at least 1")
+    {
+      REQUIRE( bpstd::binary_semaphore::max() >= 1 );
+    }
+  }
+
+  SECTION("Semaphore uses the default maximum")
+  {
+    SECTION("Supports a 32-bit count")
+    {
+      REQUIRE( bpstd::counting_semaphore<>::max() >= 2147483647 );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+TEST_CASE("counting_semaphore::try_acquire()", "[modifiers]")
+{
+  SECTION("Counter is zero")
+  {
+    bpstd::counting_semaphore<4> sut{0};
+
+    SECTION("Returns false")
+    {
+      REQUIRE_FALSE( sut.try_acquire() );
+    }
+  }
+
+  SECTION("Counter is non-zero")
+  {
+    bpstd::counting_semaphore<4> sut{2};
+
+    SECTION("Acquires until the counter reaches zero")
+    {
+      REQUIRE( sut.try_acquire() );
+      REQUIRE( sut.try_acquire() );
+      REQUIRE_FALSE( sut.try_acquire() );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("counting_semaphore::release( std::ptrdiff_t )", "[modifiers]")
+{
+  bpstd::counting_semaphore<4> sut{0};
+
+  SECTION("Releases the given number of permits")
+  {
+    sut.release(3);
+
+    REQUIRE( sut.try_acquire() );
+    REQUIRE( sut.try_acquire() );
+    REQUIRE( sut.try_acquire() );
+    REQUIRE_FALSE( sut.try_acquire() );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("counting_semaphore::acquire()", "[modifiers]")
+{
+  SECTION("Semaphore is released by another thread")
+  {
+    bpstd::binary_semaphore sut{0};
+    auto value = 0;
+
+    auto thread = std::thread{[&]{
+      value = 42;
+      sut.release();
+    }};
+    sut.acquire();
+
+    const auto result = value;
+    thread.join();
+
+    SECTION("Observes writes made before the release")
+    {
+      REQUIRE( result == 42 );
+    }
+  }
+
+  SECTION("Semaphore guards a critical section")
+  {
+    static constexpr auto thread_count = 4;
+    static constexpr auto iterations = 10000;
+
+    bpstd::binary_semaphore sut{1};
+    auto counter = 0;
+    auto threads = std::vector<std::thread>{};
+
+    for (auto i = 0; i < thread_count; ++i) {
+      threads.emplace_back([&]{
+        for (auto j = 0; j < iterations; ++j) {
+          sut.acquire();
+          ++counter;
+          sut.release();
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    SECTION("Only one thread enters at a time")
+    {
+      REQUIRE( counter == thread_count * iterations );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("counting_semaphore::try_acquire_for( const duration& )", "[modifiers]")
+{
+  SECTION("Counter stays zero")
+  {
+    bpstd::binary_semaphore sut{0};
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto result = sut.try_acquire_for(std::chrono::milliseconds{20});
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    SECTION("Returns false")
+    {
+      REQUIRE_FALSE( result );
+    }
+    SECTION("Waits for the duration")
+    {
+      REQUIRE( elapsed >= std::chrono::milliseconds{20} );
+    }
+  }
+
+  SECTION("Counter is released while waiting")
+  {
+    bpstd::binary_semaphore sut{0};
+
+    auto thread = std::thread{[&]{
+      std::this_thread::sleep_for(std::chrono::milliseconds{10});
+      sut.release();
+    }};
+    const auto result = sut.try_acquire_for(std::chrono::seconds{30});
+    thread.join();
+
+    SECTION("Returns true")
+    {
+      REQUIRE( result );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("counting_semaphore::try_acquire_until( const time_point& )", "[modifiers]")
+{
+  SECTION("Counter stays zero")
+  {
+    bpstd::binary_semaphore sut{0};
+
+    const auto deadline = std::chrono::system_clock::now() + std::chrono::milliseconds{20};
+    const auto result = sut.try_acquire_until(deadline);
+
+    SECTION("Returns false")
+    {
+      REQUIRE_FALSE( result );
+    }
+    SECTION("Waits until the deadline")
+    {
+      REQUIRE( std::chrono::system_clock::now() >= deadline );
+    }
+  }
+
+  SECTION("Counter is non-zero")
+  {
+    bpstd::binary_semaphore sut{1};
+
+    const auto deadline = std::chrono::system_clock::now();
+    const auto result = sut.try_acquire_until(deadline);
+
+    SECTION("Returns true")
+    {
+      REQUIRE( result );
+    }
+  }
+}
@@ -1085,3 +1085,52 @@ TEST_CASE("span::rbegin/span::rend", "[iterators]")
   auto result = std::equal(sut.rbegin(), sut.rend(), arr.rbegin());
   REQUIRE(result);
 }
+
+//==============================================================================
+// non-member functions : class : span
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Utilities
+//------------------------------------------------------------------------------
+
+TEST_CASE("as_bytes(span<T,N>)", "[utilities]")
+{
+  auto arr = std::array<int,3u>{{1,2,3}};
+
+  SECTION("Span has static extent")
+  {
+    const auto sut = bpstd::span<int,3u>{arr};
+    const auto result = bpstd::as_bytes(sut);
+
+    using result_type = decltype(bpstd::as_bytes(sut));
+    static_assert(result_type::extent == sizeof(int) * 3u, "");
+    REQUIRE(result.size() == sut.size_bytes());
+  }
+
+  SECTION("Span has dynamic extent")
+  {
+    const auto sut = bpstd::span<int>{arr};
+    const auto result = bpstd::as_bytes(sut);
+
+    using result_type = decltype(bpstd::as_bytes(sut));
+    static_assert(result_type::extent == bpstd::dynamic_extent, "");
+    REQUIRE(result.size() == sut.size_bytes());
+  }
+}
+
+TEST_CASE("as_writable_bytes(span<T,N>)", "[utilities]")
+{
+  auto arr = std::array<int,3u>{{1,2,3}};
+
+  SECTION("Span has dynamic extent")
+  {
+    const auto sut = bpstd::span<int>{arr};
+    const auto result = bpstd::as_writable_bytes(sut);
+
+    using result_type = decltype(bpstd::as_writable_bytes(sut));
+    static_assert(result_type::extent == bpstd::dynamic_extent, "");
+    REQUIRE(static_cast<const void*>(result.data()) == sut.data());
+    REQUIRE(result.size() == sut.size_bytes());
+  }
+}
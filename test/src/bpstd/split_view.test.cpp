@@ -0,0 +1,267 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#include <bpstd/split_view.hpp>
+
+#include <catch2/catch.hpp>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// MSVC 2015 seems to emit an error that __forceinline'd functions may not be
+// __forceinline'd at the *end of the translation unit* using it, for some
+// stupid reason.
+#if defined(_MSC_VER)
+# pragma warning(disable:4714)
+#endif
+
+namespace {
+
+  template <typename Range>
+  std::vector<std::string> tokens_of(const Range& range)
+  {
+    auto result = std::vector<std::string>{};
+    for (const auto& token : range) {
+      result.emplace_back(token.data(), token.size());
+    }
+    return result;
+  }
+
+  using strings = std::vector<std::string>;
+
+} // anonymous namespace
+
+static_assert(
+  std::is_same<
+    std::iterator_traits<bpstd::basic_char_split_view<char>::iterator>::iterator_category,
+    std::forward_iterator_tag
+  >::value,
+  "split_view iterators must be forward iterators"
+);
+
+//=============================================================================
+// class : basic_split_view
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Iterators
+//-----------------------------------------------------------------------------
+
+TEST_CASE("split( basic_string_view, CharT )", "[iterators]")
+{
+  SECTION("String is empty")
+  {
+    const auto sut = bpstd::split(bpstd::string_view{}, ',');
+
+    SECTION("Produces no tokens")
+    {
+      REQUIRE( sut.begin() == sut.end() );
+    }
+  }
+
+  SECTION("String contains no delimiter")
+  {
+    const auto sut = bpstd::split(bpstd::string_view{"hello"}, ',');
+
+    SECTION("Produces the whole string")
+    {
+      REQUIRE( tokens_of(sut) == strings{"hello"} );
+    }
+  }
+
+  SECTION("String contains delimiters")
+  {
+    const auto sut = bpstd::split(bpstd::string_view{"a,bc,def"}, ',');
+
+    SECTION("Produces each token")
+    {
+      REQUIRE( tokens_of(sut) == (strings{"a", "bc", "def"}) );
+    }
+  }
+
+  SECTION("String contains adjacent delimiters")
+  {
+    const auto sut = bpstd::split(bpstd::string_view{"a,,b"}, ',');
+
+    SECTION("Produces an empty token between them")
+    {
+      REQUIRE( tokens_of(sut) == (strings{"a", "", "b"}) );
+    }
+  }
+
+  SECTION("String starts and ends with delimiter")
+  {
+    const auto sut = bpstd::split(bpstd::string_view{",a,"}, ',');
+
+    SECTION("Produces leading and trailing empty tokens")
+    {
+      REQUIRE( tokens_of(sut) == (strings{"", "a", ""}) );
+    }
+  }
+
+  SECTION("String is only a delimiter")
+  {
+    const auto sut = bpstd::split(bpstd::string_view{","}, ',');
+
+    SECTION("Produces two empty tokens")
+    {
+      REQUIRE( tokens_of(sut) == (strings{"", ""}) );
+    }
+  }
+
+  SECTION("Tokens view the original string")
+  {
+    const auto input = bpstd::string_view{"ab,cd"};
+    const auto sut = bpstd::split(input, ',');
+
+    auto it = sut.begin();
+    REQUIRE( it->data() == input.data() );
+    ++it;
+    REQUIRE( it->data() == input.data() + 3 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("split( basic_string_view, basic_string_view )", "[iterators]")
+{
+  SECTION("Delimiter is a multi-character string")
+  {
+    const auto sut = bpstd::split(bpstd::string_view{"a::b:c::"},
+                                  bpstd::string_view{"::"});
+
+    SECTION("Only splits on the whole delimiter")
+    {
+      REQUIRE( tokens_of(sut) == (strings{"a", "b:c", ""}) );
+    }
+  }
+
+  SECTION("Delimiter is longer than the string")
+  {
+    const auto sut = bpstd::split(bpstd::string_view{"ab"},
+                                  bpstd::string_view{"abc"});
+
+    SECTION("Produces the whole string")
+    {
+      REQUIRE( tokens_of(sut) == strings{"ab"} );
+    }
+  }
+
+  SECTION("Delimiter is empty")
+  {
+    const auto sut = bpstd::split(bpstd::string_view{"abc"},
+                                  bpstd::string_view{});
+
+    SECTION("Produces each character")
+    {
+      REQUIRE( tokens_of(sut) == (strings{"a", "b", "c"}) );
+    }
+  }
+
+  SECTION("Delimiter is a string literal")
+  {
+    const auto sut = bpstd::split(bpstd::string_view{"a, b, c"}, ", ");
+
+    SECTION("Converts it to a string_view")
+    {
+      REQUIRE( tokens_of(sut) == (strings{"a", "b", "c"}) );
+    }
+  }
+
+  SECTION("Delimiter is a std::string")
+  {
+    const auto delimiter = std::string{", "};
+    const auto sut = bpstd::split(bpstd::string_view{"a, b, c"}, delimiter);
+
+    SECTION("Converts it to a string_view")
+    {
+      REQUIRE( tokens_of(sut) == (strings{"a", "b", "c"}) );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("split_any_of( basic_string_view, basic_string_view )", "[iterators]")
+{
+  const auto sut = bpstd::split_any_of(bpstd::string_view{"a b\tc\n"},
+                                       bpstd::string_view{" \t\n"});
+
+  SECTION("Splits on any delimiter character")
+  {
+    REQUIRE( tokens_of(sut) == (strings{"a", "b", "c", ""}) );
+  }
+
+  SECTION("Delimiters are a string literal")
+  {
+    const auto literal_sut = bpstd::split_any_of(bpstd::string_view{"a b\tc\n"},
+                                                 " \t\n");
+
+    SECTION("Converts them to a string_view")
+    {
+      REQUIRE( tokens_of(literal_sut) == tokens_of(sut) );
+    }
+  }
+
+  SECTION("Delimiters are a std::string")
+  {
+    const auto delimiters = std::string{" \t\n"};
+    const auto string_sut = bpstd::split_any_of(bpstd::string_view{"a b\tc\n"},
+                                                delimiters);
+
+    SECTION("Converts them to a string_view")
+    {
+      REQUIRE( tokens_of(string_sut) == tokens_of(sut) );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("basic_split_view::iterator::operator++( int )", "[iterators]")
+{
+  const auto sut = bpstd::split(bpstd::string_view{"x,y"}, ',');
+
+  SECTION("Returns the previous iterator")
+  {
+    auto it = sut.begin();
+    const auto previous = it++;
+
+    REQUIRE( *previous == "x" );
+    REQUIRE( *it == "y" );
+  }
+
+  SECTION("Iterators are multi-pass")
+  {
+    const auto first = sut.begin();
+    auto second = first;
+    ++second;
+
+    REQUIRE( *first == "x" );
+    REQUIRE( std::distance(first, sut.end()) == 2 );
+    REQUIRE( std::distance(second, sut.end()) == 1 );
+  }
+}
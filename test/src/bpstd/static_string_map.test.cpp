@@ -0,0 +1,209 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#include <bpstd/static_string_map.hpp>
+
+#include <catch2/catch.hpp>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+// MSVC 2015 seems to emit an error that __forceinline'd functions may not be
+// __forceinline'd at the *end of the translation unit* using it, for some
+// stupid reason.
+#if defined(_MSC_VER)
+# pragma warning(disable:4714)
+#endif
+
+namespace {
+
+  const std::pair<bpstd::string_view,int> methods[] = {
+    {"GET", 1},
+    {"HEAD", 2},
+    {"POST", 3},
+    {"PUT", 4},
+    {"DELETE", 5},
+    {"CONNECT", 6},
+    {"OPTIONS", 7},
+    {"TRACE", 8},
+    {"PATCH", 9},
+  };
+
+#if defined(__cplusplus) && __cplusplus >= 201402L
+  constexpr std::pair<bpstd::string_view,int> constexpr_methods[] = {
+    {"GET", 1},
+    {"HEAD", 2},
+    {"POST", 3},
+    {"PUT", 4},
+    {"PATCH", 9},
+  };
+  constexpr auto method_map = bpstd::make_static_string_map(constexpr_methods);
+
+  static_assert(method_map.at("PATCH") == 9, "");
+  static_assert(!method_map.contains("get"), "");
+#endif
+
+} // anonymous namespace
+
+//=============================================================================
+// class : static_string_map
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+TEST_CASE("static_string_map::static_string_map( const value_type (&)[N] )", "[ctor]")
+{
+  SECTION("Entries contain duplicate keys")
+  {
+    const std::pair<bpstd::string_view,int> entries[] = {
+      {"a", 1}, {"b", 2}, {"a", 3}
+    };
+
+    SECTION("Throws std::invalid_argument")
+    {
+      using map_type = bpstd::static_string_map<int,3u>;
+
+      REQUIRE_THROWS_AS( map_type{entries}, std::invalid_argument );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Iterators
+//-----------------------------------------------------------------------------
+
+TEST_CASE("static_string_map::begin()", "[iterators]")
+{
+  const auto sut = bpstd::make_static_string_map(methods);
+
+  SECTION("Iterates entries in construction order")
+  {
+    auto i = 0u;
+    for (const auto& entry : sut) {
+      REQUIRE( entry.first == methods[i].first );
+      REQUIRE( entry.second == methods[i].second );
+      ++i;
+    }
+    REQUIRE( i == sut.size() );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Lookup
+//-----------------------------------------------------------------------------
+
+TEST_CASE("static_string_map::find( key_type )", "[lookup]")
+{
+  const auto sut = bpstd::make_static_string_map(methods);
+
+  SECTION("Key exists")
+  {
+    SECTION("Finds every entry")
+    {
+      for (const auto& entry : methods) {
+        const auto it = sut.find(entry.first);
+
+        REQUIRE( it != sut.end() );
+        REQUIRE( it->second == entry.second );
+      }
+    }
+  }
+
+  SECTION("Key does not exist")
+  {
+    SECTION("Returns end")
+    {
+      REQUIRE( sut.find("get") == sut.end() );
+      REQUIRE( sut.find("") == sut.end() );
+      REQUIRE( sut.find("GETS") == sut.end() );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("static_string_map::find( key_type ) with many keys", "[lookup]")
+{
+  // Enough keys that buckets with several entries must be displaced
+  static const std::string storage[] = {
+    "accept", "accept-charset", "accept-encoding", "accept-language",
+    "accept-ranges", "age", "allow", "authorization", "cache-control",
+    "connection", "content-encoding", "content-language", "content-length",
+    "content-location", "content-range", "content-type", "cookie", "date",
+    "etag", "expect", "expires", "from", "host", "if-match",
+    "if-modified-since", "if-none-match", "if-range", "if-unmodified-since",
+    "last-modified", "location", "max-forwards", "pragma",
+    "proxy-authenticate", "proxy-authorization", "range", "referer",
+    "retry-after", "server", "set-cookie", "te", "trailer",
+    "transfer-encoding", "upgrade", "user-agent", "vary", "via", "warning",
+    "www-authenticate",
+  };
+  constexpr auto size = sizeof(storage) / sizeof(storage[0]);
+
+  std::pair<bpstd::string_view,std::size_t> entries[size] = {};
+  for (auto i = 0u; i < size; ++i) {
+    entries[i] = {storage[i], i};
+  }
+
+  const auto sut = bpstd::make_static_string_map(entries);
+
+  SECTION("Finds every entry")
+  {
+    for (auto i = 0u; i < size; ++i) {
+      REQUIRE( sut.at(storage[i]) == i );
+    }
+  }
+
+  SECTION("Unknown key is not found")
+  {
+    REQUIRE_FALSE( sut.contains("x-forwarded-for") );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("static_string_map::at( key_type )", "[lookup]")
+{
+  const auto sut = bpstd::make_static_string_map(methods);
+
+  SECTION("Key exists")
+  {
+    SECTION("Returns mapped value")
+    {
+      REQUIRE( sut.at("DELETE") == 5 );
+    }
+  }
+
+  SECTION("Key does not exist")
+  {
+    SECTION("Throws std::out_of_range")
+    {
+      REQUIRE_THROWS_AS( sut.at("delete"), std::out_of_range );
+    }
+  }
+}
@@ -0,0 +1,315 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#include <bpstd/strided_span.hpp>
+
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+// MSVC 2015 seems to emit an error that __forceinline'd functions may not be
+// __forceinline'd at the *end of the translation unit* using it, for some
+// stupid reason.
+#if defined(_MSC_VER)
+# pragma warning(disable:4714)
+#endif
+
+namespace {
+
+  struct particle
+  {
+    double x;
+    char   tag;
+    int    id;
+  };
+
+  std::vector<particle> make_particles()
+  {
+    auto result = std::vector<particle>{};
+    for (auto i = 0; i < 5; ++i) {
+      result.push_back(particle{i * 1.5, static_cast<char>('a' + i), 10 - i});
+    }
+    return result;
+  }
+
+  using iterator = bpstd::strided_span<int>::iterator;
+
+  static_assert(
+    std::is_same<std::iterator_traits<iterator>::iterator_category,std::random_access_iterator_tag>::value,
+    "strided_span iterators must be random access"
+  );
+  static_assert(std::is_convertible<bpstd::strided_span<int>,bpstd::strided_span<const int>>::value, "");
+  static_assert(!std::is_convertible<bpstd::strided_span<const int>,bpstd::strided_span<int>>::value, "");
+
+  // Projecting a member of a const object only yields a const view
+  static_assert(std::is_constructible<bpstd::strided_span<const int>,bpstd::span<const particle>,int particle::*>::value, "");
+  static_assert(!std::is_constructible<bpstd::strided_span<int>,bpstd::span<const particle>,int particle::*>::value, "");
+  static_assert(!std::is_constructible<bpstd::strided_span<int>,bpstd::span<particle>,char particle::*>::value, "");
+
+} // anonymous namespace
+
+//=============================================================================
+// class : strided_span
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+TEST_CASE("strided_span::strided_span()", "[ctor]")
+{
+  const auto sut = bpstd::strided_span<int>{};
+
+  SECTION("Is empty")
+  {
+    REQUIRE( sut.empty() );
+    REQUIRE( sut.begin() == sut.end() );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("strided_span::strided_span( span<U,N> )", "[ctor]")
+{
+  int array[] = {1, 2, 3, 4};
+  const auto sut = bpstd::strided_span<const int>{bpstd::span<int>{array}};
+
+  SECTION("Views every element")
+  {
+    REQUIRE( sut.size() == 4u );
+    REQUIRE( sut.stride() == static_cast<std::ptrdiff_t>(sizeof(int)) );
+    REQUIRE( std::equal(sut.begin(), sut.end(), array) );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("strided_span::strided_span( span<U,N>, size_type )", "[ctor]")
+{
+  int array[] = {0, 1, 2, 3, 4, 5, 6};
+
+  SECTION("Step evenly divides the span")
+  {
+    const auto sut = bpstd::strided_span<int>{bpstd::span<int>{array}.first(6u), 2u};
+
+    SECTION("Views every step'th element")
+    {
+      REQUIRE( sut.size() == 3u );
+      REQUIRE( sut[0] == 0 );
+      REQUIRE( sut[1] == 2 );
+      REQUIRE( sut[2] == 4 );
+    }
+  }
+
+  SECTION("Step does not evenly divide the span")
+  {
+    const auto sut = bpstd::strided_span<int>{bpstd::span<int>{array}, 3u};
+
+    SECTION("Includes the partial last step")
+    {
+      REQUIRE( sut.size() == 3u );
+      REQUIRE( sut.back() == 6 );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("strided_span::strided_span( span<U,N>, M C::* )", "[ctor]")
+{
+  auto particles = make_particles();
+  const auto objects = bpstd::span<particle>{particles.data(), particles.size()};
+
+  SECTION("Projects a member")
+  {
+    const auto sut = bpstd::strided_span<int>{objects, &particle::id};
+
+    SECTION("Views the member of every object")
+    {
+      REQUIRE( sut.size() == particles.size() );
+      REQUIRE( sut.stride() == static_cast<std::ptrdiff_t>(sizeof(particle)) );
+      for (auto i = 0u; i < sut.size(); ++i) {
+        REQUIRE( &sut[i] == &particles[i].id );
+      }
+    }
+
+    SECTION("Writes through to the objects")
+    {
+      std::fill(sut.begin(), sut.end(), 7);
+
+      for (const auto& p : particles) {
+        REQUIRE( p.id == 7 );
+      }
+    }
+  }
+
+  SECTION("Source span is empty")
+  {
+    const auto sut = bpstd::strided_span<double>{objects.first(0), &particle::x};
+
+    SECTION("Is empty")
+    {
+      REQUIRE( sut.empty() );
+      REQUIRE( sut.data() == nullptr );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Element Access
+//-----------------------------------------------------------------------------
+
+TEST_CASE("strided_span::front()", "[element access]")
+{
+  auto particles = make_particles();
+  const auto sut = bpstd::strided_span<char>{
+    bpstd::span<particle>{particles.data(), particles.size()},
+    &particle::tag
+  };
+
+  SECTION("Returns the first element")
+  {
+    REQUIRE( sut.front() == 'a' );
+    REQUIRE( sut.back() == 'e' );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Subviews
+//-----------------------------------------------------------------------------
+
+TEST_CASE("strided_span::subspan( size_type, size_type )", "[subviews]")
+{
+  int array[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  const auto evens = bpstd::strided_span<int>{bpstd::span<int>{array}, 2u};
+
+  SECTION("Count is dynamic_extent")
+  {
+    const auto sut = evens.subspan(1u);
+
+    SECTION("Views the remaining elements, keeping the stride")
+    {
+      REQUIRE( sut.size() == 4u );
+      REQUIRE( sut.front() == 2 );
+      REQUIRE( sut.back() == 8 );
+    }
+  }
+
+  SECTION("Offset is the size")
+  {
+    const auto sut = evens.subspan(evens.size());
+
+    SECTION("Is empty")
+    {
+      REQUIRE( sut.empty() );
+    }
+  }
+
+  SECTION("Taking the first and last elements")
+  {
+    REQUIRE( evens.first(2u).back() == 2 );
+    REQUIRE( evens.last(2u).front() == 6 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("strided_span::every( size_type )", "[subviews]")
+{
+  int array[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  const auto sut = bpstd::strided_span<int>{bpstd::span<int>{array}, 2u}.every(2u);
+
+  SECTION("Multiplies the stride")
+  {
+    REQUIRE( sut.size() == 3u );
+    REQUIRE( sut[0] == 0 );
+    REQUIRE( sut[1] == 4 );
+    REQUIRE( sut[2] == 8 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Iterators
+//-----------------------------------------------------------------------------
+
+TEST_CASE("strided_span::begin()", "[iterators]")
+{
+  auto particles = make_particles();
+  const auto sut = bpstd::strided_span<int>{
+    bpstd::span<particle>{particles.data(), particles.size()},
+    &particle::id
+  };
+
+  SECTION("Supports random access")
+  {
+    const auto it = sut.begin();
+
+    REQUIRE( sut.end() - it == 5 );
+    REQUIRE( it[3] == 7 );
+    REQUIRE( *(it + 2) == 8 );
+    REQUIRE( *(sut.end() - 1) == 6 );
+    REQUIRE( it < sut.end() );
+  }
+
+  SECTION("Supports standard algorithms")
+  {
+    std::sort(sut.begin(), sut.end());
+
+    SECTION("Only the projected members are reordered")
+    {
+      REQUIRE( std::is_sorted(sut.begin(), sut.end()) );
+      REQUIRE( particles[0].id == 6 );
+      REQUIRE( particles[0].tag == 'a' );
+      REQUIRE( std::accumulate(sut.begin(), sut.end(), 0) == 40 );
+    }
+  }
+
+  SECTION("Iterates in reverse")
+  {
+    const auto reversed = std::vector<int>(sut.rbegin(), sut.rend());
+
+    REQUIRE( reversed == (std::vector<int>{6, 7, 8, 9, 10}) );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("strided_span::iterator::operator->()", "[iterators]")
+{
+  auto particles = make_particles();
+  const auto sut = bpstd::strided_span<particle>{
+    bpstd::span<particle>{particles.data(), particles.size()},
+    2u
+  };
+
+  SECTION("Accesses members of the element")
+  {
+    REQUIRE( sut.begin()->tag == 'a' );
+    REQUIRE( (sut.begin() + 1)->tag == 'c' );
+  }
+}
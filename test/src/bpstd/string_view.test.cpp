@@ -528,6 +528,14 @@ TEST_CASE("string_view::find", "[operations]")
         REQUIRE( result == 6u );
       }
     }
+    SECTION("argument not in string after offset")
+    {
+      const auto result = sut.find("xy", 14);
+      SECTION("Returns npos")
+      {
+        REQUIRE( result == bpstd::string_view::npos );
+      }
+    }
     SECTION("Argument is string (identity)")
     {
       const auto result = sut.find(sut);
@@ -1498,3 +1506,65 @@ TEST_CASE("string_view::operator>=(...)","[comparison]")
     }
   }
 }
+
+//----------------------------------------------------------------------------
+// Hashing
+//----------------------------------------------------------------------------
+
+TEST_CASE("hash_string( basic_string_view )","[hashing]")
+{
+  using namespace bpstd::string_view_literals;
+
+  SECTION("Hash is a constant expression")
+  {
+    static_assert(bpstd::hash_string("GET"_sv) == "GET"_hash, "");
+    static_assert("GET"_hash != "PUT"_hash, "");
+  }
+
+  SECTION("Hash matches the FNV-1a reference values")
+  {
+    REQUIRE( ""_hash == 0xcbf29ce484222325ull );
+    REQUIRE( "a"_hash == 0xaf63dc4c8601ec8cull );
+    REQUIRE( "foobar"_hash == 0x85944171f73967e8ull );
+  }
+
+  SECTION("Runtime hash is the same as the literal hash")
+  {
+    const auto str = std::string{"DELETE"};
+    const auto view = bpstd::string_view{str};
+
+    auto matched = false;
+    switch (bpstd::hash_string(view)) {
+      case "GET"_hash:
+        break;
+      case "DELETE"_hash:
+        matched = true;
+        break;
+      default:
+        break;
+    }
+    REQUIRE( matched );
+  }
+
+  SECTION("Wide strings hash their code units")
+  {
+    REQUIRE( u"foobar"_hash == "foobar"_hash );
+    REQUIRE( U"foobar"_hash == "foobar"_hash );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Literals
+//----------------------------------------------------------------------------
+
+TEST_CASE("operator\"\"_sv( const char*, std::size_t )","[literals]")
+{
+  using namespace bpstd::string_view_literals;
+
+  constexpr auto view = "hello\0world"_sv;
+
+  SECTION("Includes embedded null characters")
+  {
+    REQUIRE( view.size() == 11u );
+  }
+}
@@ -0,0 +1,248 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+
+#include <bpstd/thread_pool.hpp>
+
+#include <catch2/catch.hpp>
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+// MSVC 2015 seems to emit an error that __forceinline'd functions may not be
+// __forceinline'd at the *end of the translation unit* using it, for some
+// stupid reason.
+#if defined(_MSC_VER)
+# pragma warning(disable:4714)
+#endif
+
+namespace {
+
+  struct adder
+  {
+    int base;
+
+    int add(int value) const { return base + value; }
+  };
+
+  // Computes fibonacci numbers by splitting every call into a subtask,
+  // waiting on the subtask by helping the pool
+  long fibonacci(bpstd::thread_pool& pool, int n)
+  {
+    if (n < 2) {
+      return n;
+    }
+
+    auto lhs = pool.submit(fibonacci, std::ref(pool), n - 1);
+    const auto rhs = fibonacci(pool, n - 2);
+
+    while (lhs.wait_for(std::chrono::seconds{0}) != std::future_status::ready) {
+      pool.run_pending_task();
+    }
+    return lhs.get() + rhs;
+  }
+
+} // anonymous namespace
+
+//=============================================================================
+// class : thread_pool
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors / Destructor
+//-----------------------------------------------------------------------------
+
+TEST_CASE("thread_pool::thread_pool( std::size_t )", "[ctor]")
+{
+  SECTION("Thread count is non-zero")
+  {
+    const bpstd::thread_pool sut{3u};
+
+    SECTION("Creates that many workers")
+    {
+      REQUIRE( sut.size() == 3u );
+    }
+  }
+
+  SECTION("Thread count is zero")
+  {
+    const bpstd::thread_pool sut{0u};
+
+    SECTION("Creates a single worker")
+    {
+      REQUIRE( sut.size() == 1u );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("thread_pool::~thread_pool()", "[dtor]")
+{
+  std::atomic<int> count{0};
+
+  {
+    bpstd::thread_pool sut{2u};
+    for (auto i = 0; i < 1000; ++i) {
+      sut.execute([&count]{ ++count; });
+    }
+  }
+
+  SECTION("Waits for every task to complete")
+  {
+    REQUIRE( count.load() == 1000 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Submission
+//-----------------------------------------------------------------------------
+
+TEST_CASE("thread_pool::submit( Fn&&, Args&&... )", "[submission]")
+{
+  bpstd::thread_pool sut{4u};
+
+  SECTION("Function returns a value")
+  {
+    auto result = sut.submit([](int a, int b) { return a * b; }, 6, 7);
+
+    SECTION("Future holds the result")
+    {
+      REQUIRE( result.get() == 42 );
+    }
+  }
+
+  SECTION("Function is a member function pointer")
+  {
+    auto result = sut.submit(&adder::add, adder{40}, 2);
+
+    SECTION("Invokes it as if by invoke")
+    {
+      REQUIRE( result.get() == 42 );
+    }
+  }
+
+  SECTION("Arguments are move-only")
+  {
+    auto value = std::unique_ptr<int>{new int{42}};
+    auto result = sut.submit([](std::unique_ptr<int> p) { return *p; }, std::move(value));
+
+    SECTION("Moves the arguments into the task")
+    {
+      REQUIRE( result.get() == 42 );
+    }
+  }
+
+  SECTION("Function throws")
+  {
+    auto result = sut.submit([]() -> int { throw std::runtime_error{"error"}; });
+
+    SECTION("Future holds the exception")
+    {
+      REQUIRE_THROWS_AS( result.get(), std::runtime_error );
+    }
+  }
+
+  SECTION("Tasks submit subtasks")
+  {
+    SECTION("Subtasks run on the submitting worker, or are stolen")
+    {
+      auto result = sut.submit(fibonacci, std::ref(sut), 18);
+
+      REQUIRE( result.get() == 2584 );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("thread_pool::execute( Fn&&, Args&&... )", "[submission]")
+{
+  std::atomic<std::size_t> count{0u};
+  auto done = std::promise<void>{};
+  bpstd::thread_pool sut{4u};
+
+  const auto total = std::size_t{10000u};
+  for (auto i = std::size_t{0u}; i < total; ++i) {
+    sut.execute([&]{
+      if (++count == total) {
+        done.set_value();
+      }
+    });
+  }
+  done.get_future().wait();
+
+  SECTION("Runs every task exactly once")
+  {
+    REQUIRE( count.load() == total );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Execution
+//-----------------------------------------------------------------------------
+
+TEST_CASE("thread_pool::run_pending_task()", "[execution]")
+{
+  // Declared before the pool, so that they outlive its workers
+  auto release = std::promise<void>{};
+  auto started = std::promise<void>{};
+
+  bpstd::thread_pool sut{1u};
+
+  SECTION("No tasks are pending")
+  {
+    SECTION("Returns false")
+    {
+      REQUIRE_FALSE( sut.run_pending_task() );
+    }
+  }
+
+  SECTION("The only worker is busy")
+  {
+    auto released = release.get_future().share();
+
+    sut.execute([&started, released]{
+      started.set_value();
+      released.wait();
+    });
+    started.get_future().wait();
+
+    auto result = sut.submit([]{ return 42; });
+
+    const auto ran = sut.run_pending_task();
+    const auto status = result.wait_for(std::chrono::seconds{0});
+    release.set_value();
+
+    SECTION("Runs the pending task on the calling thread")
+    {
+      REQUIRE( ran );
+      REQUIRE( status == std::future_status::ready );
+      REQUIRE( result.get() == 42 );
+    }
+  }
+}
@@ -119,6 +119,15 @@ TEST_CASE("apply(...)", "[functional]")
 
       auto result = bpstd::apply(sut, std::make_tuple(42));
 
+      REQUIRE(result);
+    }
+    SECTION("Tuple is a const lvalue")
+    {
+      auto sut = ::const_functor{42};
+      const auto tuple = std::make_tuple(42);
+
+      auto result = bpstd::apply(sut, tuple);
+
       REQUIRE(result);
     }
   }
@@ -347,6 +356,19 @@ TEST_CASE("get<T>(tuple&)", "[utility]")
       REQUIRE(&lhs == &rhs);
     }
   }
+
+  SECTION("Types differ only in cv-qualification")
+  {
+    auto cv_sut = std::tuple<int,const int,volatile int>{1,2,3};
+
+    SECTION("Gets reference to the element of the exact type")
+    {
+      auto& lhs = bpstd::get<1>(cv_sut);
+      auto& rhs = bpstd::get<const int>(cv_sut);
+
+      REQUIRE(&lhs == &rhs);
+    }
+  }
 }
 
 TEST_CASE("get<T>(tuple&&)", "[utility]")
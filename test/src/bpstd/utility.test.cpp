@@ -25,6 +25,8 @@
 #include <bpstd/utility.hpp>
 
 #include <catch2/catch.hpp>
+#include <cstddef>
+#include <type_traits>
 
 // MSVC 2015 seems to emit an error that __forceinline'd functions may not be
 // __forceinline'd at the *end of the translation unit* using it, for some
@@ -33,6 +35,20 @@
 # pragma warning(disable:4714)
 #endif
 
+namespace {
+
+  // Sums the elements of a sequence, to check sequences too long to spell out
+  template <typename T>
+  constexpr T sum() { return T(0); }
+
+  template <typename T, typename...Ts>
+  constexpr T sum(T first, Ts...rest) { return first + sum<T>(rest...); }
+
+  template <typename T, T...Ints>
+  constexpr T sum_of(bpstd::integer_sequence<T, Ints...>) { return sum<T>(Ints...); }
+
+} // anonymous namespace
+
 TEST_CASE("get<T>(pair&)", "[utility]")
 {
   auto sut = bpstd::pair<int,float>{1,3.14f};
@@ -140,3 +156,74 @@ TEST_CASE("get<T>(const pair&&)", "[utility]")
     }
   }
 }
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("make_integer_sequence<T, N>", "[utility]")
+{
+  SECTION("N is 0")
+  {
+    using sut_type = bpstd::make_integer_sequence<int, 0>;
+
+    SECTION("Creates an empty sequence")
+    {
+      REQUIRE( std::is_same<sut_type, bpstd::integer_sequence<int>>::value );
+    }
+  }
+
+  SECTION("N is 1")
+  {
+    using sut_type = bpstd::make_integer_sequence<int, 1>;
+
+    SECTION("Creates a sequence containing 0")
+    {
+      REQUIRE( std::is_same<sut_type, bpstd::integer_sequence<int, 0>>::value );
+    }
+  }
+
+  SECTION("N is odd")
+  {
+    using sut_type = bpstd::make_integer_sequence<unsigned char, 7>;
+    using expected_type = bpstd::integer_sequence<unsigned char, 0, 1, 2, 3, 4, 5, 6>;
+
+    SECTION("Creates a sequence from 0 to N-1")
+    {
+      REQUIRE( std::is_same<sut_type, expected_type>::value );
+    }
+  }
+
+  SECTION("N is even")
+  {
+    using sut_type = bpstd::make_integer_sequence<long, 8>;
+    using expected_type = bpstd::integer_sequence<long, 0, 1, 2, 3, 4, 5, 6, 7>;
+
+    SECTION("Creates a sequence from 0 to N-1")
+    {
+      REQUIRE( std::is_same<sut_type, expected_type>::value );
+    }
+  }
+
+  SECTION("N is large")
+  {
+    using sut_type = bpstd::make_index_sequence<1000>;
+
+    SECTION("Creates a sequence from 0 to N-1")
+    {
+      REQUIRE( sut_type::size() == 1000u );
+      REQUIRE( sum_of(sut_type{}) == 499500u );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("index_sequence_for<Ts...>", "[utility]")
+{
+  using sut_type = bpstd::index_sequence_for<int, float, char>;
+  using expected_type = bpstd::index_sequence<0u, 1u, 2u>;
+
+  SECTION("Creates a sequence of each index")
+  {
+    REQUIRE( std::is_same<sut_type, expected_type>::value );
+  }
+}
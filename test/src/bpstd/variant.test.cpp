@@ -1262,6 +1262,21 @@ TEST_CASE("holds_alternative(variant)", "[utilities]")
   {
     REQUIRE_FALSE(bpstd::holds_alternative<int>(sut));
   }
+  SECTION("Active element is the last of many alternatives")
+  {
+    using wide_variant_type = bpstd::variant<int, bool, char, short, long, float, double>;
+
+    auto wide_sut = wide_variant_type{2.0};
+
+    SECTION("Returns true for active element")
+    {
+      REQUIRE(bpstd::holds_alternative<double>(wide_sut));
+    }
+    SECTION("Returns false for inactive element")
+    {
+      REQUIRE_FALSE(bpstd::holds_alternative<float>(wide_sut));
+    }
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -1455,6 +1470,27 @@ TEST_CASE("get<I>(variant&)", "[utilities]")
   {
     REQUIRE_THROWS_AS(bpstd::get<0>(sut), bpstd::bad_variant_access);
   }
+  SECTION("Active element is in the second half of many alternatives")
+  {
+    using wide_variant_type = bpstd::variant<int, char, long, std::string, short, double, float>;
+
+    auto wide_sut = wide_variant_type{bpstd::in_place_index_t<5>{}, 4.0};
+
+    SECTION("Returns underlying value for active element")
+    {
+      REQUIRE(bpstd::get<5>(wide_sut) == 4.0);
+    }
+    SECTION("Returns updated value after assigning a different alternative")
+    {
+      wide_sut = std::string{expected};
+
+      REQUIRE(bpstd::get<3>(wide_sut) == expected);
+    }
+    SECTION("Throws exception for inactive element")
+    {
+      REQUIRE_THROWS_AS(bpstd::get<6>(wide_sut), bpstd::bad_variant_access);
+    }
+  }
 }
 
 TEST_CASE("get<I>(const variant&)", "[utilities]")
@@ -0,0 +1,290 @@
+#!/usr/bin/env python3
+"""
+Script for measuring the compile-time cost of Backport's headers
+
+Every header is compiled on its own to measure the cost of including it.
+Variants, tuples, index sequences, and pack indexing are then instantiated
+with an increasing number of types, to measure how the cost of the template
+machinery behind them grows.
+
+Each case is compiled several times; the fastest wall-clock time is kept,
+along with the peak memory used by the compiler (where the platform can
+report it). Results are printed as a table, and optionally written as JSON.
+"""
+
+import argparse
+import json
+import os
+import platform
+import subprocess
+import sys
+import tempfile
+import time
+
+
+def root_path():
+  path = os.path.realpath(__file__) # ./tools/compile-benchmark.py
+  path = os.path.dirname(path)      # ./tools/
+  path = os.path.dirname(path)      # ./
+
+  return path
+
+#------------------------------------------------------------------------------
+# Cases
+#------------------------------------------------------------------------------
+
+def alternatives(arity):
+  return ", ".join("alt<{}>".format(i) for i in range(arity))
+
+
+PRELUDE = """
+#include <cstddef>
+
+template <std::size_t I>
+struct alt { int value; };
+"""
+
+
+def header_source(header):
+  return "#include <bpstd/{}>\n".format(header)
+
+
+def variant_source(arity):
+  return PRELUDE + """
+#include <bpstd/variant.hpp>
+
+struct visitor
+{{
+  template <std::size_t I>
+  int operator()(const alt<I>& a) const {{ return a.value + static_cast<int>(I); }}
+}};
+
+using variant_type = bpstd::variant<{types}>;
+
+int use(const variant_type& v)
+{{
+  auto copy = v;
+  copy = alt<{last}>{{1}};
+  return bpstd::visit(visitor{{}}, copy) + static_cast<int>(copy.index());
+}}
+""".format(types=alternatives(arity), last=arity - 1)
+
+
+def tuple_source(arity):
+  return PRELUDE + """
+#include <bpstd/tuple.hpp>
+
+struct visitor
+{{
+  template <typename...Ts>
+  int operator()(const Ts&...) const {{ return static_cast<int>(sizeof...(Ts)); }}
+}};
+
+using tuple_type = bpstd::tuple<{types}>;
+
+int use(const tuple_type& t)
+{{
+  return bpstd::apply(visitor{{}}, t) + bpstd::get<{last}>(t).value;
+}}
+""".format(types=alternatives(arity), last=arity - 1)
+
+
+def integer_sequence_source(arity):
+  # A single sequence is too cheap to measure, so a sequence of every length
+  # up to 'arity' is made
+  return """
+#include <bpstd/utility.hpp>
+
+#include <cstddef>
+
+template <typename...Ts>
+struct list {{}};
+
+template <std::size_t...Ns>
+list<bpstd::make_index_sequence<Ns>...> make_all(bpstd::index_sequence<Ns...>);
+
+using all = decltype(make_all(bpstd::make_index_sequence<{arity}>{{}}));
+
+static_assert(bpstd::make_index_sequence<{last}>::size() == {last}, "");
+""".format(arity=arity, last=arity - 1)
+
+
+def nth_type_source(arity):
+  # Indexes every element of the pack, which is quadratic for a recursive
+  # implementation
+  return PRELUDE + """
+#include <bpstd/utility.hpp>
+#include <bpstd/detail/nth_type.hpp>
+
+template <typename...Ts>
+struct list {{}};
+
+template <typename...Ts>
+struct pack
+{{
+  template <std::size_t...Is>
+  static list<bpstd::detail::nth_type_t<Is, Ts...>...> index_all(bpstd::index_sequence<Is...>);
+}};
+
+using types = pack<{types}>;
+using all = decltype(types::index_all(bpstd::make_index_sequence<{arity}>{{}}));
+
+static_assert(sizeof(bpstd::detail::nth_type_t<{last}, {types}>) == sizeof(int), "");
+""".format(types=alternatives(arity), arity=arity, last=arity - 1)
+
+
+SCALING_CASES = [
+  ("variant", "variant.hpp", variant_source),
+  ("tuple", "tuple.hpp", tuple_source),
+  ("integer_sequence", "utility.hpp", integer_sequence_source),
+  ("nth_type", "detail/nth_type.hpp", nth_type_source),
+]
+
+#------------------------------------------------------------------------------
+# Measurement
+#------------------------------------------------------------------------------
+
+def compile_once(command):
+  """
+  Runs 'command', returning the wall-clock seconds and the peak resident
+  memory in KiB (or None, if unavailable) -- or None if compilation failed
+  """
+  start = time.perf_counter()
+  process = subprocess.Popen(command,
+                             stdout=subprocess.DEVNULL,
+                             stderr=subprocess.PIPE)
+
+  if hasattr(os, "wait4"):
+    _, status, usage = os.wait4(process.pid, 0)
+    seconds = time.perf_counter() - start
+    errors = process.stderr.read()
+    process.stderr.close()
+    # 'ru_maxrss' is in bytes on macOS, and KiB elsewhere
+    max_rss = usage.ru_maxrss
+    if sys.platform == "darwin":
+      max_rss //= 1024
+    failed = not (os.WIFEXITED(status) and os.WEXITSTATUS(status) == 0)
+  else:
+    _, errors = process.communicate()
+    seconds = time.perf_counter() - start
+    max_rss = None
+    failed = process.returncode != 0
+
+  if failed:
+    sys.stderr.write(errors.decode(errors="replace"))
+    return None
+
+  return seconds, max_rss
+
+
+def measure(args, name, header, arity, source):
+  with tempfile.TemporaryDirectory() as directory:
+    source_path = os.path.join(directory, "case.cpp")
+    with open(source_path, "w") as f:
+      f.write(source)
+
+    command = [args.compiler,
+               "-std={}".format(args.std),
+               "-I{}".format(args.include_dir),
+               "-c", source_path,
+               "-o", os.path.join(directory, "case.o")]
+    command += args.flag
+
+    best_seconds = None
+    best_rss = None
+    for _ in range(args.repetitions):
+      result = compile_once(command)
+      if result is None:
+        return {"name": name, "header": header, "arity": arity, "error": True}
+
+      seconds, max_rss = result
+      if best_seconds is None or seconds < best_seconds:
+        best_seconds = seconds
+      if max_rss is not None and (best_rss is None or max_rss < best_rss):
+        best_rss = max_rss
+
+  return {"name": name,
+          "header": header,
+          "arity": arity,
+          "seconds": best_seconds,
+          "max_rss_kib": best_rss}
+
+
+def print_result(result):
+  if result.get("error"):
+    print("{:<32} {:>12}".format(result["name"], "error"))
+    return
+
+  rss = result["max_rss_kib"]
+  print("{:<32} {:>10.3f} s {:>10} KiB".format(
+    result["name"],
+    result["seconds"],
+    "-" if rss is None else rss
+  ))
+
+
+#------------------------------------------------------------------------------
+# Entry
+#------------------------------------------------------------------------------
+
+if __name__ == "__main__":
+
+  parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+  parser.add_argument("--compiler", default=os.environ.get("CXX", "c++"),
+                      help="the compiler to measure (default: $CXX, or c++)")
+  parser.add_argument("--std", default="c++11",
+                      help="the language standard to compile with (default: c++11)")
+  parser.add_argument("--include-dir", default=os.path.join(root_path(), "include"),
+                      help="the directory containing 'bpstd'")
+  parser.add_argument("--arity", type=int, action="append",
+                      help="an arity to instantiate templates with; may be repeated "
+                           "(default: 8, 16, 32, 64, 128, 256)")
+  parser.add_argument("--repetitions", type=int, default=3,
+                      help="the number of times to compile each case (default: 3)")
+  parser.add_argument("--flag", action="append", default=[],
+                      help="an additional flag to pass to the compiler; may be repeated")
+  parser.add_argument("--filter", default="",
+                      help="only run cases whose name contains this string")
+  parser.add_argument("--output",
+                      help="a file to write the results to, as JSON")
+  args = parser.parse_args()
+
+  arities = args.arity or [8, 16, 32, 64, 128, 256]
+
+  cases = []
+  headers_path = os.path.join(args.include_dir, "bpstd")
+  for header in sorted(os.listdir(headers_path)):
+    if header.endswith(".hpp"):
+      cases.append(("header/{}".format(header), header, 0, header_source(header)))
+
+  for name, header, source in SCALING_CASES:
+    for arity in arities:
+      cases.append(("{}/{}".format(name, arity), header, arity, source(arity)))
+
+  results = []
+  for name, header, arity, source in cases:
+    if args.filter not in name:
+      continue
+    result = measure(args, name, header, arity, source)
+    print_result(result)
+    results.append(result)
+
+  if args.output:
+    version = subprocess.run([args.compiler, "--version"],
+                             stdout=subprocess.PIPE,
+                             stderr=subprocess.DEVNULL,
+                             universal_newlines=True).stdout.splitlines()
+    context = {
+      "date": time.strftime("%Y-%m-%dT%H:%M:%S%z"),
+      "host": platform.node(),
+      "compiler": args.compiler,
+      "compiler_version": version[0] if version else "",
+      "std": args.std,
+      "flags": args.flag,
+      "repetitions": args.repetitions,
+    }
+    with open(args.output, "w") as f:
+      json.dump({"context": context, "benchmarks": results}, f, indent=2)
+
+  if any(result.get("error") for result in results):
+    sys.exit(1)